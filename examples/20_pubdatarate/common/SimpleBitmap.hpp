@@ -15,6 +15,7 @@
 #include "areg/base/SynchObjects.hpp"
 #include "common/NELargeData.hpp"
 
+#include <cstddef>
 #include <string>
 
 /**
@@ -214,6 +215,15 @@ public:
      */
     inline bool setBlock( const NELargeData::ImageBlock& block );
 
+    /**
+     * \brief   Sets the image block in the bitmap from the serialized data of the image block,
+     *          for example, from the view of the received data. The data may be not aligned.
+     * \param   data    The serialized image block, which starts with the size of the block.
+     * \param   size    The size in bytes of the data.
+     * \return  Returns true if operation succeeded.
+     */
+    inline bool setBlock( const uint8_t * data, uint32_t size );
+
     /**
      * \brief   Returns the block of image starting at the begin of specified row (Y-Coordinate)
      *          and number of lines..
@@ -428,21 +438,34 @@ inline bool SimpleBitmap::setBlock( const NELargeData::ImageBlock & block )
     if (block.isEmpty())
         return false;
 
-    const NELargeData::sImageBlock* imgBlock = block.getBlock();
+    return setBlock(reinterpret_cast<const uint8_t *>(block.getBlock()), block.getSize());
+}
+
+inline bool SimpleBitmap::setBlock( const uint8_t * data, uint32_t size )
+{
+    constexpr uint32_t sizeHeader{ static_cast<uint32_t>(offsetof(NELargeData::sImageBlock, imageData.imgRGB)) };
+    if ((data == nullptr) || (size < sizeHeader))
+        return false;
+
+    // copy only the header, the data of the view may be not aligned.
+    NELargeData::sImageBlock imgBlock;
+    ::memcpy( &imgBlock, data, sizeHeader );
+    if (sizeHeader + imgBlock.imageData.imgRBGLen > size)
+        return false;
 
-    if ((mChannelId != -1) && (mChannelId != static_cast<int32_t>(imgBlock->channelId)))
+    if ((mChannelId != -1) && (mChannelId != static_cast<int32_t>(imgBlock.channelId)))
         return false; // wrong source
 
-    if ( (getWidth( ) != imgBlock->frameWidth) || (getHeight( ) != imgBlock->frameHeight) )
+    if ( (getWidth( ) != imgBlock.frameWidth) || (getHeight( ) != imgBlock.frameHeight) )
     {
         _release( );
-        _allocateBitmap( imgBlock->frameWidth, imgBlock->frameHeight );
+        _allocateBitmap( imgBlock.frameWidth, imgBlock.frameHeight );
     }
 
-    uint8_t * pixels = getPixels( imgBlock->imageData.imgStartPos.coordX, imgBlock->imageData.imgStartPos.coordY );
-    ::memcpy( pixels, reinterpret_cast<const uint8_t *>(imgBlock->imageData.imgRGB), imgBlock->imageData.imgRBGLen );
-    mChannelId  = static_cast<int32_t>(imgBlock->channelId);
-    mFrameId    = imgBlock->frameSeqId;
+    uint8_t * pixels = getPixels( imgBlock.imageData.imgStartPos.coordX, imgBlock.imageData.imgStartPos.coordY );
+    ::memcpy( pixels, data + sizeHeader, imgBlock.imageData.imgRBGLen );
+    mChannelId  = static_cast<int32_t>(imgBlock.channelId);
+    mFrameId    = imgBlock.frameSeqId;
 
     return true;
 }
@@ -58,6 +58,20 @@ void ServiceClient::startupComponent(ComponentThread& /* comThread */)
 void ServiceClient::broadcastImageBlockAcquired(const NELargeData::ImageBlock& imageBlock)
 {
     TRACE_SCOPE(examples_20_clientdatarate_ServiceClient_broadcastImageBlockAcquired);
+
+    // the proxy does not copy the image block, the data is read from the view of the received message.
+    const BufferView & view = getProxy()->getResponseView();
+    if (view.isEmpty() == false)
+    {
+        if (mBitmap.setBlock(view.getData(), view.getSize()))
+        {
+            mDataSize   += view.getSize();
+            mBlockCount += 1;
+        }
+
+        return;
+    }
+
     const NELargeData::sImageBlock* block = imageBlock.getBlock();
     if ((block != nullptr) && mBitmap.allocateBitmap(block->frameWidth, block->frameHeight))
     {
@@ -89,6 +103,11 @@ bool ServiceClient::serviceConnected( NEService::eServiceConnection status, Prox
     TRACE_SCOPE(examples_20_clientdatarate_ServiceClient_serviceConnected);
     bool result = LargeDataClientBase::serviceConnected(status, proxy);
 
+    // receive the image blocks as the view of the data, without copying them in the proxy.
+    proxy.setResponseView( static_cast<unsigned int>(NELargeData::eMessageIDs::MsgId_broadcastImageBlockAcquired)
+                         , static_cast<IENotificationEventConsumer &>(static_cast<LargeDataClientBase &>(*this))
+                         , isConnected());
+
     // dynamic subscribe on messages.
     notifyOnBroadcastServiceStopping(isConnected());
     notifyOnBroadcastImageBlockAcquired(isConnected());
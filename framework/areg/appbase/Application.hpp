@@ -25,7 +25,9 @@
 #include "areg/base/Containers.hpp"
 #include "areg/base/NEMemory.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/NERegistry.hpp"
+#include "areg/ipc/SendWindow.hpp"
 #include "areg/persist/ConfigManager.hpp"
 
  /************************************************************************
@@ -342,6 +344,36 @@ public:
      **/
     static void queryCommunicationData( unsigned int & OUT sizeSend, unsigned int & OUT sizeReceive );
 
+    /**
+     * \brief   Returns the number and the size of messages queued to send to the router,
+     *          the peak values and the number of sent and rejected messages.
+     *          Call periodically to monitor the queue depth of the connection.
+     **/
+    static SendWindow::sWindowStatistics querySendQueue( void );
+
+    /**
+     * \brief   Sets the send window of the connection to the router. When the window
+     *          is exhausted, the remote requests are replied with NEService::eResultType::RequestBusy
+     *          instead of growing the queue. By default, the window is set in the configuration file.
+     * \param   maxMessages The maximum number of queued messages. The value 0 means no limit.
+     * \param   maxBytes    The maximum size in bytes of queued messages. The value 0 means no limit.
+     **/
+    static void setSendWindow( uint32_t maxMessages, uint32_t maxBytes );
+
+    /**
+     * \brief   Returns the statistics of the dispatcher threads of the process: the number
+     *          of queued events, the dispatched, dropped and cancelled events, the percentiles
+     *          of the waiting and processing time in nanoseconds, also per event class and message.
+     * \param   out_list    On output contains the statistics of every dispatcher thread.
+     **/
+    static void queryDispatcherStatistics( DispatcherStatistics::ListStatistics & OUT out_list );
+
+    /**
+     * \brief   Sets the period to output the statistics of the dispatcher threads in the logs.
+     * \param   periodMs    The period in milliseconds. The value 0 stops logging statistics.
+     **/
+    static void setStatisticsLogPeriod( uint32_t periodMs );
+
     /**
      * \brief   Returns the name of the executable process.
      **/
@@ -136,6 +136,32 @@ namespace NEApplication
      **/
     constexpr  bool              DEFAULT_SERVICE_ENABLED    { true };
 
+    /**
+     * \brief   NEApplication::SERVICE_WINDOW_MESSAGES
+     *          The position of the property of the maximum number of messages
+     *          queued to send to the remote service.
+     **/
+    constexpr std::string_view  SERVICE_WINDOW_MESSAGES     { "messages" };
+
+    /**
+     * \brief   NEApplication::SERVICE_WINDOW_BYTES
+     *          The position of the property of the maximum size in bytes of messages
+     *          queued to send to the remote service.
+     **/
+    constexpr std::string_view  SERVICE_WINDOW_BYTES        { "bytes" };
+
+    /**
+     * \brief   NEApplication::DEFAULT_WINDOW_MESSAGES
+     *          The default maximum number of messages queued to send to the remote service.
+     **/
+    constexpr uint32_t          DEFAULT_WINDOW_MESSAGES     { 8 * 1024 };
+
+    /**
+     * \brief   NEApplication::DEFAULT_WINDOW_BYTES
+     *          The default maximum size in bytes of messages queued to send to the remote service.
+     **/
+    constexpr uint32_t          DEFAULT_WINDOW_BYTES        { 16 * 1024 * 1024 };
+
     /**
      * \brief   NEApplication::DEFAULT_LOG_ENABLED
      *          Default flag to indicate logging enable / disable status.
@@ -266,6 +292,8 @@ namespace NEApplication
             , { {"router"   , "*"   , "enable"  , "tcpip"   }, "true"                           }   //!< The TCP/IP connection enable / disable flag of the 'router' service.
             , { {"router"   , "*"   , "address" , "tcpip"   }, DEFAULT_ROUTER_HOST              }   //!< The TCP/IP connection address of the 'router' service.
             , { {"router"   , "*"   , "port"    , "tcpip"   }, "8181"                           }   //!< The TCP/IP connection port number of the 'router' service.
+            , { {"router"   , "*"   , "window"  , "messages"}, "8192"                           }   //!< The maximum number of messages queued to send to the 'router' service.
+            , { {"router"   , "*"   , "window"  , "bytes"   }, "16777216"                       }   //!< The maximum size in bytes of messages queued to send to the 'router' service.
 
             , { {"logger"   , "*"   , "service" , ""        }, "logger"                         }   //!< The process name of the 'logger' service.
             , { {"logger"   , "*"   , "connect" , ""        }, "tcpip"                          }   //!< The list of connection type of the 'logger' service.
@@ -312,6 +340,12 @@ namespace NEApplication
      **/
     extern AREG_API const std::vector<Identifier> LogScopePriorityIndentifiers;
 
+    /**
+     * \brief   NEApplication::ThreadPolicyIdentifiers
+     *          The list of thread scheduling policy identifiers to convert to string or Thread::eSchedulingPolicy types
+     **/
+    extern AREG_API const std::vector<Identifier> ThreadPolicyIdentifiers;
+
     /**
      * \brief   NEApplication::eApplicationState
      *          Describes the application states.
@@ -22,6 +22,7 @@
 #include "areg/base/Process.hpp"
 
 #include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
 #include "areg/component/NERegistry.hpp"
 #include "areg/component/private/ServiceManager.hpp"
 #include "areg/component/private/TimerManager.hpp"
@@ -108,6 +109,7 @@ void Application::releaseApplication(void)
     WatchdogManager::waitWatchdogManager();
     TimerManager::waitTimerManager();
     ComponentLoader::waitModelUnload(String::EmptyString);
+    ComponentThread::stopDispatcherPool();
     ServiceManager::_waitServiceManager();
     NETrace::waitLoggingEnd();
 
@@ -344,6 +346,26 @@ void Application::queryCommunicationData( unsigned int & OUT sizeSend, unsigned
     ServiceManager::queryCommunicationData( sizeSend, sizeReceive );
 }
 
+SendWindow::sWindowStatistics Application::querySendQueue( void )
+{
+    return ServiceManager::querySendQueue( );
+}
+
+void Application::setSendWindow( uint32_t maxMessages, uint32_t maxBytes )
+{
+    ServiceManager::setSendWindow( maxMessages, maxBytes );
+}
+
+void Application::queryDispatcherStatistics( DispatcherStatistics::ListStatistics & OUT out_list )
+{
+    DispatcherStatistics::collectStatistics( out_list );
+}
+
+void Application::setStatisticsLogPeriod( uint32_t periodMs )
+{
+    ServiceManager::setStatisticsLogPeriod( periodMs );
+}
+
 const String & Application::getApplicationName(void)
 {
     return Process::getInstance().getAppName();
@@ -369,6 +391,12 @@ bool Application::loadConfiguration(const char* fileName /*= nullptr*/, IEConfig
         Application::setupDefaultConfiguration(listener);
     }
 
+    // the configured placement is applied when the threads with the names start.
+    for (const auto & threadName : theApp.mConfigManager.getPlacedThreads())
+    {
+        Thread::configurePlacement(threadName, theApp.mConfigManager.getThreadPlacement(threadName));
+    }
+
     return result;
 }
 
@@ -16,6 +16,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/appbase/NEApplication.hpp"
+#include "areg/base/Thread.hpp"
 
 //! Logging type identifiers
 AREG_API_IMPL const std::vector<Identifier>     NEApplication::LogTypeIdentifiers =
@@ -58,6 +59,16 @@ AREG_API_IMPL const std::vector<Identifier>   NEApplication::LogScopePriorityInd
     , { static_cast<unsigned int>(NETrace::eLogPriority::PrioDebug)                     , NETrace::PRIO_DEBUG_STR                           }
 };
 
+//! Thread scheduling policy identifiers
+AREG_API_IMPL const std::vector<Identifier>   NEApplication::ThreadPolicyIdentifiers
+{
+      { static_cast<unsigned int>(Thread::eSchedulingPolicy::PolicyNormal)              , "normal"                                          }
+    , { static_cast<unsigned int>(Thread::eSchedulingPolicy::PolicyBatch)               , "batch"                                           }
+    , { static_cast<unsigned int>(Thread::eSchedulingPolicy::PolicyIdle)                , "idle"                                            }
+    , { static_cast<unsigned int>(Thread::eSchedulingPolicy::PolicyFifo)                , "fifo"                                            }
+    , { static_cast<unsigned int>(Thread::eSchedulingPolicy::PolicyRoundRobin)          , "rr"                                              }
+};
+
  //! AREG TCP/IP Multicast Router Service name
 AREG_API_IMPL char NEApplication::ROUTER_SERVICE_NAME_ASCII[]           { 'm', 'c', 'r', 'o', 'u', 't', 'e', 'r', '.', 's', 'e', 'r', 'v', 'i', 'c', 'e', '\0' };
 
@@ -0,0 +1,236 @@
+#ifndef AREG_BASE_BUFFERPOOL_HPP
+#define AREG_BASE_BUFFERPOOL_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/BufferPool.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Size-classed pool of memory blocks
+ *              used to allocate byte buffers of remote messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The thread-safe pool of memory blocks grouped by size classes.
+ *          The size of blocks in each class is the power of 2, starting
+ *          from MIN_BLOCK_SIZE up to MAX_BLOCK_SIZE. The requested size
+ *          is rounded to the size of class, and the block is taken from
+ *          the list of free blocks of the class, if any. Released blocks
+ *          return to the list of free blocks, unless the list reached the
+ *          maximum number of cached blocks. Bigger blocks are not pooled.
+ *          The free blocks are linked in place, i.e. the pool does not
+ *          allocate memory for bookkeeping.
+ *          The pool is used to allocate the buffers of remote messages,
+ *          which are received and sent at high rates. The buffer returns
+ *          to the pool when the last shared buffer object releases it.
+ **/
+class AREG_API BufferPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   BufferPool::MIN_BLOCK_SIZE
+     *          The size in bytes of blocks of the smallest class.
+     **/
+    static constexpr uint32_t   MIN_BLOCK_SIZE      { 128 };
+
+    /**
+     * \brief   BufferPool::MAX_BLOCK_SIZE
+     *          The size in bytes of blocks of the biggest class.
+     **/
+    static constexpr uint32_t   MAX_BLOCK_SIZE      { 64 * 1024 };
+
+    /**
+     * \brief   BufferPool::SIZE_CLASSES
+     *          The number of size classes.
+     **/
+    static constexpr uint32_t   SIZE_CLASSES        { 10 };
+
+    /**
+     * \brief   BufferPool::DEFAULT_MAX_CACHED
+     *          The default maximum number of free blocks cached per size class.
+     **/
+    static constexpr uint32_t   DEFAULT_MAX_CACHED  { 64 };
+
+    /**
+     * \brief   BufferPool::INVALID_CLASS
+     *          The size class of blocks, which are not pooled.
+     **/
+    static constexpr uint32_t   INVALID_CLASS       { static_cast<uint32_t>(~0) };
+
+    /**
+     * \brief   BufferPool::sPoolStatistics
+     *          The statistics of a size class, used to tune the pool.
+     **/
+    struct sPoolStatistics
+    {
+        uint32_t    psBlockSize;    //!< The size in bytes of blocks in the class.
+        uint32_t    psCached;       //!< The number of free blocks currently cached.
+        uint64_t    psAllocated;    //!< The number of allocated blocks, including reused.
+        uint64_t    psReused;       //!< The number of blocks taken from the cache.
+        uint64_t    psReleased;     //!< The number of blocks returned to the cache.
+        uint64_t    psDropped;      //!< The number of blocks deleted, because the cache was full.
+    };
+
+    //!< The list of statistics of size classes. The last entry is the statistics of blocks, which are not pooled.
+    using PoolStatistics    = TEArrayList<sPoolStatistics>;
+
+    /**
+     * \brief   BufferPool::BlockDeleter
+     *          The deleter of shared pointers, which returns the block to the pool.
+     **/
+    struct AREG_API BlockDeleter
+    {
+        /**
+         * \brief   Returns the block to the pool.
+         **/
+        void operator ( ) ( void * buffer ) const;
+
+        //!< The size class of the block.
+        uint32_t    bdSizeClass;
+    };
+
+private:
+    /**
+     * \brief   BufferPool::sSizeClass
+     *          The list of free blocks of a size class and the statistics.
+     **/
+    struct sSizeClass
+    {
+        SpinLock        scLock;     //!< The lock to access the list of free blocks.
+        unsigned char * scFree;     //!< The first free block, each free block points to the next.
+        sPoolStatistics scStats;    //!< The statistics of the class.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the instance of the buffer pool. The instance is created
+     *          on the first call and is never destroyed, so that the buffers
+     *          released during the static destruction can return to the pool.
+     **/
+    static BufferPool & getInstance( void );
+
+    /**
+     * \brief   Returns the size class of the block to allocate the given size.
+     *          Returns INVALID_CLASS if the size is bigger than MAX_BLOCK_SIZE.
+     **/
+    static uint32_t getSizeClass( uint32_t size );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory block of at least the given size.
+     * \param   size        The size in bytes of the block to allocate.
+     * \param   sizeClass   On output, contains the size class of the block,
+     *                      which should be passed when the block is released.
+     * \return  Returns the pointer to the block.
+     **/
+    unsigned char * allocateBlock( uint32_t size, uint32_t & OUT sizeClass );
+
+    /**
+     * \brief   Releases the memory block. If the cache of the size class
+     *          is not full, the block is kept for reuse, otherwise it is deleted.
+     * \param   block       The block to release.
+     * \param   sizeClass   The size class of the block, returned by allocateBlock().
+     **/
+    void releaseBlock( unsigned char * block, uint32_t sizeClass );
+
+    /**
+     * \brief   Sets the maximum number of free blocks to cache per size class.
+     *          If zero, the blocks are not cached. The extra cached blocks are deleted.
+     **/
+    void setMaxCachedBlocks( uint32_t maxCached );
+
+    /**
+     * \brief   Returns the maximum number of free blocks to cache per size class.
+     **/
+    inline uint32_t getMaxCachedBlocks( void ) const;
+
+    /**
+     * \brief   Returns the statistics of the size classes. The last entry
+     *          contains the statistics of the blocks, which are not pooled.
+     **/
+    PoolStatistics getStatistics( void ) const;
+
+    /**
+     * \brief   Resets the counters of the statistics. The cached blocks remain.
+     **/
+    void resetStatistics( void );
+
+    /**
+     * \brief   Deletes all cached free blocks.
+     **/
+    void clearPool( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    BufferPool( void );
+    ~BufferPool( void );
+
+    /**
+     * \brief   Deletes the cached free blocks of the class, which exceed the given number.
+     **/
+    void _trimClass( sSizeClass & entry, uint32_t maxCached );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The size classes.
+    sSizeClass              mClasses[SIZE_CLASSES];
+
+    //!< The statistics of blocks, which are not pooled.
+    sSizeClass              mOversize;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The maximum number of free blocks cached per size class.
+    std::atomic<uint32_t>   mMaxCached;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( BufferPool );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline uint32_t BufferPool::getMaxCachedBlocks( void ) const
+{
+    return mMaxCached.load(std::memory_order_relaxed);
+}
+
+#endif  // AREG_BASE_BUFFERPOOL_HPP
@@ -0,0 +1,194 @@
+#ifndef AREG_BASE_BUFFERVIEW_HPP
+#define AREG_BASE_BUFFERVIEW_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/BufferView.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Buffer View class.
+ *              The read-only view of the part of the shared buffer.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SharedBuffer.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// BufferView class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The read-only view of the data in the shared buffer. The view
+ *          does not copy the data, it keeps the reference of the shared
+ *          buffer, the offset and the size of the data. The data remains
+ *          valid while the view or any other shared buffer references it.
+ *          The view is used to access the large binary data of received
+ *          events without copying it.
+ *
+ * \note    The view is not thread safe. The data of the view should not
+ *          be modified by other instances of the shared buffer.
+ **/
+class AREG_API BufferView
+{
+//////////////////////////////////////////////////////////////////////////
+// Static members
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The empty view without data.
+     **/
+    static const BufferView EmptyView;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the empty view.
+     **/
+    BufferView( void );
+
+    /**
+     * \brief   Creates the view of the data in the shared buffer.
+     *          The offset and the size are limited by the used size of the buffer.
+     * \param   buffer  The shared buffer to reference.
+     * \param   offset  The offset in bytes of the data in the buffer.
+     * \param   size    The size in bytes of the data.
+     **/
+    BufferView( const SharedBuffer & buffer, unsigned int offset, unsigned int size );
+
+    /**
+     * \brief   Copies the view. The data is not copied.
+     **/
+    BufferView( const BufferView & src );
+
+    /**
+     * \brief   Moves the view.
+     **/
+    BufferView( BufferView && src ) noexcept;
+
+    /**
+     * \brief   Destructor.
+     **/
+    ~BufferView( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operators
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Copies the view. The data is not copied.
+     **/
+    BufferView & operator = ( const BufferView & src );
+
+    /**
+     * \brief   Moves the view.
+     **/
+    BufferView & operator = ( BufferView && src ) noexcept;
+
+    /**
+     * \brief   Returns the byte at the given index. The index should be less than the size.
+     **/
+    inline unsigned char operator [] ( unsigned int index ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the view has no data.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Returns the pointer to the data or nullptr if the view is empty.
+     **/
+    inline const unsigned char * getData( void ) const;
+
+    /**
+     * \brief   Returns the size in bytes of the data.
+     **/
+    inline unsigned int getSize( void ) const;
+
+    /**
+     * \brief   Returns the pointer to the end of the data.
+     **/
+    inline const unsigned char * getEnd( void ) const;
+
+    /**
+     * \brief   Returns the view of the part of the data. The data is not copied.
+     * \param   offset  The offset in bytes relative to the begin of this view.
+     * \param   size    The size in bytes of the data. Limited by the size of this view.
+     **/
+    BufferView getView( unsigned int offset, unsigned int size ) const;
+
+    /**
+     * \brief   Copies the data of the view to the new shared buffer.
+     *          Call if the data should be modified.
+     **/
+    SharedBuffer copyBuffer( void ) const;
+
+    /**
+     * \brief   Releases the reference of the shared buffer and empties the view.
+     **/
+    void release( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The shared buffer, which data is referenced.
+     **/
+    SharedBuffer    mBuffer;
+
+    /**
+     * \brief   The pointer to the data in the shared buffer.
+     **/
+    const unsigned char * mData;
+
+    /**
+     * \brief   The size in bytes of the data.
+     **/
+    unsigned int    mSize;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// BufferView class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline unsigned char BufferView::operator [] ( unsigned int index ) const
+{
+    ASSERT(index < mSize);
+    return mData[index];
+}
+
+inline bool BufferView::isEmpty( void ) const
+{
+    return (mSize == 0);
+}
+
+inline const unsigned char * BufferView::getData( void ) const
+{
+    return mData;
+}
+
+inline unsigned int BufferView::getSize( void ) const
+{
+    return mSize;
+}
+
+inline const unsigned char * BufferView::getEnd( void ) const
+{
+    return (mData != nullptr ? mData + mSize : nullptr);
+}
+
+#endif  // AREG_BASE_BUFFERVIEW_HPP
@@ -53,6 +53,15 @@ protected:
      **/
     static constexpr unsigned int   MAX_BUF_LENGTH  { 0x04000000u };
 
+public:
+    /**
+     * \brief   IEByteBuffer::DEFAULT_GROWTH_LIMIT
+     *          The default maximum size in bytes to grow the buffer at once.
+     *          Until the buffer reaches this size, it doubles on every reallocation,
+     *          then it grows linearly by this size.
+     **/
+    static constexpr unsigned int   DEFAULT_GROWTH_LIMIT{ 64 * 1024 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -122,6 +131,39 @@ public:
      **/
     virtual unsigned int reserve(unsigned int size, bool copy);
 
+/************************************************************************/
+// IEByteBuffer static methods
+/************************************************************************/
+
+    /**
+     * \brief   Sets the maximum size in bytes to grow the buffer at once when
+     *          the data is streamed to the end of existing buffer. Until the buffer
+     *          reaches this size, the capacity of buffer doubles on reallocation,
+     *          so that streaming many small fields is amortized. If zero,
+     *          the buffer grows exactly by the requested size. The explicit
+     *          call of reserve() always reserves exactly the requested size.
+     * \param   growthLimit     The maximum size in bytes to grow at once.
+     **/
+    static void setGrowthLimit( unsigned int growthLimit );
+
+    /**
+     * \brief   Returns the maximum size in bytes to grow the buffer at once.
+     **/
+    static unsigned int getGrowthLimit( void );
+
+    /**
+     * \brief   Returns the number of reallocations of byte buffers, which copied
+     *          existing data to the new buffer. The value is counted for all
+     *          byte buffer objects of the process only in debug build,
+     *          in release build the function always returns zero.
+     **/
+    static uint64_t getReallocationCount( void );
+
+    /**
+     * \brief   Resets the number of reallocations of byte buffers.
+     **/
+    static void resetReallocationCount( void );
+
 /************************************************************************/
 // IEByteBuffer Attributes and operations
 /************************************************************************/
@@ -198,6 +240,16 @@ protected:
      **/
     inline unsigned char * getEndOfBuffer( void );
 
+    /**
+     * \brief   Returns the size in bytes to reserve when the data is streamed to
+     *          the end of the buffer and the buffer requires the given size.
+     *          If the buffer has not enough space, the size of the buffer grows
+     *          geometrically, but not more than the growth limit at once.
+     *          Otherwise, returns the given size.
+     * \param   size    The size in bytes, which is required to write the data.
+     **/
+    unsigned int getGrowSize( unsigned int size ) const;
+
 /************************************************************************/
 // IEByteBuffer protected overrides
 /************************************************************************/
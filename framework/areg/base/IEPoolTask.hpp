@@ -0,0 +1,64 @@
+#ifndef AREG_BASE_IEPOOLTASK_HPP
+#define AREG_BASE_IEPOOLTASK_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/IEPoolTask.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Pool Task interface class.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+//////////////////////////////////////////////////////////////////////////
+// IEPoolTask class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The task scheduled to run on the threads of WorkStealingPool.
+ *          The pool does not own the task, the task object should be valid
+ *          until it runs. The same task object can be scheduled again,
+ *          including from its runTask() method.
+ **/
+class AREG_API IEPoolTask
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   Protected default constructor
+     **/
+    IEPoolTask( void ) = default;
+
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~IEPoolTask( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Callbacks
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Triggered on one of the threads of the pool to run the task.
+     **/
+    virtual void runTask( void ) = 0;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( IEPoolTask );
+};
+
+#endif  // AREG_BASE_IEPOOLTASK_HPP
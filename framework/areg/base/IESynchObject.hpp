@@ -177,7 +177,10 @@ inline IESynchObject::eSyncObject IESynchObject::getObjectType( void ) const
 
 inline bool IESynchObject::isValid( void ) const
 {
-    return (mSynchObjectType == IESynchObject::eSyncObject::SoNolock) || (mSynchObject != nullptr);
+    // the spin-lock has no OS handle, it is always valid.
+    return (mSynchObjectType == IESynchObject::eSyncObject::SoNolock)   ||
+           (mSynchObjectType == IESynchObject::eSyncObject::SoSpinlock) ||
+           (mSynchObject != nullptr);
 }
 
 #endif  // AREG_BASE_IESYNCHOBJECT_HPP
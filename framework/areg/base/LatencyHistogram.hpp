@@ -0,0 +1,187 @@
+#ifndef AREG_BASE_LATENCYHISTOGRAM_HPP
+#define AREG_BASE_LATENCYHISTOGRAM_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/LatencyHistogram.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Latency Histogram class.
+ *              The lock-free log-linear histogram of the durations.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////
+// LatencyHistogram class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The histogram of durations in nanoseconds with log-linear buckets.
+ *          Every power of two is split into SUB_BUCKETS linear buckets, so that
+ *          the values are recorded with the relative error below 1 / SUB_BUCKETS
+ *          in the whole range, and the histogram has a fixed size.
+ *          The histogram is designed for a single writer and any number of
+ *          readers. The writer does not lock and does not use atomic
+ *          read-modify-write operations, the readers get the values, which
+ *          may be behind the writer by a few records.
+ **/
+class AREG_API LatencyHistogram
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The number of bits of linear sub-buckets in every power of two.
+     **/
+    static constexpr uint32_t   SUB_BUCKET_BITS { 3u };
+
+    /**
+     * \brief   The number of linear sub-buckets in every power of two.
+     **/
+    static constexpr uint32_t   SUB_BUCKETS     { 1u << SUB_BUCKET_BITS };
+
+    /**
+     * \brief   The values equal or bigger than 2 ^ MAX_VALUE_BITS are recorded in the last bucket.
+     *          In nanoseconds it is about 18 minutes.
+     **/
+    static constexpr uint32_t   MAX_VALUE_BITS  { 40u };
+
+    /**
+     * \brief   The number of buckets of the histogram.
+     **/
+    static constexpr uint32_t   BUCKET_COUNT    { (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1u) * SUB_BUCKETS };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the empty histogram.
+     **/
+    LatencyHistogram( void );
+
+    ~LatencyHistogram( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Records the value. Should be called only by one thread at a time.
+     * \param   value   The value to record, normally the duration in nanoseconds.
+     **/
+    inline void recordValue( uint64_t value );
+
+    /**
+     * \brief   Returns the number of recorded values.
+     **/
+    uint64_t getCount( void ) const;
+
+    /**
+     * \brief   Returns the biggest recorded value.
+     **/
+    inline uint64_t getMaxValue( void ) const;
+
+    /**
+     * \brief   Returns the value, which is not smaller than the given percent of recorded values.
+     *          The value is the upper bound of the bucket, and is not bigger than the biggest recorded value.
+     *          Returns zero if the histogram is empty.
+     * \param   percentile  The percent of values in range [0.0, 100.0].
+     **/
+    uint64_t getPercentile( double percentile ) const;
+
+    /**
+     * \brief   Removes all recorded values. Should not be called when the values are recorded.
+     **/
+    void reset( void );
+
+    /**
+     * \brief   Returns the index of the bucket, which records the value.
+     **/
+    static inline uint32_t getBucketIndex( uint64_t value );
+
+    /**
+     * \brief   Returns the biggest value recorded in the bucket with the index.
+     **/
+    static uint64_t getBucketValue( uint32_t index );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The number of values in every bucket.
+     **/
+    std::atomic_uint64_t    mBuckets[BUCKET_COUNT];
+
+    /**
+     * \brief   The biggest recorded value.
+     **/
+    std::atomic_uint64_t    mMaxValue;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LatencyHistogram );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LatencyHistogram class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline void LatencyHistogram::recordValue( uint64_t value )
+{
+    // single writer, the readers only need to see the values without tearing.
+    std::atomic_uint64_t & bucket{ mBuckets[getBucketIndex(value)] };
+    bucket.store( bucket.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed );
+    if (value > mMaxValue.load(std::memory_order_relaxed))
+    {
+        mMaxValue.store( value, std::memory_order_relaxed );
+    }
+}
+
+inline uint32_t LatencyHistogram::getBucketIndex( uint64_t value )
+{
+    if (value < SUB_BUCKETS)
+        return static_cast<uint32_t>(value);
+    else if (value >= (static_cast<uint64_t>(1u) << MAX_VALUE_BITS))
+        return (BUCKET_COUNT - 1u);
+
+    // the position of the highest set bit.
+    uint32_t bit{ 0u };
+    for (uint32_t shift = 32u; shift != 0u; shift >>= 1)
+    {
+        bit += (value >> (bit + shift)) != 0u ? shift : 0u;
+    }
+
+    const uint32_t sub{ static_cast<uint32_t>(value >> (bit - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1u) };
+    return ((bit - SUB_BUCKET_BITS + 1u) * SUB_BUCKETS + sub);
+}
+
+inline uint64_t LatencyHistogram::getMaxValue( void ) const
+{
+    return mMaxValue.load( std::memory_order_relaxed );
+}
+
+#endif  // AREG_BASE_LATENCYHISTOGRAM_HPP
@@ -271,6 +271,33 @@ namespace NECommon
      **/
     constexpr unsigned int   WATCHDOG_IGNORE        { DO_NOT_WAIT };
 
+    /**
+     * \brief   NECommon::eWaitPolicy
+     *          Defines how the dispatcher waits for the events when the queue is empty.
+     *          1.  WaitBlocking    --  Blocks immediately until an event is queued.
+     *          2.  WaitAdaptive    --  Spins for a bounded time before it blocks. While it
+     *                                  spins, the queued events do not wake up the thread.
+     *          3.  WaitBusyPoll    --  Never blocks and polls the queue. Use it only with
+     *                                  the thread pinned on an isolated CPU core.
+     **/
+    typedef enum class E_WaitPolicy : uint8_t
+    {
+          WaitBlocking  = 0 //!< Block until an event is queued.
+        , WaitAdaptive  = 1 //!< Spin for a bounded time, then block.
+        , WaitBusyPoll  = 2 //!< Poll the queue without blocking.
+    } eWaitPolicy;
+
+    /**
+     * \brief   Converts NECommon::eWaitPolicy values to string and return string values.
+     **/
+    inline const char * getString( NECommon::eWaitPolicy policy );
+
+    /**
+     * \brief   NECommon::SPIN_TIME_DEFAULT
+     *          The default time in microseconds, which the adaptive dispatcher spins before it blocks.
+     **/
+    constexpr unsigned int   SPIN_TIME_DEFAULT      { 50u };
+
     /**
      * \brief   NECommon::TIMEOUT_1_MS
      *          Timeout 1 millisecond
@@ -481,4 +508,23 @@ namespace NECommon
 
 }
 
+//////////////////////////////////////////////////////////////////////////
+// NECommon namespace inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline const char * NECommon::getString( NECommon::eWaitPolicy policy )
+{
+    switch ( policy )
+    {
+    case NECommon::eWaitPolicy::WaitBlocking:
+        return "NECommon::eWaitPolicy::WaitBlocking";
+    case NECommon::eWaitPolicy::WaitAdaptive:
+        return "NECommon::eWaitPolicy::WaitAdaptive";
+    case NECommon::eWaitPolicy::WaitBusyPoll:
+        return "NECommon::eWaitPolicy::WaitBusyPoll";
+    default:
+        return "ERR: Unexpected NECommon::eWaitPolicy value!";
+    }
+}
+
 #endif  // AREG_BASE_NECOMMON_HPP
@@ -526,6 +526,24 @@ namespace NESocket
      **/
     AREG_API int sendData( SOCKETHANDLE hSocket, const unsigned char * dataBuffer, uint32_t dataLength, uint32_t blockMaxSize );
 
+    /**
+     * \brief   NESocket::sendData
+     *          Sends the header and the data buffers to specified socket. If the total size
+     *          does not exceed the package size, both buffers are sent in one system call
+     *          (gather write), so that the header does not need to be copied in front of data.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket         The valid socket descriptor to send data.
+     * \param   header          The pointer to the header buffer, which is sent first.
+     * \param   headerLength    The length of header buffer in bytes.
+     * \param   dataBuffer      The pointer to data buffer, which is sent after header.
+     * \param   dataLength      The length of data buffer in bytes.
+     * \param   blockMaxSize    The maximum size of package in bytes to sent at once.
+     *                          If zero, it will first retrieve value and sent data.
+     * \return  If succeeds, returns number of bytes sent.
+     *          If failles, returns negative number.
+     **/
+    AREG_API int sendData( SOCKETHANDLE hSocket, const unsigned char * header, uint32_t headerLength, const unsigned char * dataBuffer, uint32_t dataLength, uint32_t blockMaxSize );
+
     /**
      * \brief   NESocket::receiveData
      *          Receives data on specified socket. The passed socket descriptor should be valid.
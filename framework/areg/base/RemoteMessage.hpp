@@ -217,6 +217,8 @@ public:
      *          If succeeds to allocate new buffer, sets reference counter to 1,
      *          sets data used size to the value specified in header.
      *          The method expects that allocated data will be manually filled.
+     *          The buffer is taken from the BufferPool and returns to the pool
+     *          when the last shared buffer object releases it.
      * \param   rmHeader    Instance of Remote Buffer Header containing buffer information.
      * \param   reserve     The size in bytes to reserve in the buffer
      * \return  Returns pointer to allocated data buffer to copy data.
@@ -231,6 +233,32 @@ public:
      **/
     RemoteMessage clone(const ITEM_ID & source = 0, const ITEM_ID & target = 0) const;
 
+    /**
+     * \brief   Creates the message, which shares the data buffer with this message, but
+     *          is delivered to the specified target. The data is not copied, the target
+     *          is kept in the new message object and is written in the header when sending.
+     *          The checksum is calculated once, since the target is not part of checksum.
+     *          Use it to forward the same message to multiple targets. After sharing,
+     *          the data of the message should not be modified.
+     * \param   target  The ID of the target to deliver the message.
+     * \return  Returns the message object, which refers to the same data buffer.
+     **/
+    RemoteMessage shareWithTarget(const ITEM_ID & target) const;
+
+    /**
+     * \brief   Returns true if the message shares the data buffer with other messages,
+     *          which are delivered to other targets.
+     **/
+    inline bool isSharedWithTarget( void ) const;
+
+    /**
+     * \brief   Copies the header of the message to the passed structure. The copied header
+     *          contains the target of the message, even if the data buffer is shared.
+     *          Call after bufferCompletionFix() before sending the message.
+     * \param   header  On output, contains the header of the message to send.
+     **/
+    inline void copyHeader( NEMemory::sRemoteMessageHeader & OUT header ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -285,6 +313,16 @@ private:
      * \brief   Calculates and returns the checksum value of given remote message
      **/
     static unsigned int _checksumCalculate( const NEMemory::sRemoteMessage & remoteMessage );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The ID of the target, if the data buffer is shared with other targets.
+     *          If 0, the target is set in the header of the data buffer.
+     **/
+    ITEM_ID     mSharedTarget;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -337,17 +375,32 @@ inline void RemoteMessage::setSource(const ITEM_ID & idSource )
 
 inline const ITEM_ID & RemoteMessage::getTarget( void ) const
 {
-    return _getHeader().rbhTarget;
+    return (mSharedTarget != 0 ? mSharedTarget : _getHeader().rbhTarget);
 }
 
 inline void RemoteMessage::setTarget(const ITEM_ID & idTarget )
 {
-    if (isValid())
+    if (mSharedTarget != 0)
+    {
+        mSharedTarget = idTarget != 0 ? idTarget : mSharedTarget;
+    }
+    else if (isValid())
     {
         _getHeader().rbhTarget = idTarget;
     }
 }
 
+inline bool RemoteMessage::isSharedWithTarget( void ) const
+{
+    return (mSharedTarget != 0);
+}
+
+inline void RemoteMessage::copyHeader( NEMemory::sRemoteMessageHeader & OUT header ) const
+{
+    header = _getHeader();
+    header.rbhTarget = getTarget();
+}
+
 inline unsigned int RemoteMessage::getMessageId( void ) const
 {
     return _getHeader().rbhMessageId;
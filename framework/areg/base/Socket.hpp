@@ -158,6 +158,20 @@ public:
      **/
     virtual int sendData( const unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, sends the header followed by data buffer using existing
+     *          socket connection and returns number of sent bytes. The buffers are sent
+     *          with one gather write, if possible, without copying them into one buffer.
+     *          Returns negative number if either socket is invalid, or failed to send data.
+     * \param   header          The buffer of header to send first.
+     * \param   headerLength    The length in bytes of header.
+     * \param   buffer          The buffer of data to send after header.
+     * \param   length          The length in bytes of data in buffer to send
+     * \return  Returns number of bytes sent to remote target.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    virtual int sendData( const unsigned char * header, int headerLength, const unsigned char * buffer, int length ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns
      *          number of received bytes in buffer, which is equal to specified length parameter.
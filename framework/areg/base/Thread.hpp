@@ -105,6 +105,70 @@ public:
      **/
     inline static const char * getString( Thread::eThreadPriority threadPriority );
 
+    /**
+     * \brief   Thread::eSchedulingPolicy
+     *          Defines the scheduling policy of the thread. By default, the thread
+     *          keeps the scheduling policy of the process. On Windows the policies
+     *          are mapped to the priorities of the thread.
+     **/
+    typedef enum class E_SchedulingPolicy : int
+    {
+          PolicyUndefined   = 0 //!< Undefined policy, the thread keeps the policy of the process
+        , PolicyNormal      = 1 //!< Default time-sharing policy (SCHED_OTHER)
+        , PolicyBatch       = 2 //!< Time-sharing policy of CPU intensive non-interactive threads (SCHED_BATCH)
+        , PolicyIdle        = 3 //!< The thread runs only if the CPU has nothing else to run (SCHED_IDLE)
+        , PolicyFifo        = 4 //!< Real-time first in, first out policy (SCHED_FIFO)
+        , PolicyRoundRobin  = 5 //!< Real-time round robin policy (SCHED_RR)
+    } eSchedulingPolicy;
+
+    /**
+     * \brief   Converts Thread::eSchedulingPolicy values to string and return string values.
+     **/
+    inline static const char * getString( Thread::eSchedulingPolicy policy );
+
+    /**
+     * \brief   Thread::NUMA_NODE_ANY
+     *          Indicates that the thread is not bound to a NUMA node.
+     **/
+    static constexpr int                NUMA_NODE_ANY           { -1 };
+
+    /**
+     * \brief   Thread::CPU_MASK_CORES
+     *          The number of CPU cores, which can be set in the CPU mask of the thread placement.
+     *          The cores with the higher numbers are ignored.
+     **/
+    static constexpr uint32_t           CPU_MASK_CORES          { 64u };
+
+    /**
+     * \brief   Thread::sPlacement
+     *          The placement of the thread: the CPU cores to run, the scheduling policy
+     *          and the NUMA node to run and allocate memory. The placement is applied
+     *          when the thread starts running.
+     **/
+    typedef struct S_Placement
+    {
+        /**
+         * \brief   Returns true if none of the placement attributes is set.
+         **/
+        inline bool isEmpty( void ) const;
+
+        /**
+         * \brief   The bit mask of the CPU cores to run the thread, the bit 0 is the core 0.
+         *          The value 0 means any core. If a NUMA node is set, the value 0 means
+         *          any core of the node. Only Thread::CPU_MASK_CORES cores can be set.
+         **/
+        uint64_t                    cpuMask     { 0u };
+        /**
+         * \brief   The scheduling policy of the thread.
+         **/
+        Thread::eSchedulingPolicy   policy      { Thread::eSchedulingPolicy::PolicyUndefined };
+        /**
+         * \brief   The NUMA node to run the thread and to allocate the memory,
+         *          or Thread::NUMA_NODE_ANY.
+         **/
+        int                         numaNode    { Thread::NUMA_NODE_ANY };
+    } sPlacement;
+
     /**
      * \brief   Thread::INVALID_THREAD_ID
      *          Invalid thread ID.
@@ -175,6 +239,14 @@ public:
      **/
     virtual bool createThread( unsigned int waitForStartMs = NECommon::DO_NOT_WAIT );
 
+    /**
+     * \brief   Waits until the created thread starts running. Call it to start
+     *          several threads without waiting and then wait for all of them.
+     * \param   waitForStartMs  Waiting time out in milliseconds until thread is running.
+     * \return  Returns true if the thread is running before the timeout expires.
+     **/
+    bool waitForThreadRun( unsigned int waitForStartMs = NECommon::WAIT_INFINITE );
+
     /**
      * \brief   Override the method to trigger exist event for the threads.
      **/
@@ -236,6 +308,12 @@ public:
      **/
     inline bool isValid( void ) const;
 
+    /**
+     * \brief   Returns true if the thread object has no own system thread and
+     *          runs on the threads of a pool. See createHostedThread().
+     **/
+    inline bool isHosted( void ) const;
+
     /**
      * \brief   Returns thread ID
      **/
@@ -280,10 +358,43 @@ public:
      **/
     inline Thread::eThreadPriority getPriority( void ) const;
 
+    /**
+     * \brief   Sets the placement of the thread, i.e. the CPU cores, the scheduling policy and
+     *          the NUMA node. The placement is applied when the thread starts running.
+     *          If the thread calls the method itself, the placement is immediately applied.
+     *          The hosted threads run on the threads of the pool and ignore the placement.
+     *          The placement configured by thread name (see configurePlacement()) overrides
+     *          the attributes set by this method.
+     * \param   placement   The placement of the thread.
+     * \return  Returns false if the thread applied the placement and failed.
+     **/
+    bool setPlacement( const Thread::sPlacement & placement );
+
+    /**
+     * \brief   Returns the placement of the thread set by setPlacement().
+     **/
+    inline Thread::sPlacement getPlacement( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // static operations
 //////////////////////////////////////////////////////////////////////////
 
+    /**
+     * \brief   Configures the placement of the threads with the specified name. The configured
+     *          placement is applied when the thread with the name starts running, and the set
+     *          attributes override the placement set by setPlacement(). Normally, the placement
+     *          is configured when the application reads the configuration file.
+     * \param   threadName  The name of the thread.
+     * \param   placement   The placement to configure. If empty, removes the configured placement.
+     **/
+    static void configurePlacement( const String & threadName, const Thread::sPlacement & placement );
+
+    /**
+     * \brief   Returns the placement configured for the threads with the specified name.
+     *          Returns empty placement if nothing is configured.
+     **/
+    static Thread::sPlacement getConfiguredPlacement( const String & threadName );
+
     /**
      * \brief	Search by thread name and return pointer the thread object.
      *          If name could not find, returns nullptr
@@ -351,6 +462,11 @@ public:
      **/
     inline static Thread * getCurrentThread( void );
 
+    /**
+     * \brief   Returns true if the current system thread runs a hosted thread, i.e. it is a pool worker.
+     **/
+    inline static bool isCurrentThreadHosted( void );
+
     /**
      * \brief   Returns the name of current thread.
      *          If Thread is not registered, returns empty string.
@@ -435,6 +551,43 @@ protected:
      **/
     static Thread * getNextThread( id_type & IN OUT threadId );
 
+/************************************************************************/
+// Hosted thread operations
+/************************************************************************/
+    /**
+     * \brief   Registers the thread object, which has no own system thread and runs
+     *          on the threads of a pool. The hosted thread gets the unique handle and ID,
+     *          and is found by name, ID and address as any other thread. The pool runs
+     *          the hosted thread by calling startHostedThread() and exitHostedThread(),
+     *          and while it runs the job of the hosted thread, the current system
+     *          thread should host the object (see hostThread()).
+     * \return  Returns true if the thread object is registered.
+     *          Returns false if the thread is already created.
+     **/
+    bool createHostedThread( void );
+
+    /**
+     * \brief   Marks the hosted thread as running and signals the threads waiting for start.
+     * \return  Returns false if the hosted thread is not valid or should not run.
+     **/
+    bool startHostedThread( void );
+
+    /**
+     * \brief   Completes the hosted thread. Calls the exit callbacks, unregisters the thread
+     *          and signals the threads waiting for completion. The thread object should not
+     *          be accessed after the call, because the waiting thread may delete it.
+     **/
+    void exitHostedThread( void );
+
+    /**
+     * \brief   Sets the thread object hosted by the current system thread. While hosted, the
+     *          object is the current thread, i.e. returned by getCurrentThread(), getCurrentThreadId(),
+     *          getCurrentThreadName() and getCurrentThreadAddress().
+     * \param   hosted  The hosted thread object. Set nullptr to restore the own thread.
+     * \return  Returns the previously hosted thread object.
+     **/
+    static Thread * hostThread( Thread * hosted );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -464,6 +617,14 @@ protected:
      * \brief   Flag indicating whether thread is running or not.
      **/
     bool                    mIsRunning;
+    /**
+     * \brief   Flag indicating whether the thread object is hosted by the threads of a pool.
+     **/
+    bool                    mIsHosted;
+    /**
+     * \brief   The placement of the thread, applied when the thread starts.
+     **/
+    Thread::sPlacement      mPlacement;
     /**
      * \brief   Object to synchronize data access
      **/
@@ -508,6 +669,17 @@ private:
      **/
     void _unregisterThread( void );
 
+    /**
+     * \brief   Unregisters the hosted thread and waits for completion. The hosted thread
+     *          cannot be terminated, if the timeout expires, it remains running on the pool.
+     **/
+    Thread::eCompletionStatus _destroyHostedThread( unsigned int waitForStopMs );
+
+    /**
+     * \brief   Returns the thread object hosted by the current system thread or nullptr.
+     **/
+    static Thread * _getHostedThread( void );
+
     /**
      * \brief   Thread entry point. Consumer function call performed here.
      * \return  Returns thread routine exit code.
@@ -519,6 +691,12 @@ private:
      **/
     inline void _setRunning(bool isRunning);
 
+    /**
+     * \brief   Applies the placement of the thread, merged with the configured placement.
+     *          Should be called by the thread itself.
+     **/
+    bool _applyPlacement( void );
+
     /**
      * \brief   Checks whether the thread is valid or not without locking synchronization objects.
      * \return  Returns true if thread data is valid.
@@ -621,6 +799,12 @@ private:
      **/
     Thread::eThreadPriority _osSetPriority( eThreadPriority newPriority );
 
+    /**
+     * \brief   OS specific implementation to bind the current thread to the CPU cores
+     *          and NUMA node, and to set the scheduling policy. Returns true if succeeded.
+     **/
+    bool _osApplyPlacement( const Thread::sPlacement & placement );
+
 private:
 /************************************************************************/
 // Resource mapping types, used to control resources, used by thread
@@ -705,6 +889,12 @@ inline bool Thread::isValid( void ) const
     return _isValidNoLock();
 }
 
+inline bool Thread::isHosted( void ) const
+{
+    Lock lock(mSynchObject);
+    return mIsHosted;
+}
+
 inline id_type Thread::getId( void ) const
 {
     Lock lock(mSynchObject);
@@ -758,17 +948,18 @@ inline void Thread::_setRunning( bool isRunning )
 
 inline Thread * Thread::getCurrentThread( void )
 {
-    return Thread::findThreadById(Thread::_osGetCurrentThreadId());
+    Thread * hosted{ Thread::_getHostedThread() };
+    return (hosted != nullptr ? hosted : Thread::findThreadById(Thread::_osGetCurrentThreadId()));
 }
 
 inline const String & Thread::getCurrentThreadName( void )
 {
-    return Thread::getThreadName( Thread::_osGetCurrentThreadId() );
+    return Thread::getThreadName( Thread::getCurrentThreadId() );
 }
 
 inline const ThreadAddress & Thread::getCurrentThreadAddress( void )
 {
-    return Thread::getThreadAddress( Thread::_osGetCurrentThreadId() );
+    return Thread::getThreadAddress( Thread::getCurrentThreadId() );
 }
 
 inline Thread::eThreadPriority Thread::getPriority( void ) const
@@ -777,6 +968,22 @@ inline Thread::eThreadPriority Thread::getPriority( void ) const
     return (isValid( ) ? mThreadPriority : Thread::eThreadPriority::PriorityUndefined);
 }
 
+inline Thread::sPlacement Thread::getPlacement( void ) const
+{
+    Lock  lock( mSynchObject );
+    return mPlacement;
+}
+
+inline bool Thread::S_Placement::isEmpty( void ) const
+{
+    return ((cpuMask == 0u) && (policy == Thread::eSchedulingPolicy::PolicyUndefined) && (numaNode == Thread::NUMA_NODE_ANY));
+}
+
+inline bool Thread::isCurrentThreadHosted( void )
+{
+    return (Thread::_getHostedThread() != nullptr);
+}
+
 inline void Thread::sleep( unsigned int ms )
 {
     _osSleep( ms );
@@ -789,12 +996,13 @@ inline void Thread::switchThread( void )
 
 inline id_type Thread::getCurrentThreadId( void )
 {
-    return _osGetCurrentThreadId( );
+    Thread * hosted{ Thread::_getHostedThread() };
+    return (hosted != nullptr ? hosted->mThreadId : _osGetCurrentThreadId( ));
 }
 
 inline Thread::eThreadPriority Thread::setPriority( eThreadPriority newPriority )
 {
-    return _osSetPriority( newPriority );
+    return (mIsHosted ? mThreadPriority : _osSetPriority( newPriority ));
 }
 
 inline const char * Thread::getString( Thread::eThreadPriority threadPriority )
@@ -818,4 +1026,25 @@ inline const char * Thread::getString( Thread::eThreadPriority threadPriority )
     }
 }
 
+inline const char * Thread::getString( Thread::eSchedulingPolicy policy )
+{
+    switch ( policy )
+    {
+    case Thread::eSchedulingPolicy::PolicyUndefined:
+        return "Thread::PolicyUndefined";
+    case Thread::eSchedulingPolicy::PolicyNormal:
+        return "Thread::PolicyNormal";
+    case Thread::eSchedulingPolicy::PolicyBatch:
+        return "Thread::PolicyBatch";
+    case Thread::eSchedulingPolicy::PolicyIdle:
+        return "Thread::PolicyIdle";
+    case Thread::eSchedulingPolicy::PolicyFifo:
+        return "Thread::PolicyFifo";
+    case Thread::eSchedulingPolicy::PolicyRoundRobin:
+        return "Thread::PolicyRoundRobin";
+    default:
+        return "ERR: Invalid Thread::eSchedulingPolicy value!";
+    }
+}
+
 #endif  // AREG_BASE_THREAD_HPP
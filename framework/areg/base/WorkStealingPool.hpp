@@ -0,0 +1,215 @@
+#ifndef AREG_BASE_WORKSTEALINGPOOL_HPP
+#define AREG_BASE_WORKSTEALINGPOOL_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/WorkStealingPool.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Work Stealing Pool class.
+ *              The fixed size pool of threads running the scheduled tasks.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/IEPoolTask.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The fixed size pool of threads, which run the scheduled tasks.
+ *          Every thread of the pool has own queue of tasks. The task
+ *          scheduled by a thread of the pool is queued in the own queue
+ *          of the thread, other tasks are distributed between the queues.
+ *          The thread, which has no task in own queue, steals the tasks
+ *          from the queues of other threads, and if there are no tasks,
+ *          waits until a task is scheduled. The pool does not own tasks.
+ **/
+class AREG_API WorkStealingPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The thread of the pool. Declared and implemented in the source file.
+     **/
+    class PoolWorker;
+    friend class PoolWorker;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the pool. The threads are created when the pool starts.
+     * \param   poolName    The name of the pool, used as a prefix of thread names.
+     **/
+    explicit WorkStealingPool( const String & poolName );
+
+    /**
+     * \brief   Stops the pool and waits for the threads to complete.
+     **/
+    ~WorkStealingPool( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the threads of the pool. If the pool is already started, does nothing.
+     * \param   threadCount     The number of threads. If zero, creates one thread per CPU core.
+     * \return  Returns true if the pool is started.
+     **/
+    bool startPool( uint32_t threadCount );
+
+    /**
+     * \brief   Stops the threads of the pool and waits for completion.
+     *          The tasks, which did not run, are removed from the queues.
+     **/
+    void stopPool( void );
+
+    /**
+     * \brief   Returns true if the threads of the pool are started.
+     **/
+    inline bool isPoolStarted( void ) const;
+
+    /**
+     * \brief   Returns the number of threads of the pool.
+     **/
+    inline uint32_t getThreadCount( void ) const;
+
+    /**
+     * \brief   Returns the name of the pool.
+     **/
+    inline const String & getName( void ) const;
+
+    /**
+     * \brief   Schedules the task to run on a thread of the pool. The task scheduled
+     *          by a thread of the pool is queued to the same thread. Should not be
+     *          called while the pool is stopping.
+     * \param   task    The task to run. The pool does not own the task.
+     * \return  Returns true if the task is scheduled. Returns false if the pool is not started.
+     **/
+    bool scheduleTask( IEPoolTask & task );
+
+    /**
+     * \brief   Returns true if the current thread is a thread of the pool.
+     **/
+    bool isPoolThread( void ) const;
+
+    /**
+     * \brief   Returns the number of tasks run by the threads of the pool.
+     **/
+    uint64_t getTasksRun( void ) const;
+
+    /**
+     * \brief   Returns the number of tasks stolen from the queues of other threads.
+     **/
+    uint64_t getTasksStolen( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Takes the next task to run by the specified thread, at first from
+     *          own queue, then from the queues of other threads.
+     *          Returns nullptr if all queues are empty.
+     **/
+    IEPoolTask * _nextTask( PoolWorker & worker );
+
+    /**
+     * \brief   Wakes up a waiting thread, if there is any.
+     **/
+    void _wakeWorker( uint32_t hint );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The name of the pool.
+     **/
+    const String            mPoolName;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The threads of the pool.
+     **/
+    TEArrayList<PoolWorker *>   mWorkers;
+
+    /**
+     * \brief   The flag, indicating that the threads of the pool should exit.
+     **/
+    std::atomic_bool        mExit;
+
+    /**
+     * \brief   The number of threads, which wait for the tasks.
+     **/
+    std::atomic_uint32_t    mIdleCount;
+
+    /**
+     * \brief   The number of started threads of the pool.
+     **/
+    std::atomic_uint32_t    mWorkerCount;
+
+    /**
+     * \brief   The index of the next queue for the tasks scheduled by other threads.
+     **/
+    std::atomic_uint32_t    mNextQueue;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The lock to start and stop the pool.
+     **/
+    mutable ResourceLock    mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    WorkStealingPool( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( WorkStealingPool );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingPool class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool WorkStealingPool::isPoolStarted( void ) const
+{
+    return (mWorkerCount.load() != 0);
+}
+
+inline uint32_t WorkStealingPool::getThreadCount( void ) const
+{
+    return mWorkerCount.load();
+}
+
+inline const String & WorkStealingPool::getName( void ) const
+{
+    return mPoolName;
+}
+
+#endif  // AREG_BASE_WORKSTEALINGPOOL_HPP
@@ -0,0 +1,241 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/BufferPool.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Size-classed pool of memory blocks
+ *              used to allocate byte buffers of remote messages.
+ ************************************************************************/
+#include "areg/base/BufferPool.hpp"
+
+#include "areg/base/NEMemory.hpp"
+
+namespace
+{
+    //!< Returns the pointer to the next free block, which is saved in the free block.
+    inline unsigned char *& _nextFree(unsigned char * block)
+    {
+        return *reinterpret_cast<unsigned char **>(block);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool::BlockDeleter implementation
+//////////////////////////////////////////////////////////////////////////
+
+void BufferPool::BlockDeleter::operator ( ) ( void * buffer ) const
+{
+    if (buffer != nullptr)
+    {
+        BufferPool::getInstance().releaseBlock(reinterpret_cast<unsigned char *>(buffer), bdSizeClass);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+BufferPool & BufferPool::getInstance( void )
+{
+    // The pool is never destroyed: the messages held by static objects are released
+    // after the static objects of this module are destroyed, and return their blocks
+    // to the pool. The cached blocks are freed by the OS when the process exits.
+    static BufferPool * _bufferPool{ DEBUG_NEW BufferPool( ) };
+    return (*_bufferPool);
+}
+
+uint32_t BufferPool::getSizeClass( uint32_t size )
+{
+    uint32_t result{ BufferPool::INVALID_CLASS };
+    if (size <= BufferPool::MAX_BLOCK_SIZE)
+    {
+        result = 0;
+        for (uint32_t blockSize = BufferPool::MIN_BLOCK_SIZE; blockSize < size; blockSize <<= 1)
+        {
+            ++ result;
+        }
+    }
+
+    return result;
+}
+
+BufferPool::BufferPool( void )
+    : mClasses  ( )
+    , mOversize ( )
+    , mMaxCached( BufferPool::DEFAULT_MAX_CACHED )
+{
+    for (uint32_t i = 0; i < BufferPool::SIZE_CLASSES; ++ i)
+    {
+        sSizeClass & entry{ mClasses[i] };
+        entry.scFree = nullptr;
+        entry.scStats = sPoolStatistics{ BufferPool::MIN_BLOCK_SIZE << i, 0u, 0u, 0u, 0u, 0u };
+    }
+
+    mOversize.scFree  = nullptr;
+    mOversize.scStats = sPoolStatistics{ 0u, 0u, 0u, 0u, 0u, 0u };
+}
+
+BufferPool::~BufferPool( void )
+{
+    clearPool();
+}
+
+unsigned char * BufferPool::allocateBlock( uint32_t size, uint32_t & OUT sizeClass )
+{
+    unsigned char * result{ nullptr };
+    sizeClass = BufferPool::getSizeClass(size);
+    if (sizeClass == BufferPool::INVALID_CLASS)
+    {
+        do
+        {
+            Lock lock(mOversize.scLock);
+            ++ mOversize.scStats.psAllocated;
+        } while (false);
+
+        result = DEBUG_NEW unsigned char[size];
+    }
+    else
+    {
+        sSizeClass & entry{ mClasses[sizeClass] };
+        do
+        {
+            Lock lock(entry.scLock);
+            ++ entry.scStats.psAllocated;
+            if (entry.scFree != nullptr)
+            {
+                result = entry.scFree;
+                entry.scFree = _nextFree(result);
+                -- entry.scStats.psCached;
+                ++ entry.scStats.psReused;
+            }
+        } while (false);
+
+        if (result == nullptr)
+        {
+            result = DEBUG_NEW unsigned char[entry.scStats.psBlockSize];
+        }
+    }
+
+    return result;
+}
+
+void BufferPool::releaseBlock( unsigned char * block, uint32_t sizeClass )
+{
+    if (block == nullptr)
+        return;
+
+    if (sizeClass >= BufferPool::SIZE_CLASSES)
+    {
+        do
+        {
+            Lock lock(mOversize.scLock);
+            ++ mOversize.scStats.psDropped;
+        } while (false);
+
+        delete[] block;
+    }
+    else
+    {
+        sSizeClass & entry{ mClasses[sizeClass] };
+        do
+        {
+            Lock lock(entry.scLock);
+            if (entry.scStats.psCached < mMaxCached.load(std::memory_order_relaxed))
+            {
+                _nextFree(block) = entry.scFree;
+                entry.scFree = block;
+                ++ entry.scStats.psCached;
+                ++ entry.scStats.psReleased;
+                block = nullptr;
+            }
+            else
+            {
+                ++ entry.scStats.psDropped;
+            }
+        } while (false);
+
+        if (block != nullptr)
+        {
+            delete[] block;
+        }
+    }
+}
+
+void BufferPool::setMaxCachedBlocks( uint32_t maxCached )
+{
+    mMaxCached.store(maxCached, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < BufferPool::SIZE_CLASSES; ++ i)
+    {
+        _trimClass(mClasses[i], maxCached);
+    }
+}
+
+BufferPool::PoolStatistics BufferPool::getStatistics( void ) const
+{
+    PoolStatistics result;
+    result.reserve(BufferPool::SIZE_CLASSES + 1);
+    for (uint32_t i = 0; i < BufferPool::SIZE_CLASSES; ++ i)
+    {
+        sSizeClass & entry{ const_cast<sSizeClass &>(mClasses[i]) };
+        Lock lock(entry.scLock);
+        result.add(entry.scStats);
+    }
+
+    sSizeClass & oversize{ const_cast<sSizeClass &>(mOversize) };
+    Lock lock(oversize.scLock);
+    result.add(oversize.scStats);
+
+    return result;
+}
+
+void BufferPool::resetStatistics( void )
+{
+    for (uint32_t i = 0; i < BufferPool::SIZE_CLASSES; ++ i)
+    {
+        sSizeClass & entry{ mClasses[i] };
+        Lock lock(entry.scLock);
+        entry.scStats = sPoolStatistics{ entry.scStats.psBlockSize, entry.scStats.psCached, 0u, 0u, 0u, 0u };
+    }
+
+    Lock lock(mOversize.scLock);
+    mOversize.scStats = sPoolStatistics{ 0u, 0u, 0u, 0u, 0u, 0u };
+}
+
+void BufferPool::clearPool( void )
+{
+    for (uint32_t i = 0; i < BufferPool::SIZE_CLASSES; ++ i)
+    {
+        _trimClass(mClasses[i], 0);
+    }
+}
+
+void BufferPool::_trimClass( sSizeClass & entry, uint32_t maxCached )
+{
+    unsigned char * blocks{ nullptr };
+    do
+    {
+        Lock lock(entry.scLock);
+        while (entry.scStats.psCached > maxCached)
+        {
+            unsigned char * block{ entry.scFree };
+            entry.scFree = _nextFree(block);
+            _nextFree(block) = blocks;
+            blocks = block;
+            -- entry.scStats.psCached;
+        }
+    } while (false);
+
+    while (blocks != nullptr)
+    {
+        unsigned char * block{ blocks };
+        blocks = _nextFree(block);
+        delete[] block;
+    }
+}
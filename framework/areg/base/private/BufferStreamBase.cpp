@@ -65,7 +65,9 @@ unsigned int BufferStreamBase::read( IEByteBuffer & buffer ) const
 
         if (read(reinterpret_cast<unsigned char *>(&length), sizeof(unsigned int)) == sizeof(unsigned int))
         {
-            length = buffer.reserve(length, false);
+            // The reserved space can be bigger than the length, read only the data of buffer.
+            unsigned int reserved = buffer.reserve(length, false);
+            length = MACRO_MIN(reserved, length);
             if (length != 0)
             {
                 unsigned char* data = buffer.getBuffer();
@@ -239,7 +241,7 @@ unsigned int BufferStreamBase::insertAt( const unsigned char* buffer, unsigned i
         }
         else
         {
-            unsigned int remain = reserve(writePos + size, true);
+            unsigned int remain = reserve(getGrowSize(writePos + size), true);
             if (remain >= size)
             {
                 ASSERT(isValid());
@@ -270,7 +272,7 @@ unsigned int BufferStreamBase::writeData(const unsigned char* buffer, unsigned i
     ASSERT( (buffer != nullptr) || (size == 0) );
     unsigned int result     = 0;
     unsigned int writePos   = isValid() ? mWritePosition.getPosition() : 0;
-    unsigned int remain     = reserve(writePos + size, true);
+    unsigned int remain     = reserve(getGrowSize(writePos + size), true);
 
     if ((remain != 0) && (size != 0))
     {
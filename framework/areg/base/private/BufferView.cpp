@@ -0,0 +1,112 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/BufferView.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Buffer View class.
+ *              The read-only view of the part of the shared buffer.
+ *
+ ************************************************************************/
+#include "areg/base/BufferView.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// BufferView class implementation
+//////////////////////////////////////////////////////////////////////////
+
+const BufferView BufferView::EmptyView;
+
+BufferView::BufferView( void )
+    : mBuffer   ( )
+    , mData     ( nullptr )
+    , mSize     ( 0 )
+{
+}
+
+BufferView::BufferView( const SharedBuffer & buffer, unsigned int offset, unsigned int size )
+    : mBuffer   ( )
+    , mData     ( nullptr )
+    , mSize     ( 0 )
+{
+    const unsigned int used{ buffer.getSizeUsed() };
+    if (offset < used)
+    {
+        mBuffer = buffer;
+        mData   = mBuffer.getBuffer() + offset;
+        mSize   = MACRO_MIN(size, used - offset);
+    }
+}
+
+BufferView::BufferView( const BufferView & src )
+    : mBuffer   ( src.mBuffer )
+    , mData     ( src.mData )
+    , mSize     ( src.mSize )
+{
+}
+
+BufferView::BufferView( BufferView && src ) noexcept
+    : mBuffer   ( std::move(src.mBuffer) )
+    , mData     ( src.mData )
+    , mSize     ( src.mSize )
+{
+    src.mData   = nullptr;
+    src.mSize   = 0;
+}
+
+BufferView & BufferView::operator = ( const BufferView & src )
+{
+    if (this != &src)
+    {
+        mBuffer = src.mBuffer;
+        mData   = src.mData;
+        mSize   = src.mSize;
+    }
+
+    return (*this);
+}
+
+BufferView & BufferView::operator = ( BufferView && src ) noexcept
+{
+    if (this != &src)
+    {
+        mBuffer = std::move(src.mBuffer);
+        mData   = src.mData;
+        mSize   = src.mSize;
+
+        src.mData   = nullptr;
+        src.mSize   = 0;
+    }
+
+    return (*this);
+}
+
+BufferView BufferView::getView( unsigned int offset, unsigned int size ) const
+{
+    BufferView result;
+    if (offset < mSize)
+    {
+        result.mBuffer  = mBuffer;
+        result.mData    = mData + offset;
+        result.mSize    = MACRO_MIN(size, mSize - offset);
+    }
+
+    return result;
+}
+
+SharedBuffer BufferView::copyBuffer( void ) const
+{
+    return (mSize != 0 ? SharedBuffer(mData, mSize) : SharedBuffer());
+}
+
+void BufferView::release( void )
+{
+    mBuffer.invalidate();
+    mData   = nullptr;
+    mSize   = 0;
+}
@@ -15,9 +15,21 @@
  ************************************************************************/
 #include "areg/base/IEByteBuffer.hpp"
 
+#include <atomic>
 #include <utility>
 #include <string.h>
 
+namespace
+{
+    //!< The maximum size in bytes to grow the byte buffer at once.
+    std::atomic<unsigned int>   _growthLimit{ IEByteBuffer::DEFAULT_GROWTH_LIMIT };
+
+#ifdef DEBUG
+    //!< The number of reallocations, which copied existing data.
+    std::atomic<uint64_t>       _reallocations{ 0 };
+#endif  // DEBUG
+}
+
 //////////////////////////////////////////////////////////////////////////
 // IEByteBuffer class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -61,6 +73,13 @@ unsigned int IEByteBuffer::reserve(unsigned int size, bool copy)
             // If not enough space
             if (size > sizeLength)
             {
+#ifdef DEBUG
+                if (copy && (sizeLength != 0))
+                {
+                    _reallocations.fetch_add(1, std::memory_order_relaxed);
+                }
+#endif  // DEBUG
+
                 unsigned int sizeAlign{ getAlignedSize() };
                 unsigned int sizeBuffer{ getHeaderSize() + size };
 
@@ -127,3 +146,43 @@ unsigned int IEByteBuffer::getAlignedSize(void) const
 {
     return NEMemory::BLOCK_SIZE;
 }
+
+unsigned int IEByteBuffer::getGrowSize(unsigned int size) const
+{
+    unsigned int sizeLength{ isValid() ? mByteBuffer->bufHeader.biLength : 0 };
+    if ((size > sizeLength) && (sizeLength != 0))
+    {
+        // The data is appended, grow geometrically to avoid reallocation on every next write.
+        unsigned int growth{ MACRO_MIN(sizeLength, _growthLimit.load(std::memory_order_relaxed)) };
+        unsigned int grown{ MACRO_MIN(sizeLength + growth, IEByteBuffer::MAX_BUF_LENGTH) };
+        size = MACRO_MAX(size, grown);
+    }
+
+    return size;
+}
+
+void IEByteBuffer::setGrowthLimit(unsigned int growthLimit)
+{
+    _growthLimit.store(MACRO_MIN(growthLimit, IEByteBuffer::MAX_BUF_LENGTH), std::memory_order_relaxed);
+}
+
+unsigned int IEByteBuffer::getGrowthLimit(void)
+{
+    return _growthLimit.load(std::memory_order_relaxed);
+}
+
+uint64_t IEByteBuffer::getReallocationCount(void)
+{
+#ifdef DEBUG
+    return _reallocations.load(std::memory_order_relaxed);
+#else   // DEBUG
+    return 0;
+#endif  // DEBUG
+}
+
+void IEByteBuffer::resetReallocationCount(void)
+{
+#ifdef DEBUG
+    _reallocations.store(0, std::memory_order_relaxed);
+#endif  // DEBUG
+}
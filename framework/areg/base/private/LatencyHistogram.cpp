@@ -0,0 +1,91 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/LatencyHistogram.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Latency Histogram class.
+ *              The lock-free log-linear histogram of the durations.
+ *
+ ************************************************************************/
+#include "areg/base/LatencyHistogram.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// LatencyHistogram class implementation
+//////////////////////////////////////////////////////////////////////////
+
+LatencyHistogram::LatencyHistogram( void )
+    : mBuckets  { }
+    , mMaxValue ( 0u )
+{
+    reset( );
+}
+
+uint64_t LatencyHistogram::getCount( void ) const
+{
+    uint64_t result{ 0u };
+    for (const auto & bucket : mBuckets)
+    {
+        result += bucket.load( std::memory_order_relaxed );
+    }
+
+    return result;
+}
+
+uint64_t LatencyHistogram::getPercentile( double percentile ) const
+{
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total{ 0u };
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++ i)
+    {
+        counts[i] = mBuckets[i].load( std::memory_order_relaxed );
+        total    += counts[i];
+    }
+
+    if (total == 0u)
+        return 0u;
+
+    percentile = MACRO_MAX( 0.0, MACRO_MIN( percentile, 100.0 ) );
+    uint64_t rank{ static_cast<uint64_t>(static_cast<double>(total) * percentile / 100.0 + 0.5) };
+    rank = MACRO_MAX( rank, static_cast<uint64_t>(1u) );
+
+    uint64_t passed{ 0u };
+    uint32_t index{ 0u };
+    for ( ; index < BUCKET_COUNT; ++ index)
+    {
+        passed += counts[index];
+        if (passed >= rank)
+            break;
+    }
+
+    const uint64_t result{ getBucketValue( MACRO_MIN(index, BUCKET_COUNT - 1u) ) };
+    const uint64_t maxValue{ mMaxValue.load( std::memory_order_relaxed ) };
+    return MACRO_MIN( result, maxValue );
+}
+
+void LatencyHistogram::reset( void )
+{
+    for (auto & bucket : mBuckets)
+    {
+        bucket.store( 0u, std::memory_order_relaxed );
+    }
+
+    mMaxValue.store( 0u, std::memory_order_relaxed );
+}
+
+uint64_t LatencyHistogram::getBucketValue( uint32_t index )
+{
+    if (index < SUB_BUCKETS)
+        return index;
+
+    const uint32_t bit{ index / SUB_BUCKETS + SUB_BUCKET_BITS - 1u };
+    const uint64_t sub{ index % SUB_BUCKETS };
+    const uint64_t step{ static_cast<uint64_t>(1u) << (bit - SUB_BUCKET_BITS) };
+    return ((SUB_BUCKETS + sub) * step + step - 1u);
+}
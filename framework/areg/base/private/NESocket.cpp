@@ -64,6 +64,13 @@ namespace NESocket
      */
     int _osSendData(SOCKETHANDLE hSocket, const unsigned char* dataBuffer, int dataLength, int blockMaxSize);
 
+    /**
+     * \brief   OS specific gather send of 2 buffers in one call. All checkups and validations should
+     *          be done before calling the method. The method does not retry partial writes.
+     * \return  Returns number of bytes sent via network or negative value if failed.
+     */
+    int _osSendDataVector(SOCKETHANDLE hSocket, const unsigned char* header, int headerLength, const unsigned char* dataBuffer, int dataLength);
+
     /**
      * \brief   OS specific receive data implementation. All checkups and validations should
      *          be done before calling the method.
@@ -739,6 +746,48 @@ AREG_API_IMPL int NESocket::sendData(SOCKETHANDLE hSocket, const unsigned char*
     return result;
 }
 
+AREG_API_IMPL int NESocket::sendData(SOCKETHANDLE hSocket, const unsigned char* header, uint32_t headerLength, const unsigned char* dataBuffer, uint32_t dataLength, uint32_t blockMaxSize /*= NECommon::DEFAULT_SIZE*/)
+{
+    if ((header == nullptr) || (static_cast<int32_t>(headerLength) <= 0))
+    {
+        return NESocket::sendData(hSocket, dataBuffer, dataLength, blockMaxSize);
+    }
+    else if ((dataBuffer == nullptr) || (static_cast<int32_t>(dataLength) <= 0))
+    {
+        return NESocket::sendData(hSocket, header, headerLength, blockMaxSize);
+    }
+
+    int result = -1;
+    if (isSocketHandleValid(hSocket))
+    {
+        int32_t hdrLen { static_cast<int32_t>(headerLength) };
+        int32_t dataLen{ static_cast<int32_t>(dataLength) };
+        int32_t maxSize{ static_cast<int32_t>(blockMaxSize) != 0 ? static_cast<int32_t>(blockMaxSize) : static_cast<int32_t>(NESocket::getMaxSendSize(hSocket)) };
+
+        // send both buffers in one system call, if the package is not too big.
+        int32_t written{ (hdrLen + dataLen) <= maxSize ? _osSendDataVector(hSocket, header, hdrLen, dataBuffer, dataLen) : 0 };
+        written = MACRO_MAX(written, 0);
+
+        // send the rest of data, if any.
+        result = written;
+        if ((result >= 0) && (written < hdrLen))
+        {
+            int sent = _osSendData(hSocket, header + written, hdrLen - written, maxSize);
+            result = sent < 0 ? -1 : result + sent;
+            written = hdrLen;
+        }
+
+        if ((result >= 0) && (written < (hdrLen + dataLen)))
+        {
+            int offset = written - hdrLen;
+            int sent = _osSendData(hSocket, dataBuffer + offset, dataLen - offset, maxSize);
+            result = sent < 0 ? -1 : result + sent;
+        }
+    }
+
+    return result;
+}
+
 AREG_API_IMPL int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, uint32_t dataLength, uint32_t blockMaxSize )
 {
     int result = -1;
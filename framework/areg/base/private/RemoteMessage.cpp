@@ -18,6 +18,7 @@
  ************************************************************************/
 #include "areg/base/RemoteMessage.hpp"
 
+#include "areg/base/BufferPool.hpp"
 #include "areg/base/NEMemory.hpp"
 #include "areg/base/NEMath.hpp"
 #include "areg/trace/GETrace.h"
@@ -38,17 +39,20 @@ inline unsigned int RemoteMessage::_checksumCalculate( const NEMemory::sRemoteMe
 
 RemoteMessage::RemoteMessage(unsigned int blockSize /*= NEMemory::BLOCK_SIZE*/)
     : SharedBuffer  ( blockSize )
+    , mSharedTarget ( 0 )
 {
 }
 
 RemoteMessage::RemoteMessage(unsigned int reserveSize, unsigned int blockSize)
     : SharedBuffer  ( blockSize )
+    , mSharedTarget ( 0 )
 {
     reserve(reserveSize, false);
 }
 
 RemoteMessage::RemoteMessage(const unsigned char * buffer, unsigned int size, unsigned int blockSize /*= NEMemory::BLOCK_SIZE*/)
     : SharedBuffer  ( blockSize )
+    , mSharedTarget ( 0 )
 {
     reserve(size, false);
     writeData(buffer, size);
@@ -106,7 +110,8 @@ bool RemoteMessage::isChecksumValid(void) const
 
 void RemoteMessage::bufferCompletionFix(void) const
 {
-    if ( isValid() )
+    // the shared data buffer is completed when it is shared and must not be modified.
+    if ( isValid() && (isSharedWithTarget() == false) )
     {
         const NEMemory::sRemoteMessage & msg = _getRemoteMessage();
         const NEMemory::sRemoteMessageHeader & header = msg.rbHeader;
@@ -133,6 +138,7 @@ void RemoteMessage::bufferCompletionFix(void) const
 unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader & rmHeader, unsigned int reserve /*= 0*/ )
 {
     invalidate();
+    mSharedTarget = 0;
 
     reserve = MACRO_MAX(reserve, 1);
     unsigned int sizeUsed   = MACRO_MAX(rmHeader.rbhBufHeader.biUsed, reserve);
@@ -140,7 +146,9 @@ unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader
     unsigned int msgSize    = hdrSize + sizeUsed;
     unsigned int sizeBuffer = MACRO_ALIGN_SIZE(msgSize, mBlockSize);
     unsigned int sizeData   = sizeBuffer - hdrSize;
-    unsigned char * result  = DEBUG_NEW unsigned char[sizeBuffer];
+    uint32_t sizeClass      = BufferPool::INVALID_CLASS;
+    // the buffer returns to the pool when the last shared buffer object releases it.
+    unsigned char * result  = BufferPool::getInstance().allocateBlock(sizeBuffer, sizeClass);
     if ( result != nullptr )
     {
         NEMemory::memZero(result, sizeof(NEMemory::sRemoteMessage));
@@ -159,7 +167,7 @@ unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader
         dst.rbhSequenceNr           = rmHeader.rbhSequenceNr;
         msg->rbData[0]              = static_cast<NEMemory::BufferData>(0);
 
-        mByteBuffer = std::shared_ptr<NEMemory::sByteBuffer>(reinterpret_cast<NEMemory::sByteBuffer *>(msg), ByteBufferDeleter());
+        mByteBuffer = std::shared_ptr<NEMemory::sByteBuffer>(reinterpret_cast<NEMemory::sByteBuffer *>(msg), BufferPool::BlockDeleter{ sizeClass });
     }
 
     return getBuffer();
@@ -194,6 +202,19 @@ RemoteMessage RemoteMessage::clone(const ITEM_ID & source /*= 0*/, const ITEM_ID
     return result;
 }
 
+RemoteMessage RemoteMessage::shareWithTarget(const ITEM_ID & target) const
+{
+    // the target is not part of checksum, calculate once for all targets.
+    if (isSharedWithTarget() == false)
+    {
+        bufferCompletionFix();
+    }
+
+    RemoteMessage result(*this);
+    result.mSharedTarget = target != 0 ? target : getTarget();
+    return result;
+}
+
 unsigned int RemoteMessage::getDataOffset(void) const
 {
     return offsetof(NEMemory::sRemoteMessage, rbData);
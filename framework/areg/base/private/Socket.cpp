@@ -109,6 +109,11 @@ int Socket::sendData( const unsigned char * buffer, int length ) const
     return (isValid() ? NESocket::sendData( *mSocket, buffer, static_cast<uint32_t>(length), static_cast<uint32_t>(mSendSize) ) : -1);
 }
 
+int Socket::sendData( const unsigned char * header, int headerLength, const unsigned char * buffer, int length ) const
+{
+    return (isValid() ? NESocket::sendData( *mSocket, header, static_cast<uint32_t>(headerLength), buffer, static_cast<uint32_t>(length), static_cast<uint32_t>(mSendSize) ) : -1);
+}
+
 int Socket::receiveData( unsigned char * buffer, int length ) const
 {
     return (isValid( ) ? NESocket::receiveData( *mSocket, buffer, static_cast<uint32_t>(length), static_cast<uint32_t>(mRecvSize) ) : -1);
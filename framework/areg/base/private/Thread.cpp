@@ -30,6 +30,29 @@ constexpr std::string_view   DEFAULT_THREAD_PREFIX   { "_AREG_thread_" };
  **/
 constexpr std::string_view   STORAGE_THREAD_CONSUMER { "ThreadConsumer" };
 
+/**
+ * \brief   The thread object hosted by the current system thread.
+ **/
+__THREAD_LOCAL Thread *       _hostedThread           { nullptr };
+
+/**
+ * \brief   The placements configured by thread name.
+ **/
+TEStringMap<Thread::sPlacement> & _configuredPlacements( void )
+{
+    static TEStringMap<Thread::sPlacement> _placements;
+    return _placements;
+}
+
+/**
+ * \brief   The lock to access the configured placements.
+ **/
+ResourceLock & _placementLock( void )
+{
+    static ResourceLock _lock;
+    return _lock;
+}
+
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -148,6 +171,8 @@ Thread::Thread(IEThreadConsumer &threadConsumer, const String & threadName )
     , mThreadAddress    (threadName.isEmpty() == false ? threadName : NEUtilities::generateName(DEFAULT_THREAD_PREFIX.data()))
     , mThreadPriority   (Thread::eThreadPriority::PriorityUndefined)
     , mIsRunning        ( false )
+    , mIsHosted         ( false )
+    , mPlacement        ( )
 
     , mSynchObject      ( )
     , mWaitForRun       (false, false)
@@ -177,6 +202,11 @@ bool Thread::createThread(unsigned int waitForStartMs /* = NECommon::DO_NOT_WAIT
     do 
     {
         Lock  lock(mSynchObject);
+        if (_isValidNoLock() == false)
+        {
+            mIsHosted = false;
+        }
+
         result = _osCreateSystemThread();
     } while (false);
 
@@ -195,13 +225,18 @@ bool Thread::createThread(unsigned int waitForStartMs /* = NECommon::DO_NOT_WAIT
     return result;
 }
 
+bool Thread::waitForThreadRun( unsigned int waitForStartMs /*= NECommon::WAIT_INFINITE*/ )
+{
+    return mWaitForRun.lock( waitForStartMs );
+}
+
 void Thread::triggerExit( void )
 {
 }
 
 Thread::eCompletionStatus Thread::shutdownThread( unsigned int waitForStopMs /* = NECommon::DO_NOT_WAIT */ )
 {
-    Thread::eCompletionStatus result{ _osDestroyThread( waitForStopMs ) };
+    Thread::eCompletionStatus result{ isHosted() ? _destroyHostedThread( waitForStopMs ) : _osDestroyThread( waitForStopMs ) };
 
     if ( mSynchObject.tryLock( ) )
     {
@@ -258,6 +293,62 @@ const ThreadAddress & Thread::getThreadAddress( id_type threadId )
     return (threadObj != nullptr ? threadObj->getAddress() : ThreadAddress::getInvalidThreadAddress());
 }
 
+bool Thread::setPlacement( const Thread::sPlacement & placement )
+{
+    do
+    {
+        Lock lock( mSynchObject );
+        mPlacement = placement;
+        if (mIsHosted)
+            return true;
+    } while (false);
+
+    return (Thread::getCurrentThread() == this ? _applyPlacement() : true);
+}
+
+void Thread::configurePlacement( const String & threadName, const Thread::sPlacement & placement )
+{
+    Lock lock( _placementLock() );
+    if (placement.isEmpty())
+    {
+        _configuredPlacements().removeAt( threadName );
+    }
+    else
+    {
+        _configuredPlacements().setAt( threadName, placement );
+    }
+}
+
+Thread::sPlacement Thread::getConfiguredPlacement( const String & threadName )
+{
+    Lock lock( _placementLock() );
+    Thread::sPlacement result;
+    _configuredPlacements().find( threadName, result );
+    return result;
+}
+
+bool Thread::_applyPlacement( void )
+{
+    Thread::sPlacement placement{ getPlacement() };
+    const Thread::sPlacement configured{ Thread::getConfiguredPlacement( getName() ) };
+    if ( configured.cpuMask != 0u )
+    {
+        placement.cpuMask = configured.cpuMask;
+    }
+
+    if ( configured.policy != Thread::eSchedulingPolicy::PolicyUndefined )
+    {
+        placement.policy = configured.policy;
+    }
+
+    if ( configured.numaNode != Thread::NUMA_NODE_ANY )
+    {
+        placement.numaNode = configured.numaNode;
+    }
+
+    return (placement.isEmpty() || _osApplyPlacement( placement ));
+}
+
 int Thread::_threadEntry( void )
 {
     IEThreadConsumer::eExitCodes result = IEThreadConsumer::eExitCodes::ExitTerminated;
@@ -266,6 +357,7 @@ int Thread::_threadEntry( void )
     {
         Thread::getCurrentThreadStorage().setStorageItem(STORAGE_THREAD_CONSUMER.data(), reinterpret_cast<void *>(&mThreadConsumer));
 
+        _applyPlacement();
         _setRunning(true);
 
         if (onPreRunThread())
@@ -301,7 +393,10 @@ void Thread::_cleanResources(bool unregister)
     mIsRunning      = false;
     mThreadPriority = Thread::eThreadPriority::PriorityUndefined;
 
-    Thread::_osCloseHandle(handle);
+    if (mIsHosted == false)
+    {
+        Thread::_osCloseHandle(handle);
+    }
 }
 
 bool Thread::_registerThread( void )
@@ -310,7 +405,11 @@ bool Thread::_registerThread( void )
     Thread::_getMapThreadName().registerResourceObject(mThreadAddress.getThreadName(), this);
     Thread::_getMapThreadId().registerResourceObject(mThreadId, this);
 
-    _osSetThreadName(mThreadId, mThreadAddress.getThreadName());
+    if (mIsHosted == false)
+    {
+        _osSetThreadName(mThreadId, mThreadAddress.getThreadName());
+    }
+
     return mThreadConsumer.onThreadRegistered(this);
 }
 
@@ -354,6 +453,82 @@ IEThreadConsumer& Thread::getCurrentThreadConsumer( void )
     return (*consumer);
 }
 
+bool Thread::createHostedThread( void )
+{
+    Lock lock(mSynchObject);
+    if (_isValidNoLock())
+        return false;
+
+    // the hosted thread has no system handle and ID, the address of object is unique.
+    mIsHosted       = true;
+    mThreadHandle   = static_cast<THREADHANDLE>(this);
+    mThreadId       = reinterpret_cast<id_type>(this);
+    mThreadPriority = Thread::eThreadPriority::PriorityNormal;
+    mWaitForRun.resetEvent();
+    mWaitForExit.resetEvent();
+
+    if (_registerThread() == false)
+    {
+        _cleanResources(true);
+        mWaitForExit.setEvent();
+        return false;
+    }
+
+    return true;
+}
+
+bool Thread::startHostedThread( void )
+{
+    ASSERT(mIsHosted);
+    if (isValid() == false)
+        return false;
+
+    _setRunning(true);
+    return onPreRunThread();
+}
+
+void Thread::exitHostedThread( void )
+{
+    ASSERT(mIsHosted);
+    _setRunning(false);
+    mThreadConsumer.onThreadExit();
+    onPostExitThread();
+    _cleanResources(true);
+
+    // the last access to the object, the waiting thread may delete it.
+    mWaitForExit.setEvent();
+}
+
+Thread * Thread::hostThread( Thread * hosted )
+{
+    Thread * result{ _hostedThread };
+    _hostedThread = hosted;
+    return result;
+}
+
+Thread * Thread::_getHostedThread( void )
+{
+    return _hostedThread;
+}
+
+Thread::eCompletionStatus Thread::_destroyHostedThread( unsigned int waitForStopMs )
+{
+    do
+    {
+        Lock lock(mSynchObject);
+        if (_isValidNoLock() == false)
+            return Thread::eCompletionStatus::ThreadInvalid;
+
+        _unregisterThread();
+    } while (false);
+
+    if ((waitForStopMs == NECommon::DO_NOT_WAIT) || mWaitForExit.lock(waitForStopMs))
+        return Thread::eCompletionStatus::ThreadCompleted;
+
+    // the job of the hosted thread cannot be cancelled on the system thread of the pool.
+    return Thread::eCompletionStatus::ThreadTerminated;
+}
+
 Thread * Thread::getFirstThread( id_type & OUT threadId )
 {
     return _getMapThreadId().resourceFirstKey( threadId );
@@ -0,0 +1,312 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/WorkStealingPool.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Work Stealing Pool class.
+ *              The fixed size pool of threads running the scheduled tasks.
+ *
+ ************************************************************************/
+#include "areg/base/WorkStealingPool.hpp"
+
+#include "areg/base/IEThreadConsumer.hpp"
+#include "areg/base/TERingStack.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <thread>
+
+namespace
+{
+    //! The initial capacity of the task queue of a thread.
+    constexpr uint32_t  QUEUE_INIT_CAPACITY { 64u };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingPool::PoolWorker class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The thread of the pool with own queue of tasks.
+ **/
+class WorkStealingPool::PoolWorker : public IEThreadConsumer
+{
+public:
+    PoolWorker( WorkStealingPool & pool, uint32_t index );
+
+    virtual ~PoolWorker( void ) = default;
+
+    /**
+     * \brief   Returns the thread of the pool, which is the current thread, or nullptr.
+     **/
+    static PoolWorker *& current( void );
+
+    /**
+     * \brief   Queues the task in the own queue.
+     **/
+    inline void pushTask( IEPoolTask & task );
+
+    /**
+     * \brief   Takes the task from the own queue. Returns nullptr if the queue is empty.
+     **/
+    inline IEPoolTask * popTask( void );
+
+protected:
+    /**
+     * \brief   Runs the tasks until the pool stops.
+     **/
+    virtual void onThreadRuns( void ) override;
+
+public:
+    WorkStealingPool &              mPool;          //!< The pool of the thread.
+    const uint32_t                  mIndex;         //!< The index of the thread in the pool.
+    Thread                          mThread;        //!< The system thread.
+    SpinLock                        mQueueLock;     //!< The lock of the task queue.
+    TENolockRingStack<IEPoolTask *> mQueue;         //!< The task queue.
+    SynchEvent                      mWakeUp;        //!< Signaled to wake up the waiting thread.
+    std::atomic_bool                mIdle;          //!< The flag, indicating that the thread waits for tasks.
+    std::atomic_uint64_t            mTasksRun;      //!< The number of tasks run by the thread.
+    std::atomic_uint64_t            mTasksStolen;   //!< The number of tasks stolen by the thread.
+
+private:
+    inline PoolWorker & self( void )
+    {
+        return (*this);
+    }
+
+    PoolWorker( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( PoolWorker );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingPool::PoolWorker class implementation
+//////////////////////////////////////////////////////////////////////////
+
+WorkStealingPool::PoolWorker::PoolWorker( WorkStealingPool & pool, uint32_t index )
+    : IEThreadConsumer  ( )
+    , mPool         ( pool )
+    , mIndex        ( index )
+    , mThread       ( self(), String(pool.getName()).append('_').append(String::makeString(index)) )
+    , mQueueLock    ( )
+    , mQueue        ( QUEUE_INIT_CAPACITY, NECommon::eRingOverlap::ResizeOnOverlap )
+    , mWakeUp       ( true, true )
+    , mIdle         ( false )
+    , mTasksRun     ( 0u )
+    , mTasksStolen  ( 0u )
+{
+}
+
+WorkStealingPool::PoolWorker *& WorkStealingPool::PoolWorker::current( void )
+{
+    static __THREAD_LOCAL PoolWorker * _currentWorker{ nullptr };
+    return _currentWorker;
+}
+
+inline void WorkStealingPool::PoolWorker::pushTask( IEPoolTask & task )
+{
+    Lock lock( mQueueLock );
+    mQueue.push( &task );
+}
+
+inline IEPoolTask * WorkStealingPool::PoolWorker::popTask( void )
+{
+    Lock lock( mQueueLock );
+    return (mQueue.isEmpty() ? nullptr : mQueue.pop());
+}
+
+void WorkStealingPool::PoolWorker::onThreadRuns( void )
+{
+    PoolWorker::current() = this;
+
+    while (mPool.mExit.load() == false)
+    {
+        IEPoolTask * task = mPool._nextTask( *this );
+        if (task == nullptr)
+        {
+            // announce waiting, then check again to not miss the task scheduled meanwhile.
+            mIdle.store( true );
+            mPool.mIdleCount.fetch_add( 1u );
+            task = mPool._nextTask( *this );
+            if ((task == nullptr) && (mPool.mExit.load() == false))
+            {
+                mWakeUp.lock( NECommon::WAIT_INFINITE );
+                continue;
+            }
+
+            if (mIdle.exchange( false ))
+            {
+                mPool.mIdleCount.fetch_sub( 1u );
+            }
+        }
+
+        if (task != nullptr)
+        {
+            // counted before, the task can be rescheduled or deleted when it runs.
+            mTasksRun.fetch_add( 1u, std::memory_order_relaxed );
+            task->runTask( );
+        }
+    }
+
+    PoolWorker::current() = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+WorkStealingPool::WorkStealingPool( const String & poolName )
+    : mPoolName     ( poolName )
+    , mWorkers      ( )
+    , mExit         ( false )
+    , mIdleCount    ( 0u )
+    , mWorkerCount  ( 0u )
+    , mNextQueue    ( 0u )
+    , mLock         ( )
+{
+}
+
+WorkStealingPool::~WorkStealingPool( void )
+{
+    stopPool( );
+}
+
+bool WorkStealingPool::startPool( uint32_t threadCount )
+{
+    Lock lock( mLock );
+    if (mWorkerCount.load() != 0)
+        return true;
+
+    threadCount = threadCount != 0 ? threadCount : MACRO_MAX(1u, static_cast<uint32_t>(std::thread::hardware_concurrency()));
+    mExit.store( false );
+    mIdleCount.store( 0u );
+    mNextQueue.store( 0u );
+    for (uint32_t i = 0; i < threadCount; ++ i)
+    {
+        mWorkers.add( DEBUG_NEW PoolWorker( *this, i ) );
+    }
+
+    mWorkerCount.store( threadCount );
+    bool result{ true };
+    for (uint32_t i = 0; i < threadCount; ++ i)
+    {
+        result = mWorkers[i]->mThread.createThread( NECommon::WAIT_INFINITE ) && result;
+    }
+
+    return result;
+}
+
+void WorkStealingPool::stopPool( void )
+{
+    Lock lock( mLock );
+    const uint32_t count{ mWorkerCount.load() };
+    if (count == 0)
+        return;
+
+    ASSERT( isPoolThread() == false );
+    mExit.store( true );
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        mWorkers[i]->mIdle.store( false );
+        mWorkers[i]->mWakeUp.setEvent( );
+    }
+
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        mWorkers[i]->mThread.shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    mWorkerCount.store( 0u );
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        delete mWorkers[i];
+    }
+
+    mWorkers.clear( );
+    mIdleCount.store( 0u );
+}
+
+bool WorkStealingPool::scheduleTask( IEPoolTask & task )
+{
+    const uint32_t count{ mWorkerCount.load() };
+    if (count == 0)
+        return false;
+
+    PoolWorker * worker{ PoolWorker::current() };
+    const uint32_t index{ (worker != nullptr) && (&worker->mPool == this) ? worker->mIndex : mNextQueue.fetch_add(1u, std::memory_order_relaxed) % count };
+    mWorkers[index]->pushTask( task );
+
+    // pairs with announcing the waiting thread, either the task is seen or the thread is woken up.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if (mIdleCount.load( std::memory_order_relaxed ) != 0)
+    {
+        _wakeWorker( index );
+    }
+
+    return true;
+}
+
+bool WorkStealingPool::isPoolThread( void ) const
+{
+    PoolWorker * worker{ PoolWorker::current() };
+    return ((worker != nullptr) && (&worker->mPool == this));
+}
+
+uint64_t WorkStealingPool::getTasksRun( void ) const
+{
+    Lock lock( mLock );
+    uint64_t result{ 0u };
+    for (uint32_t i = 0; i < mWorkers.getSize(); ++ i)
+    {
+        result += mWorkers[i]->mTasksRun.load( std::memory_order_relaxed );
+    }
+
+    return result;
+}
+
+uint64_t WorkStealingPool::getTasksStolen( void ) const
+{
+    Lock lock( mLock );
+    uint64_t result{ 0u };
+    for (uint32_t i = 0; i < mWorkers.getSize(); ++ i)
+    {
+        result += mWorkers[i]->mTasksStolen.load( std::memory_order_relaxed );
+    }
+
+    return result;
+}
+
+IEPoolTask * WorkStealingPool::_nextTask( PoolWorker & worker )
+{
+    IEPoolTask * result{ worker.popTask() };
+    const uint32_t count{ mWorkers.getSize() };
+    for (uint32_t i = 1; (result == nullptr) && (i < count); ++ i)
+    {
+        result = mWorkers[(worker.mIndex + i) % count]->popTask();
+        if (result != nullptr)
+        {
+            worker.mTasksStolen.fetch_add( 1u, std::memory_order_relaxed );
+        }
+    }
+
+    return result;
+}
+
+void WorkStealingPool::_wakeWorker( uint32_t hint )
+{
+    const uint32_t count{ mWorkers.getSize() };
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        PoolWorker * worker{ mWorkers[(hint + i) % count] };
+        if (worker->mIdle.load() && worker->mIdle.exchange( false ))
+        {
+            mIdleCount.fetch_sub( 1u );
+            worker->mWakeUp.setEvent( );
+            break;
+        }
+    }
+}
@@ -25,6 +25,7 @@
 #include <sys/socket.h>
 #include <sys/select.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netdb.h>
 #include <errno.h>
@@ -93,6 +94,26 @@ namespace NESocket
         return result;
     }
 
+    int _osSendDataVector(SOCKETHANDLE hSocket, const unsigned char* header, int headerLength, const unsigned char* dataBuffer, int dataLength)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((header != nullptr) && (headerLength > 0));
+        ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+        struct iovec buffers[2];
+        buffers[0].iov_base = const_cast<unsigned char *>(header);
+        buffers[0].iov_len  = static_cast<size_t>(headerLength);
+        buffers[1].iov_base = const_cast<unsigned char *>(dataBuffer);
+        buffers[1].iov_len  = static_cast<size_t>(dataLength);
+
+        struct msghdr msg;
+        NEMemory::memZero(&msg, sizeof(struct msghdr));
+        msg.msg_iov     = buffers;
+        msg.msg_iovlen  = 2;
+
+        return static_cast<int>(::sendmsg(hSocket, &msg, 0));
+    }
+
     int _osRecvData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength, int blockMaxSize)
     {
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
@@ -465,6 +465,11 @@ inline int SynchLockAndWaitIX::_waitCondition( void )
     {
         return ::pthread_cond_wait(&mCondVariable, &mPosixMutex);
     }
+    else if ( (mWaitTimeout == NECommon::DO_NOT_WAIT) && Thread::isCurrentThreadHosted() )
+    {
+        // the pool worker polls on every dispatched event, the expired timed wait would only put it to sleep.
+        return ETIMEDOUT;
+    }
     else
     {
         timespec waitTimeout;
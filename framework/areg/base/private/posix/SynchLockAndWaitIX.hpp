@@ -319,6 +319,8 @@ private:
 
     /**
      * \brief   Called to wait for condition variable. Either it waits with infinite wait flag or with timeout.
+     *          If the timeout is DO_NOT_WAIT and the current thread is a pool worker
+     *          running a hosted thread, returns ETIMEDOUT without waiting.
      * \return  Returns POSIX error code. If 0, the waiting method succeeded.
      **/
     inline int _waitCondition( void );
@@ -33,8 +33,66 @@
 #include <sys/unistd.h>
 #include <sys/types.h>
 
+#if defined(__linux__)
+    #include <stdio.h>
+    #include <sys/syscall.h>
+#endif  // defined(__linux__)
+
 namespace 
 {
+#if defined(__linux__)
+
+    //!< The preferred memory allocation policy of the thread, MPOL_PREFERRED of <numaif.h>
+    constexpr int   MEMORY_POLICY_PREFERRED { 1 };
+
+    //!< The maximum number of NUMA nodes in the memory policy node mask.
+    constexpr int   MEMORY_POLICY_NODES     { 1024 };
+
+    //!< The number of bits in one word of the memory policy node mask.
+    constexpr int   MEMORY_POLICY_WORD_BITS { static_cast<int>(sizeof(unsigned long) * 8) };
+
+    /**
+     * \brief   Reads the list of CPU cores of the NUMA node, like "0-3,8-11",
+     *          and sets the cores in the CPU set. Returns false if failed.
+     **/
+    bool _numaNodeCpuSet( int numaNode, cpu_set_t & OUT cpuSet )
+    {
+        CPU_ZERO( &cpuSet );
+
+        char fileName[64]{ 0 };
+        snprintf( fileName, 64, "/sys/devices/system/node/node%d/cpulist", numaNode );
+        FILE * file = fopen( fileName, "r" );
+        if ( file == nullptr )
+            return false;
+
+        bool result{ false };
+        int first{ -1 };
+        int last{ -1 };
+        char separator{ '\0' };
+        while ( fscanf( file, "%d", &first ) == 1 )
+        {
+            last = first;
+            separator = static_cast<char>(fgetc( file ));
+            if ( (separator == '-') && (fscanf( file, "%d", &last ) == 1) )
+            {
+                separator = static_cast<char>(fgetc( file ));
+            }
+
+            for ( int cpu = MACRO_MAX(first, 0); (cpu <= last) && (cpu < CPU_SETSIZE); ++ cpu )
+            {
+                CPU_SET( cpu, &cpuSet );
+                result = true;
+            }
+
+            if ( separator != ',' )
+                break;
+        }
+
+        fclose( file );
+        return result;
+    }
+
+#endif  // defined(__linux__)
 
     //!< POSIX thread structure
     typedef struct S_PosixThread
@@ -264,4 +322,102 @@ Thread::eThreadPriority Thread::_osSetPriority( eThreadPriority newPriority )
     return oldPrio;
 }
 
+bool Thread::_osApplyPlacement( const Thread::sPlacement & placement )
+{
+    bool result{ true };
+
+#if defined(__linux__)
+
+    cpu_set_t cpuSet;
+    CPU_ZERO( &cpuSet );
+    bool hasCpus{ false };
+    for ( uint32_t cpu = 0; (cpu < Thread::CPU_MASK_CORES) && (cpu < static_cast<uint32_t>(CPU_SETSIZE)); ++ cpu )
+    {
+        if ( (placement.cpuMask & (static_cast<uint64_t>(1u) << cpu)) != 0u )
+        {
+            CPU_SET( cpu, &cpuSet );
+            hasCpus = true;
+        }
+    }
+
+    if ( placement.numaNode != Thread::NUMA_NODE_ANY )
+    {
+        if ( (placement.numaNode >= 0) && (placement.numaNode < MEMORY_POLICY_NODES) )
+        {
+            // the memory of the thread is preferably allocated on the node
+            unsigned long nodeMask[MEMORY_POLICY_NODES / MEMORY_POLICY_WORD_BITS]{ 0 };
+            nodeMask[placement.numaNode / MEMORY_POLICY_WORD_BITS] = 1ul << (placement.numaNode % MEMORY_POLICY_WORD_BITS);
+            result = (RETURNED_OK == ::syscall( SYS_set_mempolicy, MEMORY_POLICY_PREFERRED, nodeMask, static_cast<unsigned long>(MEMORY_POLICY_NODES + 1) ));
+
+            // if no core is set, the thread runs on any core of the node
+            hasCpus = hasCpus || _numaNodeCpuSet( placement.numaNode, cpuSet );
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    if ( hasCpus )
+    {
+        result = (RETURNED_OK == ::pthread_setaffinity_np( ::pthread_self( ), sizeof( cpu_set_t ), &cpuSet )) && result;
+    }
+
+#endif  // defined(__linux__)
+
+    int schedPolicy{ MIN_INT_32 };
+    switch ( placement.policy )
+    {
+    case Thread::eSchedulingPolicy::PolicyNormal:
+        schedPolicy = SCHED_OTHER;
+        break;
+
+#ifdef SCHED_BATCH
+    case Thread::eSchedulingPolicy::PolicyBatch:
+        schedPolicy = SCHED_BATCH;
+        break;
+#endif  // SCHED_BATCH
+
+#ifdef SCHED_IDLE
+    case Thread::eSchedulingPolicy::PolicyIdle:
+        schedPolicy = SCHED_IDLE;
+        break;
+#endif  // SCHED_IDLE
+
+    case Thread::eSchedulingPolicy::PolicyFifo:
+        schedPolicy = SCHED_FIFO;
+        break;
+
+    case Thread::eSchedulingPolicy::PolicyRoundRobin:
+        schedPolicy = SCHED_RR;
+        break;
+
+    default:
+        break;  // do nothing, keep the policy of the process
+    }
+
+    if ( schedPolicy != MIN_INT_32 )
+    {
+        // the real-time policies run with the middle priority, others require priority 0.
+        struct sched_param schedParam;
+        const bool isRealtime{ (schedPolicy == SCHED_FIFO) || (schedPolicy == SCHED_RR) };
+        schedParam.sched_priority = isRealtime ? (sched_get_priority_min( schedPolicy ) + sched_get_priority_max( schedPolicy )) / 2 : 0;
+        result = (RETURNED_OK == ::pthread_setschedparam( ::pthread_self( ), schedPolicy, &schedParam )) && result;
+    }
+
+#ifdef DEBUG
+    if ( result == false )
+    {
+        OUTPUT_ERR("Cannot apply the placement of the thread [ %s ], CPU mask [ %llx ], policy [ %s ], NUMA node [ %d ], error code [ %x ]."
+            , getName().getString()
+            , static_cast<unsigned long long>(placement.cpuMask)
+            , Thread::getString(placement.policy)
+            , placement.numaNode
+            , errno);
+    }
+#endif // DEBUG
+
+    return result;
+}
+
 #endif  // defined(_POSIX) || defined(POSIX)
@@ -118,6 +118,22 @@ namespace NESocket
         return result;
     }
 
+    int _osSendDataVector(SOCKETHANDLE hSocket, const unsigned char* header, int headerLength, const unsigned char* dataBuffer, int dataLength)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((header != nullptr) && (headerLength > 0));
+        ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+        WSABUF buffers[2];
+        buffers[0].len  = static_cast<ULONG>(headerLength);
+        buffers[0].buf  = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(header));
+        buffers[1].len  = static_cast<ULONG>(dataLength);
+        buffers[1].buf  = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(dataBuffer));
+
+        DWORD sent{ 0 };
+        return (::WSASend(hSocket, buffers, 2, &sent, 0, nullptr, nullptr) == 0 ? static_cast<int>(sent) : -1);
+    }
+
     int _osRecvData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength, int blockMaxSize)
     {
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
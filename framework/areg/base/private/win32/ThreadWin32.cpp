@@ -228,4 +228,62 @@ Thread::eThreadPriority Thread::_osSetPriority( eThreadPriority newPriority )
     return oldPrio;
 }
 
+bool Thread::_osApplyPlacement( const Thread::sPlacement & placement )
+{
+    bool result{ true };
+    HANDLE thread{ ::GetCurrentThread( ) };
+
+    if ( placement.numaNode != Thread::NUMA_NODE_ANY )
+    {
+        // the memory is allocated from the node of the CPU, where the thread runs.
+        GROUP_AFFINITY affinity{};
+        if ( ::GetNumaNodeProcessorMaskEx( static_cast<USHORT>(placement.numaNode), &affinity ) == TRUE )
+        {
+            affinity.Mask = placement.cpuMask != 0u ? static_cast<KAFFINITY>(affinity.Mask & placement.cpuMask) : affinity.Mask;
+            result = (affinity.Mask != 0u) && (::SetThreadGroupAffinity( thread, &affinity, nullptr ) == TRUE);
+        }
+        else
+        {
+            result = false;
+        }
+    }
+    else if ( placement.cpuMask != 0u )
+    {
+        result = ::SetThreadAffinityMask( thread, static_cast<DWORD_PTR>(placement.cpuMask) ) != 0u;
+    }
+
+    // Windows has no scheduling policies, they are mapped to the priorities.
+    int Prio = MIN_INT_32;
+    switch ( placement.policy )
+    {
+    case Thread::eSchedulingPolicy::PolicyNormal:
+        Prio = THREAD_PRIORITY_NORMAL;
+        break;
+
+    case Thread::eSchedulingPolicy::PolicyBatch:
+        Prio = THREAD_PRIORITY_BELOW_NORMAL;
+        break;
+
+    case Thread::eSchedulingPolicy::PolicyIdle:
+        Prio = THREAD_PRIORITY_IDLE;
+        break;
+
+    case Thread::eSchedulingPolicy::PolicyFifo:         // fall through
+    case Thread::eSchedulingPolicy::PolicyRoundRobin:
+        Prio = THREAD_PRIORITY_TIME_CRITICAL;
+        break;
+
+    case Thread::eSchedulingPolicy::PolicyUndefined:    // fall through
+    default:
+        break;  // do nothing, keep the priority
+    }
+
+    if ( MIN_INT_32 != Prio )
+    {
+        result = (::SetThreadPriority( thread, Prio ) == TRUE) && result;
+    }
+
+    return result;
+}
+
 #endif  // _WINDOWS
@@ -0,0 +1,226 @@
+#ifndef AREG_COMPONENT_ATTRIBUTEDELTA_HPP
+#define AREG_COMPONENT_ATTRIBUTEDELTA_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/AttributeDelta.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Attribute Delta class.
+ *              Encodes and decodes the changes of serialized attribute data.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/BufferView.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class EventDataStream;
+
+//////////////////////////////////////////////////////////////////////////
+// AttributeDelta class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The image of the last serialized data of an attribute and the
+ *          encoder and decoder of the changes of the data. The Stub keeps the
+ *          image of the data sent to remote Proxies and instead of the whole
+ *          attribute sends the runs of changed bytes. The Proxy keeps the image
+ *          of the received data and applies the runs to restore the data.
+ *          Changing an entry of a large array or map attribute changes only
+ *          the bytes of the entry, so that the delta is small.
+ *
+ *          The delta is either a snapshot with the whole data, or a patch.
+ *          The patch contains the checksum of the image it is based on and
+ *          the checksum of the result. If the Proxy has no image or the
+ *          checksum does not match, the patch cannot be applied and the
+ *          Proxy should request the snapshot.
+ *
+ *          The delta structure:
+ *              snapshot:   [kind] [data]
+ *              patch:      [kind] [base crc] [new size] [new crc] [run count] [runs]
+ *              run:        [old offset] [old length] [new length] [new bytes]
+ **/
+class AREG_API AttributeDelta
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   AttributeDelta::eDeltaType
+     *          The type of the delta.
+     **/
+    enum class eDeltaType : uint8_t
+    {
+          DeltaSnapshot = 1 //!< The delta contains the whole data.
+        , DeltaPatch    = 2 //!< The delta contains the changed runs of bytes.
+    };
+
+    /**
+     * \brief   The number of equal bytes, which split the runs of changed bytes.
+     *          The smaller gaps are sent as a part of the run.
+     **/
+    static constexpr unsigned int   MIN_GAP_SIZE    { 16u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the empty image.
+     **/
+    AttributeDelta( void );
+
+    /**
+     * \brief   Copies the image. The data is not copied.
+     **/
+    AttributeDelta( const AttributeDelta & src ) = default;
+
+    /**
+     * \brief   Moves the image.
+     **/
+    AttributeDelta( AttributeDelta && src ) noexcept = default;
+
+    ~AttributeDelta( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operators
+//////////////////////////////////////////////////////////////////////////
+public:
+    AttributeDelta & operator = ( const AttributeDelta & src ) = default;
+
+    AttributeDelta & operator = ( AttributeDelta && src ) noexcept = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the image has data.
+     **/
+    inline bool hasImage( void ) const;
+
+    /**
+     * \brief   Returns the image of the last encoded or decoded data.
+     **/
+    inline const BufferView & getImage( void ) const;
+
+    /**
+     * \brief   Returns true if the snapshot is requested and the patches are ignored.
+     **/
+    inline bool isSnapshotPending( void ) const;
+
+    /**
+     * \brief   Sets or clears the flag of the requested snapshot.
+     **/
+    inline void setSnapshotPending( bool pending );
+
+    /**
+     * \brief   Releases the image. The next patch cannot be applied.
+     **/
+    void reset( void );
+
+    /**
+     * \brief   Writes the snapshot of the data. Called by Stub when the data
+     *          is sent to a new remote listener. If there is no image, the data
+     *          becomes the image, otherwise the image remains unchanged, because
+     *          other listeners apply the patches to it.
+     * \param   data        The serialized data of the attribute.
+     * \param   out_delta   On output contains the delta to send.
+     * \return  Returns false if the data is empty or is not in one buffer.
+     **/
+    bool encodeSnapshot( const EventDataStream & data, EventDataStream & out_delta );
+
+    /**
+     * \brief   Writes the changes of the data relative to the image and makes
+     *          the data the new image. If there is no image or the patch is not
+     *          smaller than the half of the data, it writes the snapshot.
+     *          Called by Stub when the attribute is updated.
+     * \param   data        The serialized data of the attribute.
+     * \param   out_delta   On output contains the delta to send.
+     * \return  Returns false if the data is empty or is not in one buffer.
+     *          In this case the image is released.
+     **/
+    bool encodeUpdate( const EventDataStream & data, EventDataStream & out_delta );
+
+    /**
+     * \brief   Restores the data from the delta and makes it the new image.
+     *          Called by Proxy when received the delta.
+     * \param   delta       The received delta.
+     * \param   out_data    On output contains the restored serialized data of the attribute.
+     * \return  Returns true if restored the data. Returns false if the delta is invalid,
+     *          the patch is not based on the image or the result does not match the checksum.
+     *          In this case the image is unchanged.
+     **/
+    bool decode( const EventDataStream & delta, EventDataStream & out_data );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Writes the snapshot of the data in the view.
+     **/
+    static void _writeSnapshot( const BufferView & data, EventDataStream & out_delta );
+
+    /**
+     * \brief   Writes the patch to convert the image to the data. Returns false
+     *          if the size of the patch exceeds the specified limit.
+     **/
+    bool _writePatch( const BufferView & data, unsigned int crcData, unsigned int sizeLimit, EventDataStream & out_delta ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The image of the last sent or received data.
+     **/
+    BufferView      mImage;
+
+    /**
+     * \brief   The checksum of the image.
+     **/
+    unsigned int    mChecksum;
+
+    /**
+     * \brief   The flag, indicating that the snapshot is requested.
+     **/
+    bool            mSnapshotPending;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// AttributeDelta class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool AttributeDelta::hasImage( void ) const
+{
+    return (mImage.isEmpty() == false);
+}
+
+inline const BufferView & AttributeDelta::getImage( void ) const
+{
+    return mImage;
+}
+
+inline bool AttributeDelta::isSnapshotPending( void ) const
+{
+    return mSnapshotPending;
+}
+
+inline void AttributeDelta::setSnapshotPending( bool pending )
+{
+    mSnapshotPending = pending;
+}
+
+#endif  // AREG_COMPONENT_ATTRIBUTEDELTA_HPP
@@ -32,8 +32,10 @@
  * Dependencies
  ************************************************************************/
 class IEWorkerThreadConsumer;
+class IEWorkerGroupConsumer;
 class ComponentThread;
 class WorkerThread;
+class WorkerGroup;
 class StubBase;
 
 //////////////////////////////////////////////////////////////////////////
@@ -91,6 +93,12 @@ public:
      **/
     using ListServers           = TELinkedList<StubBase*>;
 
+    /**
+     * \brief   Component::ListWorkerGroups
+     *          The list of Worker Groups of the component.
+     **/
+    using ListWorkerGroups      = TELinkedList<WorkerGroup*>;
+
 /************************************************************************/
 // static functions to load / unload component
 /************************************************************************/
@@ -224,6 +232,17 @@ public:
      **/
     virtual IEWorkerThreadConsumer * workerThreadConsumer( const String & consumerName, const String & workerThreadName );
 
+    /**
+     * \brief   Returns pointer to Worker Group Consumer object identified
+     *          by consumer name and if needed, by worker group name.
+     *          This function is triggered, when component is initialized and
+     *          worker groups should be created.
+     * \param   consumerName        The name of worker group consumer object to identify
+     * \param   workerGroupName     The name of worker group, which consumer should return
+     * \return  Return valid pointer if worker group has assigned consumer.
+     **/
+    virtual IEWorkerGroupConsumer * workerGroupConsumer( const String & consumerName, const String & workerGroupName );
+
 /************************************************************************/
 // Component operations
 /************************************************************************/
@@ -236,9 +255,14 @@ public:
      *                          start and stop functions will be triggered.
      * \param   ownerThread     The component thread, which owns worker thread,
      * \param   watchdogTimeout The watchdog timeout in milliseconds.
+     * \param   placement       The CPU cores, scheduling policy and NUMA node of the worker thread.
      * \return	Pointer to created worker thread object.
      **/
-    WorkerThread * createWorkerThread( const String & threadName, IEWorkerThreadConsumer & consumer, ComponentThread & ownerThread, uint32_t watchdogTimeout );
+    WorkerThread * createWorkerThread( const String & threadName
+                                     , IEWorkerThreadConsumer & consumer
+                                     , ComponentThread & ownerThread
+                                     , uint32_t watchdogTimeout
+                                     , const Thread::sPlacement & placement = Thread::sPlacement() );
 
     /**
      * \brief	Stops and deletes worker thread by given name
@@ -246,6 +270,33 @@ public:
      **/
     void deleteWorkerThread( const String & threadName );
 
+    /**
+     * \brief	Creates and starts Worker Group by given name.
+     * \param	groupName	    Worker group name, used as a prefix of the names of threads.
+     *                          Should be unique within system.
+     * \param   consumer        Worker Group consumer object, notified when the jobs are completed.
+     * \param   ownerThread     The component thread, which owns worker group.
+     * \param   threadCount     The number of threads of the group. If zero, one thread per CPU core.
+     * \return	Pointer to created worker group object.
+     **/
+    WorkerGroup * createWorkerGroup( const String & groupName
+                                   , IEWorkerGroupConsumer & consumer
+                                   , ComponentThread & ownerThread
+                                   , uint32_t threadCount );
+
+    /**
+     * \brief	Stops and deletes worker group by given name
+     * \param	groupName	Worker group name to stop and delete.
+     **/
+    void deleteWorkerGroup( const String & groupName );
+
+    /**
+     * \brief	Returns the worker group of the component by given name.
+     *          Returns nullptr if the component has no worker group with the name.
+     * \param	groupName	Worker group name to search.
+     **/
+    WorkerGroup * findWorkerGroup( const String & groupName ) const;
+
     /**
      * \brief   Call to terminate the component execution and cleanup resources.
      *          After calling this method the component deletes all worker threads,
@@ -350,6 +401,10 @@ private:
      * \brief   List of registered server services
      **/
     Component::ListServers                  mServerList;
+    /**
+     * \brief   List of created worker groups
+     **/
+    Component::ListWorkerGroups             mWorkerGroups;
     /**
      * \brief   Static Resource map of created in system component.
      **/
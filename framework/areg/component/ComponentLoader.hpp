@@ -80,6 +80,62 @@
             __model.addThread(thrEntry);                                                                        \
         }
 
+/**
+ * \brief   Sets the dispatch mode of the component threads of the model.
+ *          This should be called between BEGIN_MODEL and END_MODEL scope,
+ *          outside of the component thread scope. By default, every component
+ *          thread has own system thread. In the pooled mode, the component
+ *          threads are scheduled on the shared pool of dispatching threads.
+ *
+ * \param   dispatch_mode   The dispatch mode of NERegistry::eDispatchMode type.
+ * \param   pool_threads    The number of threads of the shared dispatcher pool.
+ *                          The value 0 creates one thread per CPU core.
+ **/
+#define REGISTER_MODEL_DISPATCH_MODE(dispatch_mode, pool_threads)                                               \
+        /*  Set the dispatch mode of the component threads of the model             */                          \
+        __model.setDispatchMode((dispatch_mode), (pool_threads));
+
+/**
+ * \brief   Sets the dispatch mode of the component thread, which overrides the mode of the model.
+ *          This should be called between BEGIN_REGISTER_THREAD and END_REGISTER_THREAD scope.
+ *
+ * \param   dispatch_mode   The dispatch mode of NERegistry::eDispatchMode type.
+ **/
+#define REGISTER_THREAD_DISPATCH_MODE(dispatch_mode)                                                            \
+            /*  Set the dispatch mode of the component thread                       */                          \
+            thrEntry.mDispatchMode = (dispatch_mode);
+
+/**
+ * \brief   Sets the placement of the component thread: the CPU cores, the scheduling
+ *          policy and the NUMA node. This should be called between BEGIN_REGISTER_THREAD
+ *          and END_REGISTER_THREAD scope, outside of the component scope. The placement
+ *          is ignored if the component thread is dispatched by the pool. The placement
+ *          configured in the configuration file overrides the set attributes.
+ *
+ * \param   cpu_mask        The bit mask of the CPU cores, the bit 0 is the core 0. The value 0 means any core.
+ * \param   sched_policy    The scheduling policy of Thread::eSchedulingPolicy type.
+ * \param   numa_node       The NUMA node to run and allocate memory, or Thread::NUMA_NODE_ANY.
+ **/
+#define REGISTER_THREAD_PLACEMENT(cpu_mask, sched_policy, numa_node)                                            \
+            /*  Set the placement of the component thread                           */                          \
+            thrEntry.mPlacement = Thread::sPlacement{ (cpu_mask), (sched_policy), (numa_node) };
+
+/**
+ * \brief   Sets the policy of the component thread to wait for the events when the queue
+ *          is empty. This should be called between BEGIN_REGISTER_THREAD and END_REGISTER_THREAD
+ *          scope, outside of the component scope. The wait policy is ignored if the component
+ *          thread is dispatched by the pool. Use NECommon::eWaitPolicy::WaitBusyPoll only
+ *          with the thread pinned on an isolated CPU core, see REGISTER_THREAD_PLACEMENT.
+ *
+ * \param   wait_policy     The wait policy of NECommon::eWaitPolicy type.
+ * \param   spin_time       The time in microseconds to spin before blocking, if the policy
+ *                          is NECommon::eWaitPolicy::WaitAdaptive.
+ **/
+#define REGISTER_THREAD_WAIT_POLICY(wait_policy, spin_time)                                                     \
+            /*  Set the wait policy of the component thread                         */                          \
+            thrEntry.mWaitPolicy = (wait_policy);                                                               \
+            thrEntry.mSpinTime   = (spin_time);
+
 /**
  * \brief   Register Component within every Component Thread scope. Extended version
  *          This should be called between BEGIN_REGISTER_THREAD
@@ -177,6 +233,52 @@
                                             , (consumer_name)                                                   \
                                             , (timeout))  );
 
+/**
+ * \brief   Register Worker Thread of the Component with the placement. The same as
+ *          REGISTER_WORKER_THREAD, and additionally sets the CPU cores, the scheduling
+ *          policy and the NUMA node of the worker thread. The placement configured
+ *          in the configuration file overrides the set attributes.
+ *
+ * \param   worker_thread_name  The name of worker thread.
+ * \param   consumer_name       The name of worker thread consumer.
+ * \param   timeout             The watchdog timeout in milliseconds.
+ * \param   cpu_mask            The bit mask of the CPU cores, the bit 0 is the core 0. The value 0 means any core.
+ * \param   sched_policy        The scheduling policy of Thread::eSchedulingPolicy type.
+ * \param   numa_node           The NUMA node to run and allocate memory, or Thread::NUMA_NODE_ANY.
+ **/
+#define REGISTER_WORKER_THREAD_PLACEMENT(worker_thread_name, consumer_name, timeout, cpu_mask, sched_policy, numa_node) \
+                {                                                                                               \
+                    /*  Register component worker thread with the placement         */                          \
+                    NERegistry::WorkerThreadEntry workerEntry(    comEntry.mThreadName.getString()              \
+                                                                , (worker_thread_name)                          \
+                                                                , comEntry.mRoleName.getString()                \
+                                                                , (consumer_name)                               \
+                                                                , (timeout));                                   \
+                    workerEntry.mPlacement = Thread::sPlacement{ (cpu_mask), (sched_policy), (numa_node) };     \
+                    comEntry.addWorkerThread( workerEntry );                                                    \
+                }
+
+/**
+ * \brief   Register worker group if needed by component. Optional.
+ *          The worker group is a fixed number of threads of the component,
+ *          which run the data processing tasks submitted by the component.
+ *          The worker group name should be unique within application.
+ *          This should be called between BEGIN_REGISTER_COMPONENT and
+ *          END_REGISTER_COMPONENT scope.
+ *
+ * \param   worker_group_name   The name of worker group.
+ * \param   consumer_name       The consumer name of worker group. Differentiate consumer
+ *                              names if one component has more than one worker group.
+ * \param   thread_count        The number of threads of the group. The value 0 creates one thread per CPU core.
+ **/
+#define REGISTER_WORKER_GROUP(worker_group_name, consumer_name, thread_count)                                   \
+                /*  Register component worker group                                 */                          \
+                comEntry.addWorkerGroup(      NERegistry::WorkerGroupEntry(comEntry.mThreadName.getString()     \
+                                            , (worker_group_name)                                               \
+                                            , comEntry.mRoleName.getString()                                    \
+                                            , (consumer_name)                                                   \
+                                            , (thread_count))  );
+
 /**
  * \brief   Declare and register component dependency. Optional.
  *          If registered component has dependency on other
@@ -476,6 +578,13 @@ public:
      **/
     static const NERegistry::ComponentThreadEntry & findThreadEntry( const String & threadName );
 
+    /**
+     * \brief   Returns true if the component thread with specified name is registered
+     *          in the Model list and is scheduled on the shared dispatcher pool.
+     * \param   threadName  The name of the component thread name to search.
+     **/
+    static bool isPooledThread( const String & threadName );
+
     /**
      * \brief   Returns true, if Model with specified name is already registered and loaded.
      * \param   modelName   The name of model to check. The name must be unique.
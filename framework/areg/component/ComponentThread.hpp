@@ -24,13 +24,19 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
 
+#include "areg/component/StubAddress.hpp"
 #include "areg/component/private/Watchdog.hpp"
+#include "areg/base/IEPoolTask.hpp"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/base/TEResourceMap.hpp"
 
+#include <atomic>
+
 /************************************************************************
  * Dependencies
  ************************************************************************/
 class Component;
+class WorkStealingPool;
 
 //////////////////////////////////////////////////////////////////////////
 // ComponentThread class declaration
@@ -41,8 +47,17 @@ class Component;
  *          same thread. This ensures that no component function call
  *          and no component data is shared between several threads.
  *          Every component thread can have several component objects.
+ *
+ *          The pooled component thread has no own system thread, it is
+ *          a lightweight actor scheduled on the shared dispatcher pool.
+ *          When it has events, it is scheduled on one of the threads
+ *          of the pool and dispatches the events one by one, so that it
+ *          keeps the single-threaded dispatching of the components.
+ *          The watchdog is ignored by the pooled component thread,
+ *          because the job on the thread of the pool cannot be terminated.
  **/
 class AREG_API ComponentThread  : public    DispatcherThread
+                                , private   IEPoolTask
 {
 //////////////////////////////////////////////////////////////////////////
 // Local types and constants
@@ -54,6 +69,26 @@ private:
      **/
     using ListComponent     = TELinkedList<Component*>;
 
+public:
+    /**
+     * \brief   The maximum number of external events, which the pooled component
+     *          thread dispatches before it lets other pooled threads run.
+     **/
+    static constexpr uint32_t   POOL_DISPATCH_EVENTS    { 64u };
+
+    /**
+     * \brief   ComponentThread::sStartupTimeline
+     *          The startup timeline of the component thread. The timestamps are
+     *          in nanoseconds of the steady clock, the value 0 means not reached yet.
+     **/
+    struct sStartupTimeline
+    {
+        uint64_t    stCreated   { 0u }; //!< The component thread object is created.
+        uint64_t    stStarted   { 0u }; //!< The thread runs and starts creating the components.
+        uint64_t    stRegistered{ 0u }; //!< The components are started and the services are sent for registration.
+        uint64_t    stConnected { 0u }; //!< The first service provider or consumer of the thread is connected.
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Declare as Runtime instance
 //////////////////////////////////////////////////////////////////////////
@@ -87,6 +122,25 @@ public:
      **/
     static bool setCurrentComponent( Component * curComponent );
 
+    /**
+     * \brief   Returns the shared pool of threads, which run the pooled component threads.
+     **/
+    static WorkStealingPool & getDispatcherPool( void );
+
+    /**
+     * \brief   Starts the shared dispatcher pool. If the pool is already started, does nothing.
+     *          The pool is started automatically when the first pooled component thread is created.
+     * \param   threadCount     The number of threads of the pool. If zero, one thread per CPU core.
+     * \return  Returns true if the pool is started.
+     **/
+    static bool startDispatcherPool( uint32_t threadCount );
+
+    /**
+     * \brief   Stops the shared dispatcher pool. Should be called when all pooled
+     *          component threads are completed.
+     **/
+    static void stopDispatcherPool( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -101,8 +155,11 @@ public:
      *                          If timeout is not zero and it expires before the thread processed
      *                          an event, it terminates and restarts the thread again.
      *                          There is no guarantee that terminated thread will make all cleanups properly.
+     *                          Ignored by the pooled component thread.
+     * \param   isPooled        If true, the component thread has no own system thread
+     *                          and is scheduled on the shared dispatcher pool.
      **/
-    explicit ComponentThread( const String & threadName, uint32_t watchdogTimeout = NECommon::WATCHDOG_IGNORE);
+    explicit ComponentThread( const String & threadName, uint32_t watchdogTimeout = NECommon::WATCHDOG_IGNORE, bool isPooled = false );
 
     /**
      * \brief   Destructor
@@ -128,10 +185,50 @@ public:
      **/
     inline uint32_t getWatchdogTimeout(void) const;
 
+    /**
+     * \brief   Returns true if the component thread is scheduled on the shared dispatcher pool.
+     **/
+    inline bool isPooled( void ) const;
+
+    /**
+     * \brief   Returns the startup timeline of the component thread.
+     **/
+    ComponentThread::sStartupTimeline getStartupTimeline( void ) const;
+
+    /**
+     * \brief   Requests to register the service provider. While the components of the
+     *          thread are starting, the services are collected and registered by one
+     *          request when all components are started. Otherwise, the service is
+     *          registered immediately.
+     * \param   server  The address of the started service provider to register.
+     **/
+    void registerServer( const StubAddress & server );
+
+    /**
+     * \brief   Called when a service provider or consumer of the thread is connected.
+     *          On the first connection, saves the time and logs the startup timeline.
+     **/
+    void serviceConnected( void );
+
 /************************************************************************/
 // Thread overrides
 /************************************************************************/
 
+    /**
+     * \brief	Creates and starts the component thread. The pooled component thread
+     *          is registered and scheduled on the shared dispatcher pool, it runs
+     *          as soon as it is created and the waiting time out is ignored.
+     * \param	waitForStartMs	Waiting time out in milliseconds until thread
+     *                          is created and running.
+     * \return	Returns true if the thread is successfully created and started.
+     **/
+    virtual bool createThread( unsigned int waitForStartMs = NECommon::DO_NOT_WAIT ) override;
+
+    /**
+     * \brief   Triggers the exit event of the thread.
+     **/
+    virtual void triggerExit( void ) override;
+
     /**
      * \brief	Shuts down the thread and frees resources. If waiting timeout is not 'DO_NOT_WAIT and it expires,
      *          the function terminates the thread. The shutdown thread can be re-created again.
@@ -190,6 +287,13 @@ protected:
      **/
     virtual bool runDispatcher( void ) override;
 
+    /**
+     * \brief	Triggered by the event queue when the event is pushed or the queue is empty.
+     *          The pooled component thread is scheduled on the dispatcher pool.
+     * \param	eventCount	The number of event elements currently in the queue.
+     **/
+    virtual void signalEvent( uint32_t eventCount ) override;
+
     /**
      * \brief   Search for consumer thread that can dispatch event.
      *          It will check whether component thread has 
@@ -264,6 +368,16 @@ protected:
      **/
     virtual bool dispatchEvent( Event & eventElem ) override;
 
+/************************************************************************/
+// IEPoolTask interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Triggered on the thread of the dispatcher pool to dispatch
+     *          the queued events of the pooled component thread.
+     **/
+    virtual void runTask( void ) override;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -290,6 +404,24 @@ private:
      **/
     inline void _shutdownComponents( void );
 
+    /**
+     * \brief   Schedules the pooled component thread on the dispatcher pool,
+     *          if it is not scheduled yet.
+     **/
+    inline void _schedulePooled( void );
+
+    /**
+     * \brief   Starts the pooled component thread on the thread of the pool.
+     *          Creates and starts the components. Returns true if the thread runs.
+     **/
+    bool _startPooled( void );
+
+    /**
+     * \brief   Creates and starts the components. Called when the thread starts running.
+     *          Returns the number of created components.
+     **/
+    inline int _startComponents( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -308,6 +440,21 @@ private:
      **/
     Watchdog        mWatchdog;
 
+    /**
+     * \brief   The flag, indicating whether the component thread is scheduled on the dispatcher pool.
+     **/
+    const bool      mIsPooled;
+
+    /**
+     * \brief   The flag, indicating whether the pooled component thread started running on the pool.
+     **/
+    bool            mPoolStarted;
+
+    /**
+     * \brief   The flag, indicating whether the started services are collected to register by one request.
+     **/
+    bool            mCollectServers;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
 #endif  // _MSC_VER
@@ -317,6 +464,26 @@ private:
      **/
     ListComponent   mListComponent;
 
+    /**
+     * \brief   The number of signals since the pooled component thread was scheduled.
+     *          The thread is scheduled on the first signal and is not scheduled again
+     *          until it completes dispatching and resets the signals.
+     **/
+    std::atomic_uint32_t    mPoolSignals;
+
+    /**
+     * \brief   The list of started services to register when all components are started.
+     **/
+    TEArrayList<StubAddress>    mRegisterServers;
+
+    /**
+     * \brief   The startup timestamps of the component thread. See ComponentThread::sStartupTimeline.
+     **/
+    const uint64_t          mTimeCreated;
+    std::atomic_uint64_t    mTimeStarted;
+    std::atomic_uint64_t    mTimeRegistered;
+    std::atomic_uint64_t    mTimeConnected;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
@@ -338,4 +505,9 @@ inline uint32_t ComponentThread::getWatchdogTimeout(void) const
     return mWatchdog.getTimeout();
 }
 
+inline bool ComponentThread::isPooled( void ) const
+{
+    return mIsPooled;
+}
+
 #endif  // AREG_COMPONENT_COMPONENTTHREAD_HPP
@@ -0,0 +1,397 @@
+#ifndef AREG_COMPONENT_DISPATCHERSTATISTICS_HPP
+#define AREG_COMPONENT_DISPATCHERSTATISTICS_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/DispatcherStatistics.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Dispatcher Statistics class.
+ *              The queue depth, waiting and running time of the dispatched events.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/LatencyHistogram.hpp"
+#include "areg/base/NECommon.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/TEArrayList.hpp"
+
+#include <atomic>
+#include <chrono>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class Event;
+class EventDispatcherBase;
+
+//////////////////////////////////////////////////////////////////////////
+// DispatcherStatistics class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The always-on statistics of an event dispatcher. The dispatcher
+ *          counts the queued, dispatched, dropped and cancelled events, tracks
+ *          the peak of the queue, and records the time the events wait in the
+ *          queue and the time to process them. The times are recorded in total
+ *          and per event class, where the service request and response events
+ *          are split by the message ID.
+ *          The values are written only by the dispatching thread without locking,
+ *          and can be read by any thread. The statistics of all dispatchers of
+ *          the process are collected by calling collectStatistics().
+ **/
+class AREG_API DispatcherStatistics
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The maximum number of event classes, which statistics are recorded
+     *          separately. The events of other classes are recorded in one entry.
+     **/
+    static constexpr uint32_t   MAX_EVENT_ENTRIES   { 32u };
+
+    /**
+     * \brief   DispatcherStatistics::sEventStatistics
+     *          The statistics of one event class. The times are in nanoseconds.
+     **/
+    struct sEventStatistics
+    {
+        String      esEventName;    //!< The name of the event class, empty for the events of not recorded classes.
+        uint32_t    esMessageId;    //!< The ID of the service message or NEService::INVALID_MESSAGE_ID.
+        uint64_t    esDispatched;   //!< The number of dispatched events.
+        uint64_t    esDeadlineMissed;   //!< The number of events dispatched after their deadline.
+        uint64_t    esWaitMedian;   //!< The median time the events waited in the queue.
+        uint64_t    esWaitP99;      //!< The 99th percentile of the time the events waited in the queue.
+        uint64_t    esWaitMax;      //!< The maximum time an event waited in the queue.
+        uint64_t    esRunMedian;    //!< The median time to process an event.
+        uint64_t    esRunP99;       //!< The 99th percentile of the time to process an event.
+        uint64_t    esRunMax;       //!< The maximum time to process an event.
+    };
+
+    /**
+     * \brief   DispatcherStatistics::sDispatcherStatistics
+     *          The statistics of one dispatcher. The times are in nanoseconds.
+     **/
+    struct sDispatcherStatistics
+    {
+        String      dsDispatcherName;   //!< The name of the dispatcher.
+        NECommon::eWaitPolicy   dsWaitPolicy;   //!< The policy of the dispatcher to wait for the events.
+        uint32_t    dsQueueSize;        //!< The number of events in the queue.
+        uint32_t    dsQueuePeak;        //!< The maximum number of events in the external queue.
+        uint64_t    dsDispatched;       //!< The number of dispatched events.
+        uint64_t    dsDropped;          //!< The number of events, which were not queued, because the dispatcher did not run.
+        uint64_t    dsCancelled;        //!< The number of events removed from the queue without dispatching.
+        uint64_t    dsDeadlineMissed;   //!< The number of events dispatched after their deadline.
+        uint64_t    dsCoalesced;        //!< The number of queued events replaced by the newer event of the same attribute.
+        uint64_t    dsWaitMedian;       //!< The median time the events waited in the queue.
+        uint64_t    dsWaitP99;          //!< The 99th percentile of the time the events waited in the queue.
+        uint64_t    dsWaitMax;          //!< The maximum time an event waited in the queue.
+        uint64_t    dsRunMedian;        //!< The median time to process an event.
+        uint64_t    dsRunP99;           //!< The 99th percentile of the time to process an event.
+        uint64_t    dsRunMax;           //!< The maximum time to process an event.
+        TEArrayList<sEventStatistics>   dsEvents;   //!< The statistics per event class.
+    };
+
+    //!< The list of statistics of dispatchers.
+    using ListStatistics    = TEArrayList<sDispatcherStatistics>;
+
+private:
+    /**
+     * \brief   The statistics of one event class. Declared and implemented in the source file.
+     **/
+    struct EventEntry;
+
+//////////////////////////////////////////////////////////////////////////
+// Statics
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the monotonic timestamp in nanoseconds to measure the times of events.
+     **/
+    static inline uint64_t getTimestamp( void );
+
+    /**
+     * \brief   Collects the statistics of all existing dispatchers of the process.
+     * \param   out_list    On output contains the statistics of the dispatchers.
+     **/
+    static void collectStatistics( DispatcherStatistics::ListStatistics & OUT out_list );
+
+    /**
+     * \brief   Outputs the statistics of all dispatchers of the process as log messages.
+     **/
+    static void logStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the statistics of the dispatcher and registers
+     *          it in the list of the statistics of the process.
+     * \param   dispatcher  The dispatcher, which statistics are collected.
+     **/
+    explicit DispatcherStatistics( EventDispatcherBase & dispatcher );
+
+    /**
+     * \brief   Unregisters the statistics from the list of the process.
+     **/
+    ~DispatcherStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the current statistics of the dispatcher.
+     **/
+    DispatcherStatistics::sDispatcherStatistics getStatistics( void ) const;
+
+    /**
+     * \brief   Returns the number of dispatched events.
+     **/
+    inline uint64_t getDispatched( void ) const;
+
+    /**
+     * \brief   Returns the number of events, which were not queued, because the dispatcher did not run.
+     **/
+    inline uint64_t getDropped( void ) const;
+
+    /**
+     * \brief   Returns the number of events removed from the queue without dispatching.
+     **/
+    inline uint64_t getCancelled( void ) const;
+
+    /**
+     * \brief   Returns the number of events dispatched after their deadline.
+     **/
+    inline uint64_t getDeadlineMissed( void ) const;
+
+    /**
+     * \brief   Returns the maximum number of events in the external queue.
+     **/
+    inline uint32_t getQueuePeak( void ) const;
+
+    /**
+     * \brief   Called when an event is queued in the external queue.
+     * \param   queueSize   The number of events in the queue.
+     **/
+    inline void eventQueued( uint32_t queueSize );
+
+    /**
+     * \brief   Called when an event is not queued, because the dispatcher does not run.
+     **/
+    inline void eventDropped( void );
+
+    /**
+     * \brief   Called when the events are removed from the queue without dispatching.
+     * \param   count   The number of removed events.
+     **/
+    inline void eventsCancelled( uint32_t count );
+
+    /**
+     * \brief   Called by the dispatching thread when an event is processed. Records the time
+     *          the event waited in the queue and the time to process it. If the event has
+     *          a deadline and the dispatcher started to process it later, counts a missed deadline.
+     * \param   eventElem   The processed event.
+     * \param   started     The timestamp when the dispatcher started to process the event.
+     * \param   completed   The timestamp when the event is processed.
+     **/
+    void eventDispatched( const Event & eventElem, uint64_t started, uint64_t completed );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the entry of the event class and message ID. Creates the entry
+     *          if it does not exist. Called only by the dispatching thread.
+     **/
+    EventEntry & _getEventEntry( const Event & eventElem );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The dispatcher, which statistics are collected.
+     **/
+    EventDispatcherBase &   mDispatcher;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The number of dispatched events.
+     **/
+    std::atomic_uint64_t    mDispatched;
+
+    /**
+     * \brief   The number of events, which were not queued.
+     **/
+    std::atomic_uint64_t    mDropped;
+
+    /**
+     * \brief   The number of events removed from the queue without dispatching.
+     **/
+    std::atomic_uint64_t    mCancelled;
+
+    /**
+     * \brief   The number of events dispatched after their deadline.
+     **/
+    std::atomic_uint64_t    mDeadlineMissed;
+
+    /**
+     * \brief   The maximum number of events in the external queue.
+     **/
+    std::atomic_uint32_t    mQueuePeak;
+
+    /**
+     * \brief   The entries of event classes. The entry is created once by the dispatching
+     *          thread and exists until the statistics are destroyed. The last entry
+     *          records the events of the classes, which did not fit in the table.
+     **/
+    std::atomic<EventEntry *>   mEntries[MAX_EVENT_ENTRIES + 1];
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The time the events waited in the queue.
+     **/
+    LatencyHistogram        mWaitTime;
+
+    /**
+     * \brief   The time to process the events.
+     **/
+    LatencyHistogram        mRunTime;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DispatcherStatistics( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( DispatcherStatistics );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// DispatcherStatistics class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline uint64_t DispatcherStatistics::getTimestamp( void )
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline uint64_t DispatcherStatistics::getDispatched( void ) const
+{
+    return mDispatched.load( std::memory_order_relaxed );
+}
+
+inline uint64_t DispatcherStatistics::getDropped( void ) const
+{
+    return mDropped.load( std::memory_order_relaxed );
+}
+
+inline uint64_t DispatcherStatistics::getCancelled( void ) const
+{
+    return mCancelled.load( std::memory_order_relaxed );
+}
+
+inline uint64_t DispatcherStatistics::getDeadlineMissed( void ) const
+{
+    return mDeadlineMissed.load( std::memory_order_relaxed );
+}
+
+inline uint32_t DispatcherStatistics::getQueuePeak( void ) const
+{
+    return mQueuePeak.load( std::memory_order_relaxed );
+}
+
+inline void DispatcherStatistics::eventQueued( uint32_t queueSize )
+{
+    uint32_t peak{ mQueuePeak.load( std::memory_order_relaxed ) };
+    while ((queueSize > peak) && (mQueuePeak.compare_exchange_weak( peak, queueSize, std::memory_order_relaxed ) == false))
+        ;
+}
+
+inline void DispatcherStatistics::eventDropped( void )
+{
+    mDropped.fetch_add( 1u, std::memory_order_relaxed );
+}
+
+inline void DispatcherStatistics::eventsCancelled( uint32_t count )
+{
+    if (count != 0)
+    {
+        mCancelled.fetch_add( count, std::memory_order_relaxed );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// DispatcherStatistics streaming operators
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * \brief   De-serializes the statistics of an event class from the stream.
+ **/
+inline const IEInStream & operator >> ( const IEInStream & stream, DispatcherStatistics::sEventStatistics & input )
+{
+    stream  >> input.esEventName >> input.esMessageId >> input.esDispatched >> input.esDeadlineMissed
+            >> input.esWaitMedian >> input.esWaitP99 >> input.esWaitMax
+            >> input.esRunMedian >> input.esRunP99 >> input.esRunMax;
+    return stream;
+}
+
+/**
+ * \brief   Serializes the statistics of an event class to the stream.
+ **/
+inline IEOutStream & operator << ( IEOutStream & stream, const DispatcherStatistics::sEventStatistics & output )
+{
+    stream  << output.esEventName << output.esMessageId << output.esDispatched << output.esDeadlineMissed
+            << output.esWaitMedian << output.esWaitP99 << output.esWaitMax
+            << output.esRunMedian << output.esRunP99 << output.esRunMax;
+    return stream;
+}
+
+/**
+ * \brief   De-serializes the statistics of a dispatcher from the stream.
+ **/
+inline const IEInStream & operator >> ( const IEInStream & stream, DispatcherStatistics::sDispatcherStatistics & input )
+{
+    uint8_t waitPolicy{ 0u };
+    stream  >> input.dsDispatcherName >> waitPolicy >> input.dsQueueSize >> input.dsQueuePeak
+            >> input.dsDispatched >> input.dsDropped >> input.dsCancelled >> input.dsDeadlineMissed >> input.dsCoalesced
+            >> input.dsWaitMedian >> input.dsWaitP99 >> input.dsWaitMax
+            >> input.dsRunMedian >> input.dsRunP99 >> input.dsRunMax
+            >> input.dsEvents;
+    input.dsWaitPolicy = static_cast<NECommon::eWaitPolicy>(waitPolicy);
+    return stream;
+}
+
+/**
+ * \brief   Serializes the statistics of a dispatcher to the stream.
+ **/
+inline IEOutStream & operator << ( IEOutStream & stream, const DispatcherStatistics::sDispatcherStatistics & output )
+{
+    stream  << output.dsDispatcherName << static_cast<uint8_t>(output.dsWaitPolicy) << output.dsQueueSize << output.dsQueuePeak
+            << output.dsDispatched << output.dsDropped << output.dsCancelled << output.dsDeadlineMissed << output.dsCoalesced
+            << output.dsWaitMedian << output.dsWaitP99 << output.dsWaitMax
+            << output.dsRunMedian << output.dsRunP99 << output.dsRunMax
+            << output.dsEvents;
+    return stream;
+}
+
+#endif  // AREG_COMPONENT_DISPATCHERSTATISTICS_HPP
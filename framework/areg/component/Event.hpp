@@ -369,6 +369,29 @@ public:
      **/
     virtual bool removeEventListener( IEEventConsumer & eventConsumer );
 
+    /**
+     * \brief   Returns the ID of the service message delivered by the event.
+     *          The dispatcher collects the statistics of the events per runtime
+     *          class and per message ID. By default, returns NEService::INVALID_MESSAGE_ID.
+     **/
+    virtual unsigned int getMessageId( void ) const;
+
+    /**
+     * \brief   Returns the key of the event, which replaces the queued and not processed
+     *          event with the same key if the dispatcher coalesces the events with this key.
+     *          The replaced event is destroyed without processing, so that only the latest
+     *          event is dispatched. By default, returns zero and the event is never replaced.
+     **/
+    virtual uint64_t getCoalesceKey( void ) const;
+
+    /**
+     * \brief   Called if the queued event has the same coalescing key as this event.
+     *          The key may be a hash, so that the events of other targets can have the same key.
+     *          Returns true if this event replaces the queued event. By default, returns true.
+     * \param   queuedEvent The queued and not processed event with the same coalescing key.
+     **/
+    virtual bool canReplaceEvent( const Event & queuedEvent ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -448,6 +471,35 @@ public:
      **/
     inline void setEventConsumer( IEEventConsumer * consumer );
 
+    /**
+     * \brief   Returns the timestamp in nanoseconds when the event was queued in the
+     *          dispatcher. Returns zero if the event was not queued.
+     **/
+    inline uint64_t getQueuedTime( void ) const;
+    /**
+     * \brief   Sets the timestamp in nanoseconds when the event was queued in the dispatcher.
+     **/
+    inline void setQueuedTime( uint64_t queuedTime );
+
+    /**
+     * \brief   Returns the timestamp in nanoseconds of the steady clock until which the
+     *          event should be dispatched. Returns zero if the event has no deadline.
+     *          The events of the same priority with a deadline are dispatched in the
+     *          order of their deadlines before the events without deadline.
+     **/
+    inline uint64_t getDeadline( void ) const;
+    /**
+     * \brief   Sets the timestamp in nanoseconds of the steady clock until which the
+     *          event should be dispatched. Set zero to remove the deadline.
+     **/
+    inline void setDeadline( uint64_t deadline );
+    /**
+     * \brief   Sets the deadline of the event relative to the current time.
+     * \param   timeoutUs   The time in microseconds, during which the event should be dispatched.
+     *                      Set zero to remove the deadline.
+     **/
+    void setDeadlineTimeout( unsigned int timeoutUs );
+
     /**
      * \brief   Checks whether the given event type is internal or not.
      * \param   eventType   The event type to check.
@@ -478,6 +530,12 @@ public:
      **/
     inline static bool isCustom( Event::eEventType eventType );
 
+    /**
+     * \brief   Checks whether the given event type is sent to the proxy or not.
+     * \param   eventType   The event type to check.
+     **/
+    inline static bool isProxyEvent( Event::eEventType eventType );
+
     /**
      * \brief   Returns true, if event is internal, i.e. should be queued in internal event queue
      **/
@@ -543,6 +601,14 @@ protected:
      * \brief   Target thread.
      **/
     DispatcherThread*   mTargetThread;
+    /**
+     * \brief   The timestamp in nanoseconds when the event was queued.
+     **/
+    uint64_t            mQueuedTime;
+    /**
+     * \brief   The timestamp in nanoseconds until which the event should be dispatched.
+     **/
+    uint64_t            mDeadline;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls.
@@ -577,6 +643,26 @@ inline void Event::setEventConsumer( IEEventConsumer * consumer )
     mConsumer = consumer;
 }
 
+inline uint64_t Event::getQueuedTime( void ) const
+{
+    return mQueuedTime;
+}
+
+inline void Event::setQueuedTime( uint64_t queuedTime )
+{
+    mQueuedTime = queuedTime;
+}
+
+inline uint64_t Event::getDeadline( void ) const
+{
+    return mDeadline;
+}
+
+inline void Event::setDeadline( uint64_t deadline )
+{
+    mDeadline = deadline;
+}
+
 inline bool Event::isInternal( Event::eEventType eventType )
 {
     return (static_cast<unsigned int>(eventType) & static_cast<unsigned int>(Event::eEventType::EventInternal)) != 0;
@@ -602,6 +688,11 @@ inline bool Event::isCustom( Event::eEventType eventType )
     return (static_cast<unsigned int>(eventType) & static_cast<unsigned int>(Event::eEventType::EventCustom)) != 0;
 }
 
+inline bool Event::isProxyEvent( Event::eEventType eventType )
+{
+    return (static_cast<unsigned int>(eventType) & static_cast<unsigned int>(Event::eEventType::EventToProxy)) != 0;
+}
+
 inline bool Event::isInternal(void) const
 {
     return Event::isInternal(mEventType);
@@ -23,6 +23,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/base/IEIOStream.hpp"
 
+#include "areg/base/BufferView.hpp"
 #include "areg/base/SharedBuffer.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/TEStack.hpp"
@@ -69,6 +70,34 @@ public:
 
     } eEventData;
 
+    /**
+     * \brief   EventDataStream::SharedSourceScope
+     *          While the object exists, the event data streams, which are
+     *          initialized in the calling thread from the given shared buffer,
+     *          reference the data of the buffer instead of copying it,
+     *          if the data is the last entry in the buffer. Used to create
+     *          the events of received remote messages without copying the data.
+     *          The referenced data is copied only if it is modified.
+     **/
+    class AREG_API SharedSourceScope
+    {
+    public:
+        /**
+         * \brief   Sets the shared buffer to reference the data.
+         **/
+        explicit SharedSourceScope( const SharedBuffer & source );
+
+        /**
+         * \brief   Restores the previous shared buffer.
+         **/
+        ~SharedSourceScope( void );
+
+    private:
+        const SharedBuffer * mPrevSource;   //!< The previous shared buffer of the thread.
+
+        DECLARE_NOCOPY_NOMOVE( SharedSourceScope );
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -170,6 +199,31 @@ public:
      **/
     inline IEOutStream & getStreamForWrite( void );
 
+    /**
+     * \brief   Returns true if the data references the buffer of the source,
+     *          from which the event data stream was initialized.
+     **/
+    inline bool isSharedSource( void ) const;
+
+    /**
+     * \brief   Gets the read-only view of the serialized data without copying it.
+     *          The data of the received remote events references the buffer of
+     *          the received message. The view cannot be created, if the data of
+     *          the local event contains the shared buffers, which are passed
+     *          by reference instead of serializing them.
+     * \param   out_view    On output, contains the view of the data.
+     * \return  Returns true if the data is not empty and the view is created.
+     **/
+    bool getDataView( BufferView & out_view ) const;
+
+    /**
+     * \brief   Reserves the space in bytes in the data buffer to stream data.
+     *          Call before streaming the parameters to avoid the reallocation
+     *          of the buffer on every written parameter.
+     * \param   size    The size in bytes to reserve.
+     **/
+    inline void reserve( unsigned int size );
+
 /************************************************************************/
 // IEInStream interface overrides
 /************************************************************************/
@@ -287,6 +341,27 @@ protected:
      **/
     virtual unsigned int getSizeWritable( void ) const override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Reads the data buffer from the stream. Within SharedSourceScope
+     *          references the data of the source instead of copying it.
+     **/
+    void _readData( const IEInStream & stream );
+
+    /**
+     * \brief   Writes the data buffer to the stream.
+     **/
+    void _writeData( IEOutStream & stream ) const;
+
+    /**
+     * \brief   If the data references the buffer of the source, copies the data
+     *          to own buffer. Called before the data is modified.
+     **/
+    void _detachSource( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -307,6 +382,12 @@ protected:
      **/
     mutable SharedBuffer        mDataBuffer;
 
+    /**
+     * \brief   The offset of the data in the data buffer. It is not zero,
+     *          if the data buffer references the buffer of the source.
+     **/
+    unsigned int                mDataBegin;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
 #endif  // _MSC_VER
@@ -330,7 +411,7 @@ IMPLEMENT_STREAMABLE(EventDataStream::eEventData)
 
 inline bool EventDataStream::isEmpty( void ) const
 {
-    return (mDataBuffer.isEmpty() && mSharedList.isEmpty());
+    return ((mDataBuffer.getSizeUsed() == mDataBegin) && mSharedList.isEmpty());
 }
 
 inline bool EventDataStream::isExternalDataStream( void ) const
@@ -348,11 +429,22 @@ inline IEOutStream & EventDataStream::getStreamForWrite( void )
     return static_cast<IEOutStream &>(*this);
 }
 
+inline bool EventDataStream::isSharedSource( void ) const
+{
+    return (mDataBegin != 0);
+}
+
+inline void EventDataStream::reserve( unsigned int size )
+{
+    _detachSource();
+    mDataBuffer.reserve(size, true);
+}
+
 inline const IEInStream & operator >> ( const IEInStream & stream, EventDataStream & input )
 {
     stream >> input.mEventDataType;
     stream >> input.mBufferName;
-    stream >> input.mDataBuffer;
+    input._readData(stream);
     return stream;
 }
 
@@ -361,7 +453,7 @@ inline IEOutStream & operator << ( IEOutStream & stream, const EventDataStream &
     ASSERT(output.mEventDataType != EventDataStream::eEventData::EventDataInternal);
     stream << EventDataStream::eEventData::EventDataExternal;
     stream << output.mBufferName;
-    stream << output.mDataBuffer;
+    output._writeData(stream);
     return stream;
 }
 
@@ -0,0 +1,121 @@
+#ifndef AREG_COMPONENT_IEWORKERGROUPCONSUMER_HPP
+#define AREG_COMPONENT_IEWORKERGROUPCONSUMER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/IEWorkerGroupConsumer.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Worker Group Consumer.
+ *              This object is notified in the component thread
+ *              when the job submitted to the Worker Group is completed.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include "areg/base/String.hpp"
+#include "areg/component/WorkerGroup.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// IEWorkerGroupConsumer class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Worker Group Consumer is required by Worker Group to notify
+ *          the completion of the submitted jobs. The notification is
+ *          triggered in the component thread, which owns the group,
+ *          so that the consumer does not need to synchronize the access
+ *          to the data of the component. Each consumer should have name
+ *          to differentiate the consumers if a component has more than
+ *          one worker group.
+ **/
+class AREG_API IEWorkerGroupConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   Creates consumer object and sets name.
+     * \param   consumerName    The name of consumer bind to worker group.
+     **/
+    explicit IEWorkerGroupConsumer( const String & consumerName );
+
+public:
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~IEWorkerGroupConsumer( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns Consumer name of Worker Group.
+     **/
+    inline const String & getConsumerName( void ) const;
+
+    /**
+     * \brief   Compares passed name with the name of consumer
+     *          and returns true if names are equal.
+     * \param   consumerName    The name to check.
+     * \return  Returns true if passed name is the name of consumer.
+     **/
+    inline bool isEqualName( const String & consumerName ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Override operations
+//////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// IEWorkerGroupConsumer overrides
+/************************************************************************/
+
+    /**
+     * \brief   Triggered in the component thread when all tasks of the job
+     *          submitted to the Worker Group are completed.
+     * \param   workerGroup The Worker Group, which completed the job.
+     * \param   result      The ID of the job, the number of tasks and the times to complete the job.
+     **/
+    virtual void onWorkerJobCompleted( WorkerGroup & workerGroup, const WorkerGroup::sJobResult & result ) = 0;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The name of consumer. Is a fixed name and cannot be changed
+     **/
+    const String    mConsumerName;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    IEWorkerGroupConsumer( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( IEWorkerGroupConsumer );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// IEWorkerGroupConsumer class inline function implementation
+//////////////////////////////////////////////////////////////////////////
+inline const String & IEWorkerGroupConsumer::getConsumerName( void ) const
+{
+    return mConsumerName;
+}
+
+inline bool IEWorkerGroupConsumer::isEqualName( const String & consumerName ) const
+{
+    return (mConsumerName == consumerName);
+}
+
+#endif  // AREG_COMPONENT_IEWORKERGROUPCONSUMER_HPP
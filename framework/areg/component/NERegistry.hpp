@@ -26,6 +26,7 @@
 #include "areg/base/String.hpp"
 #include "areg/base/NEMemory.hpp"
 #include "areg/base/NEUtilities.hpp"
+#include "areg/base/Thread.hpp"
 
 /************************************************************************
  * Declared classes
@@ -38,6 +39,7 @@ namespace NERegistry
     class ComponentThreadList;
     class WorkerThreadEntry;
     class WorkerThreadList;
+    class WorkerGroupEntry;
     class DependencyEntry;
     class DependencyList;
     class ComponentEntry;
@@ -53,11 +55,12 @@ namespace NERegistry
  *              4. ComponentThreadList;
  *              5. WorkerThreadEntry;
  *              6. WorkerThreadList;
- *              7. DependencyEntry;
- *              8. DependencyList;
- *              9. ComponentEntry;
- *             10. ComponentList;
- *             11. Model;
+ *              7. WorkerGroupEntry;
+ *              8. DependencyEntry;
+ *              9. DependencyList;
+ *             10. ComponentEntry;
+ *             11. ComponentList;
+ *             12. Model;
  *          These classes are declared as part of Registry and used when
  *          Model is defined and created, where object have descriptions
  *          of Service Interfaces, Components, Threads and dependencies.
@@ -101,6 +104,16 @@ typedef void            (*FuncDeleteComponent)  (Component & /*componentItem*/,
  **/
 namespace NERegistry
 {
+    /**
+     * \brief   NERegistry::eDispatchMode
+     *          Defines how the component thread dispatches the events.
+     **/
+    enum class eDispatchMode    : uint8_t
+    {
+          DispatchDefault   = 0 //!< The thread uses the dispatch mode of the model.
+        , DispatchThread    = 1 //!< The thread has own system thread, which waits and dispatches the events.
+        , DispatchPooled    = 2 //!< The thread is scheduled on the shared dispatcher pool when it has events.
+    };
 
 //////////////////////////////////////////////////////////////////////////
 // NERegistry::ServiceEntry class declaration
@@ -430,6 +443,10 @@ namespace NERegistry
          * \brief   The watchdog timeout in milliseconds.
          **/
         uint32_t    mWatchdogTimeout;
+        /**
+         * \brief   The CPU cores, scheduling policy and NUMA node of the Worker Thread.
+         **/
+        Thread::sPlacement  mPlacement;
    };
 
     //////////////////////////////////////////////////////////////////////////
@@ -551,6 +568,104 @@ namespace NERegistry
 #endif  // _MSC_VER
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // NERegistry::WorkerGroupEntry class declaration
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   NERegistry::WorkerGroupEntry, defines the Worker Group of the Component.
+     *          The Worker Group is a fixed number of threads sharing the work stealing
+     *          queue of tasks, which are submitted by the Component. The Worker Groups
+     *          are created when Component is created.
+     **/
+    class AREG_API WorkerGroupEntry
+    {
+    //////////////////////////////////////////////////////////////////////////
+    // NERegistry::WorkerGroupEntry class, Constructors / Destructor
+    //////////////////////////////////////////////////////////////////////////
+    public:
+        /**
+         * \brief   Creates invalid Worker Group Entry.
+         **/
+        WorkerGroupEntry( void );
+
+        /**
+         * \brief   Initialize Worker Group Entry by given name and specifying the name of Master Thread.
+         *          The Master Thread is the thread where Component is registered and created,
+         *          and where the results of the tasks are delivered.
+         * \param   masterThreadName    The name of Master Thread where Component is created and running.
+         * \param   workerGroupName     The name of Worker Group of Component. The name should be unique.
+         * \param   compRoleName        The name of Component (Role Name) where consumer is registered.
+         * \param   compConsumerName    The name of Consumer object of the Worker Group.
+         * \param   threadCount         The number of threads of the Worker Group. If zero, one thread per CPU core.
+         **/
+        WorkerGroupEntry( const String & masterThreadName
+                        , const String & workerGroupName
+                        , const String & compRoleName
+                        , const String & compConsumerName
+                        , uint32_t threadCount );
+
+        /**
+         * \brief   Copies /move entries from source.
+         **/
+        WorkerGroupEntry( const NERegistry::WorkerGroupEntry & src ) = default;
+        WorkerGroupEntry( NERegistry::WorkerGroupEntry && src ) noexcept = default;
+
+        /**
+         * \brief   Destructor
+         **/
+        ~WorkerGroupEntry( void ) = default;
+
+    //////////////////////////////////////////////////////////////////////////
+    // NERegistry::WorkerGroupEntry class, Operators
+    //////////////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief   Copies / moves Worker Group Entry data from given source.
+         **/
+        NERegistry::WorkerGroupEntry & operator = ( const NERegistry::WorkerGroupEntry & src ) = default;
+        NERegistry::WorkerGroupEntry & operator = ( NERegistry::WorkerGroupEntry && src ) noexcept = default;
+
+        /**
+         * \brief   Checks equality of two Worker Group Entries and returns true if they are equal.
+         *          It compares Worker Group name and Consumer Name.
+         * \param   other   The Worker Group Entry to compare.
+         **/
+        bool operator == ( const NERegistry::WorkerGroupEntry & other ) const;
+        bool operator != ( const NERegistry::WorkerGroupEntry & other ) const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // NERegistry::WorkerGroupEntry class, Attributes
+    //////////////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief   Returns true if Worker Group Entry is valid.
+         *          The Entry is valid if neither Worker Group nor Consumer names are empty.
+         **/
+        bool isValid( void ) const;
+
+    //////////////////////////////////////////////////////////////////////////
+    // NERegistry::WorkerGroupEntry class, Member variables.
+    //////////////////////////////////////////////////////////////////////////
+    public:
+        /**
+         * \brief   The name of Worker Group
+         **/
+        String      mGroupName;
+        /**
+         * \brief   The name of Worker Group Consumer.
+         **/
+        String      mConsumerName;
+        /**
+         * \brief   The number of threads of Worker Group. If zero, one thread per CPU core.
+         **/
+        uint32_t    mThreadCount;
+    };
+
+    /**
+     * \brief   NERegistry::WorkerGroupList. Defines list of Worker Group Entries.
+     **/
+    using WorkerGroupList   = TEArrayList<NERegistry::WorkerGroupEntry>;
+
     //////////////////////////////////////////////////////////////////////////
     // NERegistry::DependencyEntry class declaration
     //////////////////////////////////////////////////////////////////////////
@@ -1000,6 +1115,21 @@ namespace NERegistry
          **/
         bool removeWorkerThread( const String & workerName );
 
+        /**
+         * \brief   Adds Worker Group Entry in Component Entry object,
+         *          if the Worker Group with the same name does not exist.
+         * \param   entry   The Worker Group Entry to add.
+         **/
+        void addWorkerGroup( const NERegistry::WorkerGroupEntry & entry );
+
+        /**
+         * \brief   Searches Worker Group Entry by the name.
+         * \param   groupName   The name of Worker Group to search.
+         * \return  If Entry found, returns valid zero-based index of element.
+         *          Otherwise, returns -1.
+         **/
+        int findWorkerGroup( const String & groupName ) const;
+
         /**
          * \brief   Adds Dependency Entry in Component Entry object.
          *          The Dependency Entry is defining Client part of Server Component,
@@ -1076,6 +1206,11 @@ namespace NERegistry
          **/
         const NERegistry::WorkerThreadList & getWorkerThreads( void ) const;
 
+        /**
+         * \brief   Returns list of Worker Groups of Component Entry object
+         **/
+        const NERegistry::WorkerGroupList & getWorkerGroups( void ) const;
+
         /**
          * \brief   Returns list of Dependencies of Component Entry object
          **/
@@ -1131,6 +1266,16 @@ namespace NERegistry
          * \brief   List of worker threads
          **/
         WorkerThreadList    mWorkerThreads;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+        /**
+         * \brief   List of worker groups
+         **/
+        WorkerGroupList     mWorkerGroups;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
         /**
          * \brief   List of dependencies
          **/
@@ -1482,6 +1627,28 @@ namespace NERegistry
          * \brief   The watchdog timeout in milliseconds.
          **/
         uint32_t        mWatchdogTimeout;
+
+        /**
+         * \brief   The dispatch mode of the thread. By default, the mode of the model.
+         **/
+        eDispatchMode   mDispatchMode;
+
+        /**
+         * \brief   The CPU cores, scheduling policy and NUMA node of the thread.
+         *          Ignored if the thread is dispatched by the pool.
+         **/
+        Thread::sPlacement  mPlacement;
+
+        /**
+         * \brief   The policy to wait for the events when the queue of the thread is empty.
+         *          Ignored if the thread is dispatched by the pool.
+         **/
+        NECommon::eWaitPolicy   mWaitPolicy;
+
+        /**
+         * \brief   The time in microseconds, which the thread with the adaptive wait policy spins before it blocks.
+         **/
+        uint32_t        mSpinTime;
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -1816,6 +1983,40 @@ namespace NERegistry
          **/
         inline TIME64 getAliveDuration( void ) const;
 
+        /**
+         * \brief   Sets the dispatch mode of the component threads of the model,
+         *          which have the default dispatch mode. The threads of the model
+         *          have own system threads, unless set the pooled dispatch mode.
+         * \param   dispatchMode    The dispatch mode of the threads. The default mode
+         *                          is the same as NERegistry::eDispatchMode::DispatchThread.
+         * \param   poolThreads     The number of threads of the shared dispatcher pool.
+         *                          If zero, the pool creates one thread per CPU core.
+         **/
+        inline void setDispatchMode( NERegistry::eDispatchMode dispatchMode, uint32_t poolThreads = 0u );
+
+        /**
+         * \brief   Returns the dispatch mode of the component threads of the model.
+         **/
+        inline NERegistry::eDispatchMode getDispatchMode( void ) const;
+
+        /**
+         * \brief   Returns the number of threads of the shared dispatcher pool.
+         *          The value zero means one thread per CPU core.
+         **/
+        inline uint32_t getDispatchPoolThreads( void ) const;
+
+        /**
+         * \brief   Returns true if the given component thread of the model is scheduled
+         *          on the shared dispatcher pool.
+         **/
+        inline bool isPooledThread( const NERegistry::ComponentThreadEntry & entry ) const;
+
+        /**
+         * \brief   Returns true if at least one component thread of the model is scheduled
+         *          on the shared dispatcher pool.
+         **/
+        bool hasPooledThreads( void ) const;
+
     //////////////////////////////////////////////////////////////////////////
     // NERegistry::Model class, Member variables
     //////////////////////////////////////////////////////////////////////////
@@ -1839,6 +2040,16 @@ namespace NERegistry
          * \brief   The duration of time where model was loaded and alive.
          **/
         NEUtilities::Duration   mAliveDuration;
+
+        /**
+         * \brief   The dispatch mode of the component threads.
+         **/
+        eDispatchMode           mDispatchMode;
+
+        /**
+         * \brief   The number of threads of the shared dispatcher pool.
+         **/
+        uint32_t                mPoolThreads;
     };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1936,4 +2147,26 @@ inline TIME64 NERegistry::Model::getAliveDuration( void ) const
     return (mLoadState == eModelState::ModelInitialized ? 0 : mAliveDuration.durationSinceStart());
 }
 
+inline void NERegistry::Model::setDispatchMode( NERegistry::eDispatchMode dispatchMode, uint32_t poolThreads /*= 0u*/ )
+{
+    mDispatchMode   = dispatchMode != NERegistry::eDispatchMode::DispatchDefault ? dispatchMode : NERegistry::eDispatchMode::DispatchThread;
+    mPoolThreads    = poolThreads;
+}
+
+inline NERegistry::eDispatchMode NERegistry::Model::getDispatchMode( void ) const
+{
+    return mDispatchMode;
+}
+
+inline uint32_t NERegistry::Model::getDispatchPoolThreads( void ) const
+{
+    return mPoolThreads;
+}
+
+inline bool NERegistry::Model::isPooledThread( const NERegistry::ComponentThreadEntry & entry ) const
+{
+    const NERegistry::eDispatchMode mode{ entry.mDispatchMode != NERegistry::eDispatchMode::DispatchDefault ? entry.mDispatchMode : mDispatchMode };
+    return (mode == NERegistry::eDispatchMode::DispatchPooled);
+}
+
 #endif  // AREG_COMPONENT_NEREGISTRY_HPP
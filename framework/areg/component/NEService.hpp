@@ -91,6 +91,7 @@ namespace NEService
         /* data update result */
         , DataOK            = 16512 /*0x4080*/  //!< indicates data validation.             Bits: 0100 0000 1000 0000
         , DataInvalid       = 16449 /*0x4041*/  //!< indicates data invalid.                Bits: 0100 0000 0100 0001
+        , DataDelta         = 16514 /*0x4082*/  //!< indicates changes of valid data.       Bits: 0100 0000 1000 0010
 
         /* service call result */
         , ServiceOK         = 32896 /*0x8080*/  //!< service call processed.                Bits: 1000 0000 1000 0000
@@ -249,6 +250,7 @@ namespace NEService
         , UnregisterClient  = 0x0011    //!< Client requests to unregister.         Bit set: 0001 0001
         , RegisterStub      = 0x0020    //!< Server requests to register.           Bit set: 0010 0000
         , UnregisterStub    = 0x0021    //!< Server requests to unregister.         Bit set: 0010 0001
+        , RegisterServices  = 0x0030    //!< Servers and clients request to register in one message. Bit set: 0011 0000
     } eServiceRequestType;
     
     /**
@@ -517,6 +519,12 @@ namespace NEService
         , ServiceLogConfigurationSaved
         //!< Sent by logger service or client applications to log the messages.
         , ServiceLogMessage
+        //!< Sent by log observer to set the filters of log messages to forward.
+        , ServiceLogFilterMessages
+        //!< Sent by log observer to the client applications to query the statistics of the dispatchers.
+        , ServiceLogQueryStatistics
+        //!< Sent by log source clients as a reply with the statistics of the dispatchers.
+        , ServiceLogStatistics
         //!< The last ID of service calls.
         , ServiceLastId         = SERVICE_ID_LAST  //!< Servicing call last ID
 
@@ -729,6 +737,15 @@ namespace NEService
          **/
         const unsigned int* idResponseParamCountMap{ nullptr };
 
+        /**
+         * \brief   Map of flags of attributes, which update events are coalesced by the proxy,
+         *          so that only the latest queued update is processed. Every attribute index
+         *          is calculated by formula ('attribute ID' - NEService::eFuncIdRange::AttributeFirstId)
+         *          The size of this map should be equal to idAttributeCount.
+         *          It is nullptr if no attribute is coalesced.
+         **/
+        const bool *        idAttributeCoalesceMap{ nullptr };
+
     } SInterfaceData;
 
     //////////////////////////////////////////////////////////////////////////
@@ -1380,6 +1397,8 @@ inline const char* NEService::getString(NEService::eResultType resultType)
         return "NEService::eResultType::DataOK";
     case    NEService::eResultType::DataInvalid:
         return "NEService::eResultType::DataInvalid";
+    case    NEService::eResultType::DataDelta:
+        return "NEService::eResultType::DataDelta";
 
     case    NEService::eResultType::ServiceOK:
         return "NEService::eResultType::ServiceOK";
@@ -1542,6 +1561,8 @@ inline const char * NEService::getString( NEService::eServiceRequestType svcRequ
         return "NEService::RegisterStub";
     case NEService::eServiceRequestType::UnregisterStub:
         return "NEService::eServiceRequestType::UnregisterStub";
+    case NEService::eServiceRequestType::RegisterServices:
+        return "NEService::eServiceRequestType::RegisterServices";
     default:
         return "ERR: Unexpected NEService::eServiceRequestType value!!!";
     }
@@ -1648,6 +1669,12 @@ inline const char * NEService::getString( NEService::eFuncIdRange funcId )
         return "NEService::eFuncIdRange::ServiceLogConfigurationSaved";
     case NEService::eFuncIdRange::ServiceLogMessage:
         return "NEService::eFuncIdRange::ServiceLogMessage";
+    case NEService::eFuncIdRange::ServiceLogFilterMessages:
+        return "NEService::eFuncIdRange::ServiceLogFilterMessages";
+    case NEService::eFuncIdRange::ServiceLogQueryStatistics:
+        return "NEService::eFuncIdRange::ServiceLogQueryStatistics";
+    case NEService::eFuncIdRange::ServiceLogStatistics:
+        return "NEService::eFuncIdRange::ServiceLogStatistics";
     case NEService::eFuncIdRange::RequestFirstId:
         return "NEService::eFuncIdRange::RequestFirstId";
     case NEService::eFuncIdRange::ResponseFirstId:
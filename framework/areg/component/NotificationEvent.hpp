@@ -23,6 +23,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/BufferView.hpp"
 #include "areg/component/Event.hpp"
 #include "areg/component/IEEventConsumer.hpp"
 #include "areg/component/NEService.hpp"
@@ -152,6 +153,16 @@ public:
      **/
     inline void setSequenceNr(const SequenceNumber & seqNr );
 
+    /**
+     * \brief   Returns the view of the received response or attribute data.
+     *          The view is empty, if the proxy has copied the data.
+     **/
+    inline const BufferView & getResponseView( void ) const;
+    /**
+     * \brief   Sets the view of the received response or attribute data.
+     **/
+    inline void setResponseView( const BufferView & view );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -172,6 +183,10 @@ private:
      * \brief   Call sequence number.
      **/
     SequenceNumber          mSequenceNr;
+    /**
+     * \brief   The view of the received data, if the proxy does not copy it.
+     **/
+    BufferView              mResponseView;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden / Forbidden method calls.
@@ -391,6 +406,16 @@ inline void NotificationEventData::setSequenceNr(const SequenceNumber & seqNr )
     mSequenceNr = seqNr;
 }
 
+inline const BufferView & NotificationEventData::getResponseView( void ) const
+{
+    return mResponseView;
+}
+
+inline void NotificationEventData::setResponseView( const BufferView & view )
+{
+    mResponseView = view;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // class NotificationEvent inline function implementation
 //////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/BufferView.hpp"
 #include "areg/base/NECommon.hpp"
 #include "areg/base/TEHashMap.hpp"
 #include "areg/base/TEArrayList.hpp"
@@ -31,6 +32,7 @@
 #include "areg/base/TEResourceListMap.hpp"
 #include "areg/component/ProxyEvent.hpp"
 #include "areg/component/ProxyAddress.hpp"
+#include "areg/component/AttributeDelta.hpp"
 
 #include "areg/component/NEService.hpp"
 #include "areg/component/StubAddress.hpp"
@@ -44,6 +46,7 @@
 class IENotificationEventConsumer;
 class NotificationEventData;
 class ServiceResponseEvent;
+class ResponseEvent;
 class RemoteResponseEvent;
 class ServiceRequestEvent;
 class NotificationEvent;
@@ -91,6 +94,7 @@ typedef ProxyBase* (*FuncCreateProxy)( const String & /*roleName*/, DispatcherTh
 class AREG_API ProxyBase  : public    IEProxyEventConsumer
 {
     friend class RemoteEventFactory;
+    friend class IENotificationEventConsumer;
 //////////////////////////////////////////////////////////////////////////
 // Internal classes, types and constants
 //////////////////////////////////////////////////////////////////////////
@@ -525,9 +529,9 @@ protected:
 
 public:
     /**
-     * \brief   Destructor.
+     * \brief   Destructor. Disables the coalescing of the attribute updates of the proxy.
      **/
-    virtual ~ProxyBase( void ) = default;
+    virtual ~ProxyBase( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes
@@ -554,6 +558,14 @@ public:
      **/
     inline NEService::eServiceConnection getConnectionStatus(void) const;
 
+    /**
+     * \brief   Returns false if the request call would block, i.e. the service is remote
+     *          and the send window of the connection to the router is exhausted.
+     *          The request called in this state is not sent and fails with
+     *          NEService::eResultType::RequestBusy, so that the caller can retry it later.
+     **/
+    bool canSendRequest( void ) const;
+
     /**
      * \brief   Checks whether there are more listener objects
      *          assigned for specified message ID.
@@ -580,6 +592,91 @@ public:
      **/
     inline DispatcherThread & getProxyDispatcherThread(void) const;
 
+    /**
+     * \brief   Enables or disables the view of the received data of the response,
+     *          broadcast or attribute for the client. If enabled, the client gets
+     *          the view of the received data by calling getResponseView() while
+     *          processing the notification. The data is not copied, the view references
+     *          the buffer of the received event. Enable for the large binary data.
+     *          If all clients notified of the response or broadcast use the view,
+     *          the proxy does not deserialize the data in the parameters and sets
+     *          the state of the response invalid. Otherwise, and always for attributes,
+     *          the data is deserialized as usual and the view is passed in addition.
+     * \param   msgId       The ID of the response, broadcast or attribute.
+     * \param   listener    The client, which gets the view of the data.
+     * \param   enable      If true, the view of the data is enabled for the client.
+     **/
+    void setResponseView( unsigned int msgId, IENotificationEventConsumer & listener, bool enable );
+
+    /**
+     * \brief   Returns true if the view of the received data of the response,
+     *          broadcast or attribute is enabled for the client.
+     * \param   msgId       The ID of the response, broadcast or attribute.
+     * \param   listener    The client to check.
+     **/
+    bool isResponseViewEnabled( unsigned int msgId, const IENotificationEventConsumer * listener ) const;
+
+    /**
+     * \brief   Returns the view of the received data of the response, broadcast or attribute,
+     *          which notification is processed by the client. The view is empty if it is not
+     *          enabled for the message or no notification is processed. The view is valid
+     *          while the notification is processed. Copy the view to keep the data longer,
+     *          the data is kept as long as there is a reference to it.
+     **/
+    inline const BufferView & getResponseView( void ) const;
+
+    /**
+     * \brief   Enables or disables the direct dispatching of the requests. If enabled and
+     *          the stub runs in the same dispatcher thread as the proxy, the requests and
+     *          the notification requests are processed by the stub in the call without
+     *          queueing the events, and the responses of the stub are queued in the internal
+     *          queue of the thread without locking. The responses are dispatched right after
+     *          the event, which is currently processed. The requests to the stubs of other
+     *          threads and processes are sent as events. By default, it is disabled.
+     * \param   enable  If true, the direct dispatching is enabled.
+     **/
+    inline void setDirectDispatch( bool enable );
+
+    /**
+     * \brief   Returns true if the direct dispatching of the requests is enabled.
+     **/
+    inline bool isDirectDispatchEnabled( void ) const;
+
+    /**
+     * \brief   Sets the deadline of the requests and notification requests sent by the proxy.
+     *          The stub thread dispatches the queued events of the same priority with a deadline
+     *          in the order of the earliest deadline before the events without deadline, and
+     *          counts the events dispatched after the deadline in the dispatcher statistics.
+     *          The deadline is relevant only for the stubs of the same process.
+     * \param   timeoutUs   The time in microseconds, during which the request should be dispatched.
+     *                      Set zero to send requests without deadline. By default, it is zero.
+     **/
+    inline void setRequestDeadline( unsigned int timeoutUs );
+
+    /**
+     * \brief   Returns the deadline in microseconds of the requests sent by the proxy.
+     *          Returns zero if the requests have no deadline.
+     **/
+    inline unsigned int getRequestDeadline( void ) const;
+
+    /**
+     * \brief   Enables or disables the coalescing of the update events of the attribute.
+     *          If enabled, the new update event of the attribute replaces the update
+     *          event, which is queued in the proxy thread and not processed yet, so that
+     *          the clients are notified only about the latest value of the attribute.
+     *          The updates with the delta of the data are never replaced. Enable for the
+     *          attributes, which intermediate values are not relevant for the clients.
+     * \param   attrId  The ID of the attribute.
+     * \param   enable  If true, the update events of the attribute are coalesced.
+     **/
+    void setAttributeCoalescing( unsigned int attrId, bool enable );
+
+    /**
+     * \brief   Returns true if the update events of the attribute are coalesced.
+     * \param   attrId  The ID of the attribute.
+     **/
+    inline bool isAttributeCoalescing( unsigned int attrId ) const;
+
 #ifdef DEBUG
 
     /**
@@ -723,6 +820,14 @@ protected:
      **/
     virtual void processProxyEvent( ProxyEvent & eventElem ) override;
 
+    /**
+     * \brief   Processes the event. If the event is a response with the enabled view
+     *          of data, notifies the clients without deserializing the data.
+     *          Otherwise, forwards the event to process.
+     * \param   eventElem   The event to process.
+     **/
+    virtual void startEventProcessing( Event & eventElem ) override;
+
     /**
      * \brief   Triggered, when current dispatching event is not an instance of
      *          Proxy Event and should be processed by Proxy object.
@@ -905,8 +1010,12 @@ protected:
      * \param   caller          The pointer of Notification Event consumer
      * \param   alwaysNotify    The flag indicating whether notification message
      *                          should be sent if the notification already is pending.
+     * \param   coalesce        The flag indicating whether the queued update events of
+     *                          the attribute should be replaced by the latest update.
+     *                          Ignored if the message is not an attribute.
+     *                          See setAttributeCoalescing() for details.
      **/
-    void setNotification( unsigned int msgId, IENotificationEventConsumer * caller, bool alwaysNotify = false );
+    void setNotification( unsigned int msgId, IENotificationEventConsumer * caller, bool alwaysNotify = false, bool coalesce = false );
 
     /**
      * \brief   Clears listener entries of specified Notification Event consumer
@@ -1016,6 +1125,22 @@ protected:
      **/
     std::atomic_uint32_t    mProxyInstCount;
 
+    /**
+     * \brief   The clients and the IDs of responses, broadcasts and attributes,
+     *          which data is passed to the clients as a view.
+     **/
+    ProxyListenerList           mViewListeners;
+
+    /**
+     * \brief   The IDs of attributes, which update events are coalesced.
+     **/
+    TEArrayList<unsigned int>   mCoalescedIds;
+
+    /**
+     * \brief   The images of attributes, which updates are received as a delta.
+     **/
+    TEHashMap<unsigned int, AttributeDelta> mDeltaImages;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
@@ -1050,6 +1175,26 @@ private:
      **/
     bool                            mIsConnected;
 
+    /**
+     * \brief   The view of the received data, which is passed to the clients in notification.
+     **/
+    BufferView                      mNotifyView;
+
+    /**
+     * \brief   The view of the received data of the notification processed by the client.
+     **/
+    mutable const BufferView *      mResponseView;
+
+    /**
+     * \brief   Flag, indicating whether the requests are dispatched directly to the stub of the same thread.
+     **/
+    bool                            mDirectDispatch;
+
+    /**
+     * \brief   The deadline in microseconds of the requests sent by the proxy. Zero if no deadline.
+     **/
+    unsigned int                    mRequestDeadline;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
 #endif  // _MSC_VER
@@ -1076,6 +1221,52 @@ private:
      **/
     inline ProxyBase & self( void );
 
+    /**
+     * \brief   If the view of the received data is enabled for any client of the response event,
+     *          prepares the view passed in the notifications of these clients. If all clients
+     *          notified of the response or broadcast use the view, the data is not deserialized:
+     *          the state of the response is set invalid and the clients are notified.
+     * \param   eventResponse   The response event to process.
+     * \return  Returns true if the event is processed. Returns false, if the data should be
+     *          deserialized, because not all clients use the view, the event is an attribute
+     *          update, the response is a failure or the data is empty.
+     **/
+    bool _processResponseView( ResponseEvent & eventResponse );
+
+    /**
+     * \brief   Returns true if all clients notified of the response with the given
+     *          sequence number use the view of the received data.
+     **/
+    bool _isViewForAllListeners( unsigned int respId, const SequenceNumber & seqNr ) const;
+
+    /**
+     * \brief   Disables the view of the received data of all messages for the client.
+     **/
+    void _removeViewListener( const IENotificationEventConsumer * listener );
+
+    /**
+     * \brief   Restores the data of the attribute from the received delta and replaces
+     *          the data of the event. If the delta cannot be applied, requests the
+     *          snapshot of the attribute from the stub.
+     * \param   eventResponse   The response event with the delta of the attribute.
+     * \return  Returns true if the data is restored and the event should be processed.
+     *          Returns false if the event should be ignored.
+     **/
+    bool _processAttributeDelta( ResponseEvent & eventResponse );
+
+    /**
+     * \brief   Returns true if the response event is sent to this proxy.
+     **/
+    bool _isEventTarget( const ServiceResponseEvent & eventResponse ) const;
+
+    /**
+     * \brief   Delivers the request event to the stub. If the direct dispatching is enabled
+     *          and the stub runs in the current thread, the stub processes the request
+     *          in the call and the event is destroyed. Otherwise, the event is queued.
+     * \param   eventElem   The request event to deliver.
+     **/
+    void _deliverRequestEvent( ServiceRequestEvent & eventElem );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -1211,6 +1402,36 @@ inline DispatcherThread & ProxyBase::getProxyDispatcherThread( void ) const
     return mDispatcherThread;
 }
 
+inline bool ProxyBase::isAttributeCoalescing( unsigned int attrId ) const
+{
+    return mCoalescedIds.contains( attrId );
+}
+
+inline const BufferView & ProxyBase::getResponseView( void ) const
+{
+    return (mResponseView != nullptr ? *mResponseView : BufferView::EmptyView);
+}
+
+inline void ProxyBase::setDirectDispatch( bool enable )
+{
+    mDirectDispatch = enable;
+}
+
+inline bool ProxyBase::isDirectDispatchEnabled( void ) const
+{
+    return mDirectDispatch;
+}
+
+inline void ProxyBase::setRequestDeadline( unsigned int timeoutUs )
+{
+    mRequestDeadline = timeoutUs;
+}
+
+inline unsigned int ProxyBase::getRequestDeadline( void ) const
+{
+    return mRequestDeadline;
+}
+
 #ifdef DEBUG
 
 inline unsigned int ProxyBase::getListenerCount(void) const
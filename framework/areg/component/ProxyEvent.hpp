@@ -217,7 +217,7 @@ protected:
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
-private:
+protected:
 /************************************************************************/
 // IEEventConsumer interface overrides
 /************************************************************************/
@@ -70,10 +70,15 @@ public:
      * \param   eventStreamable The event object, should be remote event type.
      *                          Otherwise, serialization is ignored.
      * \param   comChannel      The communication channel object to send event.
+     * \param   internAddresses If true, the addresses of stubs and proxies are interned
+     *                          per target and the message contains only their handles
+     *                          once they are sent. Pass false, if the message may be
+     *                          sent out of order relative to the messages serialized
+     *                          in other threads, so that the addresses are sent in full.
      * \return  Returns true if successfully recognized remote object and could
      *          serialize to streaming object. Otherwise, it returns false.
      **/
-    static bool createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel );
+    static bool createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel, bool internAddresses = true );
 
     /**
      * \brief   Call to create request failure remote event. It is called when system failed to processed request.
@@ -83,6 +88,28 @@ public:
      **/
     static StreamableEvent * createRequestFailedEvent( const RemoteMessage & stream, const Channel & comChannel );
 
+    /**
+     * \brief   Removes the addresses of stubs and proxies interned for the remote messages.
+     *          Should be called when the connection is established, since the handles
+     *          of interned addresses are valid only within the connection.
+     **/
+    static void resetAddressCache( void );
+
+    /**
+     * \brief   Removes the handles of addresses interned for the remote messages sent to
+     *          the peer, so that the next messages define the addresses again. Should be
+     *          called when failed to send message to the peer.
+     * \param   peer    The cookie of the remote peer.
+     **/
+    static void resetAddressCache( const ITEM_ID & peer );
+
+    /**
+     * \brief   Removes the handles of addresses interned for the remote messages sent to
+     *          and received from the peer. Should be called when the peer disconnects.
+     * \param   peer    The cookie of the remote peer.
+     **/
+    static void removeAddressCache( const ITEM_ID & peer );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Hidden
 //////////////////////////////////////////////////////////////////////////
@@ -142,6 +142,12 @@ public:
      **/
     inline IEOutStream & getWriteStream( void );
 
+    /**
+     * \brief   Replaces the data of the event by the buffer of serialized arguments.
+     * \param   args    The buffer of serialized arguments to set.
+     **/
+    void setData( const EventDataStream & args );
+
 protected:
     /**
      * \brief   Returns data object valid for modification.
@@ -123,6 +123,15 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// Event overrides
+/************************************************************************/
+    /**
+     * \brief   Returns the request message ID delivered by the event.
+     **/
+    virtual unsigned int getMessageId( void ) const override;
+
 protected:
 /************************************************************************/
 // StreamableEvent overrides
@@ -107,6 +107,15 @@ protected:
 //////////////////////////////////////////////////////////////////////////
 public:
 
+    /**
+     * \brief   Returns the key to coalesce the attribute update events of the proxy.
+     *          The key contains the hash of the proxy address, so that the updates of
+     *          other proxies can have the same key, see canReplaceEvent().
+     * \param   proxy   The address of the proxy, which receives the attribute update events.
+     * \param   attrId  The ID of the attribute.
+     **/
+    static inline uint64_t createCoalesceKey( const ProxyAddress & proxy, unsigned int attrId );
+
     /**
      * \brief   Get and set response message ID.
      **/
@@ -117,6 +126,11 @@ public:
      **/
     inline NEService::eResultType getResult( void ) const;
 
+    /**
+     * \brief   Sets response call result.
+     **/
+    inline void setResult( NEService::eResultType result );
+
     /**
      * \brief   Returns sequence number of call.
      **/
@@ -145,6 +159,30 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// Event overrides
+/************************************************************************/
+    /**
+     * \brief   Returns the response message ID delivered by the event.
+     **/
+    virtual unsigned int getMessageId( void ) const override;
+
+    /**
+     * \brief   Returns the key of the attribute update event with the whole data to replace
+     *          the queued not processed update of the same attribute of the same proxy.
+     *          Returns zero for the responses, broadcasts and the updates with the delta
+     *          of the data, which cannot be replaced.
+     **/
+    virtual uint64_t getCoalesceKey( void ) const override;
+
+    /**
+     * \brief   Returns true if the queued event is the update of the same attribute
+     *          of the same proxy. The coalescing key contains only the hash of the proxy address.
+     * \param   queuedEvent The queued and not processed event with the same coalescing key.
+     **/
+    virtual bool canReplaceEvent( const Event & queuedEvent ) const override;
+
 protected:
 /************************************************************************/
 // StreamableEvent overrides
@@ -194,6 +232,11 @@ private:
 // ServiceResponseEvent class inline function implementation
 //////////////////////////////////////////////////////////////////////////
 
+inline uint64_t ServiceResponseEvent::createCoalesceKey( const ProxyAddress & proxy, unsigned int attrId )
+{
+    return ((static_cast<uint64_t>(static_cast<unsigned int>(proxy)) << 32) | static_cast<uint64_t>(attrId));
+}
+
 inline unsigned int ServiceResponseEvent::getResponseId( void ) const
 {
     return mResponseId;
@@ -204,6 +247,11 @@ inline NEService::eResultType ServiceResponseEvent::getResult( void ) const
     return mResult;
 }
 
+inline void ServiceResponseEvent::setResult( NEService::eResultType result )
+{
+    mResult = result;
+}
+
 inline const SequenceNumber & ServiceResponseEvent::getSequenceNumber( void ) const
 {
     return mSequenceNr;
@@ -26,6 +26,7 @@
 #include "areg/component/ProxyAddress.hpp"
 #include "areg/component/StubAddress.hpp"
 #include "areg/component/NEService.hpp"
+#include "areg/component/AttributeDelta.hpp"
 
 #include <utility>
 
@@ -186,6 +187,12 @@ protected:
      **/
     using MapStubSession     = TEIntegerMap<StubBase::Listener>;
 
+    /**
+     * \brief   StubBase::MapAttributeDelta class defines the images of attributes,
+     *          which updates are sent to remote proxies as a delta.
+     **/
+    using MapAttributeDelta  = TEHashMap<unsigned int, AttributeDelta>;
+
     //////////////////////////////////////////////////////////////////////////
     // StubBase resource tracking
     //////////////////////////////////////////////////////////////////////////
@@ -242,6 +249,42 @@ public:
      **/
     inline const String & getServiceName( void ) const;
 
+    /**
+     * \brief   Enables or disables sending the updates of the attribute to the remote
+     *          proxies as a delta. If enabled, the stub keeps the image of the last
+     *          sent data of the attribute and sends the changed bytes instead of the
+     *          whole data. The new remote listeners get the whole data. Use it for
+     *          large attributes like arrays and maps, which entries are changed
+     *          one by one. The local proxies always get the whole data.
+     * \param   attrId  The ID of attribute. Other IDs are ignored.
+     * \param   enable  If true, the updates of the attribute are sent as a delta.
+     **/
+    void setAttributeDelta( unsigned int attrId, bool enable );
+
+    /**
+     * \brief   Returns true if the updates of the attribute are sent as a delta.
+     **/
+    inline bool isAttributeDelta( unsigned int attrId ) const;
+
+    /**
+     * \brief   Sets the deadline of the responses and broadcasts sent by the stub. The updates
+     *          of the attributes are sent without deadline. The proxy thread dispatches the
+     *          queued events of the same priority with a deadline in the order of the earliest
+     *          deadline before the events without deadline, so that the responses are not
+     *          queued behind the attribute updates. The events dispatched after the deadline
+     *          are counted in the dispatcher statistics. The deadline is relevant only for
+     *          the proxies of the same process.
+     * \param   timeoutUs   The time in microseconds, during which the response should be dispatched.
+     *                      Set zero to send responses without deadline. By default, it is zero.
+     **/
+    inline void setResponseDeadline( unsigned int timeoutUs );
+
+    /**
+     * \brief   Returns the deadline in microseconds of the responses sent by the stub.
+     *          Returns zero if the responses have no deadline.
+     **/
+    inline unsigned int getResponseDeadline( void ) const;
+
     /**
      * \brief   Sends error event to all pending responses and notification updates
      **/
@@ -694,6 +737,11 @@ private:
      **/
     unsigned int                        mSessionId;
 
+    /**
+     * \brief   The deadline in microseconds of the responses and broadcasts. Zero if no deadline.
+     **/
+    unsigned int                        mResponseDeadline;
+
 private:
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
@@ -703,6 +751,11 @@ private:
      **/
     MapStubSession                      mMapSessions;
 
+    /**
+     * \brief   The images of attributes, which updates are sent to remote proxies as a delta.
+     **/
+    mutable MapAttributeDelta           mDeltaAttributes;
+
     /**
      * \brief   Stub object resource map.
      **/
@@ -720,6 +773,18 @@ private:
      **/
     inline StubBase & self( void );
 
+    /**
+     * \brief   Sends the delta of the attribute update to the remote listeners and
+     *          removes them from the list. If the update cannot be sent as a delta,
+     *          releases the image of the attribute and the list remains unchanged.
+     * \param   msgId       The ID of attribute, which updates are sent as a delta.
+     * \param   data        The serialized data of the attribute.
+     * \param   result      The result of data update.
+     * \param   listeners   On input, the list of all listeners of the attribute.
+     *                      On output, the listeners, which should get the whole data.
+     **/
+    void _sendUpdateDelta( unsigned int msgId, const EventDataStream & data, NEService::eResultType result, StubListenerList & listeners ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -826,4 +891,19 @@ inline const String& StubBase::getServiceName(void) const
     return mAddress.getServiceName();
 }
 
+inline bool StubBase::isAttributeDelta( unsigned int attrId ) const
+{
+    return mDeltaAttributes.contains(attrId);
+}
+
+inline void StubBase::setResponseDeadline( unsigned int timeoutUs )
+{
+    mResponseDeadline = timeoutUs;
+}
+
+inline unsigned int StubBase::getResponseDeadline( void ) const
+{
+    return mResponseDeadline;
+}
+
 #endif  // AREG_COMPONENT_STUBBASE_HPP
@@ -166,6 +166,22 @@ public:
      **/
     inline bool isStopped( void ) const;
 
+    /**
+     * \brief   Sets the deadline of the fired timer events. The dispatcher thread dispatches the
+     *          queued events of the same priority with a deadline in the order of the earliest
+     *          deadline before the events without deadline and counts the events dispatched after
+     *          the deadline in the dispatcher statistics.
+     * \param   timeoutUs   The time in microseconds, during which the timer event should be dispatched.
+     *                      Set zero to fire events without deadline. By default, it is zero.
+     **/
+    inline void setEventDeadline( unsigned int timeoutUs );
+
+    /**
+     * \brief   Returns the deadline in microseconds of the fired timer events.
+     *          Returns zero if the events have no deadline.
+     **/
+    inline unsigned int getEventDeadline( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -228,6 +244,10 @@ private:
      * \brief   Last fired time. The value is system dependent.
      **/
     uint64_t            mExpiredAt;
+    /**
+     * \brief   The deadline in microseconds of the fired timer events. Zero if no deadline.
+     **/
+    unsigned int        mEventDeadline;
     /**
      * \brief   Flag, indicating whether the timer is already started by timer manager or not.
      *          This flag is true, only when startTimer of timer manager is called. 
@@ -299,4 +319,14 @@ inline bool Timer::isStopped( void ) const
     return (mTimeoutInMs == NECommon::INVALID_TIMEOUT);
 }
 
+inline void Timer::setEventDeadline( unsigned int timeoutUs )
+{
+    mEventDeadline = timeoutUs;
+}
+
+inline unsigned int Timer::getEventDeadline( void ) const
+{
+    return mEventDeadline;
+}
+
 #endif  // AREG_COMPONENT_TIMER_HPP
@@ -0,0 +1,364 @@
+#ifndef AREG_COMPONENT_WORKERGROUP_HPP
+#define AREG_COMPONENT_WORKERGROUP_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/WorkerGroup.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Worker Group class.
+ *              The threads of the component running the data processing tasks.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/LatencyHistogram.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TELinkedList.hpp"
+#include "areg/base/WorkStealingPool.hpp"
+#include "areg/component/IEEventConsumer.hpp"
+
+#include <atomic>
+#include <functional>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class ComponentThread;
+class IEWorkerGroupConsumer;
+class WorkerGroupEvent;
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The Worker Group is a fixed number of threads of the component, which
+ *          share the work stealing queue of tasks. The component submits the
+ *          jobs to the group, the job is either a single task or a range of indexes
+ *          split in chunks, which are processed in parallel. When all tasks of the
+ *          submitted job are completed, the result is delivered as an event to
+ *          the component thread and the consumer of the group is notified.
+ *          The group records the time the tasks waited in the queue and the time
+ *          to run the tasks. The group is created and deleted in the component thread.
+ **/
+class AREG_API WorkerGroup  : private IEEventConsumer
+{
+    friend class WorkerGroupEvent;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The function of the single task.
+     **/
+    using TaskFunction  = std::function<void( void )>;
+
+    /**
+     * \brief   The function, which processes the indexes in the range [first, last).
+     **/
+    using RangeFunction = std::function<void( uint32_t /*first*/, uint32_t /*last*/ )>;
+
+    /**
+     * \brief   WorkerGroup::sJobResult
+     *          The result of the completed job delivered to the component thread.
+     *          The times are in nanoseconds.
+     **/
+    struct sJobResult
+    {
+        uint32_t    jrJobId;        //!< The ID of the job given when submitted.
+        uint32_t    jrTaskCount;    //!< The number of tasks of the job.
+        uint64_t    jrElapsed;      //!< The time from submitting the job until the last task completed.
+        uint64_t    jrRunTime;      //!< The sum of the time to run the tasks of the job.
+    };
+
+    /**
+     * \brief   WorkerGroup::sGroupStatistics
+     *          The statistics of the Worker Group. The times are in nanoseconds.
+     **/
+    struct sGroupStatistics
+    {
+        uint32_t    gsThreadCount;  //!< The number of threads of the group.
+        uint64_t    gsJobs;         //!< The number of completed jobs.
+        uint64_t    gsTasks;        //!< The number of completed tasks.
+        uint64_t    gsTasksStolen;  //!< The number of tasks stolen from the queues of other threads.
+        uint64_t    gsWaitMedian;   //!< The median time the tasks waited in the queue.
+        uint64_t    gsWaitP99;      //!< The 99th percentile of the time the tasks waited in the queue.
+        uint64_t    gsRunMedian;    //!< The median time to run a task.
+        uint64_t    gsRunP99;       //!< The 99th percentile of the time to run a task.
+        uint64_t    gsRunMax;       //!< The maximum time to run a task.
+    };
+
+private:
+    /**
+     * \brief   The submitted job. Declared and implemented in the source file.
+     **/
+    class GroupJob;
+    friend class GroupJob;
+
+    /**
+     * \brief   The task of the job. Declared and implemented in the source file.
+     **/
+    class GroupTask;
+    friend class GroupTask;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the Worker Group. The threads are created when the group starts.
+     * \param   groupName   The name of the group, used as a prefix of thread names.
+     * \param   consumer    The consumer notified in the component thread when a job is completed.
+     * \param   ownerThread The component thread, which owns the group.
+     * \param   threadCount The number of threads of the group. If zero, one thread per CPU core.
+     **/
+    WorkerGroup( const String & groupName, IEWorkerGroupConsumer & consumer, ComponentThread & ownerThread, uint32_t threadCount );
+
+    /**
+     * \brief   Stops the threads of the group.
+     **/
+    virtual ~WorkerGroup( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the threads of the group. If the group is already started, does nothing.
+     * \return  Returns true if the group is started.
+     **/
+    bool startGroup( void );
+
+    /**
+     * \brief   Stops the threads of the group and waits for completion. The jobs,
+     *          which are not completed, are removed without notifying the consumer.
+     *          Should not be called while parallelFor() runs.
+     **/
+    void stopGroup( void );
+
+    /**
+     * \brief   Returns true if the threads of the group are started.
+     **/
+    inline bool isGroupStarted( void ) const;
+
+    /**
+     * \brief   Returns the name of the group.
+     **/
+    inline const String & getName( void ) const;
+
+    /**
+     * \brief   Returns the number of threads of the group. If the group is not started,
+     *          returns the number of threads passed when created.
+     **/
+    inline uint32_t getThreadCount( void ) const;
+
+    /**
+     * \brief   Returns the component thread, which owns the group.
+     **/
+    inline ComponentThread & getOwnerThread( void ) const;
+
+    /**
+     * \brief   Submits the task to run on a thread of the group. When the task completes,
+     *          the consumer is notified in the component thread.
+     * \param   jobId   The ID of the job passed to the consumer.
+     * \param   task    The task to run.
+     * \return  Returns true if the task is submitted. Returns false if the group is not started.
+     **/
+    bool postTask( uint32_t jobId, TaskFunction && task );
+
+    /**
+     * \brief   Splits the range of indexes [begin, end) in chunks and processes them in parallel
+     *          on the threads of the group. When all chunks are processed, the consumer is
+     *          notified in the component thread.
+     * \param   jobId       The ID of the job passed to the consumer.
+     * \param   begin       The first index of the range.
+     * \param   end         The index after the last index of the range.
+     * \param   grainSize   The number of indexes in a chunk. If zero, the range is split
+     *                      in the number of chunks equal to 4 chunks per thread.
+     * \param   body        The function to process a chunk.
+     * \return  Returns true if the job is submitted. Returns false if the group is not started.
+     **/
+    bool postParallelFor( uint32_t jobId, uint32_t begin, uint32_t end, uint32_t grainSize, RangeFunction && body );
+
+    /**
+     * \brief   Splits the range of indexes [begin, end) in chunks, processes them in parallel
+     *          on the threads of the group and waits until all chunks are processed. If called
+     *          by a thread of the group, processes the range in the calling thread.
+     * \param   begin       The first index of the range.
+     * \param   end         The index after the last index of the range.
+     * \param   grainSize   The number of indexes in a chunk. If zero, the range is split
+     *                      in the number of chunks equal to 4 chunks per thread.
+     * \param   body        The function to process a chunk.
+     * \return  Returns true if the range is processed. Returns false if the group is not started.
+     **/
+    bool parallelFor( uint32_t begin, uint32_t end, uint32_t grainSize, const RangeFunction & body );
+
+    /**
+     * \brief   Returns the statistics of the group.
+     **/
+    WorkerGroup::sGroupStatistics getStatistics( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// IEEventConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Not used, the results are dispatched by WorkerGroupEvent.
+     **/
+    virtual void startEventProcessing( Event & eventElem ) override;
+
+    /**
+     * \brief   Returns the number of indexes in a chunk to split the range.
+     * \param   count       The number of indexes in the range.
+     * \param   grainSize   The number of indexes in a chunk requested by the caller or zero.
+     **/
+    uint32_t _getChunkSize( uint32_t count, uint32_t grainSize ) const;
+
+    /**
+     * \brief   Schedules the tasks of the job to run on the threads of the group.
+     **/
+    void _scheduleJob( GroupJob & job );
+
+    /**
+     * \brief   Sends the result of the completed job to the component thread.
+     **/
+    void _sendResult( const WorkerGroup::sJobResult & result );
+
+    /**
+     * \brief   Called by the thread of the group when a task of the job is completed.
+     * \param   job         The job of the completed task.
+     * \param   started     The timestamp when the task started to run.
+     * \param   completed   The timestamp when the task is completed.
+     **/
+    void _taskCompleted( GroupJob & job, uint64_t started, uint64_t completed );
+
+    /**
+     * \brief   Called in the component thread to notify the consumer of the group with the ID.
+     *          Does nothing if the group does not exist anymore.
+     **/
+    static void _dispatchResult( uint32_t groupId, const WorkerGroup::sJobResult & result );
+
+    /**
+     * \brief   Returns reference to the Worker Group object.
+     **/
+    inline WorkerGroup & self( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The unique ID of the group to find it when the result is dispatched.
+     **/
+    const uint32_t          mGroupId;
+
+    /**
+     * \brief   The number of threads of the group.
+     **/
+    const uint32_t          mThreadCount;
+
+    /**
+     * \brief   The consumer notified when the job is completed.
+     **/
+    IEWorkerGroupConsumer & mConsumer;
+
+    /**
+     * \brief   The component thread, which owns the group.
+     **/
+    ComponentThread &       mOwnerThread;
+
+    /**
+     * \brief   The threads of the group with the work stealing queues.
+     **/
+    WorkStealingPool        mPool;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The list of the submitted jobs, which are not completed.
+     **/
+    TELinkedList<GroupJob *>    mJobs;
+
+    /**
+     * \brief   The number of completed jobs.
+     **/
+    std::atomic_uint64_t    mJobsCompleted;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The time the tasks waited in the queue.
+     **/
+    LatencyHistogram        mWaitTime;
+
+    /**
+     * \brief   The time to run the tasks.
+     **/
+    LatencyHistogram        mRunTime;
+
+    /**
+     * \brief   The lock of the recorded times, the histograms have a single writer.
+     **/
+    SpinLock                mTimeLock;
+
+    /**
+     * \brief   The lock of the list of jobs.
+     **/
+    mutable ResourceLock    mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    WorkerGroup( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( WorkerGroup );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool WorkerGroup::isGroupStarted( void ) const
+{
+    return mPool.isPoolStarted();
+}
+
+inline const String & WorkerGroup::getName( void ) const
+{
+    return mPool.getName();
+}
+
+inline uint32_t WorkerGroup::getThreadCount( void ) const
+{
+    return (mPool.isPoolStarted() ? mPool.getThreadCount() : mThreadCount);
+}
+
+inline ComponentThread & WorkerGroup::getOwnerThread( void ) const
+{
+    return mOwnerThread;
+}
+
+inline WorkerGroup & WorkerGroup::self( void )
+{
+    return (*this);
+}
+
+#endif  // AREG_COMPONENT_WORKERGROUP_HPP
@@ -0,0 +1,294 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/AttributeDelta.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Attribute Delta class.
+ *              Encodes and decodes the changes of serialized attribute data.
+ *
+ ************************************************************************/
+#include "areg/component/AttributeDelta.hpp"
+
+#include "areg/component/EventDataStream.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/base/TEArrayList.hpp"
+
+#include <string.h>
+
+namespace
+{
+    //! The run of changed bytes.
+    struct sRun
+    {
+        uint32_t    offset; //!< The offset of the run in the image.
+        uint32_t    oldLen; //!< The length of replaced bytes in the image.
+        uint32_t    newLen; //!< The length of new bytes.
+    };
+
+    //! The size of the patch header: kind, base crc, new size, new crc and run count.
+    constexpr unsigned int  PATCH_HEADER_SIZE   { static_cast<unsigned int>(sizeof(uint8_t) + 4 * sizeof(uint32_t)) };
+
+    //! The size of the run header.
+    constexpr unsigned int  RUN_HEADER_SIZE     { static_cast<unsigned int>(3 * sizeof(uint32_t)) };
+
+    //! The size of blocks to compare when searching the changes.
+    constexpr unsigned int  COMPARE_BLOCK_SIZE  { 64u };
+
+    inline void _writeValue( EventDataStream & stream, uint32_t value )
+    {
+        stream.getStreamForWrite().write(reinterpret_cast<const unsigned char *>(&value), static_cast<unsigned int>(sizeof(uint32_t)));
+    }
+
+    inline bool _readValue( const unsigned char *& data, const unsigned char * end, uint32_t & out_value )
+    {
+        if (static_cast<unsigned int>(end - data) < sizeof(uint32_t))
+            return false;
+
+        ::memcpy(&out_value, data, sizeof(uint32_t));
+        data += sizeof(uint32_t);
+        return true;
+    }
+
+    inline unsigned int _checksum( const BufferView & data )
+    {
+        return NEMath::crc32Calculate(data.getData(), static_cast<int>(data.getSize()));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// AttributeDelta class implementation
+//////////////////////////////////////////////////////////////////////////
+
+AttributeDelta::AttributeDelta( void )
+    : mImage            ( )
+    , mChecksum         ( 0u )
+    , mSnapshotPending  ( false )
+{
+}
+
+void AttributeDelta::reset( void )
+{
+    mImage.release();
+    mChecksum       = 0u;
+    mSnapshotPending= false;
+}
+
+bool AttributeDelta::encodeSnapshot( const EventDataStream & data, EventDataStream & out_delta )
+{
+    BufferView view;
+    if (data.getDataView(view) == false)
+        return false;
+
+    if (mImage.isEmpty())
+    {
+        mChecksum   = _checksum(view);
+        mImage      = view;
+    }
+
+    AttributeDelta::_writeSnapshot(view, out_delta);
+    return true;
+}
+
+bool AttributeDelta::encodeUpdate( const EventDataStream & data, EventDataStream & out_delta )
+{
+    BufferView view;
+    if (data.getDataView(view) == false)
+    {
+        reset();
+        return false;
+    }
+
+    const unsigned int crcData{ _checksum(view) };
+    if (mImage.isEmpty() || (_writePatch(view, crcData, view.getSize() / 2, out_delta) == false))
+    {
+        AttributeDelta::_writeSnapshot(view, out_delta);
+    }
+
+    mChecksum   = crcData;
+    mImage      = std::move(view);
+    return true;
+}
+
+bool AttributeDelta::decode( const EventDataStream & delta, EventDataStream & out_data )
+{
+    BufferView view;
+    if (delta.getDataView(view) == false)
+        return false;
+
+    const unsigned char * src   = view.getData();
+    const unsigned char * end   = view.getEnd();
+    const AttributeDelta::eDeltaType kind = static_cast<AttributeDelta::eDeltaType>(*src ++);
+    uint32_t newSize{ 0 }, crcNew{ 0 };
+
+    if (kind == AttributeDelta::eDeltaType::DeltaSnapshot)
+    {
+        if (src == end)
+            return false;
+
+        out_data.reserve(static_cast<unsigned int>(end - src));
+        out_data.getStreamForWrite().write(src, static_cast<unsigned int>(end - src));
+    }
+    else if (kind == AttributeDelta::eDeltaType::DeltaPatch)
+    {
+        uint32_t crcBase{ 0 }, count{ 0 };
+        if ( (_readValue(src, end, crcBase) == false) || (_readValue(src, end, newSize) == false) ||
+             (_readValue(src, end, crcNew ) == false) || (_readValue(src, end, count  ) == false) )
+        {
+            return false;
+        }
+
+        if (mImage.isEmpty() || (crcBase != mChecksum))
+            return false;
+
+        const unsigned char * image = mImage.getData();
+        const uint32_t imageSize{ mImage.getSize() };
+        uint32_t pos{ 0 };
+
+        out_data.reserve(newSize);
+        for (uint32_t i = 0; i < count; ++ i)
+        {
+            sRun run{ 0, 0, 0 };
+            if ( (_readValue(src, end, run.offset) == false) || (_readValue(src, end, run.oldLen) == false) ||
+                 (_readValue(src, end, run.newLen) == false) )
+            {
+                return false;
+            }
+
+            if ( (run.offset < pos) || (run.offset > imageSize) || (run.oldLen > imageSize - run.offset) ||
+                 (run.newLen > static_cast<uint32_t>(end - src)) )
+            {
+                return false;
+            }
+
+            out_data.getStreamForWrite().write(image + pos, run.offset - pos);
+            out_data.getStreamForWrite().write(src, run.newLen);
+            src += run.newLen;
+            pos  = run.offset + run.oldLen;
+        }
+
+        out_data.getStreamForWrite().write(image + pos, imageSize - pos);
+    }
+    else
+    {
+        return false;
+    }
+
+    BufferView result;
+    if (out_data.getDataView(result) == false)
+        return false;
+
+    const unsigned int crcResult{ _checksum(result) };
+    if ((kind == AttributeDelta::eDeltaType::DeltaPatch) && ((result.getSize() != newSize) || (crcResult != crcNew)))
+        return false;
+
+    mChecksum   = crcResult;
+    mImage      = std::move(result);
+    mSnapshotPending = false;
+    return true;
+}
+
+void AttributeDelta::_writeSnapshot( const BufferView & data, EventDataStream & out_delta )
+{
+    const uint8_t kind{ static_cast<uint8_t>(AttributeDelta::eDeltaType::DeltaSnapshot) };
+    out_delta.reserve(data.getSize() + 1);
+    out_delta.getStreamForWrite().write(&kind, 1);
+    out_delta.getStreamForWrite().write(data.getData(), data.getSize());
+}
+
+bool AttributeDelta::_writePatch( const BufferView & data, unsigned int crcData, unsigned int sizeLimit, EventDataStream & out_delta ) const
+{
+    const unsigned char * oldData   = mImage.getData();
+    const unsigned char * newData   = data.getData();
+    const uint32_t oldSize{ mImage.getSize() };
+    const uint32_t newSize{ data.getSize() };
+
+    TEArrayList<sRun> runs;
+    unsigned int patchSize{ PATCH_HEADER_SIZE };
+
+    // if the entries are inserted or removed, the data after the change is shifted.
+    uint32_t suffix{ 0 };
+    if (oldSize != newSize)
+    {
+        const uint32_t minSize{ MACRO_MIN(oldSize, newSize) };
+        while ((suffix < minSize) && (oldData[oldSize - suffix - 1] == newData[newSize - suffix - 1]))
+        {
+            ++ suffix;
+        }
+    }
+
+    const uint32_t oldEnd{ oldSize - suffix };
+    const uint32_t newEnd{ newSize - suffix };
+    const uint32_t length{ MACRO_MIN(oldEnd, newEnd) };
+
+    // search the runs of bytes changed in place, the runs split by small gaps are merged.
+    uint32_t pos{ 0 };
+    while (pos < length)
+    {
+        while ((pos + COMPARE_BLOCK_SIZE <= length) && (::memcmp(oldData + pos, newData + pos, COMPARE_BLOCK_SIZE) == 0))
+        {
+            pos += COMPARE_BLOCK_SIZE;
+        }
+
+        while ((pos < length) && (oldData[pos] == newData[pos]))
+        {
+            ++ pos;
+        }
+
+        if (pos == length)
+            break;
+
+        const uint32_t begin{ pos };
+        uint32_t last{ pos ++ };
+        while ((pos < length) && (pos - last <= MIN_GAP_SIZE))
+        {
+            if (oldData[pos] != newData[pos])
+            {
+                last = pos;
+            }
+
+            ++ pos;
+        }
+
+        const uint32_t size{ last + 1 - begin };
+        runs.add(sRun{ begin, size, size });
+        patchSize += RUN_HEADER_SIZE + size;
+        if (patchSize > sizeLimit)
+            return false;
+
+        pos = last + 1;
+    }
+
+    if (oldEnd != newEnd)
+    {
+        // replace the bytes between the compared part and the common suffix.
+        runs.add(sRun{ length, oldEnd - length, newEnd - length });
+        patchSize += RUN_HEADER_SIZE + newEnd - length;
+        if (patchSize > sizeLimit)
+            return false;
+    }
+
+    const uint8_t kind{ static_cast<uint8_t>(AttributeDelta::eDeltaType::DeltaPatch) };
+    out_delta.reserve(patchSize);
+    out_delta.getStreamForWrite().write(&kind, 1);
+    _writeValue(out_delta, mChecksum);
+    _writeValue(out_delta, newSize);
+    _writeValue(out_delta, crcData);
+    _writeValue(out_delta, runs.getSize());
+    for (uint32_t i = 0; i < runs.getSize(); ++ i)
+    {
+        const sRun & run = runs[i];
+        _writeValue(out_delta, run.offset);
+        _writeValue(out_delta, run.oldLen);
+        _writeValue(out_delta, run.newLen);
+        out_delta.getStreamForWrite().write(newData + run.offset, run.newLen);
+    }
+
+    return true;
+}
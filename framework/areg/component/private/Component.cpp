@@ -16,6 +16,7 @@
 #include "areg/component/Component.hpp"
 
 #include "areg/component/WorkerThread.hpp"
+#include "areg/component/WorkerGroup.hpp"
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/StubBase.hpp"
 #include "areg/component/private/ServiceManager.hpp"
@@ -52,7 +53,18 @@ Component* Component::loadComponent(const NERegistry::ComponentEntry &entry, Com
             IEWorkerThreadConsumer* consumer = static_cast<Component *>(component)->workerThreadConsumer(wtEntry.mConsumerName.getString(), wtEntry.mThreadName.getBuffer());
             if (consumer != nullptr)
             {
-                component->createWorkerThread(wtEntry.mThreadName.getString(), *consumer, componentThread, wtEntry.mWatchdogTimeout);
+                component->createWorkerThread(wtEntry.mThreadName.getString(), *consumer, componentThread, wtEntry.mWatchdogTimeout, wtEntry.mPlacement);
+            }
+        }
+
+        const NERegistry::WorkerGroupList& wGroups = entry.getWorkerGroups();
+        for (uint32_t i = 0; i < wGroups.getSize(); ++ i)
+        {
+            const NERegistry::WorkerGroupEntry& wgEntry = wGroups[i];
+            IEWorkerGroupConsumer* consumer = component->workerGroupConsumer(wgEntry.mConsumerName, wgEntry.mGroupName);
+            if (consumer != nullptr)
+            {
+                component->createWorkerGroup(wgEntry.mGroupName, *consumer, componentThread, wgEntry.mThreadCount);
             }
         }
     }
@@ -70,6 +82,12 @@ void Component::unloadComponent( Component& comItem, const NERegistry::Component
         comItem.deleteWorkerThread(wThreads.mListWorkers[i].mThreadName.getString());
     }
 
+    const NERegistry::WorkerGroupList& wGroups = entry.getWorkerGroups();
+    for (uint32_t i = 0; i < wGroups.getSize(); ++i)
+    {
+        comItem.deleteWorkerGroup(wGroups[i].mGroupName);
+    }
+
     entry.mFuncDelete(comItem, entry);
 }
 
@@ -115,6 +133,7 @@ Component::Component( const String & roleName, ComponentThread & ownerThread )
     , mComponentInfo( ownerThread, roleName )
     , mMagicNum     ( Component::_magicNumber(self()) )
     , mServerList   ( )
+    , mWorkerGroups ( )
 {
     _mapComponentResource.registerResourceObject(mMagicNum, this);
 }
@@ -125,6 +144,7 @@ Component::Component( const NERegistry::ComponentEntry & regEntry, ComponentThre
     , mComponentInfo( ownerThread, regEntry.mRoleName)
     , mMagicNum     ( Component::_magicNumber(self()) )
     , mServerList   ( )
+    , mWorkerGroups ( )
 {
     _mapComponentResource.registerResourceObject(mMagicNum, this);
 }
@@ -135,6 +155,7 @@ Component::Component( const String & roleName )
     , mComponentInfo    (_getCurrentComponentThread(), roleName)
     , mMagicNum         ( Component::_magicNumber(self()) )
     , mServerList       ( )
+    , mWorkerGroups     ( )
 {
     _mapComponentResource.registerResourceObject(mMagicNum, this);
 }
@@ -142,13 +163,22 @@ Component::Component( const String & roleName )
 
 Component::~Component( void )
 {
+    while (mWorkerGroups.isEmpty() == false)
+    {
+        delete mWorkerGroups.popFirst();
+    }
+
     _mapComponentResource.unregisterResourceObject(mMagicNum);
 }
 
 //////////////////////////////////////////////////////////////////////////
 // Methods
 //////////////////////////////////////////////////////////////////////////
-WorkerThread* Component::createWorkerThread( const String & threadName, IEWorkerThreadConsumer& consumer, ComponentThread & /* ownerThread */, uint32_t watchdogTimeout)
+WorkerThread* Component::createWorkerThread( const String & threadName
+                                           , IEWorkerThreadConsumer& consumer
+                                           , ComponentThread & /* ownerThread */
+                                           , uint32_t watchdogTimeout
+                                           , const Thread::sPlacement & placement /*= Thread::sPlacement()*/)
 {
     WorkerThread* workThread = mComponentInfo.findWorkerThread(threadName);
     if (workThread == nullptr)
@@ -156,6 +186,7 @@ WorkerThread* Component::createWorkerThread( const String & threadName, IEWorker
         workThread = DEBUG_NEW WorkerThread(threadName, self(), consumer, watchdogTimeout);
         if (workThread != nullptr)
         {
+            workThread->setPlacement(placement);
             if (workThread->createThread(NECommon::WAIT_INFINITE))
             {
                 mComponentInfo.registerWorkerThread(*workThread);
@@ -182,6 +213,56 @@ void Component::deleteWorkerThread( const String & threadName )
     }
 }
 
+WorkerGroup* Component::createWorkerGroup( const String & groupName
+                                         , IEWorkerGroupConsumer & consumer
+                                         , ComponentThread & ownerThread
+                                         , uint32_t threadCount )
+{
+    WorkerGroup* workGroup = findWorkerGroup(groupName);
+    if (workGroup == nullptr)
+    {
+        workGroup = DEBUG_NEW WorkerGroup(groupName, consumer, ownerThread, threadCount);
+        if (workGroup != nullptr)
+        {
+            if (workGroup->startGroup())
+            {
+                mWorkerGroups.pushLast(workGroup);
+            }
+            else
+            {
+                delete workGroup;
+                workGroup = nullptr;
+            }
+        }
+    }
+
+    return workGroup;
+}
+
+void Component::deleteWorkerGroup( const String & groupName )
+{
+    WorkerGroup* workGroup = findWorkerGroup(groupName);
+    if (workGroup != nullptr)
+    {
+        mWorkerGroups.removeEntry(workGroup);
+        delete workGroup;
+    }
+}
+
+WorkerGroup* Component::findWorkerGroup( const String & groupName ) const
+{
+    for (ListWorkerGroups::LISTPOS pos = mWorkerGroups.firstPosition(); mWorkerGroups.isValidPosition(pos); pos = mWorkerGroups.nextPosition(pos))
+    {
+        WorkerGroup* workGroup = mWorkerGroups.valueAtPosition(pos);
+        if (workGroup->getName() == groupName)
+        {
+            return workGroup;
+        }
+    }
+
+    return nullptr;
+}
+
 void Component::startupComponent( ComponentThread& /* comThread */ )
 {
     for (ListServers::LISTPOS pos = mServerList.firstPosition(); mServerList.isValidPosition(pos); pos = mServerList.nextPosition(pos))
@@ -189,7 +270,7 @@ void Component::startupComponent( ComponentThread& /* comThread */ )
         StubBase * stub = mServerList.valueAtPosition(pos);
         ASSERT( stub != nullptr );
         stub->startupServiceInterface(self());
-        ServiceManager::requestRegisterServer(stub->getAddress());
+        getMasterThread().registerServer(stub->getAddress());
     }
 }
 
@@ -197,6 +278,11 @@ void Component::shutdownComponent( ComponentThread& /* comThread */ )
 {
     _shutdownServices();
 
+    for (ListWorkerGroups::LISTPOS pos = mWorkerGroups.firstPosition(); mWorkerGroups.isValidPosition(pos); pos = mWorkerGroups.nextPosition(pos))
+    {
+        mWorkerGroups.valueAtPosition(pos)->stopGroup();
+    }
+
     ThreadAddress addrThread;
     WorkerThread * workerThread = mComponentInfo.getFirstWorkerThread(addrThread);
     while (workerThread != nullptr)
@@ -271,6 +357,11 @@ IEWorkerThreadConsumer* Component::workerThreadConsumer( const String & /* consu
     return nullptr;
 }
 
+IEWorkerGroupConsumer* Component::workerGroupConsumer( const String & /* consumerName */, const String & /* workerGroupName */)
+{
+    return nullptr;
+}
+
 unsigned int Component::_magicNumber(Component & comp)
 {
     unsigned int result = NEMath::CHECKSUM_IGNORE;
@@ -17,9 +17,14 @@
 
 #include "areg/component/Component.hpp"
 #include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/private/ServiceManager.hpp"
 #include "areg/base/NECommon.hpp"
 
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_component_ComponentLoader_loadModel);
+
 //////////////////////////////////////////////////////////////////////////
 // ModelDataCreator class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -182,6 +187,26 @@ const NERegistry::ComponentThreadEntry& ComponentLoader::findThreadEntry(const S
     return (result != nullptr ? *result : NERegistry::invalidThreadEntry());
 }
 
+bool ComponentLoader::isPooledThread( const String & threadName )
+{
+    bool result{ false };
+    ComponentLoader& loader = ComponentLoader::getInstance();
+    Lock lock(loader.mLock);
+
+    for (uint32_t i = 0; i < loader.mModelList.getSize(); ++i)
+    {
+        const NERegistry::Model & model = loader.mModelList.getAt(i);
+        const int index{ model.findThread(threadName) };
+        if (index != NECommon::INVALID_INDEX)
+        {
+            result = model.isPooledThread(model.getThreadList().mListThreads.getAt(static_cast<uint32_t>(index)));
+            break;
+        }
+    }
+
+    return result;
+}
+
 bool ComponentLoader::isModelLoaded( const String & modelName )
 {
     bool result = false;
@@ -380,36 +405,66 @@ bool ComponentLoader::loadModel( NERegistry::Model & whichModel ) const
 
     if ( whichModel.isValid() && (whichModel.isModelLoaded( ) == false) )
     {
+        TRACE_SCOPE(areg_component_ComponentLoader_loadModel);
+        const uint64_t loadStarted{ DispatcherStatistics::getTimestamp( ) };
         const NERegistry::ComponentThreadList& thrList = whichModel.getThreadList( );
         whichModel.markModelLoaded( true );
         result = true;
-        for ( uint32_t i = 0; result && i < thrList.mListThreads.getSize( ); ++ i )
+        if ( whichModel.hasPooledThreads( ) )
+        {
+            result = ComponentThread::startDispatcherPool( whichModel.getDispatchPoolThreads( ) );
+        }
+
+        // start all threads without waiting, so that they start concurrently,
+        // and then wait once until all of them run. The lock is released
+        // before waiting, because the started threads read their components under the lock.
+        ThreadList startedList( thrList.mListThreads.getSize( ) );
+        do
         {
             Lock lock( mLock );
-            const NERegistry::ComponentThreadEntry& entry = thrList.mListThreads[i];
-            if ( entry.isValid( ) && Thread::findThreadByName( entry.mThreadName ) == nullptr )
+            for ( uint32_t i = 0; result && i < thrList.mListThreads.getSize( ); ++ i )
             {
-                ComponentThread* thrObject = DEBUG_NEW ComponentThread( entry.mThreadName, entry.mWatchdogTimeout );
-                if ( thrObject != nullptr )
+                const NERegistry::ComponentThreadEntry& entry = thrList.mListThreads[i];
+                if ( entry.isValid( ) && Thread::findThreadByName( entry.mThreadName ) == nullptr )
                 {
-                    if ( thrObject->createThread( NECommon::WAIT_INFINITE ) == false )
+                    ComponentThread* thrObject = DEBUG_NEW ComponentThread( entry.mThreadName, entry.mWatchdogTimeout, whichModel.isPooledThread( entry ) );
+                    if ( thrObject != nullptr )
+                    {
+                        thrObject->setPlacement( entry.mPlacement );
+                        thrObject->setWaitPolicy( entry.mWaitPolicy, entry.mSpinTime );
+                        if ( thrObject->createThread( NECommon::DO_NOT_WAIT ) )
+                        {
+                            startedList.add( thrObject );
+                        }
+                        else
+                        {
+                            thrObject->shutdownThread( NECommon::DO_NOT_WAIT );
+                            delete thrObject;
+                            result = false;
+                        }
+                    }
+                    else
                     {
-                        thrObject->shutdownThread( NECommon::DO_NOT_WAIT );
-                        delete thrObject;
                         result = false;
                     }
                 }
                 else
                 {
-                    result = false;
+                    result = entry.isValid( );
                 }
             }
-            else
-            {
-                result = entry.isValid( );
-            }
+        } while ( false );
+
+        for ( Thread * thread : startedList.getData( ) )
+        {
+            thread->waitForThreadRun( NECommon::WAIT_INFINITE );
         }
 
+        TRACE_INFO( "Model [ %s ] started [ %u ] component threads in [ %llu ] us"
+                    , whichModel.getModelName( ).getString( )
+                    , startedList.getSize( )
+                    , static_cast<unsigned long long>((DispatcherStatistics::getTimestamp( ) - loadStarted) / 1000u) );
+
         whichModel.markModelAlive( result );
     }
     else
@@ -19,6 +19,22 @@
 #include "areg/component/ProxyBase.hpp"
 #include "areg/component/ComponentLoader.hpp"
 #include "areg/component/NERegistry.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/private/ServiceManager.hpp"
+#include "areg/base/WorkStealingPool.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_component_ComponentThread_startComponents);
+DEF_TRACE_SCOPE(areg_component_ComponentThread_serviceConnected);
+
+namespace
+{
+    /**
+     * \brief   The name of the shared pool of threads, which run the pooled component threads.
+     **/
+    constexpr std::string_view  DISPATCHER_POOL_NAME    { "_AREG_dispatcher_pool_" };
+}
 
 //////////////////////////////////////////////////////////////////////////
 // ComponentThread class implementation
@@ -47,6 +63,22 @@ bool ComponentThread::setCurrentComponent( Component* curComponent )
     return (comThread != nullptr);
 }
 
+WorkStealingPool & ComponentThread::getDispatcherPool( void )
+{
+    static WorkStealingPool _dispatcherPool( DISPATCHER_POOL_NAME );
+    return _dispatcherPool;
+}
+
+bool ComponentThread::startDispatcherPool( uint32_t threadCount )
+{
+    return ComponentThread::getDispatcherPool().startPool( threadCount );
+}
+
+void ComponentThread::stopDispatcherPool( void )
+{
+    ComponentThread::getDispatcherPool().stopPool( );
+}
+
 inline ComponentThread & ComponentThread::self( void )
 {
     return (*this);
@@ -60,12 +92,22 @@ inline ComponentThread* ComponentThread::_getCurrentComponentThread( void )
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
-ComponentThread::ComponentThread( const String & threadName, uint32_t watchdogTimeout /*= NECommon::WATCHDOG_IGNORE*/ )
+ComponentThread::ComponentThread( const String & threadName, uint32_t watchdogTimeout /*= NECommon::WATCHDOG_IGNORE*/, bool isPooled /*= false*/ )
     : DispatcherThread  ( threadName )
+    , IEPoolTask        ( )
 
     , mCurrentComponent ( nullptr )
-    , mWatchdog         ( self(), watchdogTimeout )
+    , mWatchdog         ( self(), isPooled ? NECommon::WATCHDOG_IGNORE : watchdogTimeout )
+    , mIsPooled         ( isPooled )
+    , mPoolStarted      ( false )
+    , mCollectServers   ( false )
     , mListComponent    ( )
+    , mPoolSignals      ( 0u )
+    , mRegisterServers  ( )
+    , mTimeCreated      ( DispatcherStatistics::getTimestamp() )
+    , mTimeStarted      ( 0u )
+    , mTimeRegistered   ( 0u )
+    , mTimeConnected    ( 0u )
 {
 }
 
@@ -77,19 +119,153 @@ bool ComponentThread::postEvent( Event& eventElem )
     return EventDispatcher::postEvent(eventElem);
 }
 
+ComponentThread::sStartupTimeline ComponentThread::getStartupTimeline( void ) const
+{
+    sStartupTimeline result;
+    result.stCreated    = mTimeCreated;
+    result.stStarted    = mTimeStarted.load( );
+    result.stRegistered = mTimeRegistered.load( );
+    result.stConnected  = mTimeConnected.load( );
+    return result;
+}
+
+void ComponentThread::registerServer( const StubAddress & server )
+{
+    if (mCollectServers)
+    {
+        mRegisterServers.add( server );
+    }
+    else
+    {
+        ServiceManager::requestRegisterServer( server );
+    }
+}
+
+void ComponentThread::serviceConnected( void )
+{
+    uint64_t connected{ 0u };
+    if ((mTimeConnected.load( ) == 0u) && mTimeConnected.compare_exchange_strong( connected, DispatcherStatistics::getTimestamp() ))
+    {
+        TRACE_SCOPE(areg_component_ComponentThread_serviceConnected);
+        const sStartupTimeline timeline{ getStartupTimeline() };
+        TRACE_INFO("Component thread [ %s ] startup timeline: started +%llu us, registered +%llu us, first connect +%llu us after created"
+                    , getName().getString()
+                    , static_cast<unsigned long long>((timeline.stStarted - timeline.stCreated) / 1000u)
+                    , static_cast<unsigned long long>((timeline.stRegistered - timeline.stCreated) / 1000u)
+                    , static_cast<unsigned long long>((timeline.stConnected - timeline.stCreated) / 1000u));
+    }
+}
+
 bool ComponentThread::runDispatcher( void )
 {
     bool result{ false };
-    if (createComponents() > 0)
+    if (_startComponents() > 0)
     {
-        readyForEvents( true );
-        startComponents();
         result = DispatcherThread::runDispatcher();
     }
 
     return result;
 }
 
+bool ComponentThread::createThread( unsigned int waitForStartMs /*= NECommon::DO_NOT_WAIT*/ )
+{
+    if (mIsPooled == false)
+        return DispatcherThread::createThread( waitForStartMs );
+
+    WorkStealingPool & pool{ ComponentThread::getDispatcherPool() };
+    if ((pool.isPoolStarted() == false) && (pool.startPool( 0u ) == false))
+        return false;
+
+    if (createHostedThread() == false)
+        return false;
+
+    // the hosted thread runs as soon as it is created, there is nothing to wait.
+    // the components are created when the thread is run in the pool the first time.
+    mPoolStarted = false;
+    mPoolSignals.store( 1u );
+    const bool result{ startHostedThread() };
+    pool.scheduleTask( static_cast<IEPoolTask &>(self()) );
+    return result;
+}
+
+void ComponentThread::triggerExit( void )
+{
+    DispatcherThread::triggerExit( );
+    if (mIsPooled)
+    {
+        _schedulePooled( );
+    }
+}
+
+void ComponentThread::signalEvent( uint32_t eventCount )
+{
+    if (mIsPooled == false)
+    {
+        DispatcherThread::signalEvent( eventCount );
+    }
+    else if (eventCount != 0)
+    {
+        mStatistics.eventQueued( eventCount );
+        _schedulePooled( );
+    }
+}
+
+void ComponentThread::runTask( void )
+{
+    WorkStealingPool & pool{ ComponentThread::getDispatcherPool() };
+    uint32_t signals{ mPoolSignals.load() };
+    Thread * hosting{ Thread::hostThread(this) };
+
+    bool isRunning{ mPoolStarted || _startPooled() };
+    isRunning = isRunning && dispatchQueuedEvents( POOL_DISPATCH_EVENTS );
+    if (isRunning == false)
+    {
+        completeDispatcher( );
+        // the object may be deleted when the thread exits, do not access it anymore.
+        exitHostedThread( );
+        Thread::hostThread( hosting );
+        return;
+    }
+
+    // if new events are signaled while dispatching, the thread is scheduled again,
+    // otherwise the next signal schedules it. The check is still made as the hosted thread.
+    const bool reschedule{ hasQueuedEvents() || (mPoolSignals.compare_exchange_strong( signals, 0u ) == false) };
+    Thread::hostThread( hosting );
+    if (reschedule)
+    {
+        mPoolSignals.store( 1u );
+        pool.scheduleTask( static_cast<IEPoolTask &>(self()) );
+    }
+}
+
+inline void ComponentThread::_schedulePooled( void )
+{
+    if (mPoolSignals.fetch_add( 1u ) == 0u)
+    {
+        ComponentThread::getDispatcherPool().scheduleTask( static_cast<IEPoolTask &>(self()) );
+    }
+}
+
+bool ComponentThread::_startPooled( void )
+{
+    mPoolStarted = true;
+    return (isRunning() && (_startComponents() > 0));
+}
+
+inline int ComponentThread::_startComponents( void )
+{
+    mTimeStarted.store( DispatcherStatistics::getTimestamp() );
+    int result{ createComponents() };
+    if (result > 0)
+    {
+        readyForEvents( true );
+        startComponents( );
+    }
+
+    mTimeRegistered.store( DispatcherStatistics::getTimestamp() );
+    return result;
+}
+
 int ComponentThread::createComponents( void )
 {
     int result = 0;
@@ -137,6 +313,10 @@ void ComponentThread::destroyComponents( void )
 
 void ComponentThread::startComponents( void )
 {
+    TRACE_SCOPE(areg_component_ComponentThread_startComponents);
+
+    // collect the services of all components and register them by one request.
+    mCollectServers = true;
     ListComponent::LISTPOS pos = mListComponent.lastPosition();
     while (mListComponent.isValidPosition(pos))
     {
@@ -144,6 +324,18 @@ void ComponentThread::startComponents( void )
         ASSERT(comObj != nullptr);
         comObj->startupComponent(self());
     }
+
+    mCollectServers = false;
+    TRACE_DBG("Component thread [ %s ] started [ %u ] components with [ %u ] services"
+                , getName().getString()
+                , mListComponent.getSize()
+                , mRegisterServers.getSize());
+
+    if (mRegisterServers.isEmpty() == false)
+    {
+        ServiceManager::requestRegisterServers( mRegisterServers );
+        mRegisterServers.clear( );
+    }
 }
 
 void ComponentThread::shutdownComponents( void )
@@ -173,7 +365,7 @@ void ComponentThread::terminateSelf(void)
 {
     mHasStarted = false;
     removeAllEvents();
-    mEventExit.setEvent();
+    signalExit( );
 
     _shutdownProxies();
 
@@ -232,6 +424,12 @@ Thread::eCompletionStatus ComponentThread::shutdownThread( unsigned int waitForS
         comObj->notifyComponentShutdown( self( ) );
     }
 
+    if (mIsPooled)
+    {
+        stopDispatcher( );
+        _schedulePooled( );
+    }
+
     return DispatcherThread::shutdownThread( waitForStopMs );
 }
 
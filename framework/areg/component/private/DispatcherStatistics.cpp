@@ -0,0 +1,265 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/DispatcherStatistics.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Dispatcher Statistics class.
+ *              The queue depth, waiting and running time of the dispatched events.
+ *
+ ************************************************************************/
+#include "areg/component/DispatcherStatistics.hpp"
+
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TELinkedList.hpp"
+#include "areg/component/Event.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/component/private/EventDispatcherBase.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_component_private_DispatcherStatistics_logStatistics);
+
+namespace
+{
+    //! The list of the statistics of existing dispatchers.
+    TELinkedList<DispatcherStatistics *> & _listStatistics( void )
+    {
+        static TELinkedList<DispatcherStatistics *> _list;
+        return _list;
+    }
+
+    //! The lock of the list of the statistics.
+    ResourceLock & _statisticsLock( void )
+    {
+        static ResourceLock _lock;
+        return _lock;
+    }
+
+    //! Returns the key of the event class and message ID.
+    inline uint64_t _eventKey( const Event & eventElem )
+    {
+        return ((static_cast<uint64_t>(eventElem.getRuntimeClassId().getMagic()) << 32) | static_cast<uint64_t>(eventElem.getMessageId()));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// DispatcherStatistics::EventEntry structure declaration
+//////////////////////////////////////////////////////////////////////////
+struct DispatcherStatistics::EventEntry
+{
+    EventEntry( uint64_t key, const String & eventName, uint32_t messageId )
+        : eeKey         ( key )
+        , eeEventName   ( eventName )
+        , eeMessageId   ( messageId )
+        , eeDispatched  ( 0u )
+        , eeMissed      ( 0u )
+        , eeWaitTime    ( )
+        , eeRunTime     ( )
+    {
+    }
+
+    const uint64_t          eeKey;          //!< The key of the event class and message ID.
+    const String            eeEventName;    //!< The name of the event class.
+    const uint32_t          eeMessageId;    //!< The ID of the service message.
+    std::atomic_uint64_t    eeDispatched;   //!< The number of dispatched events.
+    std::atomic_uint64_t    eeMissed;       //!< The number of events dispatched after the deadline.
+    LatencyHistogram        eeWaitTime;     //!< The time the events waited in the queue.
+    LatencyHistogram        eeRunTime;      //!< The time to process the events.
+};
+
+//////////////////////////////////////////////////////////////////////////
+// DispatcherStatistics class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void DispatcherStatistics::collectStatistics( DispatcherStatistics::ListStatistics & OUT out_list )
+{
+    Lock lock( _statisticsLock() );
+    const TELinkedList<DispatcherStatistics *> & list{ _listStatistics() };
+    out_list.clear( );
+    out_list.reserve( list.getSize() );
+    for (const DispatcherStatistics * entry : list.getData())
+    {
+        out_list.add( entry->getStatistics() );
+    }
+}
+
+void DispatcherStatistics::logStatistics( void )
+{
+    TRACE_SCOPE(areg_component_private_DispatcherStatistics_logStatistics);
+
+    DispatcherStatistics::ListStatistics list;
+    DispatcherStatistics::collectStatistics( list );
+    for (const auto & stats : list.getData())
+    {
+        TRACE_INFO("Dispatcher [ %s ], wait policy [ %s ]: queue %u (peak %u), dispatched %llu, dropped %llu, cancelled %llu, missed deadlines %llu, coalesced %llu, wait p50/p99/max %llu / %llu / %llu ns, run p50/p99/max %llu / %llu / %llu ns"
+                    , stats.dsDispatcherName.getString()
+                    , NECommon::getString(stats.dsWaitPolicy)
+                    , stats.dsQueueSize
+                    , stats.dsQueuePeak
+                    , static_cast<unsigned long long>(stats.dsDispatched)
+                    , static_cast<unsigned long long>(stats.dsDropped)
+                    , static_cast<unsigned long long>(stats.dsCancelled)
+                    , static_cast<unsigned long long>(stats.dsDeadlineMissed)
+                    , static_cast<unsigned long long>(stats.dsCoalesced)
+                    , static_cast<unsigned long long>(stats.dsWaitMedian)
+                    , static_cast<unsigned long long>(stats.dsWaitP99)
+                    , static_cast<unsigned long long>(stats.dsWaitMax)
+                    , static_cast<unsigned long long>(stats.dsRunMedian)
+                    , static_cast<unsigned long long>(stats.dsRunP99)
+                    , static_cast<unsigned long long>(stats.dsRunMax));
+
+        for (const auto & event : stats.dsEvents.getData())
+        {
+            TRACE_INFO("    Event [ %s ], message [ 0x%X ]: dispatched %llu, missed deadlines %llu, wait p50/p99/max %llu / %llu / %llu ns, run p50/p99/max %llu / %llu / %llu ns"
+                        , event.esEventName.isEmpty() ? "<others>" : event.esEventName.getString()
+                        , event.esMessageId
+                        , static_cast<unsigned long long>(event.esDispatched)
+                        , static_cast<unsigned long long>(event.esDeadlineMissed)
+                        , static_cast<unsigned long long>(event.esWaitMedian)
+                        , static_cast<unsigned long long>(event.esWaitP99)
+                        , static_cast<unsigned long long>(event.esWaitMax)
+                        , static_cast<unsigned long long>(event.esRunMedian)
+                        , static_cast<unsigned long long>(event.esRunP99)
+                        , static_cast<unsigned long long>(event.esRunMax));
+        }
+    }
+}
+
+DispatcherStatistics::DispatcherStatistics( EventDispatcherBase & dispatcher )
+    : mDispatcher   ( dispatcher )
+    , mDispatched   ( 0u )
+    , mDropped      ( 0u )
+    , mCancelled    ( 0u )
+    , mDeadlineMissed( 0u )
+    , mQueuePeak    ( 0u )
+    , mEntries      { }
+    , mWaitTime     ( )
+    , mRunTime      ( )
+{
+    for (auto & entry : mEntries)
+    {
+        entry.store( nullptr, std::memory_order_relaxed );
+    }
+
+    Lock lock( _statisticsLock() );
+    _listStatistics().pushLast( this );
+}
+
+DispatcherStatistics::~DispatcherStatistics( void )
+{
+    do
+    {
+        Lock lock( _statisticsLock() );
+        _listStatistics().removeEntry( this );
+    } while (false);
+
+    for (auto & entry : mEntries)
+    {
+        delete entry.exchange( nullptr );
+    }
+}
+
+DispatcherStatistics::sDispatcherStatistics DispatcherStatistics::getStatistics( void ) const
+{
+    sDispatcherStatistics result;
+    result.dsDispatcherName = mDispatcher.getDispatcherName( );
+    result.dsWaitPolicy     = mDispatcher.getWaitPolicy( );
+    result.dsQueueSize      = mDispatcher.getQueueSize( );
+    result.dsQueuePeak      = mQueuePeak.load( std::memory_order_relaxed );
+    result.dsDispatched     = mDispatched.load( std::memory_order_relaxed );
+    result.dsDropped        = mDropped.load( std::memory_order_relaxed );
+    result.dsCancelled      = mCancelled.load( std::memory_order_relaxed );
+    result.dsDeadlineMissed = mDeadlineMissed.load( std::memory_order_relaxed );
+    result.dsCoalesced      = mDispatcher.getCoalescedCount( );
+    result.dsWaitMedian     = mWaitTime.getPercentile( 50.0 );
+    result.dsWaitP99        = mWaitTime.getPercentile( 99.0 );
+    result.dsWaitMax        = mWaitTime.getMaxValue( );
+    result.dsRunMedian      = mRunTime.getPercentile( 50.0 );
+    result.dsRunP99         = mRunTime.getPercentile( 99.0 );
+    result.dsRunMax         = mRunTime.getMaxValue( );
+
+    for (const auto & slot : mEntries)
+    {
+        const EventEntry * entry{ slot.load( std::memory_order_acquire ) };
+        if (entry != nullptr)
+        {
+            sEventStatistics event;
+            event.esEventName   = entry->eeEventName;
+            event.esMessageId   = entry->eeMessageId;
+            event.esDispatched  = entry->eeDispatched.load( std::memory_order_relaxed );
+            event.esDeadlineMissed  = entry->eeMissed.load( std::memory_order_relaxed );
+            event.esWaitMedian  = entry->eeWaitTime.getPercentile( 50.0 );
+            event.esWaitP99     = entry->eeWaitTime.getPercentile( 99.0 );
+            event.esWaitMax     = entry->eeWaitTime.getMaxValue( );
+            event.esRunMedian   = entry->eeRunTime.getPercentile( 50.0 );
+            event.esRunP99      = entry->eeRunTime.getPercentile( 99.0 );
+            event.esRunMax      = entry->eeRunTime.getMaxValue( );
+            result.dsEvents.add( event );
+        }
+    }
+
+    return result;
+}
+
+void DispatcherStatistics::eventDispatched( const Event & eventElem, uint64_t started, uint64_t completed )
+{
+    const uint64_t queued{ eventElem.getQueuedTime() };
+    const uint64_t waitTime{ (queued != 0u) && (started > queued) ? started - queued : 0u };
+    const uint64_t runTime{ completed > started ? completed - started : 0u };
+
+    mDispatched.store( mDispatched.load( std::memory_order_relaxed ) + 1u, std::memory_order_relaxed );
+    mWaitTime.recordValue( waitTime );
+    mRunTime.recordValue( runTime );
+
+    EventEntry & entry{ _getEventEntry( eventElem ) };
+    entry.eeDispatched.store( entry.eeDispatched.load( std::memory_order_relaxed ) + 1u, std::memory_order_relaxed );
+    entry.eeWaitTime.recordValue( waitTime );
+    entry.eeRunTime.recordValue( runTime );
+
+    const uint64_t deadline{ eventElem.getDeadline() };
+    if ((deadline != 0u) && (started > deadline))
+    {
+        mDeadlineMissed.store( mDeadlineMissed.load( std::memory_order_relaxed ) + 1u, std::memory_order_relaxed );
+        entry.eeMissed.store( entry.eeMissed.load( std::memory_order_relaxed ) + 1u, std::memory_order_relaxed );
+    }
+}
+
+DispatcherStatistics::EventEntry & DispatcherStatistics::_getEventEntry( const Event & eventElem )
+{
+    const uint64_t key{ _eventKey( eventElem ) };
+    // Fibonacci hashing of the key, then linear probing in the table.
+    const uint32_t start{ static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32) % MAX_EVENT_ENTRIES };
+    for (uint32_t i = 0; i < MAX_EVENT_ENTRIES; ++ i)
+    {
+        std::atomic<EventEntry *> & slot{ mEntries[(start + i) % MAX_EVENT_ENTRIES] };
+        EventEntry * entry{ slot.load( std::memory_order_relaxed ) };
+        if (entry == nullptr)
+        {
+            // only the dispatching thread creates the entries, the readers see the complete entry.
+            entry = DEBUG_NEW EventEntry( key, eventElem.getRuntimeClassName(), eventElem.getMessageId() );
+            slot.store( entry, std::memory_order_release );
+            return (*entry);
+        }
+        else if (entry->eeKey == key)
+        {
+            return (*entry);
+        }
+    }
+
+    std::atomic<EventEntry *> & others{ mEntries[MAX_EVENT_ENTRIES] };
+    EventEntry * entry{ others.load( std::memory_order_relaxed ) };
+    if (entry == nullptr)
+    {
+        entry = DEBUG_NEW EventEntry( 0u, String::EmptyString, NEService::INVALID_MESSAGE_ID );
+        others.store( entry, std::memory_order_release );
+    }
+
+    return (*entry);
+}
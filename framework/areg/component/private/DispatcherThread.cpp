@@ -238,7 +238,7 @@ void DispatcherThread::triggerExit( void )
         mExternaEvents.pushEvent( ExitEvent::getExitEvent( ) );
     }
 
-    mEventExit.setEvent( );
+    signalExit( );
     mExternaEvents.unlockQueue( );
 }
 
@@ -15,8 +15,10 @@
  ************************************************************************/
 #include "areg/component/Event.hpp"
 
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/IEEventConsumer.hpp"
+#include "areg/component/NEService.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // Event class declaration
@@ -76,6 +78,8 @@ Event::Event( void )
     , mEventPrio    ( DefaultPriority )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mQueuedTime   ( 0u )
+    , mDeadline     ( 0u )
 {
 }
 
@@ -85,6 +89,8 @@ Event::Event( Event::eEventType eventType )
     , mEventPrio    ( DefaultPriority )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mQueuedTime   ( 0u )
+    , mDeadline     ( 0u )
 {
 }
 
@@ -122,6 +128,11 @@ void Event::deliverEvent( void )
     }
 }
 
+void Event::setDeadlineTimeout( unsigned int timeoutUs )
+{
+    mDeadline = (timeoutUs != 0u ? DispatcherStatistics::getTimestamp( ) + static_cast<uint64_t>(timeoutUs) * 1000u : 0u);
+}
+
 bool Event::registerForThread( id_type whichThread /*= 0*/ )
 {
     return registerForThread(whichThread != 0 ? RUNTIME_CAST(Thread::findThreadById(whichThread), DispatcherThread)
@@ -158,6 +169,21 @@ bool Event::removeEventListener( IEEventConsumer& eventConsumer )
     return getDispatcher().unregisterEventConsumer(getRuntimeClassId(), eventConsumer);
 }
 
+unsigned int Event::getMessageId( void ) const
+{
+    return NEService::INVALID_MESSAGE_ID;
+}
+
+uint64_t Event::getCoalesceKey( void ) const
+{
+    return 0u;
+}
+
+bool Event::canReplaceEvent( const Event & /*queuedEvent*/ ) const
+{
+    return true;
+}
+
 void Event::dispatchSelf( IEEventConsumer* consumer )
 {
     consumer = consumer != nullptr ? consumer : this->mConsumer;
@@ -26,6 +26,23 @@ namespace
     //! The default name of the event stream.
     static constexpr std::string_view DefaultStreamName{ "EventDataStream" };
 
+    //! The shared buffer of the calling thread to reference the data of event data streams.
+    thread_local const SharedBuffer * _sharedSource{ nullptr };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EventDataStream::SharedSourceScope class implementation
+//////////////////////////////////////////////////////////////////////////
+
+EventDataStream::SharedSourceScope::SharedSourceScope( const SharedBuffer & source )
+    : mPrevSource   ( _sharedSource )
+{
+    _sharedSource = &source;
+}
+
+EventDataStream::SharedSourceScope::~SharedSourceScope( void )
+{
+    _sharedSource = mPrevSource;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -45,6 +62,7 @@ EventDataStream::EventDataStream( EventDataStream::eEventData evetDataType, cons
     , mEventDataType(evetDataType)
     , mBufferName   (name.isEmpty() == false ? name : DefaultStreamName)
     , mDataBuffer   ( )
+    , mDataBegin    ( 0 )
     , mSharedList   ( )
 {
 }
@@ -55,9 +73,10 @@ EventDataStream::EventDataStream( const EventDataStream & buffer, const String &
     , mEventDataType(buffer.mEventDataType)
     , mBufferName   (name.isEmpty() == false ? name : DefaultStreamName)
     , mDataBuffer   (buffer.mDataBuffer)
+    , mDataBegin    (buffer.mDataBegin)
     , mSharedList   (buffer.mSharedList)
 {
-    mDataBuffer.moveToBegin();
+    resetCursor();
 }
 
 EventDataStream::EventDataStream( const EventDataStream & src )
@@ -66,8 +85,10 @@ EventDataStream::EventDataStream( const EventDataStream & src )
     , mEventDataType(src.mEventDataType)
     , mBufferName   (src.mBufferName)
     , mDataBuffer   (src.mDataBuffer)
+    , mDataBegin    (src.mDataBegin)
     , mSharedList   (src.mSharedList)
 {
+    resetCursor();
 }
 
 EventDataStream::EventDataStream( EventDataStream && src ) noexcept
@@ -76,8 +97,10 @@ EventDataStream::EventDataStream( EventDataStream && src ) noexcept
     , mEventDataType( src.mEventDataType )
     , mBufferName   ( std::move(src.mBufferName) )
     , mDataBuffer   ( std::move(src.mDataBuffer) )
+    , mDataBegin    ( src.mDataBegin )
     , mSharedList   ( std::move(src.mSharedList) )
 {
+    src.mDataBegin = 0;
 }
 
 EventDataStream::EventDataStream(const IEInStream & stream)
@@ -86,9 +109,11 @@ EventDataStream::EventDataStream(const IEInStream & stream)
     , mEventDataType( EventDataStream::eEventData::EventDataExternal)
     , mBufferName   ( DefaultStreamName)
     , mDataBuffer   ( )
+    , mDataBegin    ( 0 )
     , mSharedList   ( )
 {
-    stream >> mEventDataType >> mBufferName >> mDataBuffer;
+    stream >> mEventDataType >> mBufferName;
+    _readData(stream);
 }
 
 EventDataStream::~EventDataStream( void )
@@ -106,7 +131,8 @@ EventDataStream & EventDataStream::operator = ( const EventDataStream & src )
     {
         mSharedList = src.mSharedList;
         mDataBuffer = src.mDataBuffer;
-        mDataBuffer.moveToBegin();
+        mDataBegin  = src.mDataBegin;
+        resetCursor();
     }
 
     return (*this);
@@ -118,7 +144,9 @@ EventDataStream & EventDataStream::operator = ( EventDataStream && src ) noexcep
     {
         mSharedList = std::move(src.mSharedList);
         mDataBuffer = std::move(src.mDataBuffer);
-        mDataBuffer.moveToBegin( );
+        mDataBegin  = src.mDataBegin;
+        src.mDataBegin = 0;
+        resetCursor();
     }
 
     return (*this);
@@ -158,18 +186,31 @@ unsigned int EventDataStream::read( WideString & wide ) const
     return mDataBuffer.read(wide);
 }
 
+bool EventDataStream::getDataView( BufferView & out_view ) const
+{
+    out_view.release();
+    if (mSharedList.isEmpty() && (mDataBuffer.getSizeUsed() > mDataBegin))
+    {
+        out_view = BufferView(mDataBuffer, mDataBegin, mDataBuffer.getSizeUsed() - mDataBegin);
+    }
+
+    return (out_view.isEmpty() == false);
+}
+
 void EventDataStream::resetCursor( void ) const
 {
-    mDataBuffer.moveToBegin();
+    mDataBuffer.setPosition(static_cast<int>(mDataBegin), IECursorPosition::eCursorPosition::PositionBegin);
 }
 
 unsigned int EventDataStream::write( const unsigned char* buffer, unsigned int size )
 {
+    _detachSource();
     return mDataBuffer.write(buffer, size);
 }
 
 unsigned int EventDataStream::write( const IEByteBuffer & buffer )
 {
+    _detachSource();
     unsigned int result = 0;
     if (mEventDataType == EventDataStream::eEventData::EventDataInternal)
     {
@@ -186,11 +227,13 @@ unsigned int EventDataStream::write( const IEByteBuffer & buffer )
 
 unsigned int EventDataStream::write( const String & ascii )
 {
+    _detachSource();
     return mDataBuffer.write(ascii);
 }
 
 unsigned int EventDataStream::write( const WideString & wide )
 {
+    _detachSource();
     return mDataBuffer.write(wide);
 }
 
@@ -209,3 +252,58 @@ unsigned int EventDataStream::getSizeWritable( void ) const
     ASSERT(false);
     return 0;
 }
+
+void EventDataStream::_readData( const IEInStream & stream )
+{
+    mDataBegin = 0;
+    const SharedBuffer * source{ _sharedSource };
+    if ((source == nullptr) || (static_cast<const IEInStream *>(source) != &stream))
+    {
+        stream >> mDataBuffer;
+        return;
+    }
+
+    unsigned int length{ 0 };
+    stream >> length;
+    const unsigned int begin{ source->getPosition() };
+    if ((length != 0) && (begin + length == source->getSizeUsed()))
+    {
+        // The data is the last entry of the source, reference it without copying.
+        mDataBuffer = *source;
+        mDataBegin  = begin;
+        source->setPosition(static_cast<int>(length), IECursorPosition::eCursorPosition::PositionCurrent);
+    }
+    else
+    {
+        source->setPosition(-static_cast<int>(sizeof(unsigned int)), IECursorPosition::eCursorPosition::PositionCurrent);
+        stream >> mDataBuffer;
+    }
+
+    resetCursor();
+}
+
+void EventDataStream::_writeData( IEOutStream & stream ) const
+{
+    if (mDataBegin == 0)
+    {
+        stream << mDataBuffer;
+    }
+    else
+    {
+        const unsigned int length{ mDataBuffer.getSizeUsed() - mDataBegin };
+        stream << length;
+        stream.write(mDataBuffer.getBuffer() + mDataBegin, length);
+        resetCursor();
+    }
+}
+
+void EventDataStream::_detachSource( void )
+{
+    if (mDataBegin != 0)
+    {
+        const unsigned int position{ mDataBuffer.getPosition() };
+        mDataBuffer = SharedBuffer(mDataBuffer.getBuffer() + mDataBegin, mDataBuffer.getSizeUsed() - mDataBegin);
+        mDataBuffer.setPosition(static_cast<int>(position - mDataBegin), IECursorPosition::eCursorPosition::PositionBegin);
+        mDataBegin  = 0;
+    }
+}
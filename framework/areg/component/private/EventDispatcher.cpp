@@ -48,7 +48,7 @@ bool EventDispatcher::onThreadRegistered( Thread * threadObj )
     ASSERT(mDispatcherThread != nullptr);
 
     EventDispatcherBase::removeAllEvents( );
-    return EventDispatcherBase::mEventExit.resetEvent();
+    return EventDispatcherBase::resetExit( );
 }
 
 void EventDispatcher::onThreadUnregistering( void )
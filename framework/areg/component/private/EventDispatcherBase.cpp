@@ -19,6 +19,42 @@
 #include "areg/component/IEEventConsumer.hpp"
 #include "areg/component/private/ExitEvent.hpp"
 
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <intrin.h>
+#endif  // defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+
+/**
+ * \brief   The dispatcher, which directly processes an event in the current thread.
+ **/
+__THREAD_LOCAL EventDispatcherBase * _directDispatcher  { nullptr };
+
+namespace
+{
+    /**
+     * \brief   The number of spins between the checks of the exit event and the spinning time.
+     **/
+    constexpr uint32_t  SPIN_CHECK_COUNT    { 64u };
+
+    /**
+     * \brief   Hints the CPU that the thread spins, so that it saves power and
+     *          lets the other hardware thread of the core run.
+     **/
+    inline void _cpuPause( void )
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause( );
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+        __builtin_ia32_pause( );
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+        asm volatile( "yield" );
+#else   // other platforms
+        std::this_thread::yield( );
+#endif  // defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventDispatcherBase class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -37,6 +73,12 @@ EventDispatcherBase::EventDispatcherBase(const String & name )
     , mEventExit        ( false, false )
     , mEventQueue       ( true, false )
     , mHasStarted       ( false )
+    , mWaitPolicy       ( NECommon::eWaitPolicy::WaitBlocking )
+    , mSpinTime         ( static_cast<uint64_t>(NECommon::SPIN_TIME_DEFAULT) * 1'000u )
+    , mIsSpinning       ( false )
+    , mSpinWakeup       ( false )
+    , mExitRequested    ( false )
+    , mStatistics       ( self() )
 {
 }
 
@@ -56,12 +98,34 @@ bool EventDispatcherBase::isExitEvent( const Event * anEvent ) const
 
 void EventDispatcherBase::signalEvent( uint32_t eventCount )
 {
-    eventCount != 0 ? mEventQueue.setEvent() : mEventQueue.resetEvent();
+    if (eventCount != 0)
+    {
+        mStatistics.eventQueued( eventCount );
+        // the spinning dispatcher does not need the system call to wake up.
+        if (mIsSpinning.load())
+        {
+            mSpinWakeup.store( true );
+        }
+        else
+        {
+            mEventQueue.setEvent();
+        }
+    }
+    else
+    {
+        mEventQueue.resetEvent();
+    }
+}
+
+void EventDispatcherBase::setWaitPolicy( NECommon::eWaitPolicy policy, uint32_t spinTimeUs /*= NECommon::SPIN_TIME_DEFAULT*/ )
+{
+    mWaitPolicy = policy;
+    mSpinTime   = static_cast<uint64_t>(spinTimeUs) * 1'000u;
 }
 
 bool EventDispatcherBase::startDispatcher( void )
 {
-    mEventExit.resetEvent( );
+    resetExit( );
     return runDispatcher( );
 }
 
@@ -74,7 +138,7 @@ void EventDispatcherBase::stopDispatcher( void )
         mExternaEvents.pushEvent( ExitEvent::getExitEvent( ) );
     }
 
-    mEventExit.setEvent( );
+    signalExit( );
     mExternaEvents.unlockQueue( );
 }
 
@@ -83,7 +147,7 @@ void EventDispatcherBase::exitDispatcher(void)
     mInternalEvents.removeAllEvents();
     mExternaEvents.removeAllEvents();
 
-    mEventExit.setEvent();
+    signalExit( );
 }
 
 void EventDispatcherBase::shutdownDispatcher( void )
@@ -95,7 +159,7 @@ void EventDispatcherBase::shutdownDispatcher( void )
         mExternaEvents.pushEvent(ExitEvent::getExitEvent());
     }
 
-    mEventExit.setEvent( );
+    signalExit( );
     mExternaEvents.unlockQueue( );
 }
 
@@ -104,8 +168,9 @@ bool EventDispatcherBase::queueEvent( Event& eventElem )
     bool result{ false };
     if ( mHasStarted )
     {
+        eventElem.setQueuedTime( DispatcherStatistics::getTimestamp() );
         Event::eEventType eventType = eventElem.getEventType();
-        if (Event::isInternal(eventType))
+        if (Event::isInternal(eventType) || ((_directDispatcher == this) && Event::isProxyEvent(eventType)))
         {
             mInternalEvents.pushEvent(eventElem);
             result = true;
@@ -116,7 +181,37 @@ bool EventDispatcherBase::queueEvent( Event& eventElem )
             result = true;
         }
     }
+    else
+    {
+        mStatistics.eventDropped( );
+    }
+
+    return result;
+}
+
+void EventDispatcherBase::setEventCoalescing( uint64_t coalesceKey, bool enable )
+{
+    mExternaEvents.setCoalescing( coalesceKey, enable );
+    mInternalEvents.setCoalescing( coalesceKey, enable );
+}
+
+uint64_t EventDispatcherBase::getCoalescedCount( void ) const
+{
+    return (mExternaEvents.getCoalescedCount( ) + mInternalEvents.getCoalescedCount( ));
+}
+
+EventDispatcherBase * EventDispatcherBase::setDirectDispatcher( EventDispatcherBase * dispatcher )
+{
+    EventDispatcherBase * result{ _directDispatcher };
+    _directDispatcher = dispatcher;
+    return result;
+}
 
+uint32_t EventDispatcherBase::getQueueSize( void )
+{
+    mExternaEvents.lockQueue( );
+    const uint32_t result{ mExternaEvents.getCount( ) + mInternalEvents.getCount( ) };
+    mExternaEvents.unlockQueue( );
     return result;
 }
 
@@ -216,7 +311,7 @@ bool EventDispatcherBase::runDispatcher( void )
 
     do 
     {
-        whichEvent = multiLock.lock(NECommon::WAIT_INFINITE, false);
+        whichEvent = _waitForEvents(multiLock);
         Event* eventElem = whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) ? pickEvent() : nullptr;
         if ( static_cast<const Event *>(eventElem) != static_cast<const Event *>(&exitEvent) )
         {
@@ -232,7 +327,7 @@ bool EventDispatcherBase::runDispatcher( void )
                     // proceed one external event.
                     if (prepareDispatchEvent(eventElem) )
                     {
-                        dispatchEvent(*eventElem);
+                        _dispatchMeasured(*eventElem);
                     }
 
                     postDispatchEvent(eventElem);
@@ -258,13 +353,54 @@ bool EventDispatcherBase::runDispatcher( void )
 
     } while (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue));
 
-    readyForEvents(false);
-    removeAllEvents( );
-    _clean();
+    completeDispatcher();
 
     return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
 }
 
+inline int EventDispatcherBase::_waitForEvents( MultiLock & multiLock )
+{
+    if ((mWaitPolicy != NECommon::eWaitPolicy::WaitBlocking) && _spinForEvents())
+    {
+        return static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+    }
+
+    return multiLock.lock(NECommon::WAIT_INFINITE, false);
+}
+
+bool EventDispatcherBase::_spinForEvents( void )
+{
+    // Set the spinning flag before checking the queue. The event queued after
+    // the check sees the flag and sets the wakeup flag instead of the queue event.
+    mSpinWakeup.store( false );
+    mIsSpinning.store( true );
+
+    const bool busyPoll{ mWaitPolicy == NECommon::eWaitPolicy::WaitBusyPoll };
+    const uint64_t spinEnd{ DispatcherStatistics::getTimestamp() + mSpinTime };
+    bool result{ mExternaEvents.isEmpty() == false };
+    for (uint32_t i = 1; result == false; ++ i)
+    {
+        if (mSpinWakeup.load( std::memory_order_relaxed ))
+        {
+            result = true;
+        }
+        else if ((i % SPIN_CHECK_COUNT) == 0)
+        {
+            if (mExitRequested.load( std::memory_order_relaxed ) || ((busyPoll == false) && (DispatcherStatistics::getTimestamp() >= spinEnd)))
+                break;
+        }
+        else
+        {
+            _cpuPause();
+        }
+    }
+
+    // The event queued before resetting the flag may have skipped the queue event,
+    // check the queue again before blocking.
+    mIsSpinning.store( false );
+    return (result || (mExternaEvents.isEmpty() == false));
+}
+
 void EventDispatcherBase::readyForEvents( bool isReady )
 {
     mExternaEvents.lockQueue( );
@@ -344,7 +480,55 @@ inline void EventDispatcherBase::_clean()
     mConsumerMap.unlock();
 }
 
+bool EventDispatcherBase::dispatchQueuedEvents( uint32_t maxEvents )
+{
+    const ExitEvent& exitEvent = ExitEvent::getExitEvent();
+    for (uint32_t i = 0; i < maxEvents; ++ i)
+    {
+        if (mEventExit.lock(NECommon::DO_NOT_WAIT))
+            return false;
+
+        Event* eventElem = pickEvent();
+        if (eventElem == nullptr)
+            break;
+        else if (static_cast<const Event *>(eventElem) == static_cast<const Event *>(&exitEvent))
+            return false;
+
+        do
+        {
+            if (prepareDispatchEvent(eventElem))
+            {
+                _dispatchMeasured(*eventElem);
+            }
+
+            postDispatchEvent(eventElem);
+
+            // proceed internal events after external, unless the exit is requested.
+            eventElem = nullptr;
+            if ((static_cast<EventQueue &>(mInternalEvents).isEmpty() == false) && (mEventExit.lock(NECommon::DO_NOT_WAIT) == false))
+            {
+                eventElem = mInternalEvents.popEvent();
+            }
+
+        } while (eventElem != nullptr);
+    }
+
+    return true;
+}
+
+bool EventDispatcherBase::hasQueuedEvents( void )
+{
+    return (mExternaEvents.isEmpty() == false) || mEventExit.lock(NECommon::DO_NOT_WAIT);
+}
+
+void EventDispatcherBase::completeDispatcher( void )
+{
+    readyForEvents(false);
+    removeAllEvents( );
+    _clean();
+}
+
 bool EventDispatcherBase::pulseExit(void)
 {
-    return mEventExit.setEvent();
+    return signalExit( );
 }
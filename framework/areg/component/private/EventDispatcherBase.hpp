@@ -32,11 +32,14 @@
 #include "areg/component/private/IEQueueListener.hpp"
 #include "areg/component/private/IEEventDispatcher.hpp"
 
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/private/EventConsumerMap.hpp"
 #include "areg/component/private/EventQueue.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
 
+#include <atomic>
+
 /************************************************************************
  * Dependencies
  ************************************************************************/
@@ -136,6 +139,60 @@ public:
      **/
     bool isExitEvent( const Event * anEvent ) const;
 
+    /**
+     * \brief   Returns the name of the dispatcher.
+     **/
+    inline const String & getDispatcherName( void ) const;
+
+    /**
+     * \brief   Returns the number of external and internal events in the queues.
+     **/
+    uint32_t getQueueSize( void );
+
+    /**
+     * \brief   Enables or disables coalescing of the queued events with the specified key.
+     *          If enabled, the event with the key replaces the queued and not processed
+     *          event with the same key, so that only the latest event is dispatched.
+     * \param   coalesceKey The coalescing key of the events, see Event::getCoalesceKey().
+     * \param   enable      If true, the events with the key are coalesced.
+     **/
+    void setEventCoalescing( uint64_t coalesceKey, bool enable );
+
+    /**
+     * \brief   Returns the number of queued events replaced by the new events with the same key.
+     **/
+    uint64_t getCoalescedCount( void ) const;
+
+    /**
+     * \brief   Returns the statistics of queued and dispatched events.
+     **/
+    inline DispatcherStatistics & getStatistics( void );
+
+    /**
+     * \brief   Sets the dispatcher, which directly processes an event in the calling thread
+     *          without queueing it, and returns the previous one. While it is set, the service
+     *          responses, which this thread sends to the proxies of the same dispatcher, are
+     *          queued in the internal queue without locking, and are dispatched right after
+     *          the current event. Pass the returned value when the direct processing completes.
+     * \param   dispatcher  The dispatcher of the calling thread or nullptr to reset.
+     * \return  Returns the dispatcher, which was set before.
+     **/
+    static EventDispatcherBase * setDirectDispatcher( EventDispatcherBase * dispatcher );
+
+    /**
+     * \brief   Sets the policy to wait for the events when the queue is empty.
+     *          Should be set before the dispatcher starts.
+     * \param   policy      The wait policy of the dispatcher.
+     * \param   spinTimeUs  The time in microseconds, which the dispatcher with
+     *                      the adaptive wait policy spins before it blocks.
+     **/
+    void setWaitPolicy( NECommon::eWaitPolicy policy, uint32_t spinTimeUs = NECommon::SPIN_TIME_DEFAULT );
+
+    /**
+     * \brief   Returns the policy to wait for the events when the queue is empty.
+     **/
+    inline NECommon::eWaitPolicy getWaitPolicy( void ) const;
+
 /************************************************************************/
 // IEEventDispatcher overrides
 /************************************************************************/
@@ -300,6 +357,44 @@ protected:
      **/
     virtual void readyForEvents( bool isReady );
 
+/************************************************************************/
+// EventDispatcherBase operations
+/************************************************************************/
+
+    /**
+     * \brief   Dispatches the queued events without waiting for new events.
+     *          Each external event is followed by the queued internal events.
+     *          Used by the dispatchers, which do not own a thread and run
+     *          on the threads of a pool.
+     * \param   maxEvents   The maximum number of external events to dispatch.
+     * \return  Returns false if the dispatcher should exit. Otherwise, returns true
+     *          if the queue is empty or the maximum number of events is dispatched.
+     **/
+    bool dispatchQueuedEvents( uint32_t maxEvents );
+
+    /**
+     * \brief   Returns true if there are queued external events or the exit is signaled.
+     **/
+    bool hasQueuedEvents( void );
+
+    /**
+     * \brief   Stops receiving events, removes queued events and consumers.
+     *          Called when the dispatcher exits.
+     **/
+    void completeDispatcher( void );
+
+    /**
+     * \brief   Sets the exit flag and signals the exit event.
+     * \return  Returns true if could fire event.
+     **/
+    inline bool signalExit( void );
+
+    /**
+     * \brief   Resets the exit flag and the exit event.
+     * \return  Returns true if could reset event.
+     **/
+    inline bool resetExit( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -352,6 +447,48 @@ protected:
      **/
     bool                mHasStarted;
 
+    /**
+     * \brief   The policy to wait for the events when the queue is empty.
+     **/
+    NECommon::eWaitPolicy   mWaitPolicy;
+
+    /**
+     * \brief   The time in nanoseconds, which the adaptive dispatcher spins before it blocks.
+     **/
+    uint64_t            mSpinTime;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The flag, indicating that the dispatcher spins waiting for events.
+     *          The queued events do not signal the queue event while it is set.
+     **/
+    std::atomic_bool    mIsSpinning;
+
+    /**
+     * \brief   The flag, which is set instead of signaling the queue event when
+     *          an event is queued while the dispatcher spins.
+     **/
+    std::atomic_bool    mSpinWakeup;
+
+    /**
+     * \brief   The flag, which is set together with the exit event.
+     *          The spinning dispatcher checks it instead of locking the exit event.
+     **/
+    std::atomic_bool    mExitRequested;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The statistics of queued and dispatched events.
+     *          Declared last to be registered when the dispatcher is initialized.
+     **/
+    DispatcherStatistics    mStatistics;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -360,6 +497,20 @@ private:
      * \brief   Returns reference to EventDispatcherBase object
      **/
     inline EventDispatcherBase & self( void );
+    /**
+     * \brief   Dispatches the event and records the waiting and processing time.
+     **/
+    inline void _dispatchMeasured( Event & eventElem );
+    /**
+     * \brief   Waits for the events according to the wait policy. Returns the index
+     *          of the signaled synchronization object, as the multi-lock does.
+     **/
+    inline int _waitForEvents( MultiLock & multiLock );
+    /**
+     * \brief   Spins until an event is queued, the exit is signaled or the spinning
+     *          time expires. Returns true if the queue has events.
+     **/
+    bool _spinForEvents( void );
     /**
      * \brief   Called when needs to make cleanup after Dispatcher completed job.
      *          This will remove Event Consumers.
@@ -383,17 +534,32 @@ inline bool EventDispatcherBase::isReady( void ) const
     return mHasStarted;
 }
 
+inline bool EventDispatcherBase::signalExit( void )
+{
+    mExitRequested.store( true );
+    return mEventExit.setEvent( );
+}
+
+inline bool EventDispatcherBase::resetExit( void )
+{
+    mExitRequested.store( false );
+    return mEventExit.resetEvent( );
+}
+
 inline void EventDispatcherBase::removeEvents(bool keepSpecials)
 {
     mExternaEvents.lockQueue();
+    const uint32_t count{ mExternaEvents.getCount() + mInternalEvents.getCount() };
     mInternalEvents.removeEvents( false );
     mExternaEvents.removeEvents( keepSpecials );
+    mStatistics.eventsCancelled( count - mExternaEvents.getCount() - mInternalEvents.getCount() );
     mExternaEvents.unlockQueue();
 }
 
 inline void EventDispatcherBase::removeAllEvents(void)
 {
     mExternaEvents.lockQueue();
+    mStatistics.eventsCancelled( mExternaEvents.getCount() + mInternalEvents.getCount() );
     mInternalEvents.removeAllEvents( );
     mExternaEvents.removeAllEvents( );
     mExternaEvents.unlockQueue();
@@ -401,7 +567,33 @@ inline void EventDispatcherBase::removeAllEvents(void)
 
 inline void EventDispatcherBase::removeExternalEventType( const RuntimeClassID & eventClassId )
 {
+    mExternaEvents.lockQueue();
+    const uint32_t count{ mExternaEvents.getCount() };
     mExternaEvents.removeEvents(eventClassId);
+    mStatistics.eventsCancelled( count - mExternaEvents.getCount() );
+    mExternaEvents.unlockQueue();
+}
+
+inline const String & EventDispatcherBase::getDispatcherName( void ) const
+{
+    return mDispatcherName;
+}
+
+inline NECommon::eWaitPolicy EventDispatcherBase::getWaitPolicy( void ) const
+{
+    return mWaitPolicy;
+}
+
+inline DispatcherStatistics & EventDispatcherBase::getStatistics( void )
+{
+    return mStatistics;
+}
+
+inline void EventDispatcherBase::_dispatchMeasured( Event & eventElem )
+{
+    const uint64_t started{ DispatcherStatistics::getTimestamp() };
+    dispatchEvent( eventElem );
+    mStatistics.eventDispatched( eventElem, started, DispatcherStatistics::getTimestamp() );
 }
 
 inline EventDispatcherBase& EventDispatcherBase::self( void )
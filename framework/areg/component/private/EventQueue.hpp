@@ -85,6 +85,11 @@ public:
      **/
     inline bool isEmpty( void ) const;
 
+    /**
+     * \brief   Returns the number of Event objects in the Queue.
+     **/
+    inline uint32_t getCount( void ) const;
+
     /**
      * \brief   Pushes new Event in the Queue and notifies Event Listener
      *          about new Event element availability.
@@ -129,6 +134,19 @@ public:
      **/
     void removeAllEvents( void );
 
+    /**
+     * \brief   Enables or disables coalescing of the events with the specified key. If enabled,
+     *          the pushed event with the key replaces the queued event with the same key.
+     * \param   coalesceKey The coalescing key of the events, see Event::getCoalesceKey().
+     * \param   enable      If true, the events with the key are coalesced.
+     **/
+    inline void setCoalescing( uint64_t coalesceKey, bool enable );
+
+    /**
+     * \brief   Returns the number of queued events replaced by the new events with the same key.
+     **/
+    inline uint64_t getCoalescedCount( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -269,4 +287,19 @@ inline bool EventQueue::isEmpty( void ) const
     return mEventQueue.isEmpty();
 }
 
+inline uint32_t EventQueue::getCount( void ) const
+{
+    return mEventQueue.getCount();
+}
+
+inline void EventQueue::setCoalescing( uint64_t coalesceKey, bool enable )
+{
+    mEventQueue.setCoalescing( coalesceKey, enable );
+}
+
+inline uint64_t EventQueue::getCoalescedCount( void ) const
+{
+    return mEventQueue.getCoalescedCount( );
+}
+
 #endif  // AREG_COMPONENT_PRIVATE_EVENTQUEUE_HPP
@@ -211,6 +211,7 @@ NERegistry::WorkerThreadEntry::WorkerThreadEntry(void)
     : mThreadName       ()
     , mConsumerName     ()
     , mWatchdogTimeout  (NECommon::WATCHDOG_IGNORE)
+    , mPlacement        ( )
 {
 }
 
@@ -222,6 +223,7 @@ NERegistry::WorkerThreadEntry::WorkerThreadEntry( const String & masterThreadNam
     : mThreadName       (NEUtilities::createComponentItemName(masterThreadName, workerThreadName))
     , mConsumerName     (NEUtilities::createComponentItemName(compRoleName, compConsumerName))
     , mWatchdogTimeout  (watchdogTimeout)
+    , mPlacement        ( )
 {
 }
 
@@ -240,6 +242,43 @@ bool NERegistry::WorkerThreadEntry::isValid( void ) const
     return ( (mThreadName.isEmpty() == false) && (mConsumerName.isEmpty() == false) );
 }
 
+//////////////////////////////////////////////////////////////////////////
+// class NERegistry::WorkerGroupEntry implementation
+//////////////////////////////////////////////////////////////////////////
+
+NERegistry::WorkerGroupEntry::WorkerGroupEntry(void)
+    : mGroupName    ()
+    , mConsumerName ()
+    , mThreadCount  (0u)
+{
+}
+
+NERegistry::WorkerGroupEntry::WorkerGroupEntry( const String & masterThreadName
+                                              , const String & workerGroupName
+                                              , const String & compRoleName
+                                              , const String & compConsumerName
+                                              , uint32_t threadCount )
+    : mGroupName    (NEUtilities::createComponentItemName(masterThreadName, workerGroupName))
+    , mConsumerName (NEUtilities::createComponentItemName(compRoleName, compConsumerName))
+    , mThreadCount  (threadCount)
+{
+}
+
+bool NERegistry::WorkerGroupEntry::operator == ( const NERegistry::WorkerGroupEntry & other ) const
+{
+    return ( (this == &other) || ((mGroupName == other.mGroupName) && (mConsumerName == other.mConsumerName)));
+}
+
+bool NERegistry::WorkerGroupEntry::operator != ( const NERegistry::WorkerGroupEntry & other ) const
+{
+    return ((this != &other) && ((mGroupName != other.mGroupName) || (mConsumerName != other.mConsumerName)));
+}
+
+bool NERegistry::WorkerGroupEntry::isValid( void ) const
+{
+    return ( (mGroupName.isEmpty() == false) && (mConsumerName.isEmpty() == false) );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // class NERegistry::WorkerThreadList implementation
 //////////////////////////////////////////////////////////////////////////
@@ -374,6 +413,7 @@ NERegistry::ComponentEntry::ComponentEntry( void )
 
     , mSupportedServices    ( )
     , mWorkerThreads        ( )
+    , mWorkerGroups         ( )
     , mDependencyServices   ( )
 
     , mComponentData        ( NEMemory::InvalidElement )
@@ -389,6 +429,7 @@ NERegistry::ComponentEntry::ComponentEntry( const String & masterThreadName, con
 
     , mSupportedServices    ( )
     , mWorkerThreads        ( )
+    , mWorkerGroups         ( )
     , mDependencyServices   ( )
 
     , mComponentData        ( NEMemory::InvalidElement )
@@ -410,6 +451,7 @@ NERegistry::ComponentEntry::ComponentEntry(   const String & masterThreadName
 
     , mSupportedServices    (serviceList)
     , mWorkerThreads        (workerList)
+    , mWorkerGroups         ( )
     , mDependencyServices   (dependencyList)
 
     , mComponentData        ( NEMemory::InvalidElement )
@@ -431,6 +473,7 @@ NERegistry::ComponentEntry::ComponentEntry(   const String & masterThreadName
 
     , mSupportedServices    (service)
     , mWorkerThreads        (worker)
+    , mWorkerGroups         ( )
     , mDependencyServices   (dependency)
 
     , mComponentData        ( NEMemory::InvalidElement )
@@ -446,6 +489,7 @@ NERegistry::ComponentEntry::ComponentEntry( const NERegistry::ComponentEntry & s
 
     , mSupportedServices    (src.mSupportedServices)
     , mWorkerThreads        (src.mWorkerThreads)
+    , mWorkerGroups         ( src.mWorkerGroups )
     , mDependencyServices   (src.mDependencyServices)
 
     , mComponentData        ( src.mComponentData )
@@ -461,6 +505,7 @@ NERegistry::ComponentEntry::ComponentEntry( NERegistry::ComponentEntry && src )
 
     , mSupportedServices    ( std::move(src.mSupportedServices) )
     , mWorkerThreads        ( std::move(src.mWorkerThreads) )
+    , mWorkerGroups         ( std::move(src.mWorkerGroups) )
     , mDependencyServices   ( std::move(src.mDependencyServices) )
 
     , mComponentData        ( std::move(src.mComponentData) )
@@ -479,6 +524,7 @@ NERegistry::ComponentEntry & NERegistry::ComponentEntry::operator = ( const NERe
 
         mSupportedServices  = src.mSupportedServices;
         mWorkerThreads      = src.mWorkerThreads;
+        mWorkerGroups       = src.mWorkerGroups;
         mDependencyServices = src.mDependencyServices;
 
         mComponentData      = src.mComponentData;
@@ -495,6 +541,7 @@ NERegistry::ComponentEntry & NERegistry::ComponentEntry::operator = ( NERegistry
     mFuncDelete         = std::move(src.mFuncDelete);
     mSupportedServices  = std::move(src.mSupportedServices);
     mWorkerThreads      = std::move(src.mWorkerThreads);
+    mWorkerGroups       = std::move(src.mWorkerGroups);
     mDependencyServices = std::move(src.mDependencyServices);
     mComponentData      = std::move(src.mComponentData);
 
@@ -582,6 +629,29 @@ void NERegistry::ComponentEntry::addWorkerThread( const NERegistry::WorkerThread
     }
 }
 
+void NERegistry::ComponentEntry::addWorkerGroup( const NERegistry::WorkerGroupEntry & entry )
+{
+    if (findWorkerGroup(entry.mGroupName) < 0)
+    {
+        mWorkerGroups.add(entry);
+    }
+}
+
+int NERegistry::ComponentEntry::findWorkerGroup( const String & groupName ) const
+{
+    int result = NECommon::INVALID_INDEX;
+    for ( uint32_t i = 0; i < mWorkerGroups.getSize(); ++ i )
+    {
+        if (mWorkerGroups[i].mGroupName == groupName)
+        {
+            result = static_cast<int>(i);
+            break;
+        }
+    }
+
+    return result;
+}
+
 int NERegistry::ComponentEntry::findWorkerThread( const NERegistry::WorkerThreadEntry& entry ) const
 {
     return mWorkerThreads.findThread(entry);
@@ -669,6 +739,11 @@ const NERegistry::WorkerThreadList & NERegistry::ComponentEntry::getWorkerThread
     return mWorkerThreads;
 }
 
+const NERegistry::WorkerGroupList & NERegistry::ComponentEntry::getWorkerGroups( void ) const
+{
+    return mWorkerGroups;
+}
+
 const NERegistry::DependencyList & NERegistry::ComponentEntry::getDependencyServices( void ) const
 {
     return mDependencyServices;
@@ -763,6 +838,10 @@ NERegistry::ComponentThreadEntry::ComponentThreadEntry( void )
     : mThreadName       ( )
     , mComponents       ( )
     , mWatchdogTimeout  (NECommon::WATCHDOG_IGNORE)
+    , mDispatchMode     (NERegistry::eDispatchMode::DispatchDefault)
+    , mPlacement        ( )
+    , mWaitPolicy       (NECommon::eWaitPolicy::WaitBlocking)
+    , mSpinTime         (NECommon::SPIN_TIME_DEFAULT)
 {
 }
 
@@ -770,6 +849,10 @@ NERegistry::ComponentThreadEntry::ComponentThreadEntry( const String & threadNam
     : mThreadName       (threadName)
     , mComponents       ( )
     , mWatchdogTimeout  (watchdogTimeout)
+    , mDispatchMode     (NERegistry::eDispatchMode::DispatchDefault)
+    , mPlacement        ( )
+    , mWaitPolicy       (NECommon::eWaitPolicy::WaitBlocking)
+    , mSpinTime         (NECommon::SPIN_TIME_DEFAULT)
 {
 }
 
@@ -777,6 +860,10 @@ NERegistry::ComponentThreadEntry::ComponentThreadEntry( const String & threadNam
     : mThreadName       (threadName)
     , mComponents       (supCompList)
     , mWatchdogTimeout  (watchdogTimeout)
+    , mDispatchMode     (NERegistry::eDispatchMode::DispatchDefault)
+    , mPlacement        ( )
+    , mWaitPolicy       (NECommon::eWaitPolicy::WaitBlocking)
+    , mSpinTime         (NECommon::SPIN_TIME_DEFAULT)
 {
 }
 
@@ -910,6 +997,8 @@ NERegistry::Model::Model( void )
     , mModelThreads ( )
     , mLoadState    ( Model::eModelState::ModelInitialized )
     , mAliveDuration( )
+    , mDispatchMode ( NERegistry::eDispatchMode::DispatchThread )
+    , mPoolThreads  ( 0u )
 {
 }
 
@@ -918,6 +1007,8 @@ NERegistry::Model::Model( const String & modelName )
     , mModelThreads ( )
     , mLoadState    ( Model::eModelState::ModelInitialized )
     , mAliveDuration( )
+    , mDispatchMode ( NERegistry::eDispatchMode::DispatchThread )
+    , mPoolThreads  ( 0u )
 {
 }
 
@@ -926,6 +1017,8 @@ NERegistry::Model::Model( const String & modelName, const ComponentThreadList &
     , mModelThreads (threadList)
     , mLoadState    ( Model::eModelState::ModelInitialized )
     , mAliveDuration( )
+    , mDispatchMode ( NERegistry::eDispatchMode::DispatchThread )
+    , mPoolThreads  ( 0u )
 {
 }
 
@@ -1028,6 +1121,17 @@ bool NERegistry::Model::hasRegisteredComponent( const String & roleName ) const
     return ( result >= 0 );
 }
 
+bool NERegistry::Model::hasPooledThreads( void ) const
+{
+    bool result{ false };
+    for (uint32_t i = 0; (result == false) && (i < mModelThreads.mListThreads.getSize()); ++i)
+    {
+        result = isPooledThread(mModelThreads.mListThreads[i]);
+    }
+
+    return result;
+}
+
 bool NERegistry::Model::isModelLoaded( void ) const
 {
     return (mLoadState == NERegistry::Model::eModelState::ModelLoaded);
@@ -29,6 +29,7 @@ NotificationEventData::NotificationEventData( const ProxyBase & proxy, NEService
     , mNotifyType   (notifyType)
     , mNotifyId     (notifyId)
     , mSequenceNr   (seqNr)
+    , mResponseView ( )
 {
 }
 
@@ -37,6 +38,7 @@ NotificationEventData::NotificationEventData( const NotificationEventData& src )
     , mNotifyType   (src.mNotifyType)
     , mNotifyId     (src.mNotifyId)
     , mSequenceNr   (src.mSequenceNr)
+    , mResponseView (src.mResponseView)
 {
 }
 
@@ -45,6 +47,7 @@ NotificationEventData::NotificationEventData( NotificationEventData && src ) noe
     , mNotifyType   ( src.mNotifyType )
     , mNotifyId     ( src.mNotifyId )
     , mSequenceNr   ( src.mSequenceNr )
+    , mResponseView ( std::move(src.mResponseView) )
 {
     src.mProxy = nullptr;
 }
@@ -57,6 +60,7 @@ NotificationEventData & NotificationEventData::operator = ( const NotificationEv
         mNotifyType = src.mNotifyType;
         mNotifyId   = src.mNotifyId;
         mSequenceNr = src.mSequenceNr;
+        mResponseView = src.mResponseView;
     }
 
     return (*this);
@@ -70,6 +74,7 @@ NotificationEventData & NotificationEventData::operator = ( NotificationEventDat
         mNotifyType = src.mNotifyType;
         mNotifyId   = src.mNotifyId;
         mSequenceNr = src.mSequenceNr;
+        mResponseView = std::move(src.mResponseView);
 
         src.mProxy  = nullptr;
     }
@@ -133,6 +138,19 @@ void IENotificationEventConsumer::startEventProcessing( Event& eventElem )
     NotificationEvent* eventNotify = RUNTIME_CAST(&eventElem, NotificationEvent);
     if (eventNotify != nullptr)
     {
-        processNotificationEvent(*eventNotify);
+        const NotificationEventData & data = static_cast<const NotificationEvent *>(eventNotify)->getData();
+        const ProxyBase * proxy = data.getProxy();
+        if ((proxy != nullptr) && (data.getResponseView().isEmpty() == false))
+        {
+            // the view of the data is available for the clients while they process the notification.
+            const BufferView * prevView = proxy->mResponseView;
+            proxy->mResponseView = &data.getResponseView();
+            processNotificationEvent(*eventNotify);
+            proxy->mResponseView = prevView;
+        }
+        else
+        {
+            processNotificationEvent(*eventNotify);
+        }
     }
 }
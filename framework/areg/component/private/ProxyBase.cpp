@@ -20,9 +20,12 @@
 #include "areg/base/NEUtilities.hpp"
 
 #include "areg/component/ServiceResponseEvent.hpp"
+#include "areg/component/ResponseEvents.hpp"
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/NotificationEvent.hpp"
 #include "areg/component/IEProxyListener.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/StubBase.hpp"
 
 #include "areg/component/private/ProxyConnectEvent.hpp"
 #include "areg/component/private/ComponentInfo.hpp"
@@ -40,6 +43,7 @@ DEF_TRACE_SCOPE(areg_component_ProxyBase_serviceConnectionUpdated);
 DEF_TRACE_SCOPE(areg_component_ProxyBase_unregisterListener);
 DEF_TRACE_SCOPE(areg_component_ProxyBase_prepareListeners);
 DEF_TRACE_SCOPE(areg_component_ProxyBase_stopProxy);
+DEF_TRACE_SCOPE(areg_component_ProxyBase__processAttributeDelta);
 
 //////////////////////////////////////////////////////////////////////////
 // ProxyBase class statics
@@ -273,6 +277,9 @@ ProxyBase::ProxyBase(const String & roleName, const NEService::SInterfaceData &
     , mListenerList     ( serviceIfData.idAttributeCount + serviceIfData.idResponseCount )
     , mListConnect      (   )
     , mProxyInstCount   ( 0 )
+    , mViewListeners    ( )
+    , mCoalescedIds     ( )
+    , mDeltaImages      ( )
 
     , mIsStopped        ( false )
 
@@ -281,8 +288,32 @@ ProxyBase::ProxyBase(const String & roleName, const NEService::SInterfaceData &
     , mDispatcherThread ( (ownerThread != nullptr) && (ownerThread->isValid()) ? *ownerThread : DispatcherThread::getDispatcherThread( mProxyAddress.getThread()) )
     , mConnectionStatus ( NEService::eServiceConnection::ServiceConnectionUnknown )
     , mIsConnected      ( false )
+    , mNotifyView       ( )
+    , mResponseView     ( nullptr )
+    , mDirectDispatch   ( false )
+    , mRequestDeadline  ( 0u )
 {
     ASSERT(mDispatcherThread.isValid());
+
+    if (serviceIfData.idAttributeCoalesceMap != nullptr)
+    {
+        for (unsigned int i = 0; i < serviceIfData.idAttributeCount; ++ i)
+        {
+            if (serviceIfData.idAttributeCoalesceMap[i])
+            {
+                setAttributeCoalescing(serviceIfData.idAttributeList[i], true);
+            }
+        }
+    }
+}
+
+ProxyBase::~ProxyBase( void )
+{
+    EventDispatcher & dispatcher{ mDispatcherThread.getEventDispatcher() };
+    for (unsigned int attrId : mCoalescedIds.getData())
+    {
+        dispatcher.setEventCoalescing(ServiceResponseEvent::createCoalesceKey(mProxyAddress, attrId), false);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -312,6 +343,7 @@ void ProxyBase::freeProxy( IEProxyListener & connect )
     removeListener( static_cast<unsigned int>(NEService::eFuncIdRange::ResponseServiceProviderConnection)
                   , NEService::SEQUENCE_NUMBER_NOTIFY
                   , static_cast<IENotificationEventConsumer *>(&connect));
+    _removeViewListener( static_cast<IENotificationEventConsumer *>(&connect) );
 
     std::shared_ptr<ProxyBase> proxy = ProxyBase::findProxyByAddress( mProxyAddress );
 
@@ -322,6 +354,7 @@ void ProxyBase::freeProxy( IEProxyListener & connect )
             stopAllServiceNotifications( );
             unregisterServiceListeners( );
             mListenerList.clear();
+            mViewListeners.clear();
 
             ServiceManager::requestUnregisterClient( getProxyAddress( ), NEService::eDisconnectReason::ReasonConsumerDisconnected );
             mDispatcherThread.removeConsumer( *this );
@@ -345,6 +378,7 @@ void ProxyBase::terminateSelf(void)
     if (mProxyInstCount != 0)
     {
         mListenerList.clear();
+        mViewListeners.clear();
         if (mIsStopped == false)
         {
             ServiceManager::requestUnregisterClient(getProxyAddress(), NEService::eDisconnectReason::ReasonConsumerDisconnected );
@@ -377,11 +411,17 @@ void ProxyBase::serviceConnectionUpdated( const StubAddress & server, const Chan
         if ( proxyConnected )
         {
             mStubAddress = server;
+            ComponentThread * ownerThread = RUNTIME_CAST(&mDispatcherThread, ComponentThread);
+            if ( ownerThread != nullptr )
+            {
+                ownerThread->serviceConnected( );
+            }
         }
         else
         {
             mStubAddress = StubAddress::getInvalidStubAddress();
             mProxyData.resetStates();
+            mDeltaImages.clear();
         }
 
         // first collect listeners, because on connect / disconnect
@@ -419,8 +459,13 @@ void ProxyBase::serviceConnectionUpdated( const StubAddress & server, const Chan
     }
 }
 
-void ProxyBase::setNotification( unsigned int msgId, IENotificationEventConsumer* caller, bool alwaysNotify /*= false*/ )
+void ProxyBase::setNotification( unsigned int msgId, IENotificationEventConsumer* caller, bool alwaysNotify /*= false*/, bool coalesce /*= false*/ )
 {
+    if (coalesce && NEService::isAttributeId(msgId))
+    {
+        setAttributeCoalescing(msgId, true);
+    }
+
     if (isConnected())
     {
         bool hasListener{ hasNotificationListener(msgId) };
@@ -479,6 +524,7 @@ void ProxyBase::unregisterListener( IENotificationEventConsumer *consumer )
 {
     TRACE_SCOPE(areg_component_ProxyBase_unregisterListener);
     TRACE_DBG("Unregisters proxy client [ %p ]", consumer);
+    _removeViewListener(consumer);
 
     uint32_t index = 0;
     while (index < mListenerList.getSize())
@@ -543,6 +589,11 @@ void ProxyBase::notifyListeners( unsigned int respId, NEService::eResultType res
 void ProxyBase::sendNotificationEvent( unsigned int msgId, NEService::eResultType resType, const SequenceNumber & seqNr, IENotificationEventConsumer* caller )
 {
     NotificationEventData data(self(), resType, msgId, seqNr);
+    if ((mNotifyView.isEmpty() == false) && isResponseViewEnabled(msgId, caller))
+    {
+        data.setResponseView(mNotifyView);
+    }
+
     NotificationEvent* eventElem = createNotificationEvent(data);
     if (eventElem != nullptr)
     {
@@ -566,6 +617,188 @@ void ProxyBase::processProxyEvent( ProxyEvent& /*eventElem*/ )
 }
 #endif  // DEBUG
 
+void ProxyBase::startEventProcessing( Event & eventElem )
+{
+    ResponseEvent * eventResponse = RUNTIME_CAST(&eventElem, ResponseEvent);
+    if ((eventResponse != nullptr) && _isEventTarget(*eventResponse))
+    {
+        if (eventResponse->getResult() == NEService::eResultType::DataDelta)
+        {
+            if (_processAttributeDelta(*eventResponse) == false)
+                return;
+        }
+        else if (mDeltaImages.isEmpty() == false)
+        {
+            // the data is sent without delta, the next delta starts with the snapshot.
+            mDeltaImages.removeAt(eventResponse->getResponseId());
+        }
+
+        if ((mViewListeners.isEmpty() == false) && _processResponseView(*eventResponse))
+            return;
+    }
+
+    IEProxyEventConsumer::startEventProcessing(eventElem);
+    mNotifyView.release();
+}
+
+void ProxyBase::setResponseView( unsigned int msgId, IENotificationEventConsumer & listener, bool enable )
+{
+    const ProxyBase::Listener viewListener(msgId, NEService::SEQUENCE_NUMBER_NOTIFY, &listener);
+    if (enable)
+    {
+        mViewListeners.addIfUnique(viewListener);
+    }
+    else
+    {
+        mViewListeners.removeElem(viewListener);
+    }
+}
+
+bool ProxyBase::isResponseViewEnabled( unsigned int msgId, const IENotificationEventConsumer * listener ) const
+{
+    for (uint32_t i = 0; i < mViewListeners.getSize(); ++ i)
+    {
+        const ProxyBase::Listener & elem = mViewListeners.getAt(i);
+        if ((elem.mMessageId == msgId) && (elem.mListener == listener))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ProxyBase::setAttributeCoalescing( unsigned int attrId, bool enable )
+{
+    ASSERT(NEService::isAttributeId(attrId));
+    if (enable ? mCoalescedIds.addIfUnique(attrId) : mCoalescedIds.removeElem(attrId))
+    {
+        mDispatcherThread.getEventDispatcher().setEventCoalescing(ServiceResponseEvent::createCoalesceKey(mProxyAddress, attrId), enable);
+    }
+}
+
+bool ProxyBase::_isEventTarget( const ServiceResponseEvent & eventResponse ) const
+{
+    const ProxyAddress & addrProxy = eventResponse.getTargetProxy();
+    return ( (static_cast<const ServiceAddress &>(addrProxy) == static_cast<const ServiceAddress &>(mProxyAddress)) &&
+             (addrProxy.getChannel() == mProxyAddress.getChannel()) );
+}
+
+bool ProxyBase::_processAttributeDelta( ResponseEvent & eventResponse )
+{
+    TRACE_SCOPE(areg_component_ProxyBase__processAttributeDelta);
+
+    const unsigned int attrId{ eventResponse.getResponseId() };
+    AttributeDelta & image = mDeltaImages[attrId];
+    EventDataStream data(EventDataStream::eEventData::EventDataExternal);
+    if (image.decode(static_cast<const ResponseEvent &>(eventResponse).getData().getDataStream(), data))
+    {
+        eventResponse.setData(data);
+        eventResponse.setResult(NEService::eResultType::DataOK);
+        return true;
+    }
+
+    if (image.isSnapshotPending() == false)
+    {
+        // the delta is not based on the image of the attribute, request the snapshot.
+        TRACE_WARN("The proxy [ %s ] cannot apply the delta of attribute [ %u ], requests the snapshot"
+                    , ProxyAddress::convAddressToPath(getProxyAddress()).getString()
+                    , attrId);
+
+        image.reset();
+        image.setSnapshotPending(true);
+        stopNotification(attrId);
+        startNotification(attrId);
+    }
+
+    return false;
+}
+
+bool ProxyBase::_processResponseView( ResponseEvent & eventResponse )
+{
+    const NEService::eResultType result{ eventResponse.getResult() };
+    const unsigned int respId{ eventResponse.getResponseId() };
+    if ((result != NEService::eResultType::DataOK) && (result != NEService::eResultType::RequestOK))
+    {
+        return false;
+    }
+
+    bool isAttribute{ false };
+    switch (eventResponse.getDataType())
+    {
+    case NEService::eMessageDataType::RequestDataType:  // fall through
+    case NEService::eMessageDataType::ResponseDataType:
+        break;
+
+    case NEService::eMessageDataType::AttributeDataType:
+        isAttribute = true;
+        break;
+
+    default:
+        return false;
+    }
+
+    bool hasViewListener{ false };
+    for (uint32_t i = 0; (hasViewListener == false) && (i < mViewListeners.getSize()); ++ i)
+    {
+        hasViewListener = mViewListeners.getAt(i).mMessageId == respId;
+    }
+
+    if ((hasViewListener == false) || (static_cast<const ResponseEvent &>(eventResponse).getData().getDataStream().getDataView(mNotifyView) == false))
+    {
+        return false;
+    }
+
+    // The attribute is read by every client of the proxy, it is always deserialized.
+    // If any client of the response does not use the view, the parameters are deserialized.
+    // In both cases the view is passed to the clients, which use it.
+    const SequenceNumber & seqNr{ eventResponse.getSequenceNumber() };
+    if (isAttribute || (_isViewForAllListeners(respId, seqNr) == false))
+    {
+        return false;
+    }
+
+    // The parameters are not updated, so that they are not valid.
+    setState(respId, NEService::eDataStateType::DataIsInvalid);
+    notifyListeners(respId, result, seqNr);
+    mNotifyView.release();
+
+    return true;
+}
+
+void ProxyBase::_removeViewListener( const IENotificationEventConsumer * listener )
+{
+    uint32_t index = 0;
+    while (index < mViewListeners.getSize())
+    {
+        if (mViewListeners.getAt(index).mListener == listener)
+        {
+            mViewListeners.removeAt(index);
+        }
+        else
+        {
+            ++ index;
+        }
+    }
+}
+
+bool ProxyBase::_isViewForAllListeners( unsigned int respId, const SequenceNumber & seqNr ) const
+{
+    for (uint32_t i = 0; i < mListenerList.getSize(); ++ i)
+    {
+        const ProxyBase::Listener & elem = mListenerList.getAt(i);
+        if ((elem.mMessageId == respId) && ((elem.mSequenceNr == NEService::SEQUENCE_NUMBER_NOTIFY) || (elem.mSequenceNr == seqNr)))
+        {
+            if (isResponseViewEnabled(respId, elem.mListener) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 void ProxyBase::processGenericEvent( Event& eventElem )
 {
     ProxyBase::ServiceAvailableEvent * serviceEvent = RUNTIME_CAST( &eventElem, ProxyBase::ServiceAvailableEvent );
@@ -594,16 +827,54 @@ void ProxyBase::sendRequestEvent( unsigned int reqId, const EventDataStream& arg
             evenElem->setSequenceNumber(mSequenceCount);
         }
 
-        mProxyAddress.deliverServiceEvent(*evenElem);
+        _deliverRequestEvent(*evenElem);
     }
 }
 
+bool ProxyBase::canSendRequest( void ) const
+{
+    return (mStubAddress.isRemoteAddress() == false) || ServiceManager::isSendWindowOpen();
+}
+
 void ProxyBase::sendNotificationRequestEvent( unsigned int msgId, NEService::eRequestType reqType )
 {
     ServiceRequestEvent* notifyEvent = createNotificationRequestEvent(msgId, reqType);
     if (notifyEvent != nullptr)
     {
-        mProxyAddress.deliverServiceEvent( *notifyEvent );
+        _deliverRequestEvent( *notifyEvent );
+    }
+}
+
+void ProxyBase::_deliverRequestEvent( ServiceRequestEvent & eventElem )
+{
+    StubBase * stub{ nullptr };
+    if ( mDirectDispatch && mStubAddress.isLocalAddress() && (&DispatcherThread::getCurrentDispatcherThread() == &mDispatcherThread) )
+    {
+        stub = StubBase::findStubByAddress( mStubAddress );
+        if ( (stub != nullptr) && (static_cast<DispatcherThread *>(&stub->getComponentThread()) != &mDispatcherThread) )
+        {
+            stub = nullptr;
+        }
+    }
+
+    if ( stub != nullptr )
+    {
+        // the stub runs in this thread, process the request in the call and queue the responses internally.
+        Component * curComponent{ ComponentThread::getCurrentComponent() };
+        EventDispatcherBase * prevDispatcher{ EventDispatcherBase::setDirectDispatcher( &mDispatcherThread.getEventDispatcher() ) };
+        static_cast<Event &>(eventElem).dispatchSelf( static_cast<IEEventConsumer *>(stub) );
+        EventDispatcherBase::setDirectDispatcher( prevDispatcher );
+        ComponentThread::setCurrentComponent( curComponent );
+        eventElem.destroy();
+    }
+    else
+    {
+        if ( mRequestDeadline != 0u )
+        {
+            eventElem.setDeadlineTimeout( mRequestDeadline );
+        }
+
+        mProxyAddress.deliverServiceEvent( eventElem );
     }
 }
 
@@ -683,6 +954,7 @@ void ProxyBase::stopProxy(void)
         stopAllServiceNotifications( );
         unregisterServiceListeners( );
         mListenerList.clear();
+        mViewListeners.clear();
         ServiceManager::requestUnregisterClient( getProxyAddress( ), NEService::eDisconnectReason::ReasonConsumerDisconnected );
         mDispatcherThread.removeConsumer( *this );
 
@@ -16,6 +16,7 @@
 #include "areg/component/ProxyEvent.hpp"
 
 #include "areg/component/private/ProxyConnectEvent.hpp"
+#include "areg/component/private/RemoteAddressCache.hpp"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/ServiceResponseEvent.hpp"
 #include "areg/component/ProxyBase.hpp"
@@ -41,7 +42,7 @@ ProxyEvent::ProxyEvent( const ProxyAddress & targetProxy, Event::eEventType even
 
 ProxyEvent::ProxyEvent( const IEInStream & stream )
     : StreamableEvent       ( stream )
-    , mTargetProxyAddress   ( stream )
+    , mTargetProxyAddress   ( RemoteAddressCache::readProxyAddress(stream) )
 {
 }
 
@@ -69,14 +70,14 @@ void ProxyEvent::deliverEvent( void )
 const IEInStream & ProxyEvent::readStream( const IEInStream & stream )
 {
     StreamableEvent::readStream(stream);
-    stream >> mTargetProxyAddress;
+    mTargetProxyAddress = RemoteAddressCache::readProxyAddress(stream);
     return stream;
 }
 
 IEOutStream & ProxyEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetProxyAddress;
+    RemoteAddressCache::writeAddress(stream, mTargetProxyAddress);
     return stream;
 }
 
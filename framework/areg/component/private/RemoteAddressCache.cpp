@@ -0,0 +1,213 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/RemoteAddressCache.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The connection scoped cache of interned
+ *              service addresses used in remote events.
+ ************************************************************************/
+#include "areg/component/private/RemoteAddressCache.hpp"
+
+#include "areg/base/IEIOStream.hpp"
+#include "areg/component/NEService.hpp"
+
+namespace
+{
+    /**
+     * \brief   The peer and the direction of the remote message,
+     *          which is created or parsed in the current thread.
+     **/
+    struct sThreadScope
+    {
+        ITEM_ID tsPeer;     //!< The cookie of the remote peer.
+        bool    tsOutgoing; //!< The direction of the message.
+        bool    tsActive;   //!< Flag, indicating whether the addresses are interned.
+    };
+
+    thread_local sThreadScope _threadScope{ NEService::COOKIE_UNKNOWN, false, false };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteAddressCache::Scope class implementation
+//////////////////////////////////////////////////////////////////////////
+
+RemoteAddressCache::Scope::Scope( const ITEM_ID & peer, bool outgoing )
+    : mPeer     ( _threadScope.tsPeer )
+    , mOutgoing ( _threadScope.tsOutgoing )
+    , mActive   ( _threadScope.tsActive )
+{
+    _threadScope = sThreadScope{ peer, outgoing, peer != NEService::COOKIE_UNKNOWN };
+}
+
+RemoteAddressCache::Scope::~Scope( void )
+{
+    _threadScope = sThreadScope{ mPeer, mOutgoing, mActive };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteAddressCache class implementation
+//////////////////////////////////////////////////////////////////////////
+
+RemoteAddressCache & RemoteAddressCache::_getInstance( void )
+{
+    static RemoteAddressCache _addressCache;
+    return _addressCache;
+}
+
+RemoteAddressCache::RemoteAddressCache( void )
+    : mOutgoing ( )
+    , mIncoming ( )
+    , mLock     ( false )
+{
+}
+
+void RemoteAddressCache::writeAddress( IEOutStream & stream, const StubAddress & address )
+{
+    RemoteAddressCache::_writeAddress(stream, address, &sAddressTable::atStubHandles, &sAddressTable::atStubs);
+}
+
+void RemoteAddressCache::writeAddress( IEOutStream & stream, const ProxyAddress & address )
+{
+    RemoteAddressCache::_writeAddress(stream, address, &sAddressTable::atProxyHandles, &sAddressTable::atProxies);
+}
+
+StubAddress RemoteAddressCache::readStubAddress( const IEInStream & stream )
+{
+    return RemoteAddressCache::_readAddress(stream, &sAddressTable::atStubs);
+}
+
+ProxyAddress RemoteAddressCache::readProxyAddress( const IEInStream & stream )
+{
+    return RemoteAddressCache::_readAddress(stream, &sAddressTable::atProxies);
+}
+
+void RemoteAddressCache::clear( void )
+{
+    RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+    Lock lock(cache.mLock);
+    cache.mOutgoing.clear();
+    cache.mIncoming.clear();
+}
+
+void RemoteAddressCache::resetPeer( const ITEM_ID & peer )
+{
+    RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+    Lock lock(cache.mLock);
+    cache.mOutgoing.removeAt(peer);
+}
+
+void RemoteAddressCache::removePeer( const ITEM_ID & peer )
+{
+    RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+    Lock lock(cache.mLock);
+    cache.mOutgoing.removeAt(peer);
+    cache.mIncoming.removeAt(peer);
+}
+
+template<typename Address>
+void RemoteAddressCache::_writeAddress( IEOutStream & stream
+                                      , const Address & address
+                                      , TEHashMap<Address, uint32_t> sAddressTable::* handles
+                                      , TEArrayList<Address> sAddressTable::* addresses )
+{
+    const sThreadScope & scope{ _threadScope };
+    if ((scope.tsActive == false) || (scope.tsOutgoing == false) || (address.isValid() == false))
+    {
+        stream << static_cast<uint8_t>(eAddressEncoding::AddressFull);
+        stream << address;
+        return;
+    }
+
+    RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+    Lock lock(cache.mLock);
+
+    sAddressTable & table{ cache.mOutgoing[scope.tsPeer] };
+    uint32_t handle{ 0 };
+    if ((table.*handles).find(address, handle))
+    {
+        stream << static_cast<uint8_t>(eAddressEncoding::AddressHandle);
+        stream << handle;
+    }
+    else
+    {
+        (table.*addresses).add(address);
+        handle = (table.*addresses).getSize();
+        (table.*handles).setAt(address, handle);
+
+        stream << static_cast<uint8_t>(eAddressEncoding::AddressDefine);
+        stream << handle;
+        stream << address;
+    }
+}
+
+template<typename Address>
+Address RemoteAddressCache::_readAddress( const IEInStream & stream, TEArrayList<Address> sAddressTable::* addresses )
+{
+    const sThreadScope & scope{ _threadScope };
+    uint8_t encoding{ static_cast<uint8_t>(eAddressEncoding::AddressFull) };
+    uint32_t handle{ 0 };
+    stream >> encoding;
+
+    switch (static_cast<eAddressEncoding>(encoding))
+    {
+    case eAddressEncoding::AddressFull:
+        return Address(stream);
+
+    case eAddressEncoding::AddressDefine:
+        {
+            stream >> handle;
+            Address address(stream);
+            // The outgoing messages are read only if failed to send, the handle is already interned.
+            if (scope.tsActive && (scope.tsOutgoing == false) && (handle != 0))
+            {
+                RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+                Lock lock(cache.mLock);
+
+                TEArrayList<Address> & list{ cache.mIncoming[scope.tsPeer].*addresses };
+                if (list.getSize() < handle)
+                {
+                    list.resize(handle);
+                }
+
+                list.setAt(handle - 1, address);
+            }
+
+            return address;
+        }
+
+    case eAddressEncoding::AddressHandle:
+        {
+            stream >> handle;
+            if (scope.tsActive && (handle != 0))
+            {
+                RemoteAddressCache & cache{ RemoteAddressCache::_getInstance() };
+                Lock lock(cache.mLock);
+
+                PeerTables & tables{ scope.tsOutgoing ? cache.mOutgoing : cache.mIncoming };
+                PeerTables::MAPPOS pos{ tables.find(scope.tsPeer) };
+                if (tables.isValidPosition(pos))
+                {
+                    const TEArrayList<Address> & list{ tables.valueAtPosition(pos).*addresses };
+                    if (list.getSize() >= handle)
+                    {
+                        return list[handle - 1];
+                    }
+                }
+            }
+        }
+        break;
+
+    default:
+        ASSERT(false);
+        break;
+    }
+
+    return Address();
+}
@@ -0,0 +1,230 @@
+#ifndef AREG_COMPONENT_PRIVATE_REMOTEADDRESSCACHE_HPP
+#define AREG_COMPONENT_PRIVATE_REMOTEADDRESSCACHE_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/RemoteAddressCache.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The connection scoped cache of interned
+ *              service addresses used in remote events.
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class IEInStream;
+class IEOutStream;
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteAddressCache class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The cache of interned addresses of stubs and proxies, which are
+ *          streamed in the remote events. The addresses are interned per
+ *          remote peer, i.e. per cookie of the connected process. The first
+ *          time the address is sent to the peer, it is assigned a compact
+ *          numeric handle and streamed in full together with the handle.
+ *          Next messages to the same peer contain only the handle, which
+ *          the receiver resolves to the address without parsing strings
+ *          and recomputing checksums. Since the messages between two peers
+ *          are delivered in order, the handle is always defined before use.
+ *
+ *          The addresses are interned only when the remote message is created
+ *          or parsed within the Scope object, which sets the peer of the message
+ *          for the calling thread. Otherwise, the addresses are streamed in full.
+ *          The cache is cleared when the connection to the router is changed,
+ *          because the handles are scoped to the connection of the peers.
+ **/
+class AREG_API RemoteAddressCache
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   RemoteAddressCache::eAddressEncoding
+     *          The encoding of the address in the stream.
+     **/
+    enum class eAddressEncoding : uint8_t
+    {
+          AddressFull   = 0 //!< The full address is streamed.
+        , AddressDefine = 1 //!< The handle and the full address are streamed.
+        , AddressHandle = 2 //!< Only the handle of the address is streamed.
+    };
+
+    /**
+     * \brief   RemoteAddressCache::Scope
+     *          Sets the peer of the remote message, which is created or parsed
+     *          in the calling thread, and enables the interning of addresses.
+     **/
+    class AREG_API Scope
+    {
+    public:
+        /**
+         * \brief   Sets the peer of the remote message.
+         * \param   peer        The cookie of the remote peer. If unknown,
+         *                      the addresses are streamed in full.
+         * \param   outgoing    If true, the message is sent to the peer.
+         *                      Otherwise, the message is received from the peer.
+         **/
+        Scope( const ITEM_ID & peer, bool outgoing );
+
+        /**
+         * \brief   Restores the previous scope.
+         **/
+        ~Scope( void );
+
+    private:
+        const ITEM_ID   mPeer;      //!< The previous peer.
+        const bool      mOutgoing;  //!< The previous direction.
+        const bool      mActive;    //!< The previous state.
+
+        DECLARE_NOCOPY_NOMOVE( Scope );
+    };
+
+private:
+    /**
+     * \brief   RemoteAddressCache::sAddressTable
+     *          The interned addresses of a single peer in a single direction.
+     *          The handle is the index in the list plus one.
+     **/
+    struct sAddressTable
+    {
+        TEHashMap<StubAddress, uint32_t>    atStubHandles;  //!< The handles of stub addresses.
+        TEHashMap<ProxyAddress, uint32_t>   atProxyHandles; //!< The handles of proxy addresses.
+        TEArrayList<StubAddress>            atStubs;        //!< The stub addresses by handle.
+        TEArrayList<ProxyAddress>           atProxies;      //!< The proxy addresses by handle.
+    };
+
+    //!< The tables of addresses by peer cookie.
+    using PeerTables    = TEHashMap<ITEM_ID, sAddressTable>;
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Writes the stub address to the stream. Within the outgoing scope
+     *          writes the handle, and the full address only the first time.
+     **/
+    static void writeAddress( IEOutStream & stream, const StubAddress & address );
+
+    /**
+     * \brief   Writes the proxy address to the stream. Within the outgoing scope
+     *          writes the handle, and the full address only the first time.
+     **/
+    static void writeAddress( IEOutStream & stream, const ProxyAddress & address );
+
+    /**
+     * \brief   Reads the stub address written by writeAddress(). Returns invalid
+     *          address, if the address is streamed as handle, which is unknown.
+     **/
+    static StubAddress readStubAddress( const IEInStream & stream );
+
+    /**
+     * \brief   Reads the proxy address written by writeAddress(). Returns invalid
+     *          address, if the address is streamed as handle, which is unknown.
+     **/
+    static ProxyAddress readProxyAddress( const IEInStream & stream );
+
+    /**
+     * \brief   Removes all interned addresses.
+     **/
+    static void clear( void );
+
+    /**
+     * \brief   Removes the handles of addresses sent to the peer. The next messages
+     *          to the peer define the addresses again. Called when failed to send
+     *          the message, because the peer may not have received the definition
+     *          of the handles. The handles received from the peer remain valid.
+     * \param   peer    The cookie of the remote peer.
+     **/
+    static void resetPeer( const ITEM_ID & peer );
+
+    /**
+     * \brief   Removes the handles of addresses sent to the peer and received from
+     *          the peer. Called when the peer disconnects, so that the tables of
+     *          disconnected peers do not grow and are not used by a new peer.
+     * \param   peer    The cookie of the remote peer.
+     **/
+    static void removePeer( const ITEM_ID & peer );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    RemoteAddressCache( void );
+    ~RemoteAddressCache( void ) = default;
+
+    /**
+     * \brief   Returns the instance of the cache.
+     **/
+    static RemoteAddressCache & _getInstance( void );
+
+    /**
+     * \brief   Writes the address of the stub or the proxy to the stream.
+     * \param   stream      The stream to write the address.
+     * \param   address     The address to write.
+     * \param   handles     The member of the table, which contains the handles of addresses.
+     * \param   addresses   The member of the table, which contains the addresses by handle.
+     **/
+    template<typename Address>
+    static void _writeAddress( IEOutStream & stream
+                             , const Address & address
+                             , TEHashMap<Address, uint32_t> sAddressTable::* handles
+                             , TEArrayList<Address> sAddressTable::* addresses );
+
+    /**
+     * \brief   Reads the address of the stub or the proxy from the stream.
+     * \param   stream      The stream to read the address.
+     * \param   addresses   The member of the table, which contains the addresses by handle.
+     **/
+    template<typename Address>
+    static Address _readAddress( const IEInStream & stream, TEArrayList<Address> sAddressTable::* addresses );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The tables of addresses sent to peers.
+    PeerTables      mOutgoing;
+
+    //!< The tables of addresses received from peers.
+    PeerTables      mIncoming;
+
+    //!< The lock to access tables.
+    ResourceLock    mLock;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( RemoteAddressCache );
+};
+
+#endif  // AREG_COMPONENT_PRIVATE_REMOTEADDRESSCACHE_HPP
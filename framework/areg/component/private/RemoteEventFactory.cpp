@@ -21,6 +21,7 @@
 #include "areg/base/Process.hpp"
 #include "areg/component/private/ProxyConnectEvent.hpp"
 #include "areg/component/private/StubConnectEvent.hpp"
+#include "areg/component/private/RemoteAddressCache.hpp"
 #include "areg/component/StubBase.hpp"
 #include "areg/component/ProxyBase.hpp"
 #include "areg/component/Channel.hpp"
@@ -35,6 +36,9 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     TRACE_SCOPE(areg_component_RemoteEventFactory_createEventFromStream);
 
     StreamableEvent * result = nullptr;
+    RemoteAddressCache::Scope scope(stream.getSource(), false);
+    // The created events reference the data of the received message without copying.
+    EventDataStream::SharedSourceScope source(stream);
     Event::eEventType eventType;
     stream >> eventType;
 
@@ -44,8 +48,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     {
     case Event::eEventType::EventRemoteServiceRequest:
         {
-            StubAddress addrStub;
-            stream >> addrStub;
+            StubAddress addrStub{ RemoteAddressCache::readStubAddress(stream) };
             if ( comChannel.getCookie() == addrStub.getCookie() )
             {
                 addrStub.setCookie( NEService::COOKIE_LOCAL );
@@ -75,8 +78,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
 
     case Event::eEventType::EventRemoteNotifyRequest:
         {
-            StubAddress addrStub;
-            stream >> addrStub;
+            StubAddress addrStub{ RemoteAddressCache::readStubAddress(stream) };
             if ( comChannel.getCookie() == addrStub.getCookie() )
             {
                 addrStub.setCookie( NEService::COOKIE_LOCAL );
@@ -107,8 +109,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     case Event::eEventType::EventRemoteServiceResponse:
         {
             ProxyBase::lockProxyResource();
-            ProxyAddress addrProxy;
-            stream >> addrProxy;
+            ProxyAddress addrProxy{ RemoteAddressCache::readProxyAddress(stream) };
             if ( comChannel.getCookie() == addrProxy.getCookie() )
                 addrProxy.setCookie( NEService::COOKIE_LOCAL );
             std::shared_ptr<ProxyBase> proxy = ProxyBase::findProxyByAddress(addrProxy);
@@ -170,7 +171,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     return result;
 }
 
-bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel )
+bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel, bool internAddresses /*= true*/ )
 {
     bool result = false;
     stream.invalidate();
@@ -182,6 +183,7 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
             const ServiceRequestEvent * stubEvent = RUNTIME_CONST_CAST(&eventStreamable, ServiceRequestEvent);
             if ( stubEvent != nullptr )
             {
+                RemoteAddressCache::Scope scope(internAddresses ? stubEvent->getTargetStub().getCookie() : NEService::COOKIE_UNKNOWN, true);
                 eventStreamable.writeStream(stream);
                 if (stream.isValid())
                 {
@@ -205,6 +207,7 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
             const ServiceRequestEvent * stubEvent = RUNTIME_CONST_CAST(&eventStreamable, ServiceRequestEvent);
             if ( stubEvent != nullptr )
             {
+                RemoteAddressCache::Scope scope(internAddresses ? stubEvent->getTargetStub().getCookie() : NEService::COOKIE_UNKNOWN, true);
                 eventStreamable.writeStream(stream);
                 if (stream.isValid())
                 {
@@ -228,6 +231,7 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
             const ServiceResponseEvent * proxyEvent = RUNTIME_CONST_CAST(&eventStreamable, ServiceResponseEvent);
             if ( proxyEvent != nullptr )
             {
+                RemoteAddressCache::Scope scope(internAddresses ? proxyEvent->getTargetProxy().getCookie() : NEService::COOKIE_UNKNOWN, true);
                 eventStreamable.writeStream(stream);
                 if ( stream.isValid() )
                 {
@@ -286,11 +290,14 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
     return result;
 }
 
-StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMessage & stream, const Channel & /* comChannel */ )
+StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMessage & stream, const Channel & comChannel )
 {
     TRACE_SCOPE(areg_component_RemoteEventFactory_createRequestFailedEvent);
 
     StreamableEvent * result = nullptr;
+    // The message is either sent by this process and failed to deliver, or received and failed to process.
+    const bool outgoing{ stream.getSource() == comChannel.getCookie() };
+    RemoteAddressCache::Scope scope(outgoing ? stream.getTarget() : stream.getSource(), outgoing);
     Event::eEventType eventType;
     stream >> eventType;
 
@@ -303,10 +310,13 @@ StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMess
             stream.moveToBegin();
             RemoteRequestEvent eventRequest(stream);
             const ProxyAddress & addrProxy = eventRequest.getEventSource();
-            result = static_cast<StreamableEvent *>( ProxyBase::createRequestFailureEvent( addrProxy
-                                                                                         , eventRequest.getRequestId()
-                                                                                         , NEService::eResultType::MessageUndelivered
-                                                                                         , eventRequest.getSequenceNumber()) );
+            if ( addrProxy.isValid() )
+            {
+                result = static_cast<StreamableEvent *>( ProxyBase::createRequestFailureEvent( addrProxy
+                                                                                             , eventRequest.getRequestId()
+                                                                                             , NEService::eResultType::MessageUndelivered
+                                                                                             , eventRequest.getSequenceNumber()) );
+            }
         }
         break;
 
@@ -315,10 +325,13 @@ StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMess
             stream.moveToBegin();
             RemoteNotifyRequestEvent eventNotify(stream);
             const ProxyAddress & addrProxy = eventNotify.getEventSource();
-            result = static_cast<StreamableEvent *>( ProxyBase::createRequestFailureEvent( addrProxy
-                                                                                         , eventNotify.getRequestId()
-                                                                                         , NEService::eResultType::MessageUndelivered
-                                                                                         , eventNotify.getSequenceNumber()) );
+            if ( addrProxy.isValid() )
+            {
+                result = static_cast<StreamableEvent *>( ProxyBase::createRequestFailureEvent( addrProxy
+                                                                                             , eventNotify.getRequestId()
+                                                                                             , NEService::eResultType::MessageUndelivered
+                                                                                             , eventNotify.getSequenceNumber()) );
+            }
         }
         break;
 
@@ -361,3 +374,18 @@ StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMess
 
     return result;
 }
+
+void RemoteEventFactory::resetAddressCache( void )
+{
+    RemoteAddressCache::clear();
+}
+
+void RemoteEventFactory::resetAddressCache( const ITEM_ID & peer )
+{
+    RemoteAddressCache::resetPeer(peer);
+}
+
+void RemoteEventFactory::removeAddressCache( const ITEM_ID & peer )
+{
+    RemoteAddressCache::removePeer(peer);
+}
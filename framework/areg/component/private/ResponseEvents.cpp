@@ -62,6 +62,11 @@ ResponseEvent::ResponseEvent(const IEInStream & stream)
 {
 }
 
+void ResponseEvent::setData( const EventDataStream & args )
+{
+    mData = EventData(getResponseId(), args);
+}
+
 const IEInStream & ResponseEvent::readStream(const IEInStream & stream)
 {
     ServiceResponseEvent::readStream(stream);
@@ -17,8 +17,10 @@
 
 #include "areg/base/Process.hpp"
 #include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/NERegistry.hpp"
 #include "areg/component/private/ServerList.hpp"
+#include "areg/component/private/TimerEventData.hpp"
 
 #include "areg/trace/GETrace.h"
 
@@ -26,6 +28,7 @@
 
 DEF_TRACE_SCOPE(areg_component_private_ServiceManager_processEvent);
 DEF_TRACE_SCOPE(areg_component_private_ServiceManager_requestRegisterServer);
+DEF_TRACE_SCOPE(areg_component_private_ServiceManager_requestRegisterServers);
 DEF_TRACE_SCOPE(areg_component_private_ServiceManager_requestUnregisterServer);
 DEF_TRACE_SCOPE(areg_component_private_ServiceManager_requestRegisterClient);
 DEF_TRACE_SCOPE(areg_component_private_ServiceManager_requestUnregisterClient);
@@ -86,6 +89,36 @@ void ServiceManager::queryCommunicationData( unsigned int & OUT sizeSend, unsign
     sizeReceive = serviceManager.mServiceClient.queryBytesReceived( );
 }
 
+SendWindow::sWindowStatistics ServiceManager::querySendQueue( void )
+{
+    return ServiceManager::getInstance().mServiceClient.querySendQueue();
+}
+
+void ServiceManager::setSendWindow( uint32_t maxMessages, uint32_t maxBytes )
+{
+    ServiceManager::getInstance().mServiceClient.setSendWindow(maxMessages, maxBytes);
+}
+
+bool ServiceManager::isSendWindowOpen( void )
+{
+    return ServiceManager::getInstance().mServiceClient.isSendWindowOpen();
+}
+
+void ServiceManager::setStatisticsLogPeriod( uint32_t periodMs )
+{
+    ServiceManager & serviceManager = ServiceManager::getInstance( );
+    Lock lock( serviceManager.mLock );
+    serviceManager.mStatisticsPeriod = periodMs;
+    if ( periodMs == 0 )
+    {
+        serviceManager.mStatisticsTimer.stopTimer( );
+    }
+    else if ( serviceManager.isReady( ) )
+    {
+        serviceManager.mStatisticsTimer.startTimer( periodMs, static_cast<DispatcherThread &>(serviceManager), Timer::CONTINUOUSLY );
+    }
+}
+
 void ServiceManager::requestRegisterServer( const StubAddress & whichServer )
 {
     TRACE_SCOPE(areg_component_private_ServiceManager_requestRegisterServer);
@@ -101,6 +134,17 @@ void ServiceManager::requestRegisterServer( const StubAddress & whichServer )
                                   , static_cast<DispatcherThread &>(serviceManager));
 }
 
+void ServiceManager::requestRegisterServers( const TEArrayList<StubAddress> & serverList )
+{
+    TRACE_SCOPE(areg_component_private_ServiceManager_requestRegisterServers);
+    TRACE_DBG("Request to register [ %u ] servers", serverList.getSize());
+
+    ServiceManager & serviceManager = ServiceManager::getInstance();
+    ServiceManagerEvent::sendEvent( ServiceManagerEventData::registerStubList(serverList)
+                                  , static_cast<IEServiceManagerEventConsumer &>(serviceManager)
+                                  , static_cast<DispatcherThread &>(serviceManager));
+}
+
 void ServiceManager::requestUnregisterServer( const StubAddress & whichServer, const NEService::eDisconnectReason reason )
 {
     TRACE_SCOPE(areg_component_private_ServiceManager_requestUnregisterServer);
@@ -225,10 +269,13 @@ ServiceManager::ServiceManager( void )
     , IEServiceManagerEventConsumer ( )
     , IEServiceConnectionConsumer   ( )
     , IEServiceRegisterConsumer     ( )
+    , IETimerConsumer               ( )
 
     , mEventProcessor   ( self() )
     , mServiceClient    ( static_cast<IEServiceConnectionConsumer&>(self()), static_cast<IEServiceRegisterConsumer&>(self()) )
     , mLock             (  )
+    , mStatisticsTimer  ( static_cast<IETimerConsumer &>(self()), "DispatcherStatisticsTimer" )
+    , mStatisticsPeriod ( 0u )
 {
 }
 
@@ -247,7 +294,7 @@ void ServiceManager::processEvent( const ServiceManagerEventData & data )
 
 bool ServiceManager::postEvent(Event & eventElem)
 {
-    return (RUNTIME_CAST(&eventElem, ServiceManagerEvent) != nullptr) && EventDispatcher::postEvent(eventElem);
+    return ((RUNTIME_CAST(&eventElem, ServiceManagerEvent) != nullptr) || (RUNTIME_CAST(&eventElem, TimerEvent) != nullptr)) && EventDispatcher::postEvent(eventElem);
 }
 
 void ServiceManager::readyForEvents( bool isReady )
@@ -258,10 +305,22 @@ void ServiceManager::readyForEvents( bool isReady )
     }
     else
     {
+        mStatisticsTimer.stopTimer( );
         ServiceManagerEvent::removeListener( static_cast<IEServiceManagerEventConsumer &>(self( )), static_cast<DispatcherThread &>(self( )) );
     }
 
     DispatcherThread::readyForEvents( isReady );
+
+    Lock lock( mLock );
+    if ( isReady && (mStatisticsPeriod != 0) )
+    {
+        mStatisticsTimer.startTimer( mStatisticsPeriod, static_cast<DispatcherThread &>(self( )), Timer::CONTINUOUSLY );
+    }
+}
+
+void ServiceManager::processTimer( Timer & /* timer */ )
+{
+    DispatcherStatistics::logStatistics( );
 }
 
 bool ServiceManager::_startServiceManagerThread( void )
@@ -298,26 +357,34 @@ void ServiceManager::extractRemoteServiceAddresses(const ITEM_ID & cookie, TEArr
     out_listStubs.clear();
     out_lisProxies.clear();
 
-    const ServerList & serverList{ mEventProcessor.getRegisteredServiceList( ) };
-
-    for (ServerList::MAPPOS posMap = serverList.firstPosition(); serverList.isValidPosition(posMap); posMap = serverList.nextPosition(posMap) )
+    if ( cookie >= NEService::COOKIE_REMOTE_SERVICE )
+    {
+        // The services of remote connection are indexed, no need to iterate all registered services.
+        mEventProcessor.getRemoteServiceIndex( ).getServices( cookie, out_listStubs, out_lisProxies );
+    }
+    else
     {
-        const StubAddress & server      = serverList.keyAtPosition(posMap).getAddress();
-        const ClientList & clientList   = serverList.valueAtPosition(posMap);
+        const ServerList & serverList{ mEventProcessor.getRegisteredServiceList( ) };
 
-        if ( server.isValid() && ((cookie == NEService::COOKIE_ANY) || (server.getCookie() == cookie)) )
+        for (ServerList::MAPPOS posMap = serverList.firstPosition(); serverList.isValidPosition(posMap); posMap = serverList.nextPosition(posMap) )
         {
-            TRACE_DBG("Found stub [ %s ] of cookie [ %u ]", StubAddress::convAddressToPath(server).getString(), static_cast<uint32_t>(cookie));
-            out_listStubs.add(server);
-        }
+            const StubAddress & server      = serverList.keyAtPosition(posMap).getAddress();
+            const ClientList & clientList   = serverList.valueAtPosition(posMap);
 
-        for (ClientList::LISTPOS pos = clientList.firstPosition(); clientList.isValidPosition(pos); pos = clientList.nextPosition(pos))
-        {
-            const ProxyAddress & proxy = clientList.valueAtPosition(pos).getAddress();
-            if ( proxy.isValid() && ((cookie == NEService::COOKIE_ANY) || (proxy.getCookie() == cookie)) )
+            if ( server.isValid() && ((cookie == NEService::COOKIE_ANY) || (server.getCookie() == cookie)) )
+            {
+                TRACE_DBG("Found stub [ %s ] of cookie [ %u ]", StubAddress::convAddressToPath(server).getString(), static_cast<uint32_t>(cookie));
+                out_listStubs.add(server);
+            }
+
+            for (ClientList::LISTPOS pos = clientList.firstPosition(); clientList.isValidPosition(pos); pos = clientList.nextPosition(pos))
             {
-                TRACE_DBG("Found proxy [ %s ] of cookie [ %u ]", ProxyAddress::convAddressToPath(proxy).getString(), cookie);
-                out_lisProxies.add(proxy);
+                const ProxyAddress & proxy = clientList.valueAtPosition(pos).getAddress();
+                if ( proxy.isValid() && ((cookie == NEService::COOKIE_ANY) || (proxy.getCookie() == cookie)) )
+                {
+                    TRACE_DBG("Found proxy [ %s ] of cookie [ %u ]", ProxyAddress::convAddressToPath(proxy).getString(), cookie);
+                    out_lisProxies.add(proxy);
+                }
             }
         }
     }
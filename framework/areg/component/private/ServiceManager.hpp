@@ -22,6 +22,8 @@
 #include "areg/base/GEGlobal.h"
 
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/component/IETimerConsumer.hpp"
+#include "areg/component/Timer.hpp"
 #include "areg/component/private/ServiceManagerEvents.hpp"
 #include "areg/ipc/IEServiceConnectionConsumer.hpp"
 #include "areg/ipc/IEServiceRegisterConsumer.hpp"
@@ -68,6 +70,7 @@ class ServiceManager    : private   DispatcherThread
                         , private   IEServiceManagerEventConsumer
                         , private   IEServiceConnectionConsumer
                         , private   IEServiceRegisterConsumer
+                        , private   IETimerConsumer
 {
     friend class Application;
     friend class ServiceManagerEventProcessor;
@@ -100,6 +103,15 @@ public:
      **/
     static void requestRegisterServer( const StubAddress & whichServer );
 
+    /**
+     * \brief   Static method to be called globally.
+     *          The function is called when the component thread starts the components
+     *          and requests to register all started Stub servers by one event.
+     *          The servers are registered in the same order as they are listed.
+     * \param   serverList      The list of addresses of the started Stub servers.
+     **/
+    static void requestRegisterServers( const TEArrayList<StubAddress> & serverList );
+
     /**
      * \brief   Static method to be called globally.
      *          The function is called when Stub Server is shutting down
@@ -176,6 +188,32 @@ public:
      **/
     static void queryCommunicationData( unsigned int & OUT sizeSend, unsigned int & OUT sizeReceive );
 
+    /**
+     * \brief   Returns the depth of the queue of messages to send to the router
+     *          and the statistics of the send window.
+     **/
+    static SendWindow::sWindowStatistics querySendQueue( void );
+
+    /**
+     * \brief   Sets the send window of the connection to the router.
+     * \param   maxMessages The maximum number of queued messages. The value 0 means no limit.
+     * \param   maxBytes    The maximum size in bytes of queued messages. The value 0 means no limit.
+     **/
+    static void setSendWindow( uint32_t maxMessages, uint32_t maxBytes );
+
+    /**
+     * \brief   Returns true if the send window of the connection to the router is not exhausted.
+     *          Otherwise, the remote requests are replied with NEService::eResultType::RequestBusy.
+     **/
+    static bool isSendWindowOpen( void );
+
+    /**
+     * \brief   Sets the period to output the statistics of the dispatchers in the logs.
+     *          The statistics are logged by the Service Manager thread.
+     * \param   periodMs    The period in milliseconds. The value 0 stops logging statistics.
+     **/
+    static void setStatisticsLogPeriod( uint32_t periodMs );
+
 private:
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -393,6 +431,16 @@ private:
      **/
     virtual void unregisteredRemoteServiceConsumer( const ProxyAddress & proxy, NEService::eDisconnectReason reason, const ITEM_ID & cookie /*= NEService::COOKIE_ANY*/ ) override;
 
+/************************************************************************/
+// IETimerConsumer overrides
+/************************************************************************/
+
+    /**
+     * \brief   Triggered when the statistics timer is expired. Logs the statistics of the dispatchers.
+     * \param   timer   The timer object that is expired.
+     **/
+    virtual void processTimer( Timer & timer ) override;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations and attributes
 //////////////////////////////////////////////////////////////////////////
@@ -450,6 +498,14 @@ private:
      * \brief   Synchronization object, for multi-threading access.
      **/
     mutable ResourceLock            mLock;
+    /**
+     * \brief   The timer to log the statistics of the dispatchers.
+     **/
+    Timer                           mStatisticsTimer;
+    /**
+     * \brief   The period in milliseconds to log the statistics. Zero if not logged.
+     **/
+    uint32_t                        mStatisticsPeriod;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls
@@ -45,6 +45,7 @@ DEF_TRACE_SCOPE( areg_component_private_ServiceManagerEventProcessor__startCompo
 ServiceManagerEventProcessor::ServiceManagerEventProcessor( ServiceManager & serviceManager )
     : mServiceManager   ( serviceManager )
     , mServerList       ( )
+    , mRemoteServices   ( )
 {
 }
 
@@ -58,6 +59,7 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
     case ServiceManagerEventData::eServiceManagerCommands::CMD_ShutdownService:
         {
             mServerList.clear( );
+            mRemoteServices.clear( );
             connectProvider.disconnectServiceHost( );
             mServiceManager.removeAllEvents( );
             mServiceManager.triggerExit( );
@@ -83,6 +85,7 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
             }
 
             mServerList.clear( );
+            mRemoteServices.clear( );
             connectProvider.disconnectServiceHost( );
             mServiceManager.removeEvents( false );
             mServiceManager.pulseExit( );
@@ -124,6 +127,22 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
         }
         break;
 
+    case ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStubList:
+        {
+            uint32_t count{ 0u };
+            stream >> count;
+            for ( uint32_t i = 0; i < count; ++ i )
+            {
+                StubAddress   addrstub;
+                Channel       channel;
+                stream >> addrstub;
+                stream >> channel;
+                addrstub.setChannel( channel );
+                _registerServer( addrstub, registerProvider);
+            }
+        }
+        break;
+
     case ServiceManagerEventData::eServiceManagerCommands::CMD_UnregisterStub:
         {
             StubAddress   addrstub;
@@ -185,6 +204,10 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
 
     case ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterConnection:
         {
+            // Collect all public services and register them by one message,
+            // instead of sending the message per service provider and consumer.
+            TEArrayList<StubAddress> stubList;
+            TEArrayList<ProxyAddress> proxyList;
             for ( ServerList::MAPPOS posMap = mServerList.firstPosition( ); mServerList.isValidPosition( posMap ); posMap = mServerList.nextPosition( posMap ) )
             {
                 const StubAddress & server = mServerList.keyAtPosition( posMap ).getAddress( );
@@ -192,7 +215,7 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
 
                 if ( server.isServicePublic( ) && server.isLocalAddress( ) && server.isValid( ) )
                 {
-                    registerProvider.registerServiceProvider( server );
+                    stubList.add( server );
                 }
 
                 for ( ClientList::LISTPOS pos = clientList.firstPosition( ); clientList.isValidPosition( pos ); pos = clientList.nextPosition( pos ) )
@@ -200,10 +223,12 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
                     const ProxyAddress & proxy = clientList.valueAtPosition( pos ).getAddress( );
                     if ( proxy.isServicePublic( ) && (proxy.isTargetLocal( ) == false) && proxy.isValid( ) )
                     {
-                        registerProvider.registerServiceConsumer( proxy );
+                        proxyList.add( proxy );
                     }
                 }
             }
+
+            registerProvider.registerServices( stubList, proxyList );
         }
         break;
 
@@ -215,25 +240,7 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
             // elements from the existing list and it may invalidate position object.
             TEArrayList<StubAddress> stubList;
             TEArrayList<ProxyAddress> proxyList;
-            for ( ServerList::MAPPOS posMap = mServerList.firstPosition( ); mServerList.isValidPosition( posMap ); posMap = mServerList.nextPosition( posMap ) )
-            {
-                const StubAddress & server = mServerList.keyAtPosition( posMap ).getAddress( );
-                const ClientList & clientList = mServerList.valueAtPosition( posMap );
-
-                if ( server.isServicePublic( ) && server.isRemoteAddress( ) && server.isValid( ) )
-                {
-                    stubList.add( server );
-                }
-
-                for ( ClientList::LISTPOS pos = clientList.firstPosition( ); clientList.isValidPosition( pos ); pos = clientList.nextPosition( pos ) )
-                {
-                    const ProxyAddress & proxy = clientList.valueAtPosition( pos ).getAddress( );
-                    if ( proxy.isServicePublic( ) && proxy.isRemoteAddress( ) && proxy.isValid( ) )
-                    {
-                        proxyList.add( proxy );
-                    }
-                }
-            }
+            mRemoteServices.getServices( NEService::COOKIE_ANY, stubList, proxyList );
 
             NEService::eDisconnectReason reason { NEService::eDisconnectReason::ReasonProviderDisconnected };
             if ( cmdService == ServiceManagerEventData::eServiceManagerCommands::CMD_LostConnection )
@@ -299,6 +306,11 @@ void ServiceManagerEventProcessor::_registerServer( const StubAddress & whichSer
     mServerList.registerServer( whichServer, clientList );
 #endif  // !AREG_LOGS
 
+    if ( whichServer.isServicePublic( ) && whichServer.isRemoteAddress( ) && whichServer.isValid( ) )
+    {
+        mRemoteServices.addStub( whichServer.getCookie( ), whichServer );
+    }
+
     for ( ClientList::LISTPOS pos = clientList.firstPosition( ); clientList.isValidPosition( pos ); pos = clientList.nextPosition( pos ) )
     {
         const ClientInfo & client{ clientList.valueAtPosition( pos ) };
@@ -334,6 +346,8 @@ void ServiceManagerEventProcessor::_unregisterServer( const StubAddress & whichS
 
 #endif  // AREG_LOGS
 
+    mRemoteServices.removeStub( whichServer.getCookie( ), whichServer );
+
     NEService::eServiceConnection status = NEService::serviceConnection( reason );
     for ( ClientList::LISTPOS pos = clientList.firstPosition( ); clientList.isValidPosition( pos ); pos = clientList.nextPosition( pos ) )
     {
@@ -356,6 +370,10 @@ void ServiceManagerEventProcessor::_registerClient( const ProxyAddress & whichCl
 
     ClientInfo client;
     const ServerInfo & server = mServerList.registerClient( whichClient, client );
+    if ( whichClient.isServicePublic( ) && whichClient.isRemoteAddress( ) && whichClient.isValid( ) )
+    {
+        mRemoteServices.addProxy( whichClient.getCookie( ), whichClient );
+    }
 
     TRACE_DBG( "Client [ %s ] is registered for server [ %s ], connection status [ %s ]"
                , ProxyAddress::convAddressToPath( client.getAddress( ) ).getString( )
@@ -384,6 +402,8 @@ void ServiceManagerEventProcessor::_unregisterClient( const ProxyAddress & which
     ClientInfo client;
 
     ServerInfo server = mServerList.unregisterClient( whichClient, client );
+    mRemoteServices.removeProxy( whichClient.getCookie( ), whichClient );
+
     TRACE_DBG( "Client [ %s ] is unregistered from server [ %s ], connection status [ %s ]"
                , ProxyAddress::convAddressToPath( client.getAddress( ) ).getString( )
                , StubAddress::convAddressToPath( server.getAddress( ) ).getString( )
@@ -493,7 +513,12 @@ void ServiceManagerEventProcessor::_startComponentThread( const String & threadN
     Thread * thread = Thread::findThreadByName( threadName );
     if ( entry.isValid( ) && (thread == nullptr) )
     {
-        ComponentThread * compThread = DEBUG_NEW ComponentThread( entry.mThreadName, entry.mWatchdogTimeout );
+        ComponentThread * compThread = DEBUG_NEW ComponentThread( entry.mThreadName, entry.mWatchdogTimeout, ComponentLoader::isPooledThread( threadName ) );
+        if ( compThread != nullptr )
+        {
+            compThread->setPlacement( entry.mPlacement );
+        }
+
         if ( (compThread != nullptr) && compThread->createThread( NECommon::WAIT_INFINITE ) )
         {
             TRACE_DBG( "Succeeded to create and start component thread [ %s ]", threadName.getString( ) );
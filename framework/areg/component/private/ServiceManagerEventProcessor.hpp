@@ -23,6 +23,7 @@
 
 #include "areg/component/private/ServerList.hpp"
 #include "areg/component/private/ServiceManagerEvents.hpp"
+#include "areg/ipc/RemoteServiceIndex.hpp"
 
 /************************************************************************
  * Dependencies
@@ -75,6 +76,11 @@ public:
      **/
     inline const ServerList& getRegisteredServiceList(void) const;
 
+    /**
+     * \brief   Returns the index of registered remote public service providers and consumers by cookie.
+     **/
+    inline const RemoteServiceIndex & getRemoteServiceIndex( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -164,6 +170,10 @@ private:
      * \brief   The Map of Server Info object as a Key and Client Info List as Values
      **/
     ServerList              mServerList;
+    /**
+     * \brief   The index of remote public service providers and consumers by cookie.
+     **/
+    RemoteServiceIndex      mRemoteServices;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -182,4 +192,9 @@ inline const ServerList & ServiceManagerEventProcessor::getRegisteredServiceList
     return mServerList;
 }
 
+inline const RemoteServiceIndex & ServiceManagerEventProcessor::getRemoteServiceIndex( void ) const
+{
+    return mRemoteServices;
+}
+
 #endif  // AREG_COMPONENT_PRIVATE_SERVICEMANAGEREVENTPROCESSOR_HPP
@@ -62,6 +62,20 @@ ServiceManagerEventData ServiceManagerEventData::registerStub(const StubAddress
     return data;
 }
 
+ServiceManagerEventData ServiceManagerEventData::registerStubList( const TEArrayList<StubAddress> & listStubs )
+{
+    ServiceManagerEventData data( ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStubList );
+    IEOutStream & stream = data.getWriteStream();
+    stream << listStubs.getSize();
+    for ( const StubAddress & addrStub : listStubs.getData() )
+    {
+        stream << addrStub;
+        stream << addrStub.getChannel();
+    }
+
+    return data;
+}
+
 ServiceManagerEventData ServiceManagerEventData::unregisterStub( const StubAddress & addrStub, NEService::eDisconnectReason reason )
 {
     ServiceManagerEventData data( ServiceManagerEventData::eServiceManagerCommands::CMD_UnregisterStub );
@@ -56,6 +56,7 @@ public:
         , CMD_RegisterProxy             //!< Requested to register Proxy
         , CMD_UnregisterProxy           //!< Requested to unregister Proxy
         , CMD_RegisterStub              //!< Requested to register Stub
+        , CMD_RegisterStubList          //!< Requested to register the list of Stubs
         , CMD_UnregisterStub            //!< Requested to unregister Stub
         , CMD_ConfigureConnection       //!< Requested to configure connection
         , CMD_StartConnection           //!< Requested to start connection, the data is configuration file
@@ -106,6 +107,13 @@ public:
      **/
     static ServiceManagerEventData registerStub( const StubAddress & addrStub );
 
+    /**
+     * \brief   Creates and returns Service Manager event data with command to register
+     *          the list of Stubs by one event.
+     * \param   listStubs   The list of addresses of the service providers to register.
+     **/
+    static ServiceManagerEventData registerStubList( const TEArrayList<StubAddress> & listStubs );
+
     /**
      * \brief   Creates and returns Service Manager event data with command to unregister Stub
      * \param   addrStub    The address of the service provider to unregister / disconnect.
@@ -314,6 +322,8 @@ inline const char * ServiceManagerEventData::getString( ServiceManagerEventData:
         return "ServiceManagerEventData::eServiceManagerCommands::CMD_UnregisterProxy";
     case ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStub:
         return "ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStub";
+    case ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStubList:
+        return "ServiceManagerEventData::eServiceManagerCommands::CMD_RegisterStubList";
     case ServiceManagerEventData::eServiceManagerCommands::CMD_UnregisterStub:
         return "ServiceManagerEventData::eServiceManagerCommands::CMD_UnregisterStub";
     case ServiceManagerEventData::eServiceManagerCommands::CMD_ConfigureConnection:
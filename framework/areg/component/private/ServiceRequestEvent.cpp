@@ -15,6 +15,7 @@
  ************************************************************************/
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/StubAddress.hpp"
+#include "areg/component/private/RemoteAddressCache.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // ServiceRequestEvent class implementation
@@ -43,7 +44,7 @@ ServiceRequestEvent::ServiceRequestEvent( const ProxyAddress & proxyAddress
 
 ServiceRequestEvent::ServiceRequestEvent(const IEInStream & stream)
     : StubEvent     (stream)
-    , mProxySource  (stream)
+    , mProxySource  (RemoteAddressCache::readProxyAddress(stream))
     , mMessageId    (NEService::INVALID_MESSAGE_ID)
     , mRequestType  (NEService::eRequestType::Unprocessed)
     , mSequenceNr   (NEService::SEQUENCE_NUMBER_NOTIFY)
@@ -53,10 +54,15 @@ ServiceRequestEvent::ServiceRequestEvent(const IEInStream & stream)
     stream >> mSequenceNr;
 }
 
+unsigned int ServiceRequestEvent::getMessageId( void ) const
+{
+    return mMessageId;
+}
+
 const IEInStream & ServiceRequestEvent::readStream(const IEInStream & stream)
 {
     StubEvent::readStream(stream);
-    stream >> mProxySource;
+    mProxySource = RemoteAddressCache::readProxyAddress(stream);
     stream >> mMessageId;
     stream >> mRequestType;
     stream >> mSequenceNr;
@@ -66,7 +72,7 @@ const IEInStream & ServiceRequestEvent::readStream(const IEInStream & stream)
 IEOutStream & ServiceRequestEvent::writeStream(IEOutStream & stream) const
 {
     StubEvent::writeStream(stream);
-    stream << mProxySource;
+    RemoteAddressCache::writeAddress(stream, mProxySource);
     stream << mMessageId;
     stream << mRequestType;
     stream << mSequenceNr;
@@ -55,6 +55,31 @@ ServiceResponseEvent* ServiceResponseEvent::cloneForTarget( const ProxyAddress &
     return DEBUG_NEW ServiceResponseEvent(target, *this);
 }
 
+unsigned int ServiceResponseEvent::getMessageId( void ) const
+{
+    return mResponseId;
+}
+
+uint64_t ServiceResponseEvent::getCoalesceKey( void ) const
+{
+    const bool hasData{ (mResult == NEService::eResultType::DataOK) || (mResult == NEService::eResultType::DataInvalid) };
+    return (hasData && NEService::isAttributeId(mResponseId) ? ServiceResponseEvent::createCoalesceKey(getTargetProxy(), mResponseId) : 0u);
+}
+
+bool ServiceResponseEvent::canReplaceEvent( const Event & queuedEvent ) const
+{
+    const ServiceResponseEvent * queued{ RUNTIME_CONST_CAST(&queuedEvent, ServiceResponseEvent) };
+    if ((queued == nullptr) || (queued->mResponseId != mResponseId))
+        return false;
+
+    const ProxyAddress & target{ getTargetProxy() };
+    const ProxyAddress & other{ queued->getTargetProxy() };
+    return  (target == other)                                   &&
+            (target.getServiceName() == other.getServiceName()) &&
+            (target.getRoleName() == other.getRoleName())       &&
+            (target.getThread() == other.getThread());
+}
+
 const IEInStream & ServiceResponseEvent::readStream( const IEInStream & stream )
 {
     ProxyEvent::readStream(stream);
@@ -21,223 +21,352 @@
 
 #include "areg/component/Event.hpp"
 
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////
+// SortedEventStack class implementation
+//////////////////////////////////////////////////////////////////////////
+
+inline uint32_t SortedEventStack::_getLevel(Event::eEventPriority eventPrio)
+{
+    switch (eventPrio)
+    {
+    case Event::eEventPriority::EventPriorityExit:
+        return 0u;
+    case Event::eEventPriority::EventPriorityCritical:
+        return 1u;
+    case Event::eEventPriority::EventPriorityHigh:
+        return 2u;
+    case Event::eEventPriority::EventPriorityNormal:
+        return 3u;
+    case Event::eEventPriority::EventPriorityLow:
+        return 4u;
+
+    case Event::eEventPriority::EventPriorityUndefined: // fall through
+    case Event::eEventPriority::EventPriorityIgnore:    // fall through
+    default:
+        return LEVEL_COUNT;
+    }
+}
+
+inline bool SortedEventStack::_isLater(const sDeadlineEntry & lhs, const sDeadlineEntry & rhs)
+{
+    return (lhs.deDeadline != rhs.deDeadline ? lhs.deDeadline > rhs.deDeadline : lhs.deSequence > rhs.deSequence);
+}
+
+inline Event * SortedEventStack::_popDeadline(sPriorityLevel & level)
+{
+    ASSERT(level.plDeadlines.empty() == false);
+    std::pop_heap(level.plDeadlines.begin(), level.plDeadlines.end(), &SortedEventStack::_isLater);
+    Event * result{ level.plDeadlines.back().deEvent };
+    level.plDeadlines.pop_back();
+    return result;
+}
+
+SortedEventStack::SortedEventStack(void)
+    : mLock     ( false )
+    , mLevels   ( )
+    , mCount    ( 0u )
+    , mSequence ( 0u )
+    , mCoalesceKeys     ( )
+    , mCoalesceEntries  ( )
+    , mCoalesced        ( 0u )
+{
+}
+
 SortedEventStack::~SortedEventStack(void)
 {
-    for (auto evt : mValueList)
+    for (auto & level : mLevels)
     {
-        evt->destroy();
+        _deleteLevel(level);
     }
 
-    mValueList.clear();
+    mCount = 0u;
 }
 
 void SortedEventStack::deleteAllEvents(void)
 {
-    Lock lock( mSynchObject );
+    Lock lock( mLock );
 
-    while ( mValueList.empty( ) == false )
+    for (auto & level : mLevels)
     {
-        Event * evt = mValueList.back( );
-        ASSERT( evt != nullptr );
-        evt->destroy( );
-        mValueList.pop_back( );
+        _deleteLevel(level);
     }
+
+    mCount = 0u;
+    mCoalesceEntries.clear();
 }
 
 uint32_t SortedEventStack::deleteAllLowerPriority(Event::eEventPriority eventPrio)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    while (mValueList.empty() == false)
+    // The levels are sorted, the lowest priority is the last.
+    const uint32_t first{ eventPrio > Event::eEventPriority::EventPriorityCritical ? 1u : _getLevel(eventPrio) + 1u };
+    for (uint32_t i = first; i < LEVEL_COUNT; ++ i)
     {
-        Event* evt = mValueList.back();
-        ASSERT(evt != nullptr);
-        if (evt->getEventPriority() < eventPrio)
-        {
-            evt->destroy();
-            mValueList.pop_back();
-        }
-        else
-        {
-            // Since the queue is sorted, ignore the rest
-            break;
-        }
+        _deleteLevel(mLevels[i]);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    _rebuildCoalesceEntries();
+    return mCount;
 }
 
 uint32_t SortedEventStack::deleteAllExceptClass(const RuntimeClassID& eventClassId)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    // The level of "Exit" events is untouched.
+    for (uint32_t i = 1u; i < LEVEL_COUNT; ++ i)
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId != (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        _deleteLevelClass(mLevels[i], eventClassId, false);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    _rebuildCoalesceEntries();
+    return mCount;
 }
 
 uint32_t SortedEventStack::deleteAllMatchPriority(Event::eEventPriority eventPrio)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    const uint32_t index{ _getLevel(eventPrio) };
+    if ((index != 0u) && (index < LEVEL_COUNT))
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventPrio == (*it)->getEventPriority())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        _deleteLevel(mLevels[index]);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    _rebuildCoalesceEntries();
+    return mCount;
 }
 
 uint32_t SortedEventStack::deleteAllMatchClass(const RuntimeClassID& eventClassId)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    // The level of "Exit" events is untouched.
+    for (uint32_t i = 1u; i < LEVEL_COUNT; ++ i)
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId == (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        _deleteLevelClass(mLevels[i], eventClassId, true);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    _rebuildCoalesceEntries();
+    return mCount;
 }
 
 uint32_t SortedEventStack::pushEvent(Event * newEvent)
 {
     ASSERT(newEvent != nullptr);
-    Lock lock(mSynchObject);
-    switch (newEvent->getEventPriority())
-    {
-    case Event::eEventPriority::EventPriorityLow:
-        _insertAtEnd(newEvent);
-        break;
-
-    case Event::eEventPriority::EventPriorityNormal:
-        _insertAfterPrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
-
-    case Event::eEventPriority::EventPriorityHigh:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
+    Lock lock(mLock);
 
-    case Event::eEventPriority::EventPriorityCritical:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityHigh);
-        break;
-
-    case Event::eEventPriority::EventPriorityExit:
-        _insertAtBegin(newEvent);
-        break;
+    const uint32_t index{ _getLevel(newEvent->getEventPriority()) };
+    ASSERT(index < LEVEL_COUNT);
+    sPriorityLevel & level{ mLevels[index < LEVEL_COUNT ? index : _getLevel(Event::DefaultPriority)] };
+    const uint64_t deadline{ newEvent->getDeadline() };
+    const uint64_t coalesceKey{ (index != 0u) && (mCoalesceKeys.empty() == false) ? _coalesceEvent(*newEvent) : 0u };
 
-    case Event::eEventPriority::EventPriorityUndefined: // fall through
-    case Event::eEventPriority::EventPriorityIgnore:    // fall through
-    default:
-        ASSERT(false);
-        break;
+    if (index == 0u)
+    {
+        // the "Exit" events are processed as soon as possible.
+        level.plEvents.push_front(newEvent);
+    }
+    else if (deadline != 0u)
+    {
+        level.plDeadlines.push_back(sDeadlineEntry{ deadline, mSequence ++, newEvent });
+        std::push_heap(level.plDeadlines.begin(), level.plDeadlines.end(), &SortedEventStack::_isLater);
+    }
+    else
+    {
+        level.plEvents.push_back(newEvent);
+        if (coalesceKey != 0u)
+        {
+            // the entries in the heap are moved, only the events of the FIFO list can be replaced.
+            mCoalesceEntries[coalesceKey] = &level.plEvents.back();
+        }
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return (++ mCount);
 }
 
 uint32_t  SortedEventStack::popEvent(Event** stackEvent)
 {
     ASSERT(stackEvent != nullptr);
 
-    Lock lock(mSynchObject);
-    if (mValueList.empty() == false)
+    Lock lock(mLock);
+    *stackEvent = nullptr;
+    for (auto & level : mLevels)
     {
-        *stackEvent = mValueList.front();
-        mValueList.pop_front();
+        if ((level.plDeadlines.empty() == false) && (level.plEvents.empty() || (level.plRun < DEADLINE_RUN_MAX)))
+        {
+            // count only the events, which are dispatched before the waiting events without deadline.
+            level.plRun = level.plEvents.empty() ? 0u : level.plRun + 1u;
+            *stackEvent = _popDeadline(level);
+            break;
+        }
+
+        while ((*stackEvent == nullptr) && (level.plEvents.empty() == false))
+        {
+            // skip the empty entries of the replaced events.
+            Event * & entry{ level.plEvents.front() };
+            if ((entry != nullptr) && (mCoalesceEntries.empty() == false))
+            {
+                auto pos = mCoalesceEntries.find(entry->getCoalesceKey());
+                if ((pos != mCoalesceEntries.end()) && (pos->second == &entry))
+                {
+                    mCoalesceEntries.erase(pos);
+                }
+            }
+
+            *stackEvent = entry;
+            level.plEvents.pop_front();
+        }
+
+        level.plRun = 0u;
+        if ((*stackEvent == nullptr) && (level.plDeadlines.empty() == false))
+        {
+            // the FIFO list had only the empty entries of the replaced events.
+            *stackEvent = _popDeadline(level);
+        }
+
+        if (*stackEvent != nullptr)
+        {
+            break;
+        }
     }
-    else
+
+    if (*stackEvent != nullptr)
     {
-        *stackEvent = nullptr;
+        -- mCount;
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return mCount;
 }
 
-inline void SortedEventStack::_insertAtEnd(Event* newEvent)
+void SortedEventStack::setCoalescing(uint64_t coalesceKey, bool enable)
 {
-    mValueList.push_back(newEvent);
+    Lock lock(mLock);
+
+    if (enable)
+    {
+        mCoalesceKeys.insert(coalesceKey);
+    }
+    else
+    {
+        mCoalesceKeys.erase(coalesceKey);
+        mCoalesceEntries.erase(coalesceKey);
+    }
 }
 
-inline void SortedEventStack::_insertAfterPrio(Event* newEvent, Event::eEventPriority eventPrio)
+uint64_t SortedEventStack::_coalesceEvent(const Event & newEvent)
 {
-    auto it = mValueList.end();
-    if (mValueList.empty() == false)
+    const uint64_t coalesceKey{ newEvent.getCoalesceKey() };
+    if ((coalesceKey == 0u) || (mCoalesceKeys.find(coalesceKey) == mCoalesceKeys.end()))
+        return 0u;
+
+    auto pos = mCoalesceEntries.find(coalesceKey);
+    if (pos != mCoalesceEntries.end())
     {
-        const auto begin = mValueList.begin();
-        it = std::prev(it);
-        while ( (it != begin) && ((*it)->getEventPriority() < eventPrio) )
+        // the queued event is superseded, leave the entry empty to keep O(1).
+        Event * & entry{ *pos->second };
+        ASSERT(entry != nullptr);
+        if (newEvent.canReplaceEvent(*entry) == false)
         {
-            it = std::prev(it);
+            // the same key of other target, both events are queued.
+            return 0u;
         }
 
-        if ((*it)->getEventPriority() >= eventPrio)
+        entry->destroy();
+        entry = nullptr;
+        mCoalesceEntries.erase(pos);
+        mCoalesced.fetch_add(1u, std::memory_order_relaxed);
+        -- mCount;
+    }
+
+    return coalesceKey;
+}
+
+void SortedEventStack::_rebuildCoalesceEntries(void)
+{
+    if (mCoalesceEntries.empty())
+        return;
+
+    mCoalesceEntries.clear();
+    for (uint32_t i = 1u; i < LEVEL_COUNT; ++ i)
+    {
+        for (Event * & entry : mLevels[i].plEvents)
         {
-            it = std::next(it);
+            const uint64_t coalesceKey{ entry != nullptr ? entry->getCoalesceKey() : 0u };
+            if ((coalesceKey != 0u) && (mCoalesceKeys.find(coalesceKey) != mCoalesceKeys.end()))
+            {
+                mCoalesceEntries[coalesceKey] = &entry;
+            }
         }
     }
-
-    mValueList.insert(it, newEvent);
 }
 
-inline void SortedEventStack::_insertBeforePrio(Event* newEvent, Event::eEventPriority eventPrio)
+void SortedEventStack::_deleteLevel(sPriorityLevel & level)
 {
-    auto it = mValueList.begin();
-    if (mValueList.empty() == false)
+    uint32_t count{ 0u };
+    for (Event * evt : level.plEvents)
     {
-        const auto end = mValueList.end();
-        while ((it != end) && ((*it)->getEventPriority() > eventPrio))
+        if (evt != nullptr)
         {
-            it = std::next(it);
+            evt->destroy();
+            ++ count;
         }
     }
 
-    mValueList.insert(it, newEvent);
+    for (const sDeadlineEntry & entry : level.plDeadlines)
+    {
+        ASSERT(entry.deEvent != nullptr);
+        entry.deEvent->destroy();
+    }
+
+    mCount -= count + static_cast<uint32_t>(level.plDeadlines.size());
+    level.plEvents.clear();
+    level.plDeadlines.clear();
+    level.plRun = 0u;
 }
 
-inline void SortedEventStack::_insertAtBegin(Event* newEvent)
+void SortedEventStack::_deleteLevelClass(sPriorityLevel & level, const RuntimeClassID & eventClassId, bool match)
 {
-    mValueList.push_front(newEvent);
+    uint32_t removed{ 0u };
+
+    auto itEvents = std::remove_if(level.plEvents.begin(), level.plEvents.end(), [&eventClassId, match, &removed](Event * evt) -> bool
+        {
+            if (evt == nullptr)
+            {
+                // the entry of the replaced event.
+                return true;
+            }
+            else if ((eventClassId == evt->getRuntimeClassId()) == match)
+            {
+                evt->destroy();
+                ++ removed;
+                return true;
+            }
+
+            return false;
+        });
+    level.plEvents.erase(itEvents, level.plEvents.end());
+
+    auto itDeadlines = std::remove_if(level.plDeadlines.begin(), level.plDeadlines.end(), [&eventClassId, match, &removed](const sDeadlineEntry & entry) -> bool
+        {
+            if ((eventClassId == entry.deEvent->getRuntimeClassId()) == match)
+            {
+                entry.deEvent->destroy();
+                ++ removed;
+                return true;
+            }
+
+            return false;
+        });
+
+    if (itDeadlines != level.plDeadlines.end())
+    {
+        level.plDeadlines.erase(itDeadlines, level.plDeadlines.end());
+        std::make_heap(level.plDeadlines.begin(), level.plDeadlines.end(), &SortedEventStack::_isLater);
+    }
+
+    mCount -= removed;
 }
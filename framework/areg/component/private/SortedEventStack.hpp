@@ -20,9 +20,15 @@
   * Includes
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
-#include "areg/base/TEStack.hpp"
+#include "areg/base/SynchObjects.hpp"
 #include "areg/component/Event.hpp"
 
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 class RuntimeClassID;
 
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
@@ -47,14 +53,78 @@ class RuntimeClassID;
  *          The "Exit" events have reserved "Exit" priority. This priority is only for internal use and should not be used
  *          by other developers. The "Exit" events should be immediately processed and they are not removed from the 
  *          stack until they are not processed by thread dispatcher.
+ *
+ *          Each priority has its own level in the stack. The events without deadline are kept in the FIFO list of
+ *          the level, the events with deadline are kept in the binary min-heap of the level and within the level
+ *          they are dispatched in the order of the earliest deadline before the events without deadline.
+ *          To avoid starving the events without deadline, after DEADLINE_RUN_MAX events with deadline are
+ *          dispatched in a row while the FIFO list of the level is not empty, the next event is taken from
+ *          the FIFO list. The events with the same deadline are dispatched in the order they are pushed. Both push and pop
+ *          are O(1) for events without deadline and O(log n) for the events with deadline.
+ *
+ *          The stack coalesces the events with the enabled coalescing key ("latest value wins"). When the
+ *          event with the enabled key is pushed, the queued event with the same key, which is not processed
+ *          yet, is destroyed and its entry in the FIFO list is left empty, then the new event is pushed at
+ *          the end. The empty entries are skipped when the events are popped. The replacement is O(1).
  **/
-class SortedEventStack  : protected TELockStack<Event *>
+class SortedEventStack
 {
+//////////////////////////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The maximum number of events with deadline dispatched in a row within the level
+     *          while events without deadline are waiting in the same level.
+     **/
+    static constexpr uint32_t   DEADLINE_RUN_MAX    { 8u };
+
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The number of priority levels in the stack: Exit, Critical, High, Normal and Low.
+     **/
+    static constexpr uint32_t   LEVEL_COUNT { 5u };
+
+    /**
+     * \brief   The entry of the event with the deadline in the heap of the level.
+     **/
+    struct sDeadlineEntry
+    {
+        uint64_t    deDeadline; //!< The deadline of the event.
+        uint64_t    deSequence; //!< The sequence number of pushed event to keep the FIFO order of the same deadlines.
+        Event *     deEvent;    //!< The queued event.
+    };
+
+    /**
+     * \brief   The events of one priority level.
+     **/
+    struct sPriorityLevel
+    {
+        std::deque<Event *>         plEvents;   //!< The FIFO list of events without deadline.
+        std::vector<sDeadlineEntry> plDeadlines;//!< The min-heap of events with deadline.
+        uint32_t                    plRun{ 0u };//!< The number of events with deadline dispatched in a row while the FIFO list is not empty.
+    };
+
+    /**
+     * \brief   The entries of the queued events in the FIFO lists by coalescing key.
+     *          The references to the entries of std::deque remain valid when pushing
+     *          at the begin or at the end.
+     **/
+    using MapCoalesceEntries    = std::unordered_map<uint64_t, Event **>;
+
+    /**
+     * \brief   The set of enabled coalescing keys.
+     **/
+    using SetCoalesceKeys       = std::unordered_set<uint64_t>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
 public:
-    SortedEventStack( void ) = default;
+    SortedEventStack( void );
 
     ~SortedEventStack(void);
 
@@ -112,6 +182,19 @@ public:
      **/
     uint32_t popEvent(Event** OUT stackEvent);
 
+    /**
+     * \brief   Enables or disables coalescing of the events with the specified key. If enabled,
+     *          the pushed event with the key replaces the queued event with the same key.
+     * \param   coalesceKey The coalescing key of the events, see Event::getCoalesceKey().
+     * \param   enable      If true, the events with the key are coalesced.
+     **/
+    void setCoalescing(uint64_t coalesceKey, bool enable);
+
+    /**
+     * \brief   Returns the number of queued events replaced by the new events with the same key.
+     **/
+    inline uint64_t getCoalescedCount(void) const;
+
     /**
      * \brief   Returns true if the stack is empty.
      **/
@@ -138,36 +221,79 @@ public:
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Inserts the event at the end of the stack. No priority is considered.
-     *          For example, the events with low priority are inserted at the end of the stack.
+     * \brief   Returns the index of the level of the specified priority. The level of "Exit" events is zero.
+     *          Returns LEVEL_COUNT if the priority cannot be queued.
+     **/
+    static inline uint32_t _getLevel(Event::eEventPriority eventPrio);
+
+    /**
+     * \brief   Returns true if the deadline entry 'lhs' should be dispatched after 'rhs'.
+     *          Used as a comparison of the min-heap.
+     **/
+    static inline bool _isLater(const sDeadlineEntry & lhs, const sDeadlineEntry & rhs);
+
+    /**
+     * \brief   Removes and returns the event with the earliest deadline of the specified level.
+     *          The min-heap of the level must not be empty.
+     **/
+    static inline Event * _popDeadline(sPriorityLevel & level);
+
+    /**
+     * \brief   Deletes all events of the specified level.
      **/
-    inline void _insertAtEnd(Event * newEvent);
+    void _deleteLevel(sPriorityLevel & level);
 
     /**
-     * \brief   Inserts the event object at the end of the event elements list of specified priority.
-     *          The function compares the priority of the events and inserts the element
-     *          at the end of the list with events of the specified priority.
-     *          The search is started at the end.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Destroys the queued event with the same coalescing key as the new event
+     *          if the coalescing of the key is enabled. Returns the key of the new event
+     *          if it is enabled, otherwise returns zero.
      **/
-    inline void _insertAfterPrio(Event * newEvent, Event::eEventPriority eventPrio);
+    uint64_t _coalesceEvent(const Event & newEvent);
 
     /**
-     * \brief   Inserts the event object before the elements of specified are queued.
-     *          The function compares the priority of the events and inserts the element
-     *          at the position before the events of specified priority start.
-     *          The search is started at the begin.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Collects again the entries of the queued events with coalescing keys
+     *          after the events are deleted from the FIFO lists.
      **/
-    inline void _insertBeforePrio(Event * newEvent, Event::eEventPriority eventPrio);
+    void _rebuildCoalesceEntries(void);
 
     /**
-     * \brief   Inserts the event element at the very begin of the stack, so that it is
-     *          processed as soon as possible.
+     * \brief   Deletes the events of the specified level, which match the class ID if 'match' is true
+     *          or which do not match the class ID if 'match' is false.
      **/
-    inline void _insertAtBegin(Event * newEvent);
+    void _deleteLevelClass(sPriorityLevel & level, const RuntimeClassID & eventClassId, bool match);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The lock to synchronize the access to the stack.
+     **/
+    mutable ResourceLock    mLock;
+    /**
+     * \brief   The levels of the events sorted by priority, the "Exit" level is first.
+     **/
+    sPriorityLevel          mLevels[LEVEL_COUNT];
+    /**
+     * \brief   The number of events in the stack.
+     **/
+    uint32_t                mCount;
+    /**
+     * \brief   The sequence number of the next event pushed with deadline.
+     **/
+    uint64_t                mSequence;
+    /**
+     * \brief   The enabled coalescing keys.
+     **/
+    SetCoalesceKeys         mCoalesceKeys;
+    /**
+     * \brief   The entries of the queued events with enabled coalescing keys.
+     **/
+    MapCoalesceEntries      mCoalesceEntries;
+    /**
+     * \brief   The number of queued events replaced by the new events.
+     **/
+    std::atomic_uint64_t    mCoalesced;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden methods
@@ -185,25 +311,30 @@ private:
 // SortedEventStack class inline implementation.
 //////////////////////////////////////////////////////////////////////////
 
+inline uint64_t SortedEventStack::getCoalescedCount(void) const
+{
+    return mCoalesced.load(std::memory_order_relaxed);
+}
+
 inline bool SortedEventStack::isEmpty(void) const
 {
-    Lock lock(mSynchObject);
-    return mValueList.empty();
+    Lock lock(mLock);
+    return (mCount == 0u);
 }
 
 inline uint32_t SortedEventStack::getCount(void) const
 {
-    return static_cast<uint32_t>(mValueList.size());
+    return mCount;
 }
 
 inline bool SortedEventStack::lockStack(void)
 {
-    return lock();
+    return mLock.lock(NECommon::WAIT_INFINITE);
 }
 
 inline void SortedEventStack::unlockStack(void)
 {
-    unlock();
+    mLock.unlock();
 }
 
 #endif  // AREG_COMPONENT_PRIVATE_SORTEDEVENTSTACK_HPP
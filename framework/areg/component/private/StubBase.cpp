@@ -82,7 +82,9 @@ StubBase::StubBase( Component & masterComp, const NEService::SInterfaceData & si
     , mListListener         ( )
     , mCurrListener         (mListListener.invalidPosition())
     , mSessionId            (0)
+    , mResponseDeadline     (0u)
     , mMapSessions          ( )
+    , mDeltaAttributes      ( )
 {
     _mapRegisteredStubs.registerResourceObject(mAddress, this);
     masterComp.registerServerItem(self());
@@ -252,6 +254,11 @@ void StubBase::sendUpdateNotification( const StubListenerList & whichListeners,
 
 void StubBase::sendServiceResponse( ServiceResponseEvent & eventElem ) const
 {
+    if ( (mResponseDeadline != 0u) && (NEService::isAttributeId(eventElem.getResponseId()) == false) )
+    {
+        eventElem.setDeadlineTimeout( mResponseDeadline );
+    }
+
     eventElem.getTargetProxy().deliverServiceEvent(eventElem);
 }
 
@@ -335,11 +342,32 @@ void StubBase::invalidateAttribute( unsigned int attrId )
         errorRequest(attrId, false);
 }
 
+void StubBase::setAttributeDelta( unsigned int attrId, bool enable )
+{
+    if ( NEService::isAttributeId(attrId) )
+    {
+        if ( enable )
+        {
+            mDeltaAttributes.addIfUnique(attrId, AttributeDelta());
+        }
+        else
+        {
+            mDeltaAttributes.removeAt(attrId);
+        }
+    }
+}
+
 void StubBase::sendUpdateEvent( unsigned int msgId, const EventDataStream & data, NEService::eResultType result ) const
 {
     TRACE_SCOPE( areg_component_StubBase_sendUpdateEvent);
     StubBase::StubListenerList listeners;
-    if (findListeners(msgId, listeners) > 0)
+    findListeners(msgId, listeners);
+    if ( mDeltaAttributes.contains(msgId) )
+    {
+        _sendUpdateDelta(msgId, data, result, listeners);
+    }
+
+    if (listeners.isEmpty() == false)
     {
         const ProxyAddress & proxy = listeners.firstEntry( ).mProxy;
         TRACE_WARN( "Sends busy message to proxy [ %s ] for the request [ %u ]", ProxyAddress::convAddressToPath( proxy).getString(), msgId);
@@ -355,7 +383,22 @@ void StubBase::sendUpdateEvent( unsigned int msgId, const EventDataStream & data
 
 void StubBase::sendUpdateNotificationOnce( const ProxyAddress & target, unsigned int msgId, const EventDataStream & data, NEService::eResultType result ) const
 {
-    ResponseEvent * eventElem = createResponseEvent( target, msgId, result, data );
+    ResponseEvent * eventElem { nullptr };
+    if ( (result == NEService::eResultType::DataOK) && target.isRemoteAddress() && mDeltaAttributes.contains(msgId) )
+    {
+        // the new remote listener gets the snapshot to apply next changes.
+        EventDataStream delta(EventDataStream::eEventData::EventDataExternal);
+        if ( mDeltaAttributes.getAt(msgId).encodeSnapshot(data, delta) )
+        {
+            eventElem = createResponseEvent( target, msgId, NEService::eResultType::DataDelta, delta );
+        }
+    }
+
+    if ( eventElem == nullptr )
+    {
+        eventElem = createResponseEvent( target, msgId, result, data );
+    }
+
     if ( eventElem != nullptr )
     {
         sendServiceResponse( *eventElem );
@@ -517,6 +560,8 @@ void StubBase::processStubRegisteredEvent(const StubAddress & stubTarget, NEServ
         
         _mapRegisteredStubs.registerResourceObject(mAddress, this);
         _mapRegisteredStubs.unlock();
+
+        getComponentThread().serviceConnected();
     }
 
     mConnectionStatus = status;
@@ -582,3 +627,39 @@ void StubBase::processStubEvent( StubEvent & /* eventElem */ )
 void StubBase::processGenericEvent(Event & /* eventElem */)
 {
 }
+
+void StubBase::_sendUpdateDelta( unsigned int msgId, const EventDataStream & data, NEService::eResultType result, StubListenerList & listeners ) const
+{
+    StubBase::StubListenerList remotes;
+    StubBase::StubListenerList locals;
+    for (StubListenerList::LISTPOS pos = listeners.firstPosition(); listeners.isValidPosition(pos); pos = listeners.nextPosition(pos))
+    {
+        const StubBase::Listener & listener = listeners[pos];
+        if (listener.mProxy.isRemoteAddress())
+        {
+            remotes.pushLast(listener);
+        }
+        else
+        {
+            locals.pushLast(listener);
+        }
+    }
+
+    AttributeDelta & image = mDeltaAttributes.getAt(msgId);
+    EventDataStream delta(EventDataStream::eEventData::EventDataExternal);
+    if (remotes.isEmpty() || (result != NEService::eResultType::DataOK) || (image.encodeUpdate(data, delta) == false))
+    {
+        // the listeners get the whole data, the next remote update is sent as a snapshot.
+        image.reset();
+        return;
+    }
+
+    ResponseEvent * eventElem = createResponseEvent(remotes.firstEntry().mProxy, msgId, NEService::eResultType::DataDelta, delta);
+    if (eventElem != nullptr)
+    {
+        sendUpdateNotification(remotes, *eventElem);
+        eventElem->destroy();
+    }
+
+    listeners = std::move(locals);
+}
@@ -20,6 +20,7 @@
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/RequestEvents.hpp"
 #include "areg/component/private/StubConnectEvent.hpp"
+#include "areg/component/private/RemoteAddressCache.hpp"
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -42,7 +43,7 @@ StubEvent::StubEvent( const StubAddress& toTarget, Event::eEventType eventType )
 
 StubEvent::StubEvent( const IEInStream & stream  )
     : StreamableEvent   (stream)
-    , mTargetStubAddress(stream)
+    , mTargetStubAddress(RemoteAddressCache::readStubAddress(stream))
 {
 }
 
@@ -52,14 +53,14 @@ StubEvent::StubEvent( const IEInStream & stream  )
 const IEInStream & StubEvent::readStream( const IEInStream & stream )
 {
     StreamableEvent::readStream(stream);
-    stream >> mTargetStubAddress;
+    mTargetStubAddress = RemoteAddressCache::readStubAddress(stream);
     return stream;
 }
 
 IEOutStream & StubEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetStubAddress;
+    RemoteAddressCache::writeAddress(stream, mTargetStubAddress);
     return stream;
 }
 
@@ -44,6 +44,7 @@ Timer::Timer( IETimerConsumer& timerConsumer
     , mDispatchThread   (nullptr)
     , mStartedAt        ( 0u )
     , mExpiredAt        ( 0u )
+    , mEventDeadline    ( 0u )
     , mStarted          (false)
 {
 }
@@ -51,6 +51,11 @@ TimerEvent::TimerEvent(Timer & timer, DispatcherThread & target)
 
     setEventConsumer(static_cast<IEEventConsumer *>(&timer.getConsumer()));
     registerForThread(&target);
+    if (timer.getEventDeadline() != 0u)
+    {
+        setDeadlineTimeout(timer.getEventDeadline());
+    }
+
     timer._queueTimer();
 }
 
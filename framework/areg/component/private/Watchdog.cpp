@@ -28,44 +28,57 @@ Watchdog::GUARD_ID Watchdog::_generateId(void)
 }
 
 Watchdog::Watchdog(ComponentThread& thread, uint32_t msTimeout /*= NECommon::WATCHDOG_IGNORE*/)
-    : TimerBase         (TimerBase::eTimerType::TimerTypeWatchdog, thread.getName(), msTimeout, TimerBase::ONE_TIME)
+    : mName             ( thread.getName() )
+    , mTimeoutInMs      ( msTimeout )
     , mGuardId          ( _generateId() )
     , mSequence         ( 0u )
     , mComponentThread  ( thread )
+    , mStamp            ( 0u )
+    , mCheckedStamp     ( 0u )
+    , mCheckedTime      ( 0u )
 {
+    WatchdogManager::registerWatchdog(*this);
 }
 
 Watchdog::Watchdog(WorkerThread& thread, uint32_t msTimeout /*= NECommon::WATCHDOG_IGNORE*/)
-    : TimerBase         ( TimerBase::eTimerType::TimerTypeWatchdog, thread.getName(), msTimeout, TimerBase::ONE_TIME)
+    : mName             ( thread.getName() )
+    , mTimeoutInMs      ( msTimeout )
     , mGuardId          ( _generateId() )
     , mSequence         ( 0u )
     , mComponentThread  ( thread.getBindingComponentThread() )
+    , mStamp            ( 0u )
+    , mCheckedStamp     ( 0u )
+    , mCheckedTime      ( 0u )
 {
+    WatchdogManager::registerWatchdog(*this);
 }
 
 Watchdog::~Watchdog(void)
 {
-    WatchdogManager::stopTimer(*this);
+    WatchdogManager::unregisterWatchdog(*this);
 }
 
-void Watchdog::startGuard(void)
+bool Watchdog::checkExpired( uint64_t nowMs )
 {
-    if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
+    bool result{ false };
+    const Watchdog::STAMP stamp{ mStamp.load(std::memory_order_relaxed) };
+    if ((stamp & 1u) == 0u)
     {
-        Lock lock(mLock);
-        ASSERT(mHandle != nullptr);
-        ++mSequence;
-        mActive = WatchdogManager::startTimer(*this);
+        // the thread does not process an event.
+        mCheckedStamp   = stamp;
     }
-}
-
-void Watchdog::stopGuard( void )
-{
-    if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
+    else if (stamp != mCheckedStamp)
     {
-        Lock lock(mLock);
-        ASSERT(mHandle != nullptr);
-        mActive = false;
-        WatchdogManager::stopTimer(*this);
+        // the thread started the next event.
+        mCheckedStamp   = stamp;
+        mCheckedTime    = nowMs;
     }
+    else if ((mCheckedTime != 0u) && (nowMs - mCheckedTime >= mTimeoutInMs))
+    {
+        // the same event is processed longer than the timeout, report once.
+        mCheckedTime    = 0u;
+        result          = true;
+    }
+
+    return result;
 }
@@ -18,7 +18,11 @@
  /************************************************************************
   * Include files.
   ************************************************************************/
-#include "areg/component/TimerBase.hpp"
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NECommon.hpp"
+#include "areg/base/String.hpp"
+
+#include <atomic>
 
  /************************************************************************
   * Dependencies.
@@ -32,6 +36,10 @@ class WorkerThread;
  *          starts to process an event. If the watchdog timeout expired before
  *          the thread could process an event, it riggers procedure to
  *          terminate the component thread and restarts again.
+ *          The thread only writes the stamp with the sequence number of the
+ *          processed event, which costs an atomic store. The watchdog manager
+ *          thread periodically checks the stamps of all watchdogs and detects
+ *          the threads, which process the same event longer than the timeout.
  *          There is no guarantee that terminated thread will make all memory
  *          and stack cleanups. The terminated thread cleans up all components
  *          and proxies registered in the thread, all worker threads and then
@@ -41,7 +49,7 @@ class WorkerThread;
  *          If the watchdog timeout is zero (NECommon::WATCHDOG_IGNORE), the
  *          watchdog is ignored for the thread and thread is not terminated.
  **/
-class AREG_API Watchdog  : public TimerBase
+class AREG_API Watchdog
 {
 //////////////////////////////////////////////////////////////////////////
 // Object specific types and constants
@@ -77,6 +85,12 @@ public:
      */
     static constexpr WATCHDOG_ID    INVALID_WATCHDOG    { static_cast<WATCHDOG_ID>(0u) };
 
+    /**
+     * \brief   The stamp of the watchdog. The upper bits contain the sequence number
+     *          of the processed event, the lowest bit is set while the event is processed.
+     **/
+    using STAMP         = uint64_t;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / destructor
 //////////////////////////////////////////////////////////////////////////
@@ -102,28 +116,55 @@ public:
     /**
      * \brief   Destructor.
      **/
-    virtual ~Watchdog( void );
+    ~Watchdog( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Operations and attributes
 //////////////////////////////////////////////////////////////////////////
 public:
     /**
-     * \brief   Call to start the watchdog.
+     * \brief   Call to start the watchdog. Marks the stamp as busy with the next sequence number.
      **/
-    void startGuard(void);
+    inline void startGuard(void);
 
     /**
-     * \brief   Call to stop the watchdog.
+     * \brief   Call to stop the watchdog. Marks the stamp as not busy.
      **/
-    void stopGuard(void);
+    inline void stopGuard(void);
 
     /**
-     * \brief   Returns true if watchdog object is valid and can start timer.
+     * \brief   Returns true if watchdog object is valid and can guard the thread.
      *          The Watchdog is valid if the timeout is not zero.
      **/
     inline bool isValid( void ) const;
 
+    /**
+     * \brief   Returns the current stamp of the watchdog.
+     **/
+    inline Watchdog::STAMP getStamp( void ) const;
+
+    /**
+     * \brief   Checks the stamp of the watchdog. Called by the watchdog manager thread
+     *          with the current time. The time, when the stamp is seen first, is the
+     *          start of processing the event, so that the thread is detected within one
+     *          period of checks after the timeout expires and is never detected earlier.
+     * \param   nowMs   The current time in milliseconds.
+     * \return  Returns true once for the stamp, if the thread processes the same event
+     *          longer than the timeout.
+     **/
+    bool checkExpired( uint64_t nowMs );
+
+    /**
+     * \brief   Returns the name of the watchdog, which is the name of the guarded thread.
+     **/
+    inline const String & getName( void ) const;
+
+    /**
+     * \brief   Returns the timeout in milliseconds of the watchdog.
+     *          The timeout NECommon::WATCHDOG_IGNORE means the watchdog is ignored.
+     **/
+    inline uint32_t getTimeout( void ) const;
+
     /**
      * \brief   Returns the watchdog ID.
      */
@@ -186,6 +227,14 @@ private:
 //////////////////////////////////////////////////////////////////////////
 private:
 
+    /**
+     * \brief   The name of the watchdog.
+     **/
+    const String        mName;
+    /**
+     * \brief   The timeout in milliseconds of the watchdog.
+     **/
+    const uint32_t      mTimeoutInMs;
     /**
      * \brief   The unique identifier of the Watchdog object.
      **/
@@ -199,6 +248,26 @@ private:
      **/
     ComponentThread &   mComponentThread;
 
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The stamp written by the guarded thread.
+     **/
+    std::atomic<STAMP>  mStamp;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The last stamp seen by the watchdog manager thread.
+     **/
+    STAMP               mCheckedStamp;
+    /**
+     * \brief   The time in milliseconds when the watchdog manager thread has seen the stamp first.
+     **/
+    uint64_t            mCheckedTime;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -211,9 +280,42 @@ private:
 // Watchdog inline methods.
 //////////////////////////////////////////////////////////////////////////
 
+inline void Watchdog::startGuard( void )
+{
+    if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
+    {
+        // only the guarded thread writes the stamp, the order of other data is not relevant.
+        ++ mSequence;
+        mStamp.store((static_cast<STAMP>(mSequence) << 1) | 1u, std::memory_order_relaxed);
+    }
+}
+
+inline void Watchdog::stopGuard( void )
+{
+    if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
+    {
+        mStamp.store(static_cast<STAMP>(mSequence) << 1, std::memory_order_relaxed);
+    }
+}
+
 inline bool Watchdog::isValid(void) const
 {
-    return (mHandle != nullptr);
+    return (mTimeoutInMs != NECommon::WATCHDOG_IGNORE);
+}
+
+inline Watchdog::STAMP Watchdog::getStamp( void ) const
+{
+    return mStamp.load(std::memory_order_relaxed);
+}
+
+inline const String & Watchdog::getName( void ) const
+{
+    return mName;
+}
+
+inline uint32_t Watchdog::getTimeout( void ) const
+{
+    return mTimeoutInMs;
 }
 
 inline Watchdog::GUARD_ID Watchdog::getId(void) const
@@ -16,13 +16,13 @@
  ************************************************************************/
 #include "areg/component/private/WatchdogManager.hpp"
 
-#include "areg/component/private/ExitEvent.hpp"
 #include "areg/component/private/ServiceManager.hpp"
 #include "areg/component/ComponentThread.hpp"
+#include "areg/base/DateTime.hpp"
 
 #include "areg/trace/GETrace.h"
 
-DEF_TRACE_SCOPE(areg_component_private_WatchdogManager__processExpiredTimers);
+DEF_TRACE_SCOPE(areg_component_private_WatchdogManager__checkWatchdogs);
 
 //////////////////////////////////////////////////////////////////////////
 // WatchdogManager class implementation
@@ -40,45 +40,55 @@ WatchdogManager& WatchdogManager::getInstance(void)
 
 bool WatchdogManager::startWatchdogManager(void)
 {
-    return getInstance().startTimerManagerThread();
+    WatchdogManager & watchdogManager = getInstance();
+    if (watchdogManager.mThread.isRunning() == false)
+    {
+        watchdogManager.mExit.store(false);
+        watchdogManager.mEventCheck.resetEvent();
+        watchdogManager.mThread.createThread(NECommon::WAIT_INFINITE);
+    }
+
+    return watchdogManager.mThread.isRunning();
 }
 
 void WatchdogManager::stopWatchdogManager(bool waitComplete)
 {
-    return getInstance().stopTimerManagerThread(waitComplete);
+    WatchdogManager & watchdogManager = getInstance();
+    watchdogManager.mExit.store(true);
+    watchdogManager.mEventCheck.setEvent();
+    if (waitComplete)
+    {
+        watchdogManager.mThread.shutdownThread(NECommon::WAIT_INFINITE);
+    }
 }
 
 void WatchdogManager::waitWatchdogManager(void)
 {
-    return getInstance().waitCompletion();
+    getInstance().mThread.shutdownThread(NECommon::WAIT_INFINITE);
 }
 
 bool WatchdogManager::isWatchdogManagerStarted(void)
 {
-    return getInstance().isReady();
+    return getInstance().mThread.isRunning();
 }
 
-bool WatchdogManager::startTimer(Watchdog& watchdog)
+void WatchdogManager::registerWatchdog(Watchdog& watchdog)
 {
-    bool result = false;
-    ASSERT(watchdog.getHandle() != nullptr);
-    WatchdogManager& watchdogManager = getInstance();
-
-    if (watchdogManager.isWatchdogManagerStarted())
+    if (watchdog.isValid())
     {
-        watchdogManager._registerWatchdog(watchdog);
-        result = TimerManagerEvent::sendEvent( TimerManagerEventData(&watchdog)
-                                             , static_cast<IETimerManagerEventConsumer&>(watchdogManager)
-                                             , static_cast<DispatcherThread&>(watchdogManager));
+        WatchdogManager & watchdogManager = getInstance();
+        watchdogManager.mWatchdogResource.registerResourceObject(watchdog.getId(), &watchdog);
+        // wake up the thread to recalculate the period of checks.
+        watchdogManager.mEventCheck.setEvent();
     }
-
-    return result;
 }
 
-void WatchdogManager::stopTimer(Watchdog& watchdog)
+void WatchdogManager::unregisterWatchdog(Watchdog& watchdog)
 {
-    getInstance()._unregisterWatchdog(watchdog);
-    WatchdogManager::_osSystemTimerStop(watchdog.getHandle());
+    if (watchdog.isValid())
+    {
+        getInstance().mWatchdogResource.unregisterResourceObject(watchdog.getId());
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -86,82 +96,62 @@ void WatchdogManager::stopTimer(Watchdog& watchdog)
 //////////////////////////////////////////////////////////////////////////
 
 WatchdogManager::WatchdogManager(void)
-    : TimerManagerBase(WatchdogManager::WATCHDOG_THREAD_NAME)
-
-    , mWatchdogResource()
+    : IEThreadConsumer  ( )
+    , mThread           ( static_cast<IEThreadConsumer &>(self()), String(WatchdogManager::WATCHDOG_THREAD_NAME) )
+    , mEventCheck       ( true, true )
+    , mExit             ( false )
+    , mWatchdogResource ( )
 {
 }
 
 WatchdogManager::~WatchdogManager(void)
 {
-    _removeAllWatchdogs();
+    mExit.store(true);
+    mEventCheck.setEvent();
+    mThread.shutdownThread(NECommon::WAIT_INFINITE);
+    mWatchdogResource.removeAllResources();
 }
 
 //////////////////////////////////////////////////////////////////////////
 // Methods
 //////////////////////////////////////////////////////////////////////////
 
-inline void WatchdogManager::_registerWatchdog(Watchdog & watchdog)
-{
-    mWatchdogResource.registerResourceObject(watchdog.getId(), &watchdog);
-}
-
-inline void WatchdogManager::_unregisterWatchdog(Watchdog& watchdog)
-{
-    mWatchdogResource.unregisterResourceObject(watchdog.getId());
-    WatchdogManager::_osSystemTimerStop(watchdog.getHandle());
-}
-
-void WatchdogManager::_removeAllWatchdogs(void)
+void WatchdogManager::onThreadRuns(void)
 {
-    mWatchdogResource.lock();
-
-    std::pair< Watchdog::GUARD_ID, Watchdog*> elem;
-    while (mWatchdogResource.isEmpty() == false)
+    while (mExit.load() == false)
     {
-        mWatchdogResource.removeResourceFirstElement(elem);
-        ASSERT(elem.second != nullptr);
-        WatchdogManager::_osSystemTimerStop(elem.second->getHandle());
+        const uint32_t period{ _checkWatchdogs() };
+        mEventCheck.lock(period);
     }
-
-    mWatchdogResource.unlock();
 }
 
-void WatchdogManager::processEvent(const TimerManagerEventData & data)
+uint32_t WatchdogManager::_checkWatchdogs(void)
 {
-    Watchdog* watchdog = static_cast<Watchdog*>(data.getTimer());
-    ASSERT(watchdog != nullptr);
-    if (mWatchdogResource.existResource(watchdog->getId()))
-    {
-        WatchdogManager::_osSystemTimerStart(*watchdog);
-    }
-}
+    TRACE_SCOPE(areg_component_private_WatchdogManager__checkWatchdogs);
 
-void WatchdogManager::_processExpiredTimer(Watchdog* watchdog, Watchdog::WATCHDOG_ID watchdogId, uint32_t /* hiBytes */, uint32_t /* loBytes */)
-{
-    TRACE_SCOPE(areg_component_private_WatchdogManager__processExpiredTimers);
+    uint32_t minTimeout{ NECommon::WAIT_INFINITE };
+    const uint64_t now{ DateTime::getSystemTickCount() };
 
     mWatchdogResource.lock();
 
-    Watchdog::SEQUENCE_ID sequence  = Watchdog::makeSequenceId(watchdogId);
-    if ((watchdog != nullptr) && (watchdog->getSequence() == sequence))
+    Watchdog::GUARD_ID key{ 0 };
+    Watchdog * watchdog = mWatchdogResource.resourceFirstKey(key);
+    while (watchdog != nullptr)
     {
-        TRACE_WARN("The watchdog [ %s ] has expired, terminating component thread [ %s ]"
-                        , watchdog->getName().getString()
-                        , watchdog->getComponentThread().getName().getString());
+        minTimeout = MACRO_MIN(minTimeout, watchdog->getTimeout());
+        if (watchdog->checkExpired(now))
+        {
+            TRACE_WARN("The watchdog [ %s ] has expired, terminating component thread [ %s ]"
+                            , watchdog->getName().getString()
+                            , watchdog->getComponentThread().getName().getString());
+
+            ServiceManager::requestRecreateThread(watchdog->getComponentThread());
+        }
 
-        ServiceManager::requestRecreateThread(watchdog->getComponentThread());
+        watchdog = mWatchdogResource.resourceNextKey(key);
     }
 
     mWatchdogResource.unlock();
-}
-
-void WatchdogManager::readyForEvents(bool isReady)
-{
-    if (isReady == false)
-    {
-        _removeAllWatchdogs();
-    }
 
-    TimerManagerBase::readyForEvents(isReady);
+    return (minTimeout == NECommon::WAIT_INFINITE ? MAX_CHECK_PERIOD : MACRO_MAX(MIN_CHECK_PERIOD, MACRO_MIN(minTimeout / CHECK_PER_TIMEOUT, MAX_CHECK_PERIOD)));
 }
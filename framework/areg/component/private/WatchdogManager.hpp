@@ -19,16 +19,47 @@
   * Include files.
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
-#include "areg/component/private/TimerManagerBase.hpp"
-#include "areg/component/private/TimerManagerEvent.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/TEResourceMap.hpp"
 
 #include "areg/component/private/Watchdog.hpp"
 
-class WatchdogManager   : protected TimerManagerBase
+#include <atomic>
+
+/**
+ * \brief   The Watchdog Manager runs the thread, which periodically checks the
+ *          stamps of the registered watchdogs and requests to restart the
+ *          component thread, which processes an event longer than the timeout
+ *          of the watchdog. The period of checks is the fraction of the smallest
+ *          watchdog timeout.
+ **/
+class WatchdogManager   : private IEThreadConsumer
 {
 //////////////////////////////////////////////////////////////////////////
 // Predefined constants and types
 //////////////////////////////////////////////////////////////////////////    
+public:
+    /**
+     * \brief   WatchdogManager::CHECK_PER_TIMEOUT
+     *          The number of checks of stamps during the smallest watchdog timeout.
+     **/
+    static constexpr uint32_t   CHECK_PER_TIMEOUT   { 8u };
+
+    /**
+     * \brief   WatchdogManager::MIN_CHECK_PERIOD
+     *          The minimum period in milliseconds to check the stamps.
+     **/
+    static constexpr uint32_t   MIN_CHECK_PERIOD    { 5u };
+
+    /**
+     * \brief   WatchdogManager::MAX_CHECK_PERIOD
+     *          The maximum period in milliseconds to check the stamps.
+     *          Used when there are no watchdogs to check.
+     **/
+    static constexpr uint32_t   MAX_CHECK_PERIOD    { 500u };
+
 private:
     /**
      * \brief   WatchdogManager::WATCHDOG_THREAD_NAME
@@ -67,12 +98,12 @@ public:
     static bool startWatchdogManager( void );
 
     /**
-     * \brief   Stops Watchdog Manager and the Thread. Cancels and stops all timers.
+     * \brief   Stops Watchdog Manager and the Thread.
      *          If 'waitComplete' is set to true, the calling thread is
-     *          blocked until Watchdog Manager completes jobs and cleans resources.
-     *          Otherwise, this triggers stop and exit events, and immediately returns.
-     * \param   waitComplete    If true, waits for Watchdog Manager to complete the jobs
-     *                          and exit threads. Otherwise, it triggers exit and returns.
+     *          blocked until Watchdog Manager thread exits.
+     *          Otherwise, this triggers exit and immediately returns.
+     * \param   waitComplete    If true, waits for Watchdog Manager thread to exit.
+     *                          Otherwise, it triggers exit and returns.
      **/
     static void stopWatchdogManager( bool waitComplete);
 
@@ -89,19 +120,17 @@ public:
     static bool isWatchdogManagerStarted( void );
 
     /**
-     * \brief   Starts the watchdog timer. If succeeds, returns true.
-     *          When timer event is fired, it will be dispatched in the
-     *          thread where it was started, i.e. in the current thread.
-     * \param   watchdog    The watchdog object that should be started.
-     * \return  Returns true if timer was successfully created.
+     * \brief   Registers the watchdog to check the stamps. The watchdogs with
+     *          ignored timeout are not registered.
+     * \param   watchdog    The watchdog object to register.
      **/
-    static bool startTimer(Watchdog& watchdog);
+    static void registerWatchdog(Watchdog& watchdog);
 
     /**
-     * \brief   Stops the watchdog timer. Returns true if timer successfully was stopped.
-     * \param   watchdog    The watchdog object that should be stopped.
+     * \brief   Unregisters the watchdog. Called when the watchdog is destroyed.
+     * \param   watchdog    The watchdog object to unregister.
      **/
-    static void stopTimer(Watchdog& watchdog);
+    static void unregisterWatchdog(Watchdog& watchdog);
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -121,97 +150,49 @@ private:
 //////////////////////////////////////////////////////////////////////////
 protected:
 /************************************************************************/
-// IETimerManagingEventConsumer overrides
+// IEThreadConsumer overrides
 /************************************************************************/
 
     /**
-     * \brief   Automatically triggered when event is dispatched by timer thread
-     * \param   data    The data object passed in event.
+     * \brief   Checks the stamps of the watchdogs until the thread is requested to exit.
      **/
-    virtual void processEvent( const TimerManagerEventData & data) override;
-
-/************************************************************************/
-// DispatcherThread overrides
-/************************************************************************/
-
-    /**
-     * \brief   Call to enable or disable event dispatching threads to receive events.
-     *          Override if need to make event dispatching preparation job.
-     * \param   isReady     The flag to indicate whether the dispatcher is ready for events.
-     **/
-    virtual void readyForEvents( bool isReady ) override;
+    virtual void onThreadRuns( void ) override;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden operations. Called from Watchdog Thread.
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Called when expired timers should be processed.
-     **/
-    void _processExpiredTimer(Watchdog* watchdog, Watchdog::WATCHDOG_ID watchdogId, uint32_t hiBytes, uint32_t loBytes);
-
-    /**
-     * \brief   Stops and removes all watchdog timers.
-     **/
-    void _removeAllWatchdogs( void );
-
-    /**
-     * \brief   Creates system timer for watchdog and registers it in the resource map.
-     * \param   watchdog       The Watchdog object that should be registered.
+     * \brief   Checks the stamps of all watchdogs and requests to restart the threads
+     *          of expired watchdogs. Returns the period in milliseconds of the next check.
      **/
-    inline void _registerWatchdog( Watchdog & watchdog);
+    uint32_t _checkWatchdogs( void );
 
     /**
-     * \brief   Stop watchdog timer and unregister from the resource map.
-     * \param   watchdog   The instance of watchdog object to unregister.
+     * \brief   Returns reference to Watchdog Manager object.
      **/
-    inline void _unregisterWatchdog( Watchdog & watchdog );
+    inline WatchdogManager & self( void );
 
 //////////////////////////////////////////////////////////////////////////
-//  OS specific hidden methods
+//  Member variables.
 //////////////////////////////////////////////////////////////////////////
 private:
-
-#ifdef _WINDOWS
-
     /**
-     * \brief   Windows OS specific timer routine function. Triggered, when one of timer is expired.
-     * \param   argPtr          The pointer of argument passed to timer expired callback function
-     * \param   timerLowValue   The low value of timer expiration
-     * \param   timerHighValue  The high value of timer expiration.
+     * \brief   The thread to check the watchdogs.
      **/
-    static void _windowsWatchdogExpiredRoutine( void * argPtr, unsigned long timerLowValue, unsigned long timerHighValue );
-
-#endif // _WINDOWS
-
-#ifdef _POSIX
+    Thread              mThread;
 
     /**
-     * \brief   POSIX timer routine function. Triggered, when one of timer is expired.
-     * \param   argSig          The value passed to thread signal when the timer was created.
-     *                          This value is passed to routine callback.
+     * \brief   The event to wake up the thread when the watchdog is registered or
+     *          the thread should exit.
      **/
-    static void _posixWatchdogExpiredRoutine( union sigval argSig );
-
-#endif // _POSIX
+    SynchEvent          mEventCheck;
 
     /**
-     * \brief   Starts system Watchdog and returns true if Watchdog started with success.
-     * \param   watchdog    The Watchdog  object with timer information.
-     * \return  Returns true if system Watchdog started with success.
+     * \brief   The flag, indicating that the thread should exit.
      **/
-    static bool _osSystemTimerStart( Watchdog & watchdog );
+    std::atomic_bool    mExit;
 
-    /**
-     * \brief   Stops previously started waitable timer.
-     * \param   handle      The waitable timer handle to destroy.
-     **/
-    static void _osSystemTimerStop(TIMERHANDLE handle);
-
-//////////////////////////////////////////////////////////////////////////
-//  Member variables.
-//////////////////////////////////////////////////////////////////////////
-private:
     /**
      * \brief   The Watchdog table object.
      **/
@@ -225,4 +206,13 @@ private:
 
 };
 
+//////////////////////////////////////////////////////////////////////////
+// WatchdogManager class inline functions implementation
+//////////////////////////////////////////////////////////////////////////
+
+inline WatchdogManager & WatchdogManager::self( void )
+{
+    return (*this);
+}
+
 #endif  // AREG_COMPONENT_PRIVATE_WATCHDOGMANAGER_HPP
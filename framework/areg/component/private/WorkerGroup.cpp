@@ -0,0 +1,372 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/WorkerGroup.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Worker Group class.
+ *              The threads of the component running the data processing tasks.
+ *
+ ************************************************************************/
+#include "areg/component/WorkerGroup.hpp"
+
+#include "areg/base/IEPoolTask.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/IEWorkerGroupConsumer.hpp"
+#include "areg/component/private/WorkerGroupEvent.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    //! The groups with the ID to dispatch the results of the completed jobs.
+    TEMap<uint32_t, WorkerGroup *> & _listGroups( void )
+    {
+        static TEMap<uint32_t, WorkerGroup *> _groups;
+        return _groups;
+    }
+
+    //! The lock of the list of the groups.
+    ResourceLock & _groupsLock( void )
+    {
+        static ResourceLock _lock;
+        return _lock;
+    }
+
+    //! Returns the next unique ID of the group.
+    uint32_t _nextGroupId( void )
+    {
+        static std::atomic_uint32_t _groupId{ 0u };
+        return (_groupId.fetch_add( 1u ) + 1u);
+    }
+
+    //! The number of chunks per thread, when the grain size is not set.
+    constexpr uint32_t  CHUNKS_PER_THREAD   { 4u };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup::GroupTask class declaration
+//////////////////////////////////////////////////////////////////////////
+class WorkerGroup::GroupTask  : public IEPoolTask
+{
+public:
+    GroupTask( void )
+        : IEPoolTask( )
+        , gtJob     ( nullptr )
+        , gtFirst   ( 0u )
+        , gtLast    ( 0u )
+    {
+    }
+
+    virtual ~GroupTask( void ) = default;
+
+    //! Runs the task or the chunk of the range and notifies the group.
+    virtual void runTask( void ) override;
+
+    GroupJob *  gtJob;      //!< The job of the task.
+    uint32_t    gtFirst;    //!< The first index of the chunk.
+    uint32_t    gtLast;     //!< The index after the last index of the chunk.
+};
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup::GroupJob class declaration
+//////////////////////////////////////////////////////////////////////////
+class WorkerGroup::GroupJob
+{
+public:
+    //! Creates the job of the single task.
+    GroupJob( WorkerGroup & group, uint32_t jobId, TaskFunction && task )
+        : gjGroup       ( group )
+        , gjJobId       ( jobId )
+        , gjTask        ( std::move(task) )
+        , gjRange       ( )
+        , gjBody        ( nullptr )
+        , gjTasks       ( 1u )
+        , gjSubmitted   ( DispatcherStatistics::getTimestamp() )
+        , gjRemaining   ( 1u )
+        , gjRunTime     ( 0u )
+        , gjWaiter      ( )
+    {
+        gjTasks[0].gtJob = this;
+    }
+
+    //! Creates the job of the range split in chunks. If the body is not set, the job owns the range function.
+    GroupJob( WorkerGroup & group, uint32_t jobId, uint32_t begin, uint32_t end, uint32_t chunkSize, RangeFunction && range, const RangeFunction * body, const std::shared_ptr<SynchEvent> & waiter )
+        : gjGroup       ( group )
+        , gjJobId       ( jobId )
+        , gjTask        ( )
+        , gjRange       ( std::move(range) )
+        , gjBody        ( body != nullptr ? body : &gjRange )
+        , gjTasks       ( (end - begin + chunkSize - 1u) / chunkSize )
+        , gjSubmitted   ( DispatcherStatistics::getTimestamp() )
+        , gjRemaining   ( static_cast<uint32_t>(gjTasks.size()) )
+        , gjRunTime     ( 0u )
+        , gjWaiter      ( waiter )
+    {
+        uint32_t first{ begin };
+        for (GroupTask & task : gjTasks)
+        {
+            task.gtJob  = this;
+            task.gtFirst= first;
+            task.gtLast = (end - first > chunkSize ? first + chunkSize : end);
+            first       = task.gtLast;
+        }
+    }
+
+    WorkerGroup &           gjGroup;        //!< The group, which runs the job.
+    const uint32_t          gjJobId;        //!< The ID of the job.
+    TaskFunction            gjTask;         //!< The single task to run.
+    RangeFunction           gjRange;        //!< The range function owned by the job.
+    const RangeFunction *   gjBody;         //!< The function to process the chunks of the range.
+    std::vector<GroupTask>  gjTasks;        //!< The tasks of the job.
+    const uint64_t          gjSubmitted;    //!< The timestamp when the job is submitted.
+    std::atomic_uint32_t    gjRemaining;    //!< The number of tasks, which are not completed.
+    std::atomic_uint64_t    gjRunTime;      //!< The sum of the time to run the tasks.
+    std::shared_ptr<SynchEvent> gjWaiter;   //!< The event signaled when the job is completed, or empty.
+
+private:
+    GroupJob( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( GroupJob );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup::GroupTask class implementation
+//////////////////////////////////////////////////////////////////////////
+void WorkerGroup::GroupTask::runTask( void )
+{
+    GroupJob & job{ *gtJob };
+    const uint64_t started{ DispatcherStatistics::getTimestamp() };
+    if (job.gjBody != nullptr)
+    {
+        (*job.gjBody)( gtFirst, gtLast );
+    }
+    else if (job.gjTask)
+    {
+        job.gjTask( );
+    }
+
+    // the job and this task can be deleted when the group is notified.
+    job.gjGroup._taskCompleted( job, started, DispatcherStatistics::getTimestamp() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// WorkerGroup class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void WorkerGroup::_dispatchResult( uint32_t groupId, const WorkerGroup::sJobResult & result )
+{
+    WorkerGroup * group{ nullptr };
+    do
+    {
+        Lock lock( _groupsLock() );
+        _listGroups().find( groupId, group );
+    } while (false);
+
+    // The group is created and deleted in the component thread, which dispatches the results.
+    if (group != nullptr)
+    {
+        group->mConsumer.onWorkerJobCompleted( *group, result );
+    }
+}
+
+WorkerGroup::WorkerGroup( const String & groupName, IEWorkerGroupConsumer & consumer, ComponentThread & ownerThread, uint32_t threadCount )
+    : IEEventConsumer   ( )
+    , mGroupId          ( _nextGroupId() )
+    , mThreadCount      ( threadCount )
+    , mConsumer         ( consumer )
+    , mOwnerThread      ( ownerThread )
+    , mPool             ( groupName )
+    , mJobs             ( )
+    , mJobsCompleted    ( 0u )
+    , mWaitTime         ( )
+    , mRunTime          ( )
+    , mTimeLock         ( )
+    , mLock             ( )
+{
+    Lock lock( _groupsLock() );
+    _listGroups().setAt( mGroupId, this );
+}
+
+WorkerGroup::~WorkerGroup( void )
+{
+    do
+    {
+        Lock lock( _groupsLock() );
+        _listGroups().removeAt( mGroupId );
+    } while (false);
+
+    stopGroup( );
+}
+
+bool WorkerGroup::startGroup( void )
+{
+    return mPool.startPool( mThreadCount );
+}
+
+void WorkerGroup::stopGroup( void )
+{
+    mPool.stopPool( );
+
+    // the threads are stopped, the tasks of the remaining jobs never run.
+    Lock lock( mLock );
+    while (mJobs.isEmpty() == false)
+    {
+        delete mJobs.popFirst( );
+    }
+}
+
+bool WorkerGroup::postTask( uint32_t jobId, TaskFunction && task )
+{
+    if (mPool.isPoolStarted() == false)
+        return false;
+
+    GroupJob * job{ DEBUG_NEW GroupJob( self(), jobId, std::move(task) ) };
+    _scheduleJob( *job );
+    return true;
+}
+
+bool WorkerGroup::postParallelFor( uint32_t jobId, uint32_t begin, uint32_t end, uint32_t grainSize, RangeFunction && body )
+{
+    if (mPool.isPoolStarted() == false)
+        return false;
+
+    if (begin >= end)
+    {
+        mJobsCompleted.fetch_add( 1u, std::memory_order_relaxed );
+        _sendResult( sJobResult{ jobId, 0u, 0u, 0u } );
+        return true;
+    }
+
+    const uint32_t chunkSize{ _getChunkSize( end - begin, grainSize ) };
+    GroupJob * job{ DEBUG_NEW GroupJob( self(), jobId, begin, end, chunkSize, std::move(body), nullptr, nullptr ) };
+    _scheduleJob( *job );
+    return true;
+}
+
+bool WorkerGroup::parallelFor( uint32_t begin, uint32_t end, uint32_t grainSize, const RangeFunction & body )
+{
+    if (mPool.isPoolStarted() == false)
+    {
+        return false;
+    }
+    else if (begin >= end)
+    {
+        return true;
+    }
+    else if (mPool.isPoolThread())
+    {
+        // waiting in the thread of the group may block the group, process the range here.
+        body( begin, end );
+        return true;
+    }
+
+    const uint32_t chunkSize{ _getChunkSize( end - begin, grainSize ) };
+    // the event is shared with the thread of the last task, which may still signal it when the job is released.
+    std::shared_ptr<SynchEvent> waiter{ std::make_shared<SynchEvent>( true, false ) };
+    GroupJob job( self(), 0u, begin, end, chunkSize, RangeFunction(), &body, waiter );
+    for (GroupTask & task : job.gjTasks)
+    {
+        mPool.scheduleTask( task );
+    }
+
+    waiter->lock( NECommon::WAIT_INFINITE );
+    return true;
+}
+
+WorkerGroup::sGroupStatistics WorkerGroup::getStatistics( void ) const
+{
+    sGroupStatistics result;
+    result.gsThreadCount= getThreadCount( );
+    result.gsJobs       = mJobsCompleted.load( std::memory_order_relaxed );
+    result.gsTasks      = mPool.getTasksRun( );
+    result.gsTasksStolen= mPool.getTasksStolen( );
+    result.gsWaitMedian = mWaitTime.getPercentile( 50.0 );
+    result.gsWaitP99    = mWaitTime.getPercentile( 99.0 );
+    result.gsRunMedian  = mRunTime.getPercentile( 50.0 );
+    result.gsRunP99     = mRunTime.getPercentile( 99.0 );
+    result.gsRunMax     = mRunTime.getMaxValue( );
+    return result;
+}
+
+void WorkerGroup::startEventProcessing( Event & /*eventElem*/ )
+{
+}
+
+uint32_t WorkerGroup::_getChunkSize( uint32_t count, uint32_t grainSize ) const
+{
+    if (grainSize != 0u)
+        return grainSize;
+
+    const uint32_t chunks{ getThreadCount() * CHUNKS_PER_THREAD };
+    return (chunks != 0u ? (count + chunks - 1u) / chunks : count);
+}
+
+void WorkerGroup::_scheduleJob( GroupJob & job )
+{
+    do
+    {
+        Lock lock( mLock );
+        mJobs.pushLast( &job );
+    } while (false);
+
+    // the job can be completed and deleted before the loop ends, do not access the job after the last task.
+    const uint32_t count{ static_cast<uint32_t>(job.gjTasks.size()) };
+    GroupTask * tasks{ job.gjTasks.data() };
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        mPool.scheduleTask( tasks[i] );
+    }
+}
+
+void WorkerGroup::_sendResult( const WorkerGroup::sJobResult & result )
+{
+    WorkerGroupEvent * eventElem{ DEBUG_NEW WorkerGroupEvent( mGroupId, result ) };
+    // the consumer is set only to pass the event to WorkerGroupEvent::dispatchSelf()
+    eventElem->setEventConsumer( static_cast<IEEventConsumer *>(this) );
+    eventElem->registerForThread( &mOwnerThread );
+    eventElem->deliverEvent( );
+}
+
+void WorkerGroup::_taskCompleted( GroupJob & job, uint64_t started, uint64_t completed )
+{
+    const uint64_t waitTime{ started > job.gjSubmitted ? started - job.gjSubmitted : 0u };
+    const uint64_t runTime{ completed > started ? completed - started : 0u };
+    do
+    {
+        Lock lock( mTimeLock );
+        mWaitTime.recordValue( waitTime );
+        mRunTime.recordValue( runTime );
+    } while (false);
+
+    job.gjRunTime.fetch_add( runTime, std::memory_order_relaxed );
+    if (job.gjRemaining.fetch_sub( 1u, std::memory_order_acq_rel ) != 1u)
+        return;
+
+    mJobsCompleted.fetch_add( 1u, std::memory_order_relaxed );
+    if (job.gjWaiter)
+    {
+        // the waiting caller owns the job and releases it when the event is signaled, the job is not accessed anymore.
+        const std::shared_ptr<SynchEvent> waiter{ job.gjWaiter };
+        waiter->setEvent( );
+    }
+    else
+    {
+        _sendResult( sJobResult{ job.gjJobId
+                               , static_cast<uint32_t>(job.gjTasks.size())
+                               , completed > job.gjSubmitted ? completed - job.gjSubmitted : 0u
+                               , job.gjRunTime.load( std::memory_order_relaxed ) } );
+
+        Lock lock( mLock );
+        mJobs.removeEntry( &job );
+        delete (&job);
+    }
+}
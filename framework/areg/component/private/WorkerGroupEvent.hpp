@@ -0,0 +1,89 @@
+#ifndef AREG_COMPONENT_PRIVATE_WORKERGROUPEVENT_HPP
+#define AREG_COMPONENT_PRIVATE_WORKERGROUPEVENT_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/WorkerGroupEvent.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Worker Group job completion event class declaration.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/component/Event.hpp"
+#include "areg/component/WorkerGroup.hpp"
+
+/**
+ * \brief   An event sent by the thread of the Worker Group to the component
+ *          thread, which owns the group, when all tasks of the job are completed.
+ *          The event is dispatched to the group with the ID, if it still exists.
+ **/
+class WorkerGroupEvent  : public    Event
+{
+//////////////////////////////////////////////////////////////////////////
+// Declare Runtime Event
+//////////////////////////////////////////////////////////////////////////
+    DECLARE_RUNTIME_EVENT(WorkerGroupEvent)   //!< Runtime data to identify event.
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Constructor. Creates event to notify the group about the completed job.
+     * \param   groupId     The ID of the Worker Group, which completed the job.
+     * \param   result      The result of the completed job.
+     **/
+    WorkerGroupEvent( uint32_t groupId, const WorkerGroup::sJobResult & result );
+
+    /**
+     * \brief   Destructor.
+     **/
+    virtual ~WorkerGroupEvent( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// Event overrides
+/************************************************************************/
+
+    /**
+     * \brief   Notifies the Worker Group with the ID about the completed job.
+     *          The consumer is not used, the group may be already deleted.
+     **/
+    virtual void dispatchSelf( IEEventConsumer * /*consumer*/ ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The ID of the Worker Group.
+     **/
+    const uint32_t                  mGroupId;
+
+    /**
+     * \brief   The result of the completed job.
+     **/
+    const WorkerGroup::sJobResult   mResult;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    WorkerGroupEvent( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( WorkerGroupEvent );
+};
+
+#endif  // AREG_COMPONENT_PRIVATE_WORKERGROUPEVENT_HPP
@@ -91,7 +91,7 @@ void WorkerThread::terminateSelf(void)
 {
     mHasStarted = false;
     removeAllEvents();
-    mEventExit.setEvent();
+    signalExit( );
     Thread::shutdownThread(NECommon::TIMEOUT_10_MS);
 
     delete this;
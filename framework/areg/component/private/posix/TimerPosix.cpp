@@ -21,7 +21,6 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/component/TimerBase.hpp"
-#include "areg/component/private/Watchdog.hpp"
 
 #include "areg/base/Thread.hpp"
 #include "areg/base/private/posix/NESynchTypesIX.hpp"
@@ -114,6 +114,18 @@ public:
      **/
     void setConnectionData(const String& address, unsigned short portNr);
 
+    /**
+     * \brief   Returns the maximum number of messages queued to send to the remote service.
+     *          The value 0 means that the number of queued messages is not limited.
+     **/
+    uint32_t getSendWindowMessages( void ) const;
+
+    /**
+     * \brief   Returns the maximum size in bytes of messages queued to send to the remote service.
+     *          The value 0 means that the size of queued messages is not limited.
+     **/
+    uint32_t getSendWindowBytes( void ) const;
+
     /**
      * \brief   Returns byte sets of connection host IP address of given connection section.
      **/
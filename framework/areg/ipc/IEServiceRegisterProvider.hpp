@@ -19,6 +19,7 @@
   * Include files.
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/component/NEService.hpp"
 
 class StubAddress;
@@ -89,6 +90,16 @@ public:
      **/
     virtual void unregisterServiceConsumer(const ProxyAddress& proxyService, const NEService::eDisconnectReason reason) = 0;
 
+    /**
+     * \brief   Call to register the lists of service providers and service consumers at once.
+     *          It is called when the connection is established to register all public services,
+     *          and has the same effect as registering each service provider and service consumer.
+     * \param   listStubs   The addresses of service providers to register in the system.
+     * \param   listProxies The addresses of service consumers to register in the system.
+     * \return  Returns true if registration process started with success. Otherwise, it returns false.
+     **/
+    virtual bool registerServices(const TEArrayList<StubAddress>& listStubs, const TEArrayList<ProxyAddress>& listProxies) = 0;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/base/NESocket.hpp"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/persist/NEPersistence.hpp"
 
@@ -75,6 +76,18 @@ namespace NERemoteService
         , RemoteConnected       = 1 //!< Remote instance is connected.
     };
 
+    /**
+     * \brief   NERemoteService::eServiceFeatures
+     *          The optional features, which the remote service confirms in the
+     *          connection notification. The features are the last field of the
+     *          notification, a service that does not send it supports none of them.
+     **/
+    enum eServiceFeatures : uint32_t
+    {
+          FeatureNone               = 0x00  //!< No optional feature is supported.
+        , FeatureRegisterServices   = 0x01  //!< Supports NEService::eServiceRequestType::RegisterServices to register services in one message.
+    };
+
     /**
      * \brief   NERemoteService::DEFAULT_REMOTE_SERVICE_ENABLED
      *          Message router enable / disable default flag. If true, by default it is enabled.
@@ -201,6 +214,19 @@ namespace NERemoteService
      **/
     AREG_API RemoteMessage createRouterUnregisterClient( const ProxyAddress & proxy, NEService::eDisconnectReason reason, const ITEM_ID & source, const ITEM_ID & target);
 
+    /**
+     * \brief   NERemoteService::createRouterRegisterServices
+     *          Initializes and returns message to register the list of Stubs and Proxies at the router.
+     *          The message is sent when the connection is established to register all public services
+     *          of the process in one message. The router registers Stubs first, then Proxies.
+     * \param   listStubs   The addresses of remote Stub services, which are registering.
+     * \param   listProxies The addresses of remote Proxies, which are registering.
+     * \param   source      The ID of the source that sends the request message to register services.
+     * \param   target      The ID of the target to send the request message to register services.
+     * \see     createRouterRegisterService, createRouterRegisterClient
+     **/
+    AREG_API RemoteMessage createRouterRegisterServices( const TEArrayList<StubAddress> & listStubs, const TEArrayList<ProxyAddress> & listProxies, const ITEM_ID & source, const ITEM_ID & target );
+
     /**
      * \brief   NERemoteService::createServiceRegisteredNotification
      *          Initializes and returns Stub available notification message to broadcast.
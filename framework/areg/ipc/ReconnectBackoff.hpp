@@ -0,0 +1,151 @@
+#ifndef AREG_IPC_RECONNECTBACKOFF_HPP
+#define AREG_IPC_RECONNECTBACKOFF_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/ReconnectBackoff.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The jittered exponential timeout to retry
+ *              the connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include <random>
+
+//////////////////////////////////////////////////////////////////////////
+// ReconnectBackoff class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Calculates the timeouts to retry the failed connection. Every
+ *          failed attempt doubles the retry window starting from the minimum
+ *          timeout up to the maximum timeout, and the timeout is randomly
+ *          chosen in the upper half of the window. When the remote service
+ *          restarts, the clients, which lost the connection at the same time,
+ *          spread their attempts instead of reconnecting in lockstep.
+ *          The object is reset when the connection is established.
+ *          The object is not thread safe, it is used by the thread,
+ *          which starts the connection.
+ **/
+class AREG_API ReconnectBackoff
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the timeouts.
+     * \param   minTimeout  The window of the first retry in milliseconds.
+     * \param   maxTimeout  The maximum window of the retry in milliseconds.
+     **/
+    ReconnectBackoff( unsigned int minTimeout, unsigned int maxTimeout );
+
+    ~ReconnectBackoff( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the window of the retry after the specified number of failed attempts.
+     *          The window is doubled for each attempt and does not exceed the maximum timeout.
+     * \param   minTimeout  The window of the first retry in milliseconds.
+     * \param   maxTimeout  The maximum window of the retry in milliseconds.
+     * \param   attempts    The number of failed attempts before the retry.
+     **/
+    static unsigned int getTimeoutWindow( unsigned int minTimeout, unsigned int maxTimeout, uint32_t attempts );
+
+    /**
+     * \brief   Returns the timeout in milliseconds to wait before the next attempt
+     *          and increases the number of attempts. The timeout is not less than
+     *          the half of the retry window.
+     **/
+    unsigned int nextTimeout( void );
+
+    /**
+     * \brief   Resets the number of attempts. Called when the connection is established.
+     **/
+    inline void reset( void );
+
+    /**
+     * \brief   Returns the number of attempts since the last reset.
+     **/
+    inline uint32_t getAttempts( void ) const;
+
+    /**
+     * \brief   Returns the window of the first retry in milliseconds.
+     **/
+    inline unsigned int getMinTimeout( void ) const;
+
+    /**
+     * \brief   Returns the maximum window of the retry in milliseconds.
+     **/
+    inline unsigned int getMaxTimeout( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The window of the first retry in milliseconds.
+    const unsigned int  mMinTimeout;
+
+    //!< The maximum window of the retry in milliseconds.
+    const unsigned int  mMaxTimeout;
+
+    //!< The number of attempts since the last reset.
+    uint32_t            mAttempts;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The generator of jitter, seeded differently in each process.
+    std::minstd_rand    mRandom;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    ReconnectBackoff( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( ReconnectBackoff );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ReconnectBackoff class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline void ReconnectBackoff::reset( void )
+{
+    mAttempts = 0u;
+}
+
+inline uint32_t ReconnectBackoff::getAttempts( void ) const
+{
+    return mAttempts;
+}
+
+inline unsigned int ReconnectBackoff::getMinTimeout( void ) const
+{
+    return mMinTimeout;
+}
+
+inline unsigned int ReconnectBackoff::getMaxTimeout( void ) const
+{
+    return mMaxTimeout;
+}
+
+#endif  // AREG_IPC_RECONNECTBACKOFF_HPP
@@ -0,0 +1,210 @@
+#ifndef AREG_IPC_REMOTESERVICEINDEX_HPP
+#define AREG_IPC_REMOTESERVICEINDEX_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/RemoteServiceIndex.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The index of remote service addresses
+ *              registered by connection cookie.
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteServiceIndex class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The secondary index of the remote stub and proxy addresses grouped
+ *          by the cookie of connection. The registries of services keep
+ *          the index next to the main list of services, so that the services
+ *          of the lost connection are found without iterating all registered
+ *          services and all their proxies. All operations take the time
+ *          proportional to the number of affected addresses.
+ *          The index does not check the state of services, the owner adds
+ *          the address when the service is registered and removes it when
+ *          the service is unregistered.
+ **/
+class AREG_API RemoteServiceIndex
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The set of stub addresses, the value is not used.
+    using StubSet   = TEHashMap<StubAddress, bool>;
+
+    //!< The set of proxy addresses, the value is not used.
+    using ProxySet  = TEHashMap<ProxyAddress, bool>;
+
+    /**
+     * \brief   RemoteServiceIndex::sCookieServices
+     *          The stub and proxy addresses of one connection cookie.
+     **/
+    struct sCookieServices
+    {
+        StubSet     csStubs;    //!< The addresses of stubs.
+        ProxySet    csProxies;  //!< The addresses of proxies.
+    };
+
+    //!< The map of connection cookie and the services of the connection.
+    using CookieMap = TEHashMap<ITEM_ID, sCookieServices>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    RemoteServiceIndex( void );
+
+    ~RemoteServiceIndex( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the index has no address.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Returns the number of connection cookies in the index.
+     **/
+    inline uint32_t getCookieCount( void ) const;
+
+    /**
+     * \brief   Returns the number of indexed stub addresses.
+     **/
+    inline uint32_t getStubCount( void ) const;
+
+    /**
+     * \brief   Returns the number of indexed proxy addresses.
+     **/
+    inline uint32_t getProxyCount( void ) const;
+
+    /**
+     * \brief   Adds the stub address to the services of the cookie.
+     * \param   cookie      The cookie of connection, which registered the stub.
+     * \param   addrStub    The address of the stub to add.
+     * \return  Returns true if the address was not indexed yet.
+     **/
+    bool addStub( const ITEM_ID & cookie, const StubAddress & addrStub );
+
+    /**
+     * \brief   Removes the stub address from the services of the cookie.
+     * \param   cookie      The cookie of connection, which registered the stub.
+     * \param   addrStub    The address of the stub to remove.
+     * \return  Returns true if the address was indexed and removed.
+     **/
+    bool removeStub( const ITEM_ID & cookie, const StubAddress & addrStub );
+
+    /**
+     * \brief   Adds the proxy address to the services of the cookie.
+     * \param   cookie      The cookie of connection, which registered the proxy.
+     * \param   addrProxy   The address of the proxy to add.
+     * \return  Returns true if the address was not indexed yet.
+     **/
+    bool addProxy( const ITEM_ID & cookie, const ProxyAddress & addrProxy );
+
+    /**
+     * \brief   Removes the proxy address from the services of the cookie.
+     * \param   cookie      The cookie of connection, which registered the proxy.
+     * \param   addrProxy   The address of the proxy to remove.
+     * \return  Returns true if the address was indexed and removed.
+     **/
+    bool removeProxy( const ITEM_ID & cookie, const ProxyAddress & addrProxy );
+
+    /**
+     * \brief   Adds the stub and proxy addresses of the cookie to the lists.
+     * \param[in]   cookie          The cookie of connection. Pass NEService::COOKIE_ANY to get all addresses.
+     * \param[out]  out_listStubs   On output, contains the addresses of stubs of the cookie.
+     * \param[out]  out_listProxies On output, contains the addresses of proxies of the cookie.
+     **/
+    void getServices( const ITEM_ID & cookie, TEArrayList<StubAddress> & OUT out_listStubs, TEArrayList<ProxyAddress> & OUT out_listProxies ) const;
+
+    /**
+     * \brief   Removes all addresses of the cookie.
+     **/
+    void removeCookie( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Removes all addresses.
+     **/
+    void clear( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Adds the addresses of the services to the lists.
+     **/
+    static void _getServices( const sCookieServices & services, TEArrayList<StubAddress> & OUT out_listStubs, TEArrayList<ProxyAddress> & OUT out_listProxies );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The services grouped by connection cookie.
+    CookieMap   mCookies;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    //!< The number of indexed stub addresses.
+    uint32_t    mStubCount;
+
+    //!< The number of indexed proxy addresses.
+    uint32_t    mProxyCount;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( RemoteServiceIndex );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteServiceIndex class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool RemoteServiceIndex::isEmpty( void ) const
+{
+    return mCookies.isEmpty();
+}
+
+inline uint32_t RemoteServiceIndex::getCookieCount( void ) const
+{
+    return mCookies.getSize();
+}
+
+inline uint32_t RemoteServiceIndex::getStubCount( void ) const
+{
+    return mStubCount;
+}
+
+inline uint32_t RemoteServiceIndex::getProxyCount( void ) const
+{
+    return mProxyCount;
+}
+
+#endif  // AREG_IPC_REMOTESERVICEINDEX_HPP
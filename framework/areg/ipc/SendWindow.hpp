@@ -0,0 +1,214 @@
+#ifndef AREG_IPC_SENDWINDOW_HPP
+#define AREG_IPC_SENDWINDOW_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/SendWindow.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The credit based window of messages queued
+ *              to send via connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SynchObjects.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// SendWindow class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The credit based flow control of the connection. Each message
+ *          queued to send takes one message credit and the credits of its
+ *          size in bytes, which are returned when the message is written to
+ *          the socket. When the window is exhausted, the message is rejected
+ *          and the sender should defer it, or the sender waits in
+ *          waitForCredits() until the queued messages are sent, so that
+ *          a fast producer cannot grow the send queue without bound on a slow link.
+ *          The messages, which must not be rejected, like connection and
+ *          service registration messages, are forced into the queue. They take
+ *          credits as well, so that the queue depth is always accounted.
+ *          The window value UNLIMITED disables the limit.
+ **/
+class AREG_API SendWindow
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SendWindow::UNLIMITED
+     *          The window value, which disables the limit.
+     **/
+    static constexpr uint32_t   UNLIMITED   { 0 };
+
+    /**
+     * \brief   SendWindow::sWindowStatistics
+     *          The queue depth and the statistics of the window.
+     **/
+    struct sWindowStatistics
+    {
+        uint32_t    wsQueuedMessages;   //!< The number of messages queued and not sent yet.
+        uint32_t    wsQueuedBytes;      //!< The size in bytes of messages queued and not sent yet.
+        uint32_t    wsPeakMessages;     //!< The maximum number of queued messages.
+        uint32_t    wsPeakBytes;        //!< The maximum size in bytes of queued messages.
+        uint64_t    wsSentMessages;     //!< The number of messages, which were sent and returned the credits.
+        uint64_t    wsRejectedMessages; //!< The number of messages rejected, because the window was exhausted.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the window.
+     * \param   maxMessages The maximum number of queued messages or UNLIMITED.
+     * \param   maxBytes    The maximum size in bytes of queued messages or UNLIMITED.
+     **/
+    SendWindow( uint32_t maxMessages = UNLIMITED, uint32_t maxBytes = UNLIMITED );
+
+    ~SendWindow( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Sets the window. The queued messages are not affected.
+     * \param   maxMessages The maximum number of queued messages or UNLIMITED.
+     * \param   maxBytes    The maximum size in bytes of queued messages or UNLIMITED.
+     **/
+    void setWindow( uint32_t maxMessages, uint32_t maxBytes );
+
+    /**
+     * \brief   Returns the maximum number of queued messages.
+     **/
+    inline uint32_t getMaxMessages( void ) const;
+
+    /**
+     * \brief   Returns the maximum size in bytes of queued messages.
+     **/
+    inline uint32_t getMaxBytes( void ) const;
+
+    /**
+     * \brief   Returns true if the message of given size can be queued,
+     *          i.e. the call of acquire() would not reject the message.
+     * \param   bytes   The size of the message in bytes.
+     **/
+    bool canAcquire( uint32_t bytes ) const;
+
+    /**
+     * \brief   Takes the credits to queue the message of given size.
+     *          The message, which is bigger than the byte window,
+     *          is accepted only if the queue is empty.
+     * \param   bytes   The size of the message in bytes.
+     * \param   force   If true, the credits are taken even if the window is exhausted.
+     * \return  Returns true if the credits are taken and the message can be queued.
+     *          Otherwise, the message is counted as rejected.
+     **/
+    bool acquire( uint32_t bytes, bool force );
+
+    /**
+     * \brief   Returns the credits of the message, which is sent or dropped.
+     * \param   bytes   The size of the message in bytes passed in acquire().
+     * \param   sent    Flag, indicating whether the message was sent.
+     *                  Only the sent messages are counted in the statistics.
+     **/
+    void release( uint32_t bytes, bool sent );
+
+    /**
+     * \brief   Returns all credits. Called when the queue of messages is cleared.
+     **/
+    void reset( void );
+
+    /**
+     * \brief   Blocks the calling thread until the window is not exhausted or
+     *          the timeout expires. Returns immediately if the window has credits.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     * \return  Returns true if the window has credits. Returns false if the timeout expired.
+     **/
+    inline bool waitForCredits( unsigned int msTimeout = NECommon::WAIT_INFINITE );
+
+    /**
+     * \brief   Returns the queue depth and the statistics of the window.
+     **/
+    SendWindow::sWindowStatistics getStatistics( void ) const;
+
+    /**
+     * \brief   Resets the peak values and the counters of sent and rejected messages.
+     **/
+    void resetStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if the window has credits for the message of given size.
+     *          The lock must be already taken.
+     **/
+    inline bool _hasCredits( uint32_t bytes ) const;
+
+    /**
+     * \brief   Signals or resets the event of credits when the window is opened or exhausted.
+     *          The lock must be already taken.
+     **/
+    inline void _updateCredits( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The maximum number of queued messages.
+    uint32_t                        mMaxMessages;
+
+    //!< The maximum size in bytes of queued messages.
+    uint32_t                        mMaxBytes;
+
+    //!< The queue depth and the statistics.
+    SendWindow::sWindowStatistics   mStatistics;
+
+    //!< The lock to access the counters.
+    mutable SpinLock                mLock;
+
+    //!< The manual reset event, which is signaled while the window has credits.
+    SynchEvent                      mEventCredits;
+
+    //!< Flag, indicating whether the window had credits when the event was last updated.
+    bool                            mHasCredits;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SendWindow );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SendWindow class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline uint32_t SendWindow::getMaxMessages( void ) const
+{
+    return mMaxMessages;
+}
+
+inline uint32_t SendWindow::getMaxBytes( void ) const
+{
+    return mMaxBytes;
+}
+
+inline bool SendWindow::waitForCredits( unsigned int msTimeout /*= NECommon::WAIT_INFINITE*/ )
+{
+    return mEventCredits.lock(msTimeout);
+}
+
+#endif  // AREG_IPC_SENDWINDOW_HPP
@@ -23,6 +23,7 @@
 #include "areg/ipc/ServiceEventConsumerBase.hpp"
 
 #include "areg/ipc/ClientConnection.hpp"
+#include "areg/ipc/ReconnectBackoff.hpp"
 #include "areg/ipc/private/ClientReceiveThread.hpp"
 #include "areg/ipc/private/ClientSendThread.hpp"
 #include "areg/component/Channel.hpp"
@@ -130,6 +131,33 @@ public:
      **/
     inline bool isCalculateDataRateEnabled(void) const;
 
+    /**
+     * \brief   Returns the depth of the queue of messages to send and the statistics of the send window.
+     **/
+    inline SendWindow::sWindowStatistics querySendQueue( void ) const;
+
+    /**
+     * \brief   Sets the send window of the connection.
+     * \param   maxMessages The maximum number of queued messages. The value 0 means no limit.
+     * \param   maxBytes    The maximum size in bytes of queued messages. The value 0 means no limit.
+     **/
+    inline void setSendWindow( uint32_t maxMessages, uint32_t maxBytes );
+
+    /**
+     * \brief   Returns true if the send window is not exhausted, i.e. the
+     *          next message can be queued without being rejected.
+     **/
+    inline bool isSendWindowOpen( void ) const;
+
+    /**
+     * \brief   Blocks the calling thread until the send window is not exhausted
+     *          or the timeout expires. The window is opened when the queued messages
+     *          are sent or the connection is lost.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     * \return  Returns true if the window is open. Returns false if the timeout expired.
+     **/
+    inline bool waitForSendWindow( unsigned int msTimeout = NECommon::WAIT_INFINITE );
+
     /**
      * \brief   Returns true if the connection status is either connecting or connected.
      **/
@@ -318,6 +346,12 @@ protected:
      **/
     inline bool isConnectionStarted(void) const;
 
+    /**
+     * \brief   Returns true if the connected remote service has confirmed the optional feature.
+     *          The features are received with the connection notification and reset when disconnected.
+     **/
+    inline bool isServiceFeatureSupported( NERemoteService::eServiceFeatures feature ) const;
+
     /**
      * \brief   Call to send an event with the command to process.
      * \param   cmd         The command to send and process.
@@ -326,11 +360,14 @@ protected:
     inline void sendCommand(ServiceEventData::eServiceEventCommands cmd, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
     /**
-     * \brief   Queues the message for sending
+     * \brief   Queues the message for sending. The message takes the credits of the send window
+     *          and is queued even if the window is exhausted. The caller should check
+     *          isSendWindowOpen() before creating the message, which can be deferred,
+     *          or wait in waitForSendWindow() if the message cannot be deferred.
      * \param   data        The data of the message.
      * \param   eventPrio   The priority of the message to set.
      **/
-    inline bool sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
+    bool sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
     /**
      * \brief   Called to start client socket connection. Returns true if connected.
@@ -369,6 +406,12 @@ private:
      **/
     inline ServiceClientConnectionBase & self( void );
 
+    /**
+     * \brief   Starts the timer to retry the connection. The timeout grows with
+     *          every failed attempt and is reset when the connection is established.
+     **/
+    void _startReconnectTimer( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Protected member variables
 //////////////////////////////////////////////////////////////////////////
@@ -417,6 +460,11 @@ protected:
      **/
     eConnectionState                        mConnectionState;
 
+    /**
+     * \brief   The bits of optional features confirmed by the connected remote service.
+     **/
+    uint32_t                                mServiceFeatures;
+
     /**
      * \brief   The Client Service event consumer
      **/
@@ -439,6 +487,10 @@ private:
      * \brief   Connection retry timer object.
      **/
     Timer                                   mTimerConnect;
+    /**
+     * \brief   The jittered exponential timeout to retry the connection.
+     **/
+    ReconnectBackoff                        mReconnectBackoff;
     /**
      * \brief   Message receiver thread
      **/
@@ -499,6 +551,26 @@ inline bool ServiceClientConnectionBase::isCalculateDataRateEnabled(void) const
     return mThreadReceive.isCalculateDataEnabled() && mThreadSend.isCalculateDataEnabled();
 }
 
+inline SendWindow::sWindowStatistics ServiceClientConnectionBase::querySendQueue( void ) const
+{
+    return mThreadSend.getSendWindow().getStatistics();
+}
+
+inline void ServiceClientConnectionBase::setSendWindow( uint32_t maxMessages, uint32_t maxBytes )
+{
+    mThreadSend.getSendWindow().setWindow(maxMessages, maxBytes);
+}
+
+inline bool ServiceClientConnectionBase::isSendWindowOpen( void ) const
+{
+    return mThreadSend.getSendWindow().canAcquire(0);
+}
+
+inline bool ServiceClientConnectionBase::waitForSendWindow( unsigned int msTimeout /*= NECommon::WAIT_INFINITE*/ )
+{
+    return mThreadSend.getSendWindow().waitForCredits(msTimeout);
+}
+
 inline bool ServiceClientConnectionBase::isConnectState( void ) const
 {
     return (static_cast<uint16_t>(mConnectionState) & static_cast<uint16_t>(ServiceClientConnectionBase::eConnectionState::ConnectState)) != 0;
@@ -551,6 +623,12 @@ inline bool ServiceClientConnectionBase::isConnectionStarted(void) const
     return (mClientConnection.isValid() && (cookie != NEService::COOKIE_LOCAL) && (cookie != NEService::COOKIE_UNKNOWN));
 }
 
+inline bool ServiceClientConnectionBase::isServiceFeatureSupported( NERemoteService::eServiceFeatures feature ) const
+{
+    Lock lock( mLock );
+    return ((mServiceFeatures & static_cast<uint32_t>(feature)) != 0);
+}
+
 inline void ServiceClientConnectionBase::setConnectionState(const ServiceClientConnectionBase::eConnectionState newState)
 {
     mConnectionState = newState;
@@ -570,13 +648,6 @@ inline void ServiceClientConnectionBase::sendCommand( ServiceEventData::eService
                                  , eventPrio );
 }
 
-inline bool ServiceClientConnectionBase::sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
-{
-    return SendMessageEvent::sendEvent( SendMessageEventData(data)
-                                      , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                      , static_cast<DispatcherThread &>(mThreadSend)
-                                      , eventPrio);
-}
 
 inline void ServiceClientConnectionBase::disconnectService( Event::eEventPriority eventPrio )
 {
@@ -31,6 +31,7 @@ ClientSendThread::ClientSendThread(IERemoteMessageHandler& remoteService, Client
     , mConnection       ( connection )
     , mBytesSend        ( 0 )
     , mSaveDataSend     ( false )
+    , mSendWindow       ( )
 {
 }
 
@@ -38,6 +39,8 @@ void ClientSendThread::readyForEvents( bool isReady )
 {
     TRACE_SCOPE(areg_ipc_private_ClientSendThread_readyForEvents);
 
+    // The messages left in the queue are not sent, the credits are returned.
+    mSendWindow.reset();
     if ( isReady )
     {
         TRACE_DBG( "Starting client service dispatcher thread [ %s ]", getName( ).getString( ) );
@@ -59,6 +62,7 @@ void ClientSendThread::processEvent( const SendMessageEventData & data )
     {
         const RemoteMessage & msg = data.getRemoteMessage( );
         int sizeSend = mConnection.sendMessage( msg );
+        mSendWindow.release( msg.getSizeUsed(), sizeSend > 0 );
         if ( sizeSend > 0 )
         {
             if (mSaveDataSend)
@@ -21,6 +21,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/ipc/SendMessageEvent.hpp"
+#include "areg/ipc/SendWindow.hpp"
 
 #include <atomic>
 
@@ -79,6 +80,17 @@ public:
      **/
     inline bool isCalculateDataEnabled(void) const;
 
+    /**
+     * \brief   Returns the window of messages queued to send. The credits are
+     *          taken when the message is queued and returned when it is sent.
+     **/
+    inline SendWindow & getSendWindow( void );
+
+    /**
+     * \brief   Returns the window of messages queued to send.
+     **/
+    inline const SendWindow & getSendWindow( void ) const;
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
@@ -142,6 +154,11 @@ private:
      **/
     bool                        mSaveDataSend;
 
+    /**
+     * \brief   The window of messages queued to send.
+     **/
+    SendWindow                  mSendWindow;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -169,4 +186,14 @@ inline bool ClientSendThread::isCalculateDataEnabled(void) const
     return mSaveDataSend;
 }
 
+inline SendWindow & ClientSendThread::getSendWindow( void )
+{
+    return mSendWindow;
+}
+
+inline const SendWindow & ClientSendThread::getSendWindow( void ) const
+{
+    return mSendWindow;
+}
+
 #endif  // AREG_IPC_PRIVATE_CLIENTSENDTHREAD_HPP
@@ -75,6 +75,16 @@ void ConnectionConfiguration::setConnectionPort(unsigned short portNr)
     Application::getConfigManager().setRemoteServicePort(mServiceName, mConnectType, portNr);
 }
 
+uint32_t ConnectionConfiguration::getSendWindowMessages( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceWindowMessages(mServiceName);
+}
+
+uint32_t ConnectionConfiguration::getSendWindowBytes( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceWindowBytes(mServiceName);
+}
+
 bool ConnectionConfiguration::getConnectionIpAddress( unsigned char & OUT field0
                                                     , unsigned char & OUT field1
                                                     , unsigned char & OUT field2
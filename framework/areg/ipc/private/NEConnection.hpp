@@ -77,6 +77,12 @@ namespace NEConnection
      *          Default connect retry timer timeout value in milliseconds
      **/
     constexpr unsigned int      DEFAULT_RETRY_CONNECT_TIMEOUT   { NECommon::TIMEOUT_500_MS };  // 500 ms
+    /**
+     * \brief   NEConnection::MAXIMUM_RETRY_CONNECT_TIMEOUT
+     *          The maximum connect retry timeout in milliseconds. The client doubles the retry
+     *          timeout after every failed attempt starting from DEFAULT_RETRY_CONNECT_TIMEOUT.
+     **/
+    constexpr unsigned int      MAXIMUM_RETRY_CONNECT_TIMEOUT   { NECommon::TIMEOUT_1_SEC * 4 }; // 4 sec
 }
 
 #endif  // AREG_IPC_NECONNECTION_HPP
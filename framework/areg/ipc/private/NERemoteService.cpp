@@ -294,6 +294,55 @@ AREG_API_IMPL RemoteMessage NERemoteService::createRouterRegisterClient( const P
     return msgResult;
 }
 
+AREG_API_IMPL RemoteMessage NERemoteService::createRouterRegisterServices( const TEArrayList<StubAddress> & listStubs, const TEArrayList<ProxyAddress> & listProxies, const ITEM_ID & source, const ITEM_ID & target )
+{
+    RemoteMessage msgResult;
+    if ( _isValidSource(source) && (msgResult.initMessage(NERemoteService::getMessageRegisterService().rbHeader) != nullptr) )
+    {
+        uint32_t countStubs{ 0 };
+        for ( uint32_t i = 0; i < listStubs.getSize(); ++ i )
+        {
+            countStubs += listStubs[i].isServicePublic() ? 1 : 0;
+        }
+
+        uint32_t countProxies{ 0 };
+        for ( uint32_t i = 0; i < listProxies.getSize(); ++ i )
+        {
+            countProxies += listProxies[i].isServicePublic() ? 1 : 0;
+        }
+
+        msgResult.setSequenceNr(NEService::SEQUENCE_NUMBER_NOTIFY);
+        msgResult << NEService::eServiceRequestType::RegisterServices;
+
+        msgResult << countStubs;
+        for ( uint32_t i = 0; i < listStubs.getSize(); ++ i )
+        {
+            if ( listStubs[i].isServicePublic() )
+            {
+                StubAddress temp( listStubs[i] );
+                temp.setCookie(source);
+                msgResult << temp;
+            }
+        }
+
+        msgResult << countProxies;
+        for ( uint32_t i = 0; i < listProxies.getSize(); ++ i )
+        {
+            if ( listProxies[i].isServicePublic() )
+            {
+                ProxyAddress temp( listProxies[i] );
+                temp.setCookie(source);
+                msgResult << temp;
+            }
+        }
+
+        msgResult.setSource(source);
+        msgResult.setTarget(target);
+    }
+
+    return msgResult;
+}
+
 AREG_API_IMPL RemoteMessage NERemoteService::createRouterUnregisterService( const StubAddress & stub, NEService::eDisconnectReason reason, const ITEM_ID & source, const ITEM_ID & target)
 {
     RemoteMessage msgResult;
@@ -0,0 +1,52 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/ReconnectBackoff.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The jittered exponential timeout to retry
+ *              the connection.
+ ************************************************************************/
+#include "areg/ipc/ReconnectBackoff.hpp"
+
+#include <chrono>
+
+ReconnectBackoff::ReconnectBackoff( unsigned int minTimeout, unsigned int maxTimeout )
+    : mMinTimeout   ( MACRO_MAX(minTimeout, 1u) )
+    , mMaxTimeout   ( MACRO_MAX(maxTimeout, MACRO_MAX(minTimeout, 1u)) )
+    , mAttempts     ( 0u )
+    , mRandom       ( )
+{
+    // the processes started at the same time should not get the same sequence.
+    std::random_device device;
+    const uint64_t ticks{ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+    mRandom.seed(static_cast<std::minstd_rand::result_type>(device() ^ ticks ^ (ticks >> 32)));
+}
+
+unsigned int ReconnectBackoff::getTimeoutWindow( unsigned int minTimeout, unsigned int maxTimeout, uint32_t attempts )
+{
+    const uint64_t minimum{ MACRO_MAX(minTimeout, 1u) };
+    const uint64_t maximum{ MACRO_MAX(static_cast<uint64_t>(maxTimeout), minimum) };
+    uint64_t result{ minimum };
+    for ( uint32_t i = 0; (i < attempts) && (result < maximum); ++ i )
+    {
+        result <<= 1;
+    }
+
+    return static_cast<unsigned int>(MACRO_MIN(result, maximum));
+}
+
+unsigned int ReconnectBackoff::nextTimeout( void )
+{
+    const unsigned int window{ ReconnectBackoff::getTimeoutWindow(mMinTimeout, mMaxTimeout, mAttempts) };
+    ++ mAttempts;
+
+    std::uniform_int_distribution<unsigned int> jitter(window - window / 2, window);
+    return jitter(mRandom);
+}
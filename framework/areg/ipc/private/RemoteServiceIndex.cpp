@@ -0,0 +1,134 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/RemoteServiceIndex.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The index of remote service addresses
+ *              registered by connection cookie.
+ ************************************************************************/
+#include "areg/ipc/RemoteServiceIndex.hpp"
+
+RemoteServiceIndex::RemoteServiceIndex( void )
+    : mCookies      ( )
+    , mStubCount    ( 0u )
+    , mProxyCount   ( 0u )
+{
+}
+
+bool RemoteServiceIndex::addStub( const ITEM_ID & cookie, const StubAddress & addrStub )
+{
+    sCookieServices & services = mCookies[cookie];
+    bool result = services.csStubs.addIfUnique(addrStub, true).second;
+    mStubCount += result ? 1u : 0u;
+    return result;
+}
+
+bool RemoteServiceIndex::removeStub( const ITEM_ID & cookie, const StubAddress & addrStub )
+{
+    bool result{ false };
+    CookieMap::MAPPOS pos = mCookies.find(cookie);
+    if (mCookies.isValidPosition(pos))
+    {
+        sCookieServices & services = mCookies.valueAtPosition(pos);
+        if (services.csStubs.removeAt(addrStub))
+        {
+            result = true;
+            -- mStubCount;
+            if (services.csStubs.isEmpty() && services.csProxies.isEmpty())
+            {
+                mCookies.removePosition(pos);
+            }
+        }
+    }
+
+    return result;
+}
+
+bool RemoteServiceIndex::addProxy( const ITEM_ID & cookie, const ProxyAddress & addrProxy )
+{
+    sCookieServices & services = mCookies[cookie];
+    bool result = services.csProxies.addIfUnique(addrProxy, true).second;
+    mProxyCount += result ? 1u : 0u;
+    return result;
+}
+
+bool RemoteServiceIndex::removeProxy( const ITEM_ID & cookie, const ProxyAddress & addrProxy )
+{
+    bool result{ false };
+    CookieMap::MAPPOS pos = mCookies.find(cookie);
+    if (mCookies.isValidPosition(pos))
+    {
+        sCookieServices & services = mCookies.valueAtPosition(pos);
+        if (services.csProxies.removeAt(addrProxy))
+        {
+            result = true;
+            -- mProxyCount;
+            if (services.csStubs.isEmpty() && services.csProxies.isEmpty())
+            {
+                mCookies.removePosition(pos);
+            }
+        }
+    }
+
+    return result;
+}
+
+void RemoteServiceIndex::getServices( const ITEM_ID & cookie, TEArrayList<StubAddress> & OUT out_listStubs, TEArrayList<ProxyAddress> & OUT out_listProxies ) const
+{
+    if (cookie == NEService::COOKIE_ANY)
+    {
+        out_listStubs.reserve(out_listStubs.getSize() + mStubCount);
+        out_listProxies.reserve(out_listProxies.getSize() + mProxyCount);
+        for (CookieMap::MAPPOS pos = mCookies.firstPosition(); mCookies.isValidPosition(pos); pos = mCookies.nextPosition(pos))
+        {
+            _getServices(mCookies.valueAtPosition(pos), out_listStubs, out_listProxies);
+        }
+    }
+    else
+    {
+        CookieMap::MAPPOS pos = mCookies.find(cookie);
+        if (mCookies.isValidPosition(pos))
+        {
+            _getServices(mCookies.valueAtPosition(pos), out_listStubs, out_listProxies);
+        }
+    }
+}
+
+void RemoteServiceIndex::removeCookie( const ITEM_ID & cookie )
+{
+    CookieMap::MAPPOS pos = mCookies.find(cookie);
+    if (mCookies.isValidPosition(pos))
+    {
+        const sCookieServices & services = mCookies.valueAtPosition(pos);
+        mStubCount  -= services.csStubs.getSize();
+        mProxyCount -= services.csProxies.getSize();
+        mCookies.removePosition(pos);
+    }
+}
+
+void RemoteServiceIndex::clear( void )
+{
+    mCookies.clear();
+    mStubCount  = 0u;
+    mProxyCount = 0u;
+}
+
+void RemoteServiceIndex::_getServices( const sCookieServices & services, TEArrayList<StubAddress> & OUT out_listStubs, TEArrayList<ProxyAddress> & OUT out_listProxies )
+{
+    for (StubSet::MAPPOS pos = services.csStubs.firstPosition(); services.csStubs.isValidPosition(pos); pos = services.csStubs.nextPosition(pos))
+    {
+        out_listStubs.add(services.csStubs.keyAtPosition(pos));
+    }
+
+    for (ProxySet::MAPPOS pos = services.csProxies.firstPosition(); services.csProxies.isValidPosition(pos); pos = services.csProxies.nextPosition(pos))
+    {
+        out_listProxies.add(services.csProxies.keyAtPosition(pos));
+    }
+}
@@ -22,6 +22,8 @@
 #include "areg/component/ResponseEvents.hpp"
 #include "areg/component/RequestEvents.hpp"
 #include "areg/component/NEService.hpp"
+#include "areg/component/ProxyBase.hpp"
+#include "areg/component/ComponentThread.hpp"
 #include "areg/appbase/Application.hpp"
 #include "areg/base/Process.hpp"
 #include "areg/trace/GETrace.h"
@@ -39,6 +41,7 @@ DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_registerServiceProvider);
 DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_unregisterServiceProvider);
 DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_registerServiceConsumer);
 DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_unregisterServiceConsumer);
+DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_registerServices);
 
 //////////////////////////////////////////////////////////////////////////
 // RouterClient class implementation
@@ -99,6 +102,12 @@ void RouterClient::onServiceExit(void)
     triggerExit();
 }
 
+void RouterClient::onChannelConnected(const ITEM_ID & cookie)
+{
+    RemoteEventFactory::resetAddressCache();
+    ServiceClientConnectionBase::onChannelConnected(cookie);
+}
+
 bool RouterClient::registerServiceProvider( const StubAddress & stubService )
 {
     TRACE_SCOPE(areg_ipc_private_RouterClient_registerServiceProvider);
@@ -163,6 +172,48 @@ void RouterClient::unregisterServiceConsumer(const ProxyAddress & proxyService,
     }
 }
 
+bool RouterClient::registerServices( const TEArrayList<StubAddress> & listStubs, const TEArrayList<ProxyAddress> & listProxies )
+{
+    TRACE_SCOPE(areg_ipc_private_RouterClient_registerServices);
+
+    Lock lock( mLock );
+    bool result{ false };
+    if ( isConnectionStarted() == false )
+    {
+        TRACE_WARN("The connection is not started, cannot register services");
+    }
+    else if ( isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) == false )
+    {
+        // the router of older version does not know the bulk registration,
+        // register each service provider and consumer by separate message.
+        TRACE_DBG("The router does not confirm the bulk registration, registering [ %u ] services and [ %u ] service clients one by one"
+                   , listStubs.getSize()
+                   , listProxies.getSize());
+
+        result = true;
+        for ( uint32_t i = 0; i < listStubs.getSize(); ++ i )
+        {
+            result = registerServiceProvider( listStubs[i] ) && result;
+        }
+
+        for ( uint32_t i = 0; i < listProxies.getSize(); ++ i )
+        {
+            result = registerServiceConsumer( listProxies[i] ) && result;
+        }
+    }
+    else if ( (listStubs.isEmpty() == false) || (listProxies.isEmpty() == false) )
+    {
+        TRACE_DBG("Queuing to send register [ %u ] services and [ %u ] service clients message by connection [ %d ]"
+                   , listStubs.getSize()
+                   , listProxies.getSize()
+                   , mClientConnection.getCookie());
+
+        result = sendMessage(NERemoteService::createRouterRegisterServices(listStubs, listProxies, mClientConnection.getCookie(), NEService::COOKIE_ROUTER), Event::eEventPriority::EventPriorityHigh);
+    }
+
+    return result;
+}
+
 void RouterClient::failedSendMessage(const RemoteMessage & msgFailed, Socket & whichTarget )
 {
     TRACE_SCOPE(areg_ipc_private_RouterClient_failedSendMessage);
@@ -188,6 +239,9 @@ void RouterClient::failedSendMessage(const RemoteMessage & msgFailed, Socket & w
                 eventError->deliverEvent();
             }
 
+            // The target may not have received the definitions of the interned addresses.
+            RemoteEventFactory::resetAddressCache(msgFailed.getTarget());
+
             if ( whichTarget.isValid() && (whichTarget.isAlive() == false))
             {
                 TRACE_DBG("Trying to reconnect");
@@ -251,7 +305,8 @@ void RouterClient::failedProcessMessage( const RemoteMessage & msgUnprocessed )
             if ( eventError != nullptr )
             {
                 RemoteMessage data;
-                if ( RemoteEventFactory::createStreamFromEvent( data, *eventError, mChannel) )
+                // The failure is serialized in the receiving thread, do not intern addresses to keep the order.
+                if ( RemoteEventFactory::createStreamFromEvent( data, *eventError, mChannel, false) )
                 {
                     sendMessage(data);
                 }
@@ -330,6 +385,11 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                         NEService::eDisconnectReason reason { NEService::eDisconnectReason::ReasonUndefined };
                         msgReceived >> reason;
                         proxy.setSource( mChannel.getSource() );
+                        if ( reason == NEService::eDisconnectReason::ReasonConsumerDisconnected )
+                        {
+                            RemoteEventFactory::removeAddressCache(proxy.getCookie());
+                        }
+
                         mRegisterConsumer.unregisteredRemoteServiceConsumer(proxy, reason, NEService::COOKIE_ANY);
                     }
                     break;
@@ -340,6 +400,11 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                         NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
                         msgReceived >> reason;
                         stub.setSource( mChannel.getSource() );
+                        if ( reason == NEService::eDisconnectReason::ReasonProviderDisconnected )
+                        {
+                            RemoteEventFactory::removeAddressCache(stub.getCookie());
+                        }
+
                         mRegisterConsumer.unregisteredRemoteServiceProvider(stub, reason, NEService::COOKIE_ANY);
                     }
                     break;
@@ -370,6 +435,9 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
         case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
         case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
         case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+        case NEService::eFuncIdRange::ServiceLogFilterMessages:         // fall through
+        case NEService::eFuncIdRange::ServiceLogQueryStatistics:        // fall through
+        case NEService::eFuncIdRange::ServiceLogStatistics:             // fall through
             break;
 
         case NEService::eFuncIdRange::AttributeLastId:          // fall through
@@ -414,7 +482,24 @@ void RouterClient::processRemoteRequestEvent( RemoteRequestEvent & requestEvent)
 {
     TRACE_SCOPE(areg_ipc_private_RouterClient_processRemoteRequestEvent);
 
-    if ( requestEvent.isRemote() )
+    if ( requestEvent.isRemote() == false )
+    {
+        TRACE_WARN("Request event with message [ %u ] is not remote, ignoring sending event", requestEvent.getRequestId());
+    }
+    else if ( isSendWindowOpen() == false )
+    {
+        // The send window is exhausted, the request is deferred to the proxy as busy.
+        TRACE_WARN("The send window is exhausted, replying busy to request [ %u ]", requestEvent.getRequestId());
+        RemoteResponseEvent * eventBusy = ProxyBase::createRequestFailureEvent( requestEvent.getEventSource()
+                                                                             , requestEvent.getRequestId()
+                                                                             , NEService::eResultType::RequestBusy
+                                                                             , requestEvent.getSequenceNumber());
+        if ( eventBusy != nullptr )
+        {
+            eventBusy->deliverEvent();
+        }
+    }
+    else
     {
         RemoteMessage data;
         if ( RemoteEventFactory::createStreamFromEvent( data, requestEvent, mChannel) )
@@ -432,10 +517,6 @@ void RouterClient::processRemoteRequestEvent( RemoteRequestEvent & requestEvent)
             TRACE_ERR("Failed to create remote request data with message [ %u ]", requestEvent.getRequestId() );
         }
     }
-    else
-    {
-        TRACE_WARN("Request event with message [ %u ] is not remote, ignoring sending event", requestEvent.getRequestId());
-    }
 }
 
 void RouterClient::processRemoteNotifyRequestEvent( RemoteNotifyRequestEvent & requestNotifyEvent )
@@ -500,6 +581,16 @@ bool RouterClient::postEvent(Event & eventElem)
     if ( eventElem.isRemote() )
     {
         eventElem.setEventConsumer( static_cast<IERemoteEventConsumer *>(this) );
+
+        // The responses, broadcasts and attribute updates of the stubs cannot be rejected like
+        // the requests of proxies. Instead, the component thread of the stub waits here until
+        // the queued messages are sent, so that the stub cannot grow the queue without bound.
+        // The threads of the connection never wait, they are the ones returning the credits.
+        if ( (eventElem.getEventType() == Event::eEventType::EventRemoteServiceResponse) &&
+             (RUNTIME_CAST(Thread::getCurrentThread(), ComponentThread) != nullptr) )
+        {
+            waitForSendWindow( NECommon::WAIT_INFINITE );
+        }
     }
 
     return EventDispatcher::postEvent(eventElem);
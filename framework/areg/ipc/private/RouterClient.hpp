@@ -87,6 +87,13 @@ protected:
      **/
     virtual void onServiceExit(void) override;
 
+    /**
+     * \brief   Called when need to inform the channel connection.
+     *          Resets the addresses interned for the remote messages of the previous connection.
+     * \param   cookie  The channel connection cookie.
+     **/
+    virtual void onChannelConnected(const ITEM_ID & cookie) override;
+
 /************************************************************************/
 // IERemoteMessageHandler interface overrides
 /************************************************************************/
@@ -156,6 +163,16 @@ protected:
      **/
     virtual void unregisterServiceConsumer( const ProxyAddress & proxyService, const NEService::eDisconnectReason reason ) override;
 
+    /**
+     * \brief   Call to register the lists of service providers and service consumers at once.
+     *          It is called when the connection is established to register all public services,
+     *          and has the same effect as registering each service provider and service consumer.
+     * \param   listStubs   The addresses of service providers to register in the system.
+     * \param   listProxies The addresses of service consumers to register in the system.
+     * \return  Returns true if registration process started with success. Otherwise, it returns false.
+     **/
+    virtual bool registerServices( const TEArrayList<StubAddress> & listStubs, const TEArrayList<ProxyAddress> & listProxies ) override;
+
 /************************************************************************/
 // IEEventRouter interface overrides
 /************************************************************************/
@@ -0,0 +1,125 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/SendWindow.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The credit based window of messages queued
+ *              to send via connection.
+ ************************************************************************/
+#include "areg/ipc/SendWindow.hpp"
+
+SendWindow::SendWindow( uint32_t maxMessages /*= UNLIMITED*/, uint32_t maxBytes /*= UNLIMITED*/ )
+    : mMaxMessages  ( maxMessages )
+    , mMaxBytes     ( maxBytes )
+    , mStatistics   { 0u, 0u, 0u, 0u, 0u, 0u }
+    , mLock         ( )
+    , mEventCredits ( false, false )
+    , mHasCredits   ( true )
+{
+}
+
+void SendWindow::setWindow( uint32_t maxMessages, uint32_t maxBytes )
+{
+    Lock lock(mLock);
+    mMaxMessages= maxMessages;
+    mMaxBytes   = maxBytes;
+    _updateCredits();
+}
+
+bool SendWindow::canAcquire( uint32_t bytes ) const
+{
+    Lock lock(mLock);
+    return _hasCredits(bytes);
+}
+
+bool SendWindow::acquire( uint32_t bytes, bool force )
+{
+    Lock lock(mLock);
+    if ((force == false) && (_hasCredits(bytes) == false))
+    {
+        ++ mStatistics.wsRejectedMessages;
+        return false;
+    }
+
+    mStatistics.wsQueuedMessages   += 1;
+    mStatistics.wsQueuedBytes      += bytes;
+    mStatistics.wsPeakMessages      = MACRO_MAX(mStatistics.wsPeakMessages, mStatistics.wsQueuedMessages);
+    mStatistics.wsPeakBytes         = MACRO_MAX(mStatistics.wsPeakBytes, mStatistics.wsQueuedBytes);
+    _updateCredits();
+    return true;
+}
+
+void SendWindow::release( uint32_t bytes, bool sent )
+{
+    Lock lock(mLock);
+    if (mStatistics.wsQueuedMessages != 0)
+    {
+        mStatistics.wsQueuedMessages   -= 1;
+        mStatistics.wsQueuedBytes      -= MACRO_MIN(bytes, mStatistics.wsQueuedBytes);
+        mStatistics.wsSentMessages     += sent ? 1u : 0u;
+        _updateCredits();
+    }
+}
+
+void SendWindow::reset( void )
+{
+    Lock lock(mLock);
+    mStatistics.wsQueuedMessages= 0u;
+    mStatistics.wsQueuedBytes   = 0u;
+    _updateCredits();
+}
+
+SendWindow::sWindowStatistics SendWindow::getStatistics( void ) const
+{
+    Lock lock(mLock);
+    return mStatistics;
+}
+
+void SendWindow::resetStatistics( void )
+{
+    Lock lock(mLock);
+    mStatistics.wsPeakMessages      = mStatistics.wsQueuedMessages;
+    mStatistics.wsPeakBytes         = mStatistics.wsQueuedBytes;
+    mStatistics.wsSentMessages      = 0u;
+    mStatistics.wsRejectedMessages  = 0u;
+}
+
+inline bool SendWindow::_hasCredits( uint32_t bytes ) const
+{
+    if ((mMaxMessages != UNLIMITED) && (mStatistics.wsQueuedMessages >= mMaxMessages))
+    {
+        return false;
+    }
+    else if ((mMaxBytes != UNLIMITED) && (mStatistics.wsQueuedMessages != 0) && (mStatistics.wsQueuedBytes + bytes > mMaxBytes))
+    {
+        return false;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+inline void SendWindow::_updateCredits( void )
+{
+    const bool hasCredits{ _hasCredits(0u) };
+    if (hasCredits != mHasCredits)
+    {
+        mHasCredits = hasCredits;
+        if (hasCredits)
+        {
+            mEventCredits.setEvent();
+        }
+        else
+        {
+            mEventCredits.resetEvent();
+        }
+    }
+}
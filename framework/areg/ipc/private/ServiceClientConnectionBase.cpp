@@ -33,6 +33,7 @@ DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase_onChannelConnected)
 DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase_serviceConnectionEvent);
 DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase_startConnection);
 DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase_cancelConnection);
+DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase__startReconnectTimer);
 
 //////////////////////////////////////////////////////////////////////////
 // ServiceClientConnectionBase class implementation
@@ -58,10 +59,12 @@ ServiceClientConnectionBase::ServiceClientConnectionBase( const ITEM_ID & target
     , mMessageDispatcher    (messageDispatcher)
     , mChannel              ( )
     , mConnectionState      ( eConnectionState::ConnectionStopped )
+    , mServiceFeatures      ( static_cast<uint32_t>(NERemoteService::eServiceFeatures::FeatureNone) )
     , mEventConsumer        ( static_cast<IEServiceEventConsumerBase &>(self()) )
     , mLock                 ( )
 
     , mTimerConnect         ( static_cast<IETimerConsumer &>(mTimerConsumer), prefixName + NEConnection::CLIENT_CONNECT_TIMER_NAME )
+    , mReconnectBackoff     ( NEConnection::DEFAULT_RETRY_CONNECT_TIMEOUT, NEConnection::MAXIMUM_RETRY_CONNECT_TIMEOUT )
     , mThreadReceive        (messageHandler, mClientConnection, prefixName)
     , mThreadSend           (messageHandler, mClientConnection, prefixName)
     , mTimerConsumer        ( static_cast<IEServiceEventConsumerBase &>(self()) )
@@ -79,9 +82,22 @@ void ServiceClientConnectionBase::serviceConnectionEvent(const RemoteMessage& ms
 
     ITEM_ID cookie{ NEService::COOKIE_UNKNOWN };
     NEService::eServiceConnection connection{ NEService::eServiceConnection::ServiceConnectionUnknown };
+    NEService::eMessageSource source{ NEService::eMessageSource::MessageSourceUndefined };
+    uint32_t features{ static_cast<uint32_t>(NERemoteService::eServiceFeatures::FeatureNone) };
     msgReceived >> cookie;
     msgReceived >> connection;
-    TRACE_DBG("Remote service connection notification: status [ %s ], cookie [ %llu ]", NEService::getString(connection), cookie);
+    // the remote service of older version sends neither the source, nor the features.
+    if (msgReceived.isEndOfBuffer() == false)
+    {
+        msgReceived >> source;
+    }
+
+    if (msgReceived.isEndOfBuffer() == false)
+    {
+        msgReceived >> features;
+    }
+
+    TRACE_DBG("Remote service connection notification: status [ %s ], cookie [ %llu ], features [ 0x%X ]", NEService::getString(connection), cookie, features);
 
     switch (connection)
     {
@@ -93,6 +109,7 @@ void ServiceClientConnectionBase::serviceConnectionEvent(const RemoteMessage& ms
                 Lock lock(mLock);
                 ASSERT(cookie == msgReceived.getTarget());
                 mClientConnection.setCookie(cookie);
+                mServiceFeatures = features;
                 onChannelConnected(cookie);
                 sendCommand(ServiceEventData::eServiceEventCommands::CMD_ServiceStarted);
             }
@@ -143,6 +160,7 @@ bool ServiceClientConnectionBase::setupServiceConnectionData(NERemoteService::eR
                 String address{ config.getConnectionAddress() };
                 unsigned short port{ config.getConnectionPort() };
                 result = mClientConnection.setAddress(address, port);
+                setSendWindow(config.getSendWindowMessages(), config.getSendWindowBytes());
             }
         }
     }
@@ -277,6 +295,7 @@ void ServiceClientConnectionBase::onServiceConnectionStarted(void)
         mChannel.setCookie( mClientConnection.getCookie() );
         mChannel.setSource( mMessageDispatcher.getId());
         mChannel.setTarget( mTarget );
+        mReconnectBackoff.reset( );
         setConnectionState(ServiceClientConnectionBase::eConnectionState::ConnectionStarted);
         mConnectionConsumer.connectedRemoteServiceChannel(mChannel);
     }
@@ -301,7 +320,7 @@ void ServiceClientConnectionBase::onServiceConnectionStopped(void)
 
     if ( Application::isServicingReady( ) )
     {
-        mTimerConnect.startTimer(NEConnection::DEFAULT_RETRY_CONNECT_TIMEOUT, mMessageDispatcher, 1 );
+        _startReconnectTimer( );
     }
 }
 
@@ -323,7 +342,7 @@ void ServiceClientConnectionBase::onServiceConnectionLost(void)
         mThreadSend.shutdownThread( NECommon::WAIT_INFINITE );
         mConnectionConsumer.lostRemoteServiceChannel( channel );
 
-        mTimerConnect.startTimer(NEConnection::DEFAULT_RETRY_CONNECT_TIMEOUT, mMessageDispatcher, 1 );
+        _startReconnectTimer( );
     }
     else
     {
@@ -365,6 +384,7 @@ void ServiceClientConnectionBase::onChannelConnected(const ITEM_ID& cookie)
     {
         TRACE_INFO("Disconnecting remote channel [ source = %llu, target = %llu, cookie = %llu ]", mChannel.getSource(), mChannel.getTarget(), mChannel.getCookie());
         mChannel.invalidate();
+        mServiceFeatures = static_cast<uint32_t>(NERemoteService::eServiceFeatures::FeatureNone);
     }
 }
 
@@ -393,11 +413,11 @@ bool ServiceClientConnectionBase::startConnection(void)
 
     if ( result == false )
     {
-        TRACE_WARN("Client service failed to start connection, going to repeat connection in [ %u ] ms", NEConnection::DEFAULT_RETRY_CONNECT_TIMEOUT);
+        TRACE_WARN("Client service failed to start connection, going to repeat connection");
         mThreadSend.shutdownThread( NECommon::DO_NOT_WAIT );
         mThreadReceive.shutdownThread( NECommon::DO_NOT_WAIT );
         mClientConnection.closeSocket();
-        mTimerConnect.startTimer(NEConnection::DEFAULT_RETRY_CONNECT_TIMEOUT, mMessageDispatcher, 1);
+        _startReconnectTimer( );
     }
 
     return result;
@@ -414,3 +434,29 @@ void ServiceClientConnectionBase::cancelConnection(void)
     mThreadReceive.shutdownThread( NECommon::DO_NOT_WAIT );
     mThreadSend.shutdownThread( NECommon::DO_NOT_WAIT );
 }
+
+bool ServiceClientConnectionBase::sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
+{
+    SendWindow & window{ mThreadSend.getSendWindow() };
+    const uint32_t size{ data.getSizeUsed() };
+    window.acquire(size, true);
+    if (SendMessageEvent::sendEvent( SendMessageEventData(data)
+                                   , static_cast<IESendMessageEventConsumer &>(mThreadSend)
+                                   , static_cast<DispatcherThread &>(mThreadSend)
+                                   , eventPrio) == false)
+    {
+        window.release(size, false);
+        return false;
+    }
+
+    return true;
+}
+
+void ServiceClientConnectionBase::_startReconnectTimer( void )
+{
+    TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase__startReconnectTimer);
+
+    const unsigned int timeout{ mReconnectBackoff.nextTimeout( ) };
+    TRACE_DBG("Retry the connection in [ %u ] ms, attempt [ %u ]", timeout, mReconnectBackoff.getAttempts( ));
+    mTimerConnect.startTimer( timeout, mMessageDispatcher, 1 );
+}
@@ -26,13 +26,20 @@ int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const So
     if ( in_message.isValid() && clientSocket.isValid() )
     {
         in_message.bufferCompletionFix();
-        const NEMemory::sRemoteMessageHeader & buffer = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *in_message.getByteBuffer() );
-        result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&buffer), sizeof(NEMemory::sRemoteMessageHeader) );
-        if ((result == sizeof(NEMemory::sRemoteMessageHeader)) && (buffer.rbhBufHeader.biUsed != 0))
+
+        // The header is copied, because the data buffer can be shared with other targets.
+        NEMemory::sRemoteMessageHeader header{ };
+        in_message.copyHeader(header);
+        if (header.rbhBufHeader.biUsed != 0)
+        {
+            ASSERT(header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed);
+            // send the header and the aligned length of data.
+            result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&header), sizeof(NEMemory::sRemoteMessageHeader)
+                                          , in_message.getBuffer(), static_cast<int>(header.rbhBufHeader.biLength));
+        }
+        else
         {
-            ASSERT(buffer.rbhBufHeader.biLength >= buffer.rbhBufHeader.biUsed);
-            // send the aligned length.
-            result += clientSocket.sendData(in_message.getBuffer(), static_cast<int>(buffer.rbhBufHeader.biLength));
+            result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&header), sizeof(NEMemory::sRemoteMessageHeader) );
         }
     }
 
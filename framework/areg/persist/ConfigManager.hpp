@@ -22,6 +22,7 @@
 
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/base/Thread.hpp"
 #include "areg/base/Version.hpp"
 #include "areg/persist/NEPersistence.hpp"
 #include "areg/persist/Property.hpp"
@@ -742,6 +743,38 @@ public:
      **/
     void setRemoteServicePort(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType, uint16_t newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the maximum number of messages queued to send to the remote service.
+     *          The value 0 means that the number of queued messages is not limited.
+     * \param   service     The string value of the remote service.
+     **/
+    uint32_t getRemoteServiceWindowMessages(const String& service) const;
+
+    /**
+     * \brief   Sets the maximum number of messages queued to send to the remote service.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The maximum number of queued messages. The value 0 means no limit.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceWindowMessages(const String& service, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the maximum size in bytes of messages queued to send to the remote service.
+     *          The value 0 means that the size of queued messages is not limited.
+     * \param   service     The string value of the remote service.
+     **/
+    uint32_t getRemoteServiceWindowBytes(const String& service) const;
+
+    /**
+     * \brief   Sets the maximum size in bytes of messages queued to send to the remote service.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The maximum size in bytes of queued messages. The value 0 means no limit.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceWindowBytes(const String& service, uint32_t newValue, bool isTemporary = false);
+
     /**
      * \brief   Returns the log database property entry of specified position.
      * \param   whichPosition   The position of log database property.
@@ -758,6 +791,34 @@ public:
      **/
     void setLogDatabaseProperty(const String & whichPosition, const String & newValue, bool isTemporary = false);
 
+/************************************************************************
+ * Thread properties.
+ ************************************************************************/
+
+    /**
+     * \brief   Returns the list of names of threads, which have configured placement,
+     *          i.e. the CPU cores, the scheduling policy or the NUMA node.
+     **/
+    std::vector<String> getPlacedThreads(void) const;
+
+    /**
+     * \brief   Returns the configured placement of the thread. The CPU cores are
+     *          listed in the configuration, like '0 | 2 | 4-7'. If nothing is
+     *          configured, returns empty placement.
+     * \param   threadName  The name of the thread.
+     **/
+    Thread::sPlacement getThreadPlacement(const String& threadName) const;
+
+    /**
+     * \brief   Sets the placement of the thread. Only the attributes, which are set
+     *          in the placement, are saved in the configuration.
+     * \param   threadName  The name of the thread.
+     * \param   placement   The placement of the thread to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setThreadPlacement(const String& threadName, const Thread::sPlacement& placement, bool isTemporary = false);
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden member variables
 //////////////////////////////////////////////////////////////////////////
@@ -179,8 +179,13 @@ namespace NEPersistence
         , EntryServiceEnable        = 23    //!< The connection enable / disable flag of the remote service.
         , EntryServiceAddress       = 24    //!< The connection address of the remote service.
         , EntryServicePort          = 25    //!< The connection port number of the remote service.
+        , EntryServiceWindow        = 26    //!< The send window of the connection to the remote service.
 
-        , EntryAnyKey               = 26    //!< Indicates any key type.
+        , EntryThreadAffinity       = 27    //!< The list of CPU cores to run the thread.
+        , EntryThreadPolicy         = 28    //!< The scheduling policy of the thread.
+        , EntryThreadNuma           = 29    //!< The NUMA node to run the thread and allocate memory.
+
+        , EntryAnyKey               = 30    //!< Indicates any key type.
     };
 
     /**
@@ -219,8 +224,13 @@ namespace NEPersistence
             , {"*"      , "*"   , "enable"  , "*"       }   //! 23  , The connection enable / disable flag of the remote service property structure.
             , {"*"      , "*"   , "address" , "*"       }   //! 24  , The connection address of the remote service property structure.
             , {"*"      , "*"   , "port"    , "*"       }   //! 25  , The connection port number of the remote service property structure.
+            , {"*"      , "*"   , "window"  , "*"       }   //! 26  , The send window of the connection to the remote service property structure.
+
+            , {"thread" , "*"   , "affinity", "*"       }   //! 27  , The list of CPU cores to run the thread property structure.
+            , {"thread" , "*"   , "policy"  , "*"       }   //! 28  , The scheduling policy of the thread property structure.
+            , {"thread" , "*"   , "numa"    , "*"       }   //! 29  , The NUMA node of the thread property structure.
 
-            , {"*"      , "*"   , "*"       , "*"       }   //! 26  , Indicates any key type.
+            , {"*"      , "*"   , "*"       , "*"       }   //! 30  , Indicates any key type.
         };
 
     /**
@@ -313,6 +323,26 @@ namespace NEPersistence
      **/
     inline const NEPersistence::sPropertyKey& getServicePort(void);
 
+    /**
+     * \brief   Returns the send window of the connection to the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceWindow(void);
+
+    /**
+     * \brief   Returns the list of CPU cores to run the thread property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getThreadAffinity(void);
+
+    /**
+     * \brief   Returns the scheduling policy of the thread property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getThreadPolicy(void);
+
+    /**
+     * \brief   Returns the NUMA node of the thread property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getThreadNuma(void);
+
     /**
      * \brief   Returns the log database name.
      **/
@@ -444,6 +474,26 @@ inline const NEPersistence::sPropertyKey& NEPersistence::getServicePort(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServicePort)];
 }
 
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceWindow(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceWindow)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getThreadAffinity(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryThreadAffinity)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getThreadPolicy(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryThreadPolicy)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getThreadNuma(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryThreadNuma)];
+}
+
 const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseName(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseName)];
@@ -23,6 +23,8 @@
 #include "areg/base/Process.hpp"
 #include "areg/persist/IEConfigurationListener.hpp"
 
+#include <algorithm>
+
 namespace
 {
     inline uint32_t _findPosition( const TEArrayList<Property>& propList
@@ -1049,6 +1051,162 @@ void ConfigManager::setRemoteServicePort(NERemoteService::eRemoteServices servic
     setRemoteServicePort(service, connect, newValue, isTemporary);
 }
 
+uint32_t ConfigManager::getRemoteServiceWindowMessages(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWindow;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWindow();
+    const PropertyValue* value = getPropertyValue(service, key.property, NEApplication::SERVICE_WINDOW_MESSAGES, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_WINDOW_MESSAGES);
+}
+
+void ConfigManager::setRemoteServiceWindowMessages(const String& service, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWindow;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWindow();
+    setModuleProperty(service, key.property, NEApplication::SERVICE_WINDOW_MESSAGES, String::makeString(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::getRemoteServiceWindowBytes(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWindow;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWindow();
+    const PropertyValue* value = getPropertyValue(service, key.property, NEApplication::SERVICE_WINDOW_BYTES, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_WINDOW_BYTES);
+}
+
+void ConfigManager::setRemoteServiceWindowBytes(const String& service, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWindow;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWindow();
+    setModuleProperty(service, key.property, NEApplication::SERVICE_WINDOW_BYTES, String::makeString(newValue), confKey, isTemporary);
+}
+
+std::vector<String> ConfigManager::getPlacedThreads(void) const
+{
+    Lock lock(mLock);
+
+    std::vector<String> result;
+    for (const auto* list : { &mReadonlyProperties, &mWritableProperties })
+    {
+        for (const auto& entry : list->getData())
+        {
+            const PropertyKey& key = entry.getKey();
+            const NEPersistence::eConfigKeys keyType{ key.getKeyType() };
+            if ( ((keyType == NEPersistence::eConfigKeys::EntryThreadAffinity) ||
+                  (keyType == NEPersistence::eConfigKeys::EntryThreadPolicy)   ||
+                  (keyType == NEPersistence::eConfigKeys::EntryThreadNuma))    &&
+                 (key.isAllModules() || (key.getModule() == mModule))          &&
+                 (std::find(result.begin(), result.end(), key.getPosition()) == result.end()) )
+            {
+                result.push_back(key.getPosition());
+            }
+        }
+    }
+
+    return result;
+}
+
+Thread::sPlacement ConfigManager::getThreadPlacement(const String& threadName) const
+{
+    Lock lock(mLock);
+
+    Thread::sPlacement result;
+    const NEPersistence::sPropertyKey& keyAffinity = NEPersistence::getThreadAffinity();
+    const PropertyValue* value = getPropertyValue(keyAffinity.section, keyAffinity.property, threadName, NEPersistence::eConfigKeys::EntryThreadAffinity);
+    if (value != nullptr)
+    {
+        // the list of CPU cores, every entry is either a core or a range of cores, like '0 | 2 | 4-7'.
+        const TEArrayList<String> cores{ value->getValueList() };
+        for (const auto& core : cores.getData())
+        {
+            String first(core);
+            String last(core);
+            const NEString::CharPos pos{ core.findFirst('-') };
+            if (core.isValidPosition(pos))
+            {
+                core.substring(first, NEString::START_POS, pos);
+                core.substring(last, pos + 1);
+            }
+
+            first.trimAll();
+            last.trimAll();
+            const uint32_t lastCore{ last.toUInt32() };
+            for (uint32_t i = first.toUInt32(); (i <= lastCore) && (i < Thread::CPU_MASK_CORES); ++ i)
+            {
+                result.cpuMask |= (static_cast<uint64_t>(1u) << i);
+            }
+        }
+    }
+
+    const NEPersistence::sPropertyKey& keyPolicy = NEPersistence::getThreadPolicy();
+    value = getPropertyValue(keyPolicy.section, keyPolicy.property, threadName, NEPersistence::eConfigKeys::EntryThreadPolicy);
+    const unsigned int policy{ value != nullptr ? value->getIndetifier(NEApplication::ThreadPolicyIdentifiers) : Identifier::BAD_IDENTIFIER_VALUE };
+    if (policy != Identifier::BAD_IDENTIFIER_VALUE)
+    {
+        result.policy = static_cast<Thread::eSchedulingPolicy>(policy);
+    }
+
+    const NEPersistence::sPropertyKey& keyNuma = NEPersistence::getThreadNuma();
+    value = getPropertyValue(keyNuma.section, keyNuma.property, threadName, NEPersistence::eConfigKeys::EntryThreadNuma);
+    if ((value != nullptr) && (value->getValue().isEmpty() == false))
+    {
+        result.numaNode = value->getValue().toInt32();
+    }
+
+    return result;
+}
+
+void ConfigManager::setThreadPlacement(const String& threadName, const Thread::sPlacement& placement, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    if (placement.cpuMask != 0u)
+    {
+        String cores;
+        for (uint32_t i = 0; i < Thread::CPU_MASK_CORES; ++ i)
+        {
+            if ((placement.cpuMask & (static_cast<uint64_t>(1u) << i)) != 0u)
+            {
+                if (cores.isEmpty() == false)
+                {
+                    cores.append(NEPersistence::SYNTAX_WHITESPACE_DELIMITER)
+                         .append(NEPersistence::SYNTAX_VALUE_LIST_DELIMITER)
+                         .append(NEPersistence::SYNTAX_WHITESPACE_DELIMITER);
+                }
+
+                cores.append(String::makeString(i));
+            }
+        }
+
+        const NEPersistence::sPropertyKey& key = NEPersistence::getThreadAffinity();
+        setModuleProperty(key.section, key.property, threadName, cores, NEPersistence::eConfigKeys::EntryThreadAffinity, isTemporary);
+    }
+
+    for (const auto& id : NEApplication::ThreadPolicyIdentifiers)
+    {
+        if (id.getValue() == static_cast<unsigned int>(placement.policy))
+        {
+            const NEPersistence::sPropertyKey& key = NEPersistence::getThreadPolicy();
+            setModuleProperty(key.section, key.property, threadName, id.getName(), NEPersistence::eConfigKeys::EntryThreadPolicy, isTemporary);
+            break;
+        }
+    }
+
+    if (placement.numaNode != Thread::NUMA_NODE_ANY)
+    {
+        const NEPersistence::sPropertyKey& key = NEPersistence::getThreadNuma();
+        setModuleProperty(key.section, key.property, threadName, String::makeString(static_cast<int32_t>(placement.numaNode)), NEPersistence::eConfigKeys::EntryThreadNuma, isTemporary);
+    }
+}
+
 String ConfigManager::getLogDatabaseProperty(const String& whichPosition)
 {
     const NEPersistence::sPropertyKey& key = NEPersistence::getLogDatabaseName();
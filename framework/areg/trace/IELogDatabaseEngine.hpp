@@ -130,6 +130,18 @@ public:
      **/
     virtual bool logScopeDeactivate(const ITEM_ID & cookie, unsigned int scopeId, const DateTime & timestamp) = 0;
 
+    /**
+     * \brief   Queries the log messages of the specified source created within the time range.
+     *          The engines, which do not support queries, return 0.
+     * \param   cookie      The cookie ID of the log source. NEService::COOKIE_ANY to query all sources.
+     * \param   timeBegin   The beginning of the time range, inclusive.
+     * \param   timeEnd     The end of the time range, inclusive.
+     * \param   result      On output, contains the found log messages in the order they were saved.
+     * \param   maxCount    The maximum number of messages to return.
+     * \return  Returns the number of found log messages added to the result.
+     **/
+    virtual uint32_t queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount);
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 #include "areg/base/String.hpp"
 #include "areg/base/TEArrayList.hpp"
 #include "areg/base/TEHashMap.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/NEService.hpp"
 
 #include <string_view>
@@ -88,6 +89,31 @@ namespace NETrace
     //!< The list of scope update structure.
     using ScopeNames    = TEArrayList<sScopeInfo>;
 
+    /**
+     * \brief   NETrace::sLogFilter
+     *          The filter of log messages, which a log observer registers at the logger service.
+     *          The logger service forwards a log message to the observer only if the message
+     *          matches at least one filter in the list. A message matches the filter if it
+     *          matches all fields of the filter. The fields with default values match any message.
+     **/
+    struct sLogFilter
+    {
+        /**
+         * \brief   Default constructor. The filter matches any log message.
+         **/
+        inline sLogFilter(void);
+
+        ITEM_ID     filterCookie;       //!< The ID of the log source. NEService::COOKIE_ANY matches any source.
+        uint32_t    filterScopeFirst;   //!< The first scope ID of the range. If the range is 0-0, matches any scope ID.
+        uint32_t    filterScopeLast;    //!< The last scope ID of the range, inclusive. If 0, the range has no upper limit.
+        uint32_t    filterPriorities;   //!< The bitwise set of NETrace::eLogPriority values. 0 matches any priority.
+        String      filterScopePrefix;  //!< The prefix of scope names. Empty string matches any scope.
+        String      filterText;         //!< The substring of the message text. Empty string matches any message.
+    };
+
+    //!< The list of log message filters.
+    using LogFilters    = TEArrayList<sLogFilter>;
+
     /**
      * \brief   NETrace::eLogingTypes
      *          The logging types in AREG framework
@@ -210,6 +236,11 @@ namespace NETrace
      **/
     constexpr std::string_view   LOGDB_NAME_SQLITE3 { "sqlite3" };
 
+    /**
+     * \brief   The name of the append-only binary log archive engine.
+     **/
+    constexpr std::string_view   LOGDB_NAME_ARCHIVE { "archive" };
+
     /**
      * \brief   Returns string value of NETrace::eLogPriority.
      *          There are following valid string priority values:
@@ -328,6 +359,9 @@ namespace NETrace
         char                        logModule[LOG_NAMES_SIZE];  //!< The name of the module that generated the log. Valid only for remote logging.
     };
 
+    //!< The list of log messages.
+    using LogMessages   = TEArrayList<sLogMessage>;
+
     /**
      * \brief   Start logging. If specified file is not nullptr, it configures logging first, then starts logging.
      * \param   fileConfig  The relative or absolute path to logging configuration file.
@@ -574,6 +608,36 @@ namespace NETrace
      **/
     AREG_API RemoteMessage messageConfigurationSaved(void);
 
+    /**
+     * \brief   Creates a message to set the filters of log messages, which the logger service
+     *          forwards to the log observer. The message replaces the filters set before.
+     *          If the list is empty, the logger service forwards all log messages to the observer.
+     * \param   source      The ID of the log observer that generated the message.
+     * \param   target      The ID of the target to send the message. Normally, it is NEService::COOKIE_LOGGER.
+     * \param   filters     The list of filters. The log message is forwarded if it matches at least one filter.
+     * \return  Returns generated message ready to send to the logger service.
+     **/
+    AREG_API RemoteMessage messageFilterLogs(const ITEM_ID& source, const ITEM_ID& target, const NETrace::LogFilters& filters);
+
+    /**
+     * \brief   Creates a message to query the statistics of the dispatcher threads of the connected client.
+     * \param   source      The ID of the log observer that generated the message.
+     * \param   target      The ID of the target to send the message.
+     *                      If the ID is NEService::COOKIE_ANY, the message is sent to all connected clients.
+     * \return  Returns generated message ready to send to the client(s) via logger service.
+     **/
+    AREG_API RemoteMessage messageQueryStatistics(const ITEM_ID& source, const ITEM_ID& target);
+
+    /**
+     * \brief   Creates a message with the statistics of the dispatcher threads of the log source.
+     *          The message is sent as a reply to the query of the statistics.
+     * \param   source      The ID of the log source that generated the message.
+     * \param   target      The ID of the log observer, which requested the statistics.
+     * \param   statistics  The statistics of the dispatcher threads.
+     * \return  Returns generated message ready to send to the log observer via logger service.
+     **/
+    AREG_API RemoteMessage messageDispatcherStatistics(const ITEM_ID& source, const ITEM_ID& target, const DispatcherStatistics::ListStatistics& statistics);
+
     /**
      * \brief   Call to set external logging database engine.
      **/
@@ -640,6 +704,30 @@ inline IEOutStream& operator << (IEOutStream& stream, const NETrace::sScopeInfo
     return stream;
 }
 
+/**
+ * \brief   De-serializes a log message filter from the stream.
+ * \param   stream  The source of data that contains log message filter.
+ * \param   input   On output this contains log message filter.
+ **/
+inline const IEInStream& operator >> (const IEInStream& stream, NETrace::sLogFilter & input)
+{
+    stream  >> input.filterCookie >> input.filterScopeFirst >> input.filterScopeLast
+            >> input.filterPriorities >> input.filterScopePrefix >> input.filterText;
+    return stream;
+}
+
+/**
+ * \brief   Serializes a log message filter to the stream.
+ * \param   stream  The streaming object to save log message filter.
+ * \param   output  The source of log message filter to serialize.
+ **/
+inline IEOutStream& operator << (IEOutStream& stream, const NETrace::sLogFilter & output)
+{
+    stream  << output.filterCookie << output.filterScopeFirst << output.filterScopeLast
+            << output.filterPriorities << output.filterScopePrefix << output.filterText;
+    return stream;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // NETrace namespace inline methods
 //////////////////////////////////////////////////////////////////////////////
@@ -696,6 +784,16 @@ inline NETrace::sScopeInfo::sScopeInfo(const char* name, uint32_t id, uint32_t p
 {
 }
 
+inline NETrace::sLogFilter::sLogFilter(void)
+    : filterCookie      ( NEService::COOKIE_ANY )
+    , filterScopeFirst  ( 0u )
+    , filterScopeLast   ( 0u )
+    , filterPriorities  ( 0u )
+    , filterScopePrefix ( )
+    , filterText        ( )
+{
+}
+
 inline bool NETrace::isValidLogPriority( NETrace::eLogPriority prio )
 {
     return (static_cast<unsigned int>(prio) & static_cast<unsigned int>(NETrace::eLogPriority::PrioValid)) != 0;
@@ -25,3 +25,8 @@ IELogDatabaseEngine::IELogDatabaseEngine(void)
 IELogDatabaseEngine::~IELogDatabaseEngine(void)
 {
 }
+
+uint32_t IELogDatabaseEngine::queryLogs(const ITEM_ID & /*cookie*/, const TIME64 & /*timeBegin*/, const TIME64 & /*timeEnd*/, NETrace::LogMessages & OUT /*result*/, uint32_t /*maxCount*/)
+{
+    return 0u;
+}
@@ -14,28 +14,60 @@
  ************************************************************************/
 #include "areg/trace/private/LayoutManager.hpp"
 
-#include "areg/trace/private/Layouts.hpp"
-#include "areg/trace/private/NELogging.hpp"
+#include "areg/base/DateTime.hpp"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/NEMemory.hpp"
 #include "areg/base/NEUtilities.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <ctime>
+#include <string_view>
 
 #if AREG_LOGS
 
-LayoutManager::~LayoutManager(void)
+namespace
+{
+    //!< The day-time format without milliseconds, which are appended separately.
+    //!< Same as NEUtilities::TIME_FORMAT_ISO8601_OUTPUT.
+    constexpr char              _formatDayTime[]    { "%Y-%m-%d %H:%M:%S," };
+
+    //!< The unknown module name
+    constexpr std::string_view  _unknownModule      { "Unknown_Module" };
+
+    //!< The unknown thread name
+    constexpr std::string_view  _unknownThread      { "Unknown_Thread" };
+
+#ifdef _BIT64
+    constexpr char  _fmtTickCount[] { "%llu" };
+    constexpr char  _fmtModuleId[]  { "0x%llX" };
+    constexpr char  _fmtThreadId[]  { "%06llu" };
+    constexpr char  _fmtCookieId[]  { "%03llu" };
+#else   // _BIT32
+    constexpr char  _fmtTickCount[] { "%u" };
+    constexpr char  _fmtModuleId[]  { "0x%X" };
+    constexpr char  _fmtThreadId[]  { "%06u" };
+    constexpr char  _fmtCookieId[]  { "%03u" };
+#endif  // _BIT64
+}
+
+LayoutManager::LayoutManager( void )
+    : mLayoutList   ( )
+    , mLayoutText   ( )
+    , mOutput       { '\0' }
+    , mOutputLen    ( 0u )
+    , mCachedSecond ( 0 )
+    , mCachedTime   { '\0' }
+    , mCachedTimeLen( 0u )
 {
-    deleteLayouts();
 }
 
 bool LayoutManager::createLayouts( const char * layoutFormat )
 {
     deleteLayouts();
-    int len = NEString::isEmpty<char>(layoutFormat) == false ? NEString::getStringLength<char>( layoutFormat ) + 1 : 0;
-    char * strFormat = len > 0 ? DEBUG_NEW char[ static_cast<unsigned int>(len) ] : nullptr;
-
-    if ( strFormat != nullptr )
+    if (NEString::isEmpty<char>(layoutFormat) == false)
     {
-        NEString::copyString<char, char>( strFormat, len, layoutFormat, len );
-        _createLayouts(strFormat);
-        delete [] strFormat;
+        _createLayouts(layoutFormat);
     }
 
     return (mLayoutList.isEmpty() == false);
@@ -44,15 +76,9 @@ bool LayoutManager::createLayouts( const char * layoutFormat )
 bool LayoutManager::createLayouts(const String& layoutFormat)
 {
     deleteLayouts();
-    uint32_t len  = static_cast<uint32_t>(layoutFormat.getLength());
-    uint32_t size = len + 1u;
-    char* strFormat = size > 1 ? DEBUG_NEW char[size] : nullptr;
-
-    if (strFormat != nullptr)
+    if (layoutFormat.isEmpty() == false)
     {
-        NEString::copyString<char, char>(strFormat, static_cast<NEString::CharCount>(len), layoutFormat.getString(), static_cast<NEString::CharCount>(len));
-        _createLayouts(strFormat);
-        delete[] strFormat;
+        _createLayouts(layoutFormat.getString());
     }
 
     return (mLayoutList.isEmpty() == false);
@@ -60,143 +86,291 @@ bool LayoutManager::createLayouts(const String& layoutFormat)
 
 void LayoutManager::deleteLayouts(void)
 {
-    const std::vector<IELayout*>& list{ mLayoutList.getData() };
-    for (IELayout* layout : list)
-    {
-        delete layout;
-    }
-
     mLayoutList.clear();
+    mLayoutText.clear();
+    mOutputLen      = 0u;
+    mCachedSecond   = 0;
+    mCachedTimeLen  = 0u;
 }
 
 void LayoutManager::logMessage(const NETrace::sLogMessage & logMsg, IEOutStream & stream) const
 {
     if (logMsg.logMessagePrio == NETrace::PrioIgnoreLayout)
     {
-        stream.write(logMsg.logMessage);
+        stream.write(reinterpret_cast<const unsigned char *>(logMsg.logMessage), static_cast<uint32_t>(NEString::getStringLength<char>(logMsg.logMessage)));
+        return;
     }
-    else
+
+    static const ITEM_ID _moduleId{ Process::getInstance().getId() };
+    static const String& _moduleName{ Process::getInstance().getAppName() };
+#ifdef _BIT64
+    static const String  _moduleIdHex{ String::makeString(static_cast<uint64_t>(_moduleId), NEString::eRadix::RadixHexadecimal) };
+#else   // _BIT32
+    static const String  _moduleIdHex{ String::makeString(static_cast<uint32_t>(_moduleId), NEString::eRadix::RadixHexadecimal) };
+#endif  // _BIT64
+
+    char buffer[128];
+    uint32_t len{ 0u };
+    const char * text{ mLayoutText.getString() };
+    const std::vector<sLayoutItem>& list{ mLayoutList.getData() };
+
+    mOutputLen = 0u;
+    for (const sLayoutItem & item : list)
     {
-        const std::vector<IELayout*>& list{ mLayoutList.getData() };
-        for (const IELayout* layout : list)
+        switch (item.lyType)
         {
-            layout->logMessage(logMsg, stream);
-        }
-    }
-}
+        case NELogging::eLayouts::LayoutAnyText:
+            _append(text + item.lyTextPos, item.lyTextLen, stream);
+            break;
+
+        case NELogging::eLayouts::LayoutCookieId:
+            len = static_cast<uint32_t>(String::formatString(buffer, 128, _fmtCookieId, static_cast<id_type>(logMsg.logCookie)));
+            _append(buffer, len, stream);
+            break;
+
+        case NELogging::eLayouts::LayoutTickCount:
+            len = static_cast<uint32_t>(String::formatString(buffer, 128, _fmtTickCount, static_cast<id_type>(DateTime::getProcessTickCount())));
+            _append(buffer, len, stream);
+            break;
+
+        case NELogging::eLayouts::LayoutDayTime:
+            if (logMsg.logTimestamp != 0)
+            {
+                _appendDayTime(logMsg.logTimestamp, stream);
+            }
+            break;
 
-inline void LayoutManager::_createLayouts(char* layoutFormat)
-{
-    ASSERT(layoutFormat != nullptr);
+        case NELogging::eLayouts::LayoutExecutableId:
+            if (logMsg.logModuleId == _moduleId)
+            {
+                _append(_moduleIdHex.getString(), static_cast<uint32_t>(_moduleIdHex.getLength()), stream);
+            }
+            else if (logMsg.logModuleId != 0)
+            {
+                len = static_cast<uint32_t>(String::formatString(buffer, 128, _fmtModuleId, static_cast<id_type>(logMsg.logModuleId)));
+                _append(buffer, len, stream);
+            }
+            break;
 
-    bool hasExclusive{ false };
-    char* pos = layoutFormat;
-    const char* pos1 = pos;
+        case NELogging::eLayouts::LayoutMessage:
+            _append(logMsg.logMessage, static_cast<uint32_t>(NEString::getStringLength<char>(logMsg.logMessage)), stream);
+            break;
 
-    while (*pos != String::EmptyChar)
-    {
-        if (*pos == NELogging::SYNTAX_SPECIAL_FORMAT)
-        {
-            char ch = *(pos + 1);
-            IELayout* newLayout{ nullptr };
-            switch (static_cast<NELogging::eLayouts>(ch))
+        case NELogging::eLayouts::LayoutEndOfLine:
+            _append(&NEString::EndOfLine, 1u, stream);
+            break;
+
+        case NELogging::eLayouts::LayoutPriority:
             {
-            case NELogging::eLayouts::LayoutTickCount:
-                newLayout = DEBUG_NEW TickCountLayout();
-                break;
+                const String& prio{ NETrace::logPrioToString(logMsg.logMessagePrio) };
+                _append(prio.getString(), static_cast<uint32_t>(prio.getLength()), stream);
+            }
+            break;
 
-            case NELogging::eLayouts::LayoutDayTime:
-                newLayout = DEBUG_NEW DayTimeLaytout();
-                break;
+        case NELogging::eLayouts::LaytoutScopeId:
+            if (logMsg.logScopeId != 0)
+            {
+                len = static_cast<uint32_t>(String::formatString(buffer, 128, "%u", logMsg.logScopeId));
+                _append(buffer, len, stream);
+            }
+            break;
+
+        case NELogging::eLayouts::LayoutThreadId:
+            if (logMsg.logThreadId != 0)
+            {
+                len = static_cast<uint32_t>(String::formatString(buffer, 128, _fmtThreadId, static_cast<id_type>(logMsg.logThreadId)));
+                _append(buffer, len, stream);
+            }
+            break;
 
-            case NELogging::eLayouts::LayoutExecutableId:
-                newLayout = DEBUG_NEW ModuleIdLayout();
-                break;
+        case NELogging::eLayouts::LayoutExecutableName:
+            if ((logMsg.logDataType == NETrace::eLogDataType::LogDataLocal) || (logMsg.logCookie == NEService::COOKIE_LOCAL))
+            {
+                _append(_moduleName.getString(), static_cast<uint32_t>(_moduleName.getLength()), stream);
+            }
+            else if ((logMsg.logCookie != NEService::COOKIE_UNKNOWN) && (logMsg.logModuleLen != 0))
+            {
+                _append(logMsg.logModule, logMsg.logModuleLen, stream);
+            }
+            else
+            {
+                _append(_unknownModule.data(), static_cast<uint32_t>(_unknownModule.length()), stream);
+            }
+            break;
 
-            case NELogging::eLayouts::LayoutMessage:
-                if (hasExclusive == false)
+        case NELogging::eLayouts::LayoutThreadName:
+            if (logMsg.logDataType == NETrace::eLogDataType::LogDataLocal)
+            {
+                const String& thread{ Thread::getThreadName(static_cast<id_type>(logMsg.logThreadId)) };
+                if (thread.isEmpty() == false)
                 {
-                    newLayout = DEBUG_NEW MessageLayout();
-                    hasExclusive = true;
+                    _append(thread.getString(), static_cast<uint32_t>(thread.getLength()), stream);
                 }
-                break;
-
-            case NELogging::eLayouts::LayoutEndOfLine:
-                newLayout = DEBUG_NEW EndOfLineLayout();
-                break;
-
-            case NELogging::eLayouts::LayoutPriority:
-                newLayout = DEBUG_NEW PriorityLayout();
-                break;
+                else
+                {
+                    _append(_unknownThread.data(), static_cast<uint32_t>(_unknownThread.length()), stream);
+                }
+            }
+            else if (logMsg.logThreadLen != 0)
+            {
+                _append(logMsg.logThread, logMsg.logThreadLen, stream);
+            }
+            else
+            {
+                _append(_unknownThread.data(), static_cast<uint32_t>(_unknownThread.length()), stream);
+            }
+            break;
 
-            case NELogging::eLayouts::LaytoutScopeId:
-                newLayout = DEBUG_NEW ScopeIdLayout();
-                break;
+        case NELogging::eLayouts::LaytoutScopeName:
+            _append(logMsg.logMessage, logMsg.logMessageLen, stream);
+            break;
 
-            case NELogging::eLayouts::LayoutThreadId:
-                newLayout = DEBUG_NEW ThreadIdLayout();
-                break;
+        case NELogging::eLayouts::LayoutUndefined:  // fall through
+        default:
+            ASSERT(false);
+            break;
+        }
+    }
 
-            case NELogging::eLayouts::LayoutExecutableName:
-                newLayout = DEBUG_NEW ModuleNameLayout();
-                break;
+    _flush(stream);
+}
 
-            case NELogging::eLayouts::LayoutThreadName:
-                newLayout = DEBUG_NEW ThreadNameLayout();
-                break;
+inline void LayoutManager::_createLayouts(const char* layoutFormat)
+{
+    ASSERT(layoutFormat != nullptr);
 
-            case NELogging::eLayouts::LaytoutScopeName:
-                if (hasExclusive == false)
-                {
-                    newLayout = DEBUG_NEW ScopeNameLayout();
-                    hasExclusive = true;
-                }
-                break;
+    bool hasExclusive{ false };
+    const char* pos = layoutFormat;
+    const char* begin = pos;
 
-            case NELogging::eLayouts::LayoutCookieId:
-                newLayout = DEBUG_NEW CookieIdLayout();
-                break;
+    while (*pos != String::EmptyChar)
+    {
+        if (*pos != NELogging::SYNTAX_SPECIAL_FORMAT)
+        {
+            ++pos;
+            continue;
+        }
 
-            case NELogging::eLayouts::LayoutUndefined:  // fall through
-            case NELogging::eLayouts::LayoutAnyText:    // fall through
-            default:
-                if (ch == NELogging::SYNTAX_SPECIAL_FORMAT)
-                {
-                    *(pos + 1) = String::EmptyChar;
-                    newLayout = DEBUG_NEW AnyTextLayout(pos1);
-                    pos1 = pos; // <== will automatically move 2 positions when newLayout is not nullptr;
-                }
-                else
-                {
-                    pos += ch != String::EmptyChar ? 2 : 1;
-                }
-                break;
+        char ch = *(pos + 1);
+        NELogging::eLayouts layout{ static_cast<NELogging::eLayouts>(ch) };
+        switch (layout)
+        {
+        case NELogging::eLayouts::LayoutMessage:    // fall through
+        case NELogging::eLayouts::LaytoutScopeName:
+            // The message and the scope name are exclusive, only one of them is output.
+            if (hasExclusive)
+            {
+                _addText(begin, static_cast<uint32_t>(pos - begin));
+                pos += 2;
+                begin = pos;
+                continue;
             }
 
-            if (newLayout != nullptr)
+            hasExclusive = true;
+            break;
+
+        case NELogging::eLayouts::LayoutCookieId:       // fall through
+        case NELogging::eLayouts::LayoutTickCount:      // fall through
+        case NELogging::eLayouts::LayoutDayTime:        // fall through
+        case NELogging::eLayouts::LayoutExecutableId:   // fall through
+        case NELogging::eLayouts::LayoutEndOfLine:      // fall through
+        case NELogging::eLayouts::LayoutPriority:       // fall through
+        case NELogging::eLayouts::LaytoutScopeId:       // fall through
+        case NELogging::eLayouts::LayoutThreadId:       // fall through
+        case NELogging::eLayouts::LayoutExecutableName: // fall through
+        case NELogging::eLayouts::LayoutThreadName:
+            break;
+
+        case NELogging::eLayouts::LayoutUndefined:  // fall through
+        case NELogging::eLayouts::LayoutAnyText:    // fall through
+        default:
+            if (ch == NELogging::SYNTAX_SPECIAL_FORMAT)
             {
-                *pos = String::EmptyChar;
-                if (pos1 != pos)
-                {
-                    mLayoutList.add(static_cast<IELayout*>(DEBUG_NEW AnyTextLayout(pos1)));
-                }
+                // "%%" outputs single '%' symbol
+                _addText(begin, static_cast<uint32_t>(pos - begin) + 1u);
+                pos += 2;
+                begin = pos;
+            }
+            else
+            {
+                // unknown specifier, output as it is
+                pos += ch != String::EmptyChar ? 2 : 1;
+            }
+            continue;
+        }
 
-                mLayoutList.add(newLayout);
+        _addText(begin, static_cast<uint32_t>(pos - begin));
+        mLayoutList.add(sLayoutItem{ layout, 0u, 0u });
+        pos += 2;
+        begin = pos;
+    }
 
-                *(++pos) = String::EmptyChar;
-                pos1 = ++pos;
-            }
+    _addText(begin, static_cast<uint32_t>(pos - begin));
+}
+
+inline void LayoutManager::_addText(const char* text, uint32_t length)
+{
+    if (length != 0)
+    {
+        uint32_t textPos{ static_cast<uint32_t>(mLayoutText.getLength()) };
+        mLayoutText.append(text, static_cast<NEString::CharCount>(length));
+        if ((mLayoutList.isEmpty() == false) && (mLayoutList.lastEntry().lyType == NELogging::eLayouts::LayoutAnyText))
+        {
+            mLayoutList.lastEntry().lyTextLen += length;
         }
         else
         {
-            ++pos;
+            mLayoutList.add(sLayoutItem{ NELogging::eLayouts::LayoutAnyText, textPos, length });
         }
     }
+}
 
-    if (pos1 != pos)
+inline void LayoutManager::_append(const char* data, uint32_t length, IEOutStream& stream) const
+{
+    if (mOutputLen + length > OUTPUT_BUFFER_SIZE)
     {
-        mLayoutList.add(static_cast<IELayout*>(DEBUG_NEW AnyTextLayout(pos1)));
+        _flush(stream);
+        if (length > OUTPUT_BUFFER_SIZE)
+        {
+            stream.write(reinterpret_cast<const unsigned char*>(data), length);
+            return;
+        }
     }
+
+    NEMemory::memCopy(mOutput + mOutputLen, length, data, length);
+    mOutputLen += length;
+}
+
+inline void LayoutManager::_flush(IEOutStream& stream) const
+{
+    if (mOutputLen != 0)
+    {
+        stream.write(reinterpret_cast<const unsigned char*>(mOutput), mOutputLen);
+        mOutputLen = 0u;
+    }
+}
+
+inline void LayoutManager::_appendDayTime(const TIME64& timestamp, IEOutStream& stream) const
+{
+    TIME64 second{ timestamp / NEUtilities::SEC_TO_MICROSECS };
+    if ((second != mCachedSecond) || (mCachedTimeLen == 0))
+    {
+        struct tm conv { };
+        NEUtilities::convToLocalTm(timestamp, conv);
+        mCachedTimeLen  = static_cast<uint32_t>(std::strftime(mCachedTime, TIMESTAMP_SIZE, _formatDayTime, &conv));
+        mCachedSecond   = second;
+    }
+
+    uint32_t milli{ static_cast<uint32_t>((timestamp / NEUtilities::MILLISEC_TO_MICROSECS) % 1000) };
+    char ms[3]
+    {
+          static_cast<char>('0' + milli / 100)
+        , static_cast<char>('0' + (milli / 10) % 10)
+        , static_cast<char>('0' + milli % 10)
+    };
+
+    _append(mCachedTime, mCachedTimeLen, stream);
+    _append(ms, 3u, stream);
 }
 
 #endif  // AREG_LOGS
@@ -18,35 +18,64 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
 #include "areg/base/TEArrayList.hpp"
 #include "areg/trace/NETrace.hpp"
+#include "areg/trace/private/NELogging.hpp"
 
 #if AREG_LOGS
 
 /************************************************************************
  * Dependencies
  ************************************************************************/
-class IELayout;
 class IEOutStream;
 
 //////////////////////////////////////////////////////////////////////////
-// ClientService class declaration
+// LayoutManager class declaration
 //////////////////////////////////////////////////////////////////////////
 /**
- * \brief   The Layout Manager keeps list of layout objects to format output message
- *          The Layouts are created based on data in tracing configuration file.
+ * \brief   The Layout Manager formats output log messages.
+ *          The layout format string is compiled once into a flat list of
+ *          layout items, where each item is either a specifier to output
+ *          a field of the log message or a reference to the literal text
+ *          between specifiers. When logging, the items are appended into
+ *          a single output buffer, which is written to the stream with
+ *          one call. The formatted date-time is cached per second and
+ *          only the milliseconds are patched for every next message.
+ *          The layouts are created based on data in logging configuration file.
  *          Currently, there are 3 types of layout manager used:
  *              - Message layout, format to display output message
  *              - Enter scope layout, format to display enter scope message
  *              - Exit scope layout, format to display exit scope message
+ * \note    The output buffer and the cached date-time are not protected,
+ *          the layout manager should be used only by one thread.
  **/
-class LayoutManager
+class AREG_API LayoutManager
 {
 //////////////////////////////////////////////////////////////////////////
 // Local types and constants.
 //////////////////////////////////////////////////////////////////////////
 private:
-    using ListLayouts   = TEArrayList<IELayout *>;
+    /**
+     * \brief   LayoutManager::sLayoutItem
+     *          A compiled layout item. If the type is LayoutAnyText,
+     *          the position and the length refer to the text in the layout text buffer.
+     **/
+    struct sLayoutItem
+    {
+        NELogging::eLayouts lyType;     //!< The type of layout.
+        uint32_t            lyTextPos;  //!< The position of the literal text in the layout text buffer.
+        uint32_t            lyTextLen;  //!< The length of the literal text.
+    };
+
+    //!< The list of compiled layout items.
+    using ListLayouts   = TEArrayList<sLayoutItem>;
+
+    //!< The size of output buffer. The buffer is flushed to the stream when it is full.
+    static constexpr uint32_t   OUTPUT_BUFFER_SIZE  { NETrace::LOG_MESSAGE_IZE + 4 * NETrace::LOG_NAMES_SIZE };
+
+    //!< The size of buffer to keep formatted date-time.
+    static constexpr uint32_t   TIMESTAMP_SIZE      { 64 };
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -55,18 +84,18 @@ public:
     /**
      * \brief   Default constructor
      **/
-    LayoutManager( void ) = default;
+    LayoutManager( void );
     /**
      * \brief   Destructor
      **/
-    virtual ~LayoutManager( void ) ;
+    virtual ~LayoutManager( void ) = default;
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
 //////////////////////////////////////////////////////////////////////////
 public:
     /**
-     * \brief   Creates list of layout objects outside of passed formatting string.
+     * \brief   Compiles the passed formatting string into the list of layout items.
      * \param   layoutFormat    The formatting string to parse and crate layout objects.
      * \return  Returns true if after parsing the layout manager contains at least one layout object.
      **/
@@ -95,19 +124,68 @@ public:
 private:
 
     /**
-     * \brief   Instantiates and creates layout objects out of layout format string.
-     * \param   layoutFormat    The layout string to parse and create objects.
+     * \brief   Parses the layout format string and creates the list of layout items.
+     * \param   layoutFormat    The layout string to parse.
+     **/
+    inline void _createLayouts( const char * layoutFormat );
+
+    /**
+     * \brief   Adds the literal text item, which refers to the text in the layout text buffer.
+     *          If the previous item is a text as well, the items are merged.
+     * \param   text    The text to add.
+     * \param   length  The length of the text to add.
      **/
-    inline void _createLayouts(char* layoutFormat);
+    inline void _addText( const char * text, uint32_t length );
+
+    /**
+     * \brief   Appends data to the output buffer. If there is not enough space,
+     *          writes the buffer to the stream before appending.
+     **/
+    inline void _append( const char * data, uint32_t length, IEOutStream & stream ) const;
+
+    /**
+     * \brief   Writes the content of output buffer to the stream.
+     **/
+    inline void _flush( IEOutStream & stream ) const;
+
+    /**
+     * \brief   Appends the formatted date-time of specified timestamp to the output buffer.
+     *          The formatting is done once per second, the milliseconds are updated for every call.
+     **/
+    inline void _appendDayTime( const TIME64 & timestamp, IEOutStream & stream ) const;
 
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   The list of layouts
+     * \brief   The list of compiled layout items.
+     **/
+    ListLayouts         mLayoutList;
+    /**
+     * \brief   The literal text of layout format, referred by layout items.
+     **/
+    String              mLayoutText;
+    /**
+     * \brief   The output buffer to format message.
+     **/
+    mutable char        mOutput[OUTPUT_BUFFER_SIZE];
+    /**
+     * \brief   The number of bytes in the output buffer.
+     **/
+    mutable uint32_t    mOutputLen;
+    /**
+     * \brief   The second of last formatted date-time.
+     **/
+    mutable TIME64      mCachedSecond;
+    /**
+     * \brief   The cached formatted date-time without milliseconds.
+     **/
+    mutable char        mCachedTime[TIMESTAMP_SIZE];
+    /**
+     * \brief   The length of cached formatted date-time.
      **/
-    ListLayouts     mLayoutList;
+    mutable uint32_t    mCachedTimeLen;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
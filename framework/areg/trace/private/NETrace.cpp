@@ -183,12 +183,14 @@ NETrace::sLogMessage::sLogMessage(const NETrace::sLogMessage & src)
     , logScopeId    { src.logScopeId }
     , logMessageLen { src.logMessageLen }
     , logMessage    { '\0' }
-    , logThreadLen  { 0 }
+    , logThreadLen  { src.logThreadLen }
     , logThread     { '\0' }
-    , logModuleLen  { 0 }
+    , logModuleLen  { src.logModuleLen }
     , logModule     { '\0' }
 {
     NEMemory::memCopy(logMessage, NETrace::LOG_MESSAGE_IZE, src.logMessage, src.logMessageLen + 1);
+    NEMemory::memCopy(logThread, NETrace::LOG_NAMES_SIZE, src.logThread, src.logThreadLen + 1);
+    NEMemory::memCopy(logModule, NETrace::LOG_NAMES_SIZE, src.logModule, src.logModuleLen + 1);
 }
 
 NETrace::sLogMessage & NETrace::sLogMessage::operator = (const NETrace::sLogMessage & src)
@@ -206,16 +208,12 @@ NETrace::sLogMessage & NETrace::sLogMessage::operator = (const NETrace::sLogMess
         logTimestamp    = src.logTimestamp;
         logScopeId      = src.logScopeId;
         logMessageLen   = src.logMessageLen;
-
-        if (logDataType == NETrace::eLogDataType::LogDataRemote)
-        {
-            logThreadLen = 0;
-            logThread[0] = String::EmptyChar;
-            logThreadLen = 0;
-            logModule[0] = String::EmptyChar;
-        }
+        logThreadLen    = src.logThreadLen;
+        logModuleLen    = src.logModuleLen;
 
         NEMemory::memCopy(logMessage, NETrace::LOG_MESSAGE_IZE, src.logMessage, src.logMessageLen + 1);
+        NEMemory::memCopy(logThread, NETrace::LOG_NAMES_SIZE, src.logThread, src.logThreadLen + 1);
+        NEMemory::memCopy(logModule, NETrace::LOG_NAMES_SIZE, src.logModule, src.logModuleLen + 1);
     }
 
     return (*this);
@@ -462,6 +460,58 @@ AREG_API_IMPL RemoteMessage NETrace::messageConfigurationSaved(void)
     return msgScope;
 }
 
+AREG_API_IMPL RemoteMessage NETrace::messageFilterLogs(const ITEM_ID& source, const ITEM_ID& target, const NETrace::LogFilters& filters)
+{
+    RemoteMessage msgFilter;
+    if ((source != NEService::COOKIE_UNKNOWN) &&
+        (target != NEService::COOKIE_UNKNOWN) &&
+        (msgFilter.initMessage(_getLogEmptyMessage().rbHeader) != nullptr))
+    {
+        msgFilter.setMessageId(static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogFilterMessages));
+        msgFilter.setTarget(target);
+        msgFilter.setSource(source);
+        msgFilter << filters.getSize();
+        for (const auto& entry : filters.getData())
+        {
+            msgFilter << entry;
+        }
+    }
+
+    return msgFilter;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::messageQueryStatistics(const ITEM_ID& source, const ITEM_ID& target)
+{
+    RemoteMessage msgQuery;
+    if ((source != NEService::COOKIE_UNKNOWN) &&
+        (target != NEService::COOKIE_UNKNOWN) &&
+        (msgQuery.initMessage(_getLogEmptyMessage().rbHeader) != nullptr))
+    {
+        msgQuery.setMessageId(static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogQueryStatistics));
+        msgQuery.setTarget(target);
+        msgQuery.setSource(source);
+        msgQuery << target;
+    }
+
+    return msgQuery;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::messageDispatcherStatistics(const ITEM_ID& source, const ITEM_ID& target, const DispatcherStatistics::ListStatistics& statistics)
+{
+    RemoteMessage msgStatistics;
+    if ((source != NEService::COOKIE_UNKNOWN) &&
+        (target != NEService::COOKIE_UNKNOWN) &&
+        (msgStatistics.initMessage(_getLogEmptyMessage().rbHeader) != nullptr))
+    {
+        msgStatistics.setMessageId(static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogStatistics));
+        msgStatistics.setTarget(target);
+        msgStatistics.setSource(source);
+        msgStatistics << statistics;
+    }
+
+    return msgStatistics;
+}
+
 AREG_API_IMPL void NETrace::setLogDatabaseEngine(IELogDatabaseEngine * dbEngine)
 {
     TraceManager::setLogDatabaseEngine(dbEngine);
@@ -634,6 +684,24 @@ AREG_API_IMPL RemoteMessage NETrace::messageConfigurationSaved(void)
     return msgScope;
 }
 
+AREG_API_IMPL RemoteMessage NETrace::messageFilterLogs(const ITEM_ID& /*source*/, const ITEM_ID& /*target*/, const NETrace::LogFilters& /*filters*/)
+{
+    RemoteMessage msgFilter;
+    return msgFilter;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::messageQueryStatistics(const ITEM_ID& /*source*/, const ITEM_ID& /*target*/)
+{
+    RemoteMessage msgQuery;
+    return msgQuery;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::messageDispatcherStatistics(const ITEM_ID& /*source*/, const ITEM_ID& /*target*/, const DispatcherStatistics::ListStatistics& /*statistics*/)
+{
+    RemoteMessage msgStatistics;
+    return msgStatistics;
+}
+
 AREG_API_IMPL void NETrace::setLogDatabaseEngine(IELogDatabaseEngine * /*dbEngine*/)
 {
 }
@@ -22,6 +22,7 @@
 #include "areg/appbase/Application.hpp"
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/persist/ConfigManager.hpp"
 #include "areg/trace/private/TraceManager.hpp"
 #include "areg/trace/private/ScopeController.hpp"
@@ -196,6 +197,14 @@ void NetTcpLogger::processReceivedMessage(const RemoteMessage & msgReceived, Soc
             }
             break;
 
+        case NEService::eFuncIdRange::ServiceLogQueryStatistics:
+            {
+                DispatcherStatistics::ListStatistics statistics;
+                DispatcherStatistics::collectStatistics(statistics);
+                sendMessage(NETrace::messageDispatcherStatistics(mChannel.getCookie(), msgReceived.getSource(), statistics));
+            }
+            break;
+
         case NEService::eFuncIdRange::ServiceSaveLogConfiguration:
             if (TraceManager::saveLogConfig())
             {
@@ -220,6 +229,8 @@ void NetTcpLogger::processReceivedMessage(const RemoteMessage & msgReceived, Soc
         case NEService::eFuncIdRange::ServiceLogScopesUpdated:          // fall through
         case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
         case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+        case NEService::eFuncIdRange::ServiceLogFilterMessages:         // fall through
+        case NEService::eFuncIdRange::ServiceLogStatistics:             // fall through
         case NEService::eFuncIdRange::AttributeLastId:                  // fall through
         case NEService::eFuncIdRange::AttributeFirstId:                 // fall through
         case NEService::eFuncIdRange::ResponseLastId:                   // fall through
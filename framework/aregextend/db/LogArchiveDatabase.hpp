@@ -0,0 +1,498 @@
+#ifndef AREG_AREGEXTEND_DB_LOGARCHIVEDATABASE_HPP
+#define AREG_AREGEXTEND_DB_LOGARCHIVEDATABASE_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        aregextend/db/LogArchiveDatabase.hpp
+ * \author      Artak Avetyan
+ * \ingroup     AREG platform, extended library, append-only binary log archive.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/trace/IELogDatabaseEngine.hpp"
+#include "areg/base/File.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// LogArchiveDatabase class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The logging database engine, which saves log messages in segmented
+ *          append-only binary files. The log messages are packed in blocks,
+ *          the block is collected in memory and written in the segment file
+ *          by one write operation. When the segment reaches the maximum size,
+ *          the next segment file is created. Every written block has an entry
+ *          in the sparse index with the time range of the messages in the block,
+ *          and for every log source and scope there is a bitmap of the blocks,
+ *          which contain the messages of the source or scope.
+ *
+ *          The queries find the blocks by the time index and the bitmaps, and read
+ *          only those blocks from the memory-mapped segment files. The index is
+ *          saved in the archive file when a segment is completed and when
+ *          the archive is closed, and the segments are saved in the files
+ *          named '<archive file>.<segment number>'. The saved archive can be
+ *          opened for queries by calling openArchive().
+ *
+ *          The archive saves only the log messages. The instance connect and
+ *          disconnect events are saved as log messages of the log observer,
+ *          the scope activation is not saved.
+ **/
+class LogArchiveDatabase : public IELogDatabaseEngine
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants.
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The default size of the block of log messages in bytes.
+    static constexpr uint32_t   DEFAULT_BLOCK_SIZE      { 64u * 1024u };
+
+    //!< The default maximum size of the segment file in bytes.
+    static constexpr uint32_t   DEFAULT_SEGMENT_SIZE    { 64u * 1024u * 1024u };
+
+    //!< Queries the messages of any scope.
+    static constexpr uint32_t   ANY_SCOPE               { 0xFFFFFFFFu };
+
+private:
+    /**
+     * \brief   LogArchiveDatabase::sArchiveRecord
+     *          The fixed header of the log message record in the block.
+     *          The header is followed by the texts of the message, the thread
+     *          and the module names without the null-terminating characters.
+     *          The record size is aligned to 8 bytes.
+     **/
+    struct sArchiveRecord
+    {
+        uint32_t    arSize;         //!< The size of the record in bytes, including the header.
+        uint32_t    arScopeId;      //!< The ID of the scope of the message.
+        uint16_t    arMessageLen;   //!< The length of the message text.
+        uint8_t     arThreadLen;    //!< The length of the thread name.
+        uint8_t     arModuleLen;    //!< The length of the module name.
+        uint8_t     arMsgType;      //!< The type of the message.
+        uint8_t     arReserved;     //!< Reserved, always zero.
+        uint16_t    arPrio;         //!< The priority of the message.
+        TIME64      arTimestamp;    //!< The timestamp when the message was created.
+        TIME64      arReceived;     //!< The timestamp when the message was received.
+        ITEM_ID     arCookie;       //!< The cookie ID of the log source.
+        ITEM_ID     arModuleId;     //!< The ID of the process of the log source.
+        ITEM_ID     arThreadId;     //!< The ID of the thread of the log source.
+    };
+
+    /**
+     * \brief   LogArchiveDatabase::sArchiveBlock
+     *          The entry of the sparse index of written blocks.
+     **/
+    struct sArchiveBlock
+    {
+        uint32_t    abSegment;      //!< The number of the segment file, which contains the block.
+        uint32_t    abOffset;       //!< The offset of the block in the segment file.
+        uint32_t    abSize;         //!< The size of the block in bytes.
+        uint32_t    abCount;        //!< The number of log messages in the block.
+        TIME64      abTimeFirst;    //!< The smallest timestamp of the messages in the block.
+        TIME64      abTimeLast;     //!< The biggest timestamp of the messages in the block.
+        TIME64      abTimeUpper;    //!< The biggest timestamp of the messages in this and all previous blocks.
+    };
+
+    /**
+     * \brief   LogArchiveDatabase::sArchiveHeader
+     *          The header of the archive index file.
+     **/
+    struct sArchiveHeader
+    {
+        uint32_t    ahMagic;        //!< The magic number of the archive file.
+        uint32_t    ahVersion;      //!< The version of the archive format.
+        uint32_t    ahSegments;     //!< The number of segment files.
+        uint32_t    ahBlocks;       //!< The number of written blocks.
+        uint32_t    ahSources;      //!< The number of bitmaps of log sources.
+        uint32_t    ahScopes;       //!< The number of bitmaps of scopes.
+        uint64_t    ahLogs;         //!< The number of log messages in the written blocks.
+    };
+
+    /**
+     * \brief   LogArchiveDatabase::sMappedSegment
+     *          The memory-mapped segment file.
+     **/
+    struct sMappedSegment
+    {
+        unsigned char * msData;     //!< The mapped data of the segment file.
+        uint64_t        msSize;     //!< The size of mapped data.
+    };
+
+    //!< The bitmap of blocks. The bit 'N' is set if the block 'N' contains messages of the source or scope.
+    using BlockBitmap   = std::vector<uint64_t>;
+    //!< The list of block index entries.
+    using ListBlocks    = TEArrayList<sArchiveBlock>;
+    //!< The bitmaps of blocks of log sources.
+    using MapSources    = TEHashMap<ITEM_ID, BlockBitmap>;
+    //!< The bitmaps of blocks of log scopes.
+    using MapScopes     = TEHashMap<uint32_t, BlockBitmap>;
+    //!< The list of mapped segments, the index is the segment number.
+    using ListSegments  = TEArrayList<sMappedSegment>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogArchiveDatabase(void);
+    virtual ~LogArchiveDatabase(void);
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if logging in the archive is enabled.
+     *          If logging is disabled, no archive operation is performed.
+     **/
+    inline bool isDabataseLoggingEnabled(void) const;
+
+    /**
+     * \brief   Enables or disables logging in the archive.
+     *          This flag should be set before connecting to the archive.
+     * \param   enable  Flag, indicating whether the logging in the archive is enabled or not.
+     **/
+    inline void setDatabaseLoggingEnabled(bool enable);
+
+    /**
+     * \brief   Sets the size of blocks and the maximum size of segment files.
+     *          The parameters should be set before connecting to the archive.
+     * \param   blockSize       The size of the block in bytes. Cannot be less than the size of one log message.
+     * \param   segmentSize     The maximum size of the segment file in bytes. Cannot be less than the block size.
+     **/
+    void setArchiveParameters(uint32_t blockSize, uint32_t segmentSize);
+
+    /**
+     * \brief   Returns the number of log messages saved in the archive.
+     **/
+    inline uint64_t getLogsWritten(void) const;
+
+    /**
+     * \brief   Writes the collected block and the index in the files.
+     **/
+    void flushLogs(void);
+
+    /**
+     * \brief   Opens the saved archive to query log messages. The opened archive is read-only.
+     * \param   filePath    The path to the archive file.
+     * \return  Returns true if succeeded to open the archive.
+     **/
+    bool openArchive(const String & filePath);
+
+    /**
+     * \brief   Queries the log messages of the specified source and scope created within the time range.
+     * \param   cookie      The cookie ID of the log source. NEService::COOKIE_ANY to query all sources.
+     * \param   scopeId     The ID of the scope. LogArchiveDatabase::ANY_SCOPE to query all scopes.
+     * \param   timeBegin   The beginning of the time range, inclusive.
+     * \param   timeEnd     The end of the time range, inclusive.
+     * \param   result      On output, contains the found log messages in the order they were saved.
+     * \param   maxCount    The maximum number of messages to return.
+     * \return  Returns the number of found log messages added to the result.
+     **/
+    uint32_t queryScopeLogs(const ITEM_ID & cookie, uint32_t scopeId, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+public:
+
+/************************************************************************/
+// IEDatabaseEngine interface overrides.
+/************************************************************************/
+
+    /**
+     * \brief   Returns true if the archive is opened and operable.
+     **/
+    virtual bool isOperable(void) const override;
+
+    /**
+     * \brief   Creates the new archive.
+     * \param   dbPath  The path to the archive file. The path may contain the mask.
+     *                  If the parameter is empty, uses the previous path.
+     * \return  Returns true if succeeded to create the archive.
+     **/
+    virtual bool connect(const String & dbPath) override;
+
+    /**
+     * \brief   Writes the collected data and closes the archive.
+     **/
+    virtual void disconnect(void) override;
+
+    /**
+     * \brief   The archive does not support SQL scripts, always returns false.
+     **/
+    virtual bool execute(const String & sql) override;
+
+    /**
+     * \brief   The archive has no transactions, always returns true if the archive is opened.
+     **/
+    virtual bool begin(void) override;
+
+    /**
+     * \brief   The archive has no transactions, always returns true if the archive is opened.
+     **/
+    virtual bool commit(bool doCommit) override;
+
+/************************************************************************/
+// IELogDatabaseEngine interface overrides.
+/************************************************************************/
+
+    /**
+     * \brief   Returns true if the archive is created and ready to log messages.
+     **/
+    virtual bool tablesInitialized(void) const override;
+
+    /**
+     * \brief   Called when logging message should be saved in the archive.
+     * \param   message     The structure of the message to log.
+     * \param   timestamp   The timestamp to register when the message is logged.
+     * \return  Returns true if succeeded to save the log in the archive.
+     **/
+    virtual bool logMessage(const NETrace::sLogMessage & message, const DateTime & timestamp) override;
+
+    /**
+     * \brief   Saves the message that the log source instance is connected.
+     * \param   instance    The structure of the logging message source.
+     * \param   timestamp   The timestamp to register when the instance is logged.
+     * \return  Returns true if succeeded to save the message in the archive.
+     **/
+    virtual bool logInstanceConnected(const NEService::sServiceConnectedInstance & instance, const DateTime & timestamp) override;
+
+    /**
+     * \brief   Saves the message that the log source instance is disconnected.
+     * \param   cookie      The cookie ID of the disconnected instance.
+     * \param   timestamp   The timestamp to register when the instance is disconnected.
+     * \return  Returns true if succeeded to save the message in the archive.
+     **/
+    virtual bool logInstanceDisconnected(const ITEM_ID & cookie, const DateTime & timestamp) override;
+
+    /**
+     * \brief   The archive does not save scopes. Returns true if the archive is opened.
+     **/
+    virtual bool logScopeActivate(const NETrace::sScopeInfo & scope, const ITEM_ID & cookie, const DateTime & timestamp) override;
+
+    /**
+     * \brief   The archive does not save scopes. Returns true if the archive is opened.
+     **/
+    virtual bool logScopeActivate(const String & scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID & cookie, const DateTime & timestamp) override;
+
+    /**
+     * \brief   The archive does not save scopes. Returns the number of scopes if the archive is opened.
+     **/
+    virtual uint32_t logScopesActivate(const NETrace::ScopeNames& scopes, const ITEM_ID& cookie, const DateTime& timestamp) override;
+
+    /**
+     * \brief   The archive does not save scopes. Returns true if the archive is opened.
+     **/
+    virtual bool logScopesDeactivate(const ITEM_ID & cookie, const DateTime & timestamp) override;
+
+    /**
+     * \brief   The archive does not save scopes. Returns true if the archive is opened.
+     **/
+    virtual bool logScopeDeactivate(const ITEM_ID & cookie, unsigned int scopeId, const DateTime & timestamp) override;
+
+    /**
+     * \brief   Queries the log messages of the specified source created within the time range.
+     * \param   cookie      The cookie ID of the log source. NEService::COOKIE_ANY to query all sources.
+     * \param   timeBegin   The beginning of the time range, inclusive.
+     * \param   timeEnd     The end of the time range, inclusive.
+     * \param   result      On output, contains the found log messages in the order they were saved.
+     * \param   maxCount    The maximum number of messages to return.
+     * \return  Returns the number of found log messages added to the result.
+     **/
+    virtual uint32_t queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+
+    /**
+     * \brief   Closes the archive, unmaps the segments and releases resources.
+     **/
+    void _close(void);
+
+    /**
+     * \brief   Creates the next segment file to write blocks.
+     **/
+    bool _openSegment(void);
+
+    /**
+     * \brief   Returns the path of the segment file with the specified number.
+     **/
+    inline String _segmentPath(uint32_t segment) const;
+
+    /**
+     * \brief   Adds the log message record in the current block. Seals the block if it is full.
+     *          The caller should lock the archive.
+     **/
+    bool _appendRecord(const NETrace::sLogMessage & message, const TIME64 & received);
+
+    /**
+     * \brief   Adds the log message generated by the archive module. The caller should lock the archive.
+     **/
+    bool _appendRecord(const char * message, const TIME64 & timestamp);
+
+    /**
+     * \brief   Writes the current block in the segment file and adds the entry in the index.
+     *          Opens the next segment if the current segment is full.
+     *          The caller should lock the archive.
+     **/
+    bool _sealBlock(void);
+
+    /**
+     * \brief   Saves the index in the archive file. The caller should lock the archive.
+     **/
+    bool _saveIndex(void);
+
+    /**
+     * \brief   Loads the index from the archive file. The caller should lock the archive.
+     **/
+    bool _loadIndex(void);
+
+    /**
+     * \brief   Returns the pointer to the data of the written block. Maps the segment file
+     *          if it is not mapped yet or the mapped data does not contain the block.
+     *          Returns nullptr if failed. The caller should lock the archive.
+     **/
+    const unsigned char * _blockData(const sArchiveBlock & block) const;
+
+    /**
+     * \brief   Unmaps all mapped segments.
+     **/
+    void _unmapSegments(void) const;
+
+    /**
+     * \brief   Checks the records of the block data and adds the matching messages in the result.
+     * \return  Returns false if the maximum number of messages is reached.
+     **/
+    static bool _queryBlock(const unsigned char * data, uint32_t size, const ITEM_ID & cookie, uint32_t scopeId, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount);
+
+    /**
+     * \brief   Sets the bit of the block in the bitmap.
+     **/
+    inline static void _setBit(BlockBitmap & bitmap, uint32_t block);
+
+    /**
+     * \brief   Returns true if the bit of the block is set in the bitmap.
+     **/
+    inline static bool _hasBit(const BlockBitmap & bitmap, uint32_t block);
+
+    /**
+     * \brief   Returns the index of the first block, which may contain messages created not earlier than specified time.
+     **/
+    inline uint32_t _firstBlock(const TIME64 & timeBegin) const;
+
+    /**
+     * \brief   OS specific implementation to map the file in the memory for reading.
+     * \param   filePath    The path to the file to map.
+     * \param   size        On output, contains the size of the mapped data.
+     * \return  Returns the pointer to the mapped data or nullptr if failed.
+     **/
+    static unsigned char * _osMapSegment(const String & filePath, uint64_t & OUT size);
+
+    /**
+     * \brief   OS specific implementation to unmap the file data.
+     * \param   data        The pointer to the mapped data.
+     * \param   size        The size of mapped data.
+     **/
+    static void _osUnmapSegment(unsigned char * data, uint64_t size);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The path to the archive file.
+    String              mArchivePath;
+
+    //!< The file of the current segment.
+    File                mSegment;
+
+    //!< Flag, indicating whether the archive is created and ready to log messages.
+    bool                mIsInitialized;
+
+    //!< Flag, indicating whether the opened archive is read-only.
+    bool                mReadOnly;
+
+    //!< Flag, indicating whether the logging in archive is enabled or not.
+    bool                mDbLogEnabled;
+
+    //!< The size of the block in bytes.
+    uint32_t            mBlockSize;
+
+    //!< The maximum size of the segment file in bytes.
+    uint32_t            mSegmentSize;
+
+    //!< The number of the current segment.
+    uint32_t            mSegmentNr;
+
+    //!< The number of bytes written in the current segment.
+    uint32_t            mSegmentUsed;
+
+    //!< The data of the current block.
+    std::vector<unsigned char>  mBlock;
+
+    //!< The number of bytes used in the current block.
+    uint32_t            mBlockUsed;
+
+    //!< The index entry of the current block.
+    sArchiveBlock       mBlockEntry;
+
+    //!< The index of written blocks.
+    ListBlocks          mBlocks;
+
+    //!< The bitmaps of blocks of log sources.
+    MapSources          mSources;
+
+    //!< The bitmaps of blocks of scopes.
+    MapScopes           mScopes;
+
+    //!< The number of log messages saved in the archive.
+    uint64_t            mLogsWritten;
+
+    //!< The mapped segments.
+    mutable ListSegments mMapped;
+
+    //!< The lock to synchronize the archive access.
+    mutable ResourceLock mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE(LogArchiveDatabase);
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogArchiveDatabase class inline methods.
+//////////////////////////////////////////////////////////////////////////
+
+inline bool LogArchiveDatabase::isDabataseLoggingEnabled(void) const
+{
+    return mDbLogEnabled;
+}
+
+inline void LogArchiveDatabase::setDatabaseLoggingEnabled(bool enable)
+{
+    mDbLogEnabled = enable;
+}
+
+inline uint64_t LogArchiveDatabase::getLogsWritten(void) const
+{
+    Lock lock(mLock);
+    return mLogsWritten;
+}
+
+#endif  // AREG_AREGEXTEND_DB_LOGARCHIVEDATABASE_HPP
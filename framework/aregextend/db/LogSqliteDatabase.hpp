@@ -19,16 +19,71 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/trace/IELogDatabaseEngine.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
 #include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/Thread.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // LogSqliteDatabase class declaration
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The logging database engine, responsible to log messages in the database.
+ *          The log messages are inserted by a persistent prepared statement
+ *          with bound parameters. The messages are queued and written in
+ *          the database by the dedicated writer thread in batches, where each
+ *          batch is a single transaction. The batch is written either when the
+ *          number of queued messages reaches the batch size, or when the batch
+ *          timeout expires. The instances and scopes are written through the
+ *          same queue, so that all rows are written in the order they are received.
+ *          The caller of the logging methods is never blocked on disk.
  **/
-class LogSqliteDatabase : public IELogDatabaseEngine
+class LogSqliteDatabase : public    IELogDatabaseEngine
+                        , private   IEThreadConsumer
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants.
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The default number of log messages to write in a single transaction.
+    static constexpr uint32_t   DEFAULT_BATCH_SIZE      { 256u };
+
+    //!< The default timeout in milliseconds to write the queued log messages.
+    static constexpr uint32_t   DEFAULT_BATCH_TIMEOUT   { 250u };
+
+private:
+    /**
+     * \brief   LogSqliteDatabase::eEntryType
+     *          The type of the queued entry to write in the database.
+     **/
+    enum class eEntryType : uint8_t
+    {
+          EntryLog      //!< The log message to insert.
+        , EntryScope    //!< The log scope to insert.
+        , EntryInstance //!< The connected instance to insert.
+        , EntrySql      //!< The SQL script to execute.
+    };
+
+    /**
+     * \brief   LogSqliteDatabase::sLogEntry
+     *          The queued entry with the timestamp when it was received.
+     **/
+    struct sLogEntry
+    {
+        eEntryType              leType;     //!< The type of the entry.
+        NETrace::sLogMessage    leMessage;  //!< The log message to write, valid if the type is EntryLog.
+        TIME64                  leReceived; //!< The timestamp when the entry is received.
+        String                  leText;     //!< The name of the scope or the SQL script.
+        ITEM_ID                 leCookie;   //!< The cookie of the scope owner instance.
+        uint32_t                leScopeId;  //!< The ID of the scope.
+        uint32_t                leScopePrio;//!< The log priority of the scope.
+        NEService::sServiceConnectedInstance leInstance;   //!< The connected instance, valid if the type is EntryInstance.
+    };
+
+    //!< The list of queued log messages.
+    using ListLogEntries    = TEArrayList<sLogEntry>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -54,6 +109,41 @@ public:
      **/
     inline void setDatabaseLoggingEnabled(bool enable);
 
+    /**
+     * \brief   Sets the number of log messages to write in a single transaction
+     *          and the timeout in milliseconds to write queued log messages.
+     *          The batch size 1 writes every log message in its own transaction.
+     * \param   batchSize       The number of log messages to write in one transaction. Cannot be 0.
+     * \param   batchTimeout    The timeout in milliseconds to write the queued messages. Cannot be 0.
+     **/
+    inline void setBatchParameters(uint32_t batchSize, uint32_t batchTimeout);
+
+    /**
+     * \brief   Returns the number of log messages written in a single transaction.
+     **/
+    inline uint32_t getBatchSize(void) const;
+
+    /**
+     * \brief   Enables or disables the write-ahead log journal mode ('journal_mode=WAL')
+     *          and the normal synchronous mode ('synchronous=NORMAL').
+     *          The flags should be set before connecting to the database.
+     * \param   walMode     Flag, indicating whether the write-ahead log journal mode is enabled.
+     * \param   syncNormal  Flag, indicating whether the normal synchronous mode is enabled.
+     *                      Otherwise, the SQLite default 'FULL' synchronous mode is used.
+     **/
+    inline void setJournalOptions(bool walMode, bool syncNormal);
+
+    /**
+     * \brief   Returns the number of log messages written in the database since connected.
+     **/
+    inline uint64_t getLogsWritten(void) const;
+
+    /**
+     * \brief   Writes all queued log messages in the database and returns
+     *          when the data is written.
+     **/
+    void flushLogs(void);
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -187,6 +277,29 @@ public:
      **/
     virtual bool logScopeDeactivate(const ITEM_ID & cookie, unsigned int scopeId, const DateTime & timestamp) override;
 
+    /**
+     * \brief   Queries the log messages of the specified source created within the time range.
+     *          The queued log messages are written in the database before the query.
+     * \param   cookie      The cookie ID of the log source. NEService::COOKIE_ANY to query all sources.
+     * \param   timeBegin   The beginning of the time range, inclusive.
+     * \param   timeEnd     The end of the time range, inclusive.
+     * \param   result      On output, contains the found log messages in the order they were saved.
+     * \param   maxCount    The maximum number of messages to return.
+     * \return  Returns the number of found log messages added to the result.
+     **/
+    virtual uint32_t queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount) override;
+
+/************************************************************************/
+// IEThreadConsumer interface overrides.
+/************************************************************************/
+private:
+
+    /**
+     * \brief   The writer thread function. Waits for the queued log messages
+     *          and writes them in the database in batches.
+     **/
+    virtual void onThreadRuns(void) override;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -218,11 +331,100 @@ private:
      **/
     inline void _initialize(void);
 
+    /**
+     * \brief   Sets the journal and synchronous modes of the opened database.
+     **/
+    inline void _setJournalOptions(void);
+
+    /**
+     * \brief   Creates the prepared statements to insert logs and scopes.
+     **/
+    inline bool _prepareStatements(void);
+
+    /**
+     * \brief   Releases the prepared statements.
+     **/
+    inline void _finalizeStatements(void);
+
     /**
      * \brief   Executes the SQL script. The database should be already opened and initialized.
      **/
     inline bool _execute(const char * sql);
 
+    /**
+     * \brief   Inserts the log message by using prepared statement.
+     *          The caller should lock the database.
+     **/
+    inline bool _insertLog(const NETrace::sLogMessage & message, const TIME64 & timestamp);
+
+    /**
+     * \brief   Inserts the log message generated by the log database
+     *          module by using prepared statement. The caller should lock the database.
+     **/
+    inline bool _insertLog(const char * message, const TIME64 & timestamp);
+
+    /**
+     * \brief   Inserts the log scope by using prepared statement.
+     *          The caller should lock the database.
+     **/
+    inline bool _insertScope(const char * scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID & cookie, const TIME64 & timestamp);
+
+    /**
+     * \brief   Inserts the connected instance by using prepared statement.
+     *          The caller should lock the database.
+     **/
+    inline bool _insertInstance(const NEService::sServiceConnectedInstance & instance, const TIME64 & timestamp);
+
+    /**
+     * \brief   Creates the log message generated by the log database module.
+     **/
+    inline NETrace::sLogMessage _createLog(const char * message, const TIME64 & timestamp) const;
+
+    /**
+     * \brief   Queues the log message generated by the log database module.
+     **/
+    inline void _queueLog(const char * message, const TIME64 & timestamp);
+
+    /**
+     * \brief   Queues the log scope to insert.
+     **/
+    inline void _queueScope(const String & scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID & cookie, const TIME64 & timestamp);
+
+    /**
+     * \brief   Queues the SQL script to execute.
+     **/
+    inline void _queueSql(const char * sql, const TIME64 & timestamp);
+
+    /**
+     * \brief   Queues the connected instance to insert.
+     **/
+    inline void _queueInstance(const NEService::sServiceConnectedInstance & instance, const TIME64 & timestamp);
+
+    /**
+     * \brief   Adds the entry to the queue and signals the writer thread if the batch is full.
+     **/
+    inline void _queueEntry(const sLogEntry & entry);
+
+    /**
+     * \brief   Writes the queued entries in the database in one transaction.
+     **/
+    void _writeQueuedLogs(void);
+
+    /**
+     * \brief   Starts the writer thread.
+     **/
+    inline void _startWriter(void);
+
+    /**
+     * \brief   Stops the writer thread and writes the rest of queued log messages.
+     **/
+    inline void _stopWriter(void);
+
+    /**
+     * \brief   Returns instance of the object. Used in the constructor.
+     **/
+    inline LogSqliteDatabase & self(void);
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -239,6 +441,52 @@ protected:
     //!< Flag, indicating whether the database logging is enabled or not.
     bool        mDbLogEnabled;
 
+    //!< The prepared statement to insert logs.
+    void *      mStmtLog;
+
+    //!< The prepared statement to insert scopes.
+    void *      mStmtScope;
+
+    //!< The prepared statement to insert connected instances.
+    void *      mStmtInstance;
+
+    //!< Flag, indicating whether the write-ahead log journal mode is enabled.
+    bool        mWalMode;
+
+    //!< Flag, indicating whether the normal synchronous mode is enabled.
+    bool        mSyncNormal;
+
+    //!< The number of log messages to write in one transaction.
+    uint32_t    mBatchSize;
+
+    //!< The timeout in milliseconds to write queued log messages.
+    uint32_t    mBatchTimeout;
+
+    //!< The number of log messages written in the database.
+    uint64_t    mLogsWritten;
+
+private:
+    //!< The writer thread.
+    Thread              mWriterThread;
+
+    //!< The queue of log messages, scopes and SQL scripts to write.
+    ListLogEntries      mQueue;
+
+    //!< The list of entries, which are currently written. Accessed only when database is locked.
+    ListLogEntries      mWriting;
+
+    //!< The event to signal the writer thread to write the queued log messages.
+    SynchEvent          mEventWrite;
+
+    //!< Flag, indicating whether the writer thread should exit.
+    bool                mWriterExit;
+
+    //!< The lock to synchronize the queue of log messages.
+    mutable ResourceLock mQueueLock;
+
+    //!< The lock to synchronize the database access.
+    mutable ResourceLock mDbLock;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -260,4 +508,32 @@ inline void LogSqliteDatabase::setDatabaseLoggingEnabled(bool enable)
     mDbLogEnabled = enable;
 }
 
+inline void LogSqliteDatabase::setBatchParameters(uint32_t batchSize, uint32_t batchTimeout)
+{
+    mBatchSize      = MACRO_MAX(batchSize, 1u);
+    mBatchTimeout   = MACRO_MAX(batchTimeout, 1u);
+}
+
+inline uint32_t LogSqliteDatabase::getBatchSize(void) const
+{
+    return mBatchSize;
+}
+
+inline void LogSqliteDatabase::setJournalOptions(bool walMode, bool syncNormal)
+{
+    mWalMode    = walMode;
+    mSyncNormal = syncNormal;
+}
+
+inline uint64_t LogSqliteDatabase::getLogsWritten(void) const
+{
+    Lock lock(mQueueLock);
+    return mLogsWritten;
+}
+
+inline LogSqliteDatabase& LogSqliteDatabase::self(void)
+{
+    return (*this);
+}
+
 #endif  // AREG_AREGEXTEND_DB_LOGSQLITEDATABASE_HPP
@@ -0,0 +1,674 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        aregextend/db/private/LogArchiveDatabase.cpp
+ * \author      Artak Avetyan
+ * \ingroup     AREG platform, extended library, append-only binary log archive.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "aregextend/db/LogArchiveDatabase.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/NEService.hpp"
+
+namespace
+{
+    //! The magic number of the archive index file, 'ALGA'.
+    constexpr uint32_t  ARCHIVE_MAGIC   { 0x41474C41u };
+
+    //! The version of the archive format.
+    constexpr uint32_t  ARCHIVE_VERSION { 1u };
+
+    //! The alignment of the records in the block.
+    constexpr uint32_t  RECORD_ALIGN    { 8u };
+
+    //! The number of bits in the word of the bitmap.
+    constexpr uint32_t  BITMAP_BITS     { 64u };
+
+    //! The size of the string buffer to generate a message.
+    constexpr uint32_t  MSG_LEN         { 512 };
+
+    //! Returns the length of the text, which is not longer than the size of the buffer.
+    inline uint32_t _textLength(uint32_t length, uint32_t space)
+    {
+        return (length < space ? length : space - 1u);
+    }
+
+    //! Writes the data in the file and returns true if all data is written.
+    inline bool _writeData(File & file, const void * data, uint32_t size)
+    {
+        return ((size == 0) || (file.write(reinterpret_cast<const unsigned char *>(data), size) == size));
+    }
+
+    //! Reads the data from the file and returns true if all data is read.
+    inline bool _readData(File & file, void * data, uint32_t size)
+    {
+        return ((size == 0) || (file.read(reinterpret_cast<unsigned char *>(data), size) == size));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// LogArchiveDatabase class implementation.
+//////////////////////////////////////////////////////////////////////////
+
+LogArchiveDatabase::LogArchiveDatabase(void)
+    : IELogDatabaseEngine   ( )
+
+    , mArchivePath          ( )
+    , mSegment              ( )
+    , mIsInitialized        ( false )
+    , mReadOnly             ( false )
+    , mDbLogEnabled         ( true )
+    , mBlockSize            ( DEFAULT_BLOCK_SIZE )
+    , mSegmentSize          ( DEFAULT_SEGMENT_SIZE )
+    , mSegmentNr            ( 0u )
+    , mSegmentUsed          ( 0u )
+    , mBlock                ( )
+    , mBlockUsed            ( 0u )
+    , mBlockEntry           ( )
+    , mBlocks               ( )
+    , mSources              ( )
+    , mScopes               ( )
+    , mLogsWritten          ( 0u )
+    , mMapped               ( )
+    , mLock                 ( false )
+{
+}
+
+LogArchiveDatabase::~LogArchiveDatabase(void)
+{
+    disconnect();
+}
+
+void LogArchiveDatabase::setArchiveParameters(uint32_t blockSize, uint32_t segmentSize)
+{
+    constexpr uint32_t minBlock{ static_cast<uint32_t>(sizeof(sArchiveRecord)) + NETrace::LOG_MESSAGE_IZE + 2u * NETrace::LOG_NAMES_SIZE };
+    mBlockSize      = MACRO_MAX(blockSize, minBlock);
+    mSegmentSize    = MACRO_MAX(segmentSize, mBlockSize);
+}
+
+void LogArchiveDatabase::flushLogs(void)
+{
+    Lock lock(mLock);
+    if (mIsInitialized)
+    {
+        _sealBlock();
+        _saveIndex();
+    }
+}
+
+bool LogArchiveDatabase::openArchive(const String & filePath)
+{
+    Lock lock(mLock);
+    if (mIsInitialized)
+        return false;
+
+    _close();
+    mArchivePath = File::normalizePath(filePath);
+    mReadOnly = _loadIndex();
+    if (mReadOnly == false)
+    {
+        _close();
+    }
+
+    return mReadOnly;
+}
+
+uint32_t LogArchiveDatabase::queryScopeLogs(const ITEM_ID & cookie, uint32_t scopeId, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount) const
+{
+    Lock lock(mLock);
+    const uint32_t start{ result.getSize() };
+    if ((mIsInitialized == false) && (mReadOnly == false))
+        return 0u;
+
+    const uint32_t limit{ maxCount > (0xFFFFFFFFu - start) ? 0xFFFFFFFFu : start + maxCount };
+    const BlockBitmap * srcBits{ nullptr };
+    const BlockBitmap * scopeBits{ nullptr };
+    if (cookie != NEService::COOKIE_ANY)
+    {
+        MapSources::MAPPOS pos = mSources.find(cookie);
+        if (mSources.isValidPosition(pos) == false)
+            return 0u;
+
+        srcBits = &mSources.valueAtPosition(pos);
+    }
+
+    if (scopeId != ANY_SCOPE)
+    {
+        MapScopes::MAPPOS pos = mScopes.find(scopeId);
+        if (mScopes.isValidPosition(pos) == false)
+            return 0u;
+
+        scopeBits = &mScopes.valueAtPosition(pos);
+    }
+
+    bool hasSpace{ limit > start };
+    const uint32_t count{ mBlocks.getSize() };
+    for (uint32_t i = _firstBlock(timeBegin); hasSpace && (i < count); ++ i)
+    {
+        if ((srcBits != nullptr) && (_hasBit(*srcBits, i) == false))
+        {
+            // skip the rest of the bitmap word if there are no more blocks of the source.
+            const uint32_t word{ i / BITMAP_BITS };
+            if (word >= srcBits->size())
+                break;
+
+            if (((*srcBits)[word] >> (i % BITMAP_BITS)) == 0u)
+            {
+                i = (word + 1u) * BITMAP_BITS - 1u;
+            }
+
+            continue;
+        }
+
+        if ((scopeBits != nullptr) && (_hasBit(*scopeBits, i) == false))
+            continue;
+
+        const sArchiveBlock & block{ mBlocks[i] };
+        if ((block.abTimeLast < timeBegin) || (block.abTimeFirst > timeEnd))
+            continue;
+
+        const unsigned char * data{ _blockData(block) };
+        if (data != nullptr)
+        {
+            hasSpace = _queryBlock(data, block.abSize, cookie, scopeId, timeBegin, timeEnd, result, limit);
+        }
+    }
+
+    // the messages of the current block are not written yet.
+    if (hasSpace && (mBlockUsed != 0u))
+    {
+        if (((srcBits  == nullptr) || _hasBit(*srcBits, count))   &&
+            ((scopeBits == nullptr) || _hasBit(*scopeBits, count)) &&
+            (mBlockEntry.abTimeLast >= timeBegin) && (mBlockEntry.abTimeFirst <= timeEnd))
+        {
+            _queryBlock(mBlock.data(), mBlockUsed, cookie, scopeId, timeBegin, timeEnd, result, limit);
+        }
+    }
+
+    return (result.getSize() - start);
+}
+
+bool LogArchiveDatabase::isOperable(void) const
+{
+    return (mIsInitialized || mReadOnly);
+}
+
+bool LogArchiveDatabase::connect(const String & dbPath)
+{
+    Lock lock(mLock);
+    if (mIsInitialized || (mDbLogEnabled == false))
+        return mIsInitialized;
+
+    _close();
+    mArchivePath = dbPath.isEmpty() == false ? File::normalizePath(dbPath) : mArchivePath;
+    String folder = File::getFileDirectory(mArchivePath);
+    if ((folder.isEmpty() == false) && (File::existDir(folder) == false))
+    {
+        File::createDirCascaded(folder);
+    }
+
+    mBlock.resize(mBlockSize);
+    mSegmentNr  = 0u;
+    mLogsWritten= 0u;
+    if (_openSegment())
+    {
+        mIsInitialized = true;
+        _appendRecord("Starting archive logging...", DateTime::getNow().getTime());
+        _saveIndex();
+    }
+
+    return mIsInitialized;
+}
+
+void LogArchiveDatabase::disconnect(void)
+{
+    Lock lock(mLock);
+    if (mIsInitialized)
+    {
+        _appendRecord("Closing archive logging...", DateTime::getNow().getTime());
+        _sealBlock();
+        _saveIndex();
+    }
+
+    _close();
+}
+
+bool LogArchiveDatabase::execute(const String & /*sql*/)
+{
+    return false;
+}
+
+bool LogArchiveDatabase::begin(void)
+{
+    return mIsInitialized;
+}
+
+bool LogArchiveDatabase::commit(bool /*doCommit*/)
+{
+    return mIsInitialized;
+}
+
+bool LogArchiveDatabase::tablesInitialized(void) const
+{
+    return mIsInitialized;
+}
+
+bool LogArchiveDatabase::logMessage(const NETrace::sLogMessage & message, const DateTime & timestamp)
+{
+    Lock lock(mLock);
+    return (mIsInitialized ? _appendRecord(message, timestamp.getTime()) : false);
+}
+
+bool LogArchiveDatabase::logInstanceConnected(const NEService::sServiceConnectedInstance & instance, const DateTime & timestamp)
+{
+    char msg[MSG_LEN];
+    String::formatString( msg, MSG_LEN, "The %u-bit instance [ %s ] with cookie [ %llu ] is connected at time [ %s ]"
+                        , static_cast<uint32_t>(instance.ciBitness)
+                        , instance.ciInstance.getString()
+                        , static_cast<uint64_t>(instance.ciCookie)
+                        , timestamp.formatTime().getString());
+
+    Lock lock(mLock);
+    return (mIsInitialized ? _appendRecord(msg, timestamp.getTime()) : false);
+}
+
+bool LogArchiveDatabase::logInstanceDisconnected(const ITEM_ID & cookie, const DateTime & timestamp)
+{
+    char msg[MSG_LEN];
+    String::formatString( msg, MSG_LEN, "The instance with cookie [ %llu ] is disconnected at time [ %s ]"
+                        , static_cast<uint64_t>(cookie)
+                        , timestamp.formatTime().getString());
+
+    Lock lock(mLock);
+    return (mIsInitialized ? _appendRecord(msg, timestamp.getTime()) : false);
+}
+
+bool LogArchiveDatabase::logScopeActivate(const NETrace::sScopeInfo & /*scope*/, const ITEM_ID & /*cookie*/, const DateTime & /*timestamp*/)
+{
+    return mIsInitialized;
+}
+
+bool LogArchiveDatabase::logScopeActivate(const String & /*scopeName*/, uint32_t /*scopeId*/, uint32_t /*scopePrio*/, const ITEM_ID & /*cookie*/, const DateTime & /*timestamp*/)
+{
+    return mIsInitialized;
+}
+
+uint32_t LogArchiveDatabase::logScopesActivate(const NETrace::ScopeNames & scopes, const ITEM_ID & /*cookie*/, const DateTime & /*timestamp*/)
+{
+    return (mIsInitialized ? scopes.getSize() : 0u);
+}
+
+bool LogArchiveDatabase::logScopesDeactivate(const ITEM_ID & /*cookie*/, const DateTime & /*timestamp*/)
+{
+    return mIsInitialized;
+}
+
+bool LogArchiveDatabase::logScopeDeactivate(const ITEM_ID & /*cookie*/, unsigned int /*scopeId*/, const DateTime & /*timestamp*/)
+{
+    return mIsInitialized;
+}
+
+uint32_t LogArchiveDatabase::queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount)
+{
+    return queryScopeLogs(cookie, ANY_SCOPE, timeBegin, timeEnd, result, maxCount);
+}
+
+void LogArchiveDatabase::_close(void)
+{
+    mSegment.close();
+    _unmapSegments();
+
+    mIsInitialized  = false;
+    mReadOnly       = false;
+    mSegmentNr      = 0u;
+    mSegmentUsed    = 0u;
+    mBlockUsed      = 0u;
+    mBlockEntry     = sArchiveBlock{ };
+    mBlocks.clear();
+    mSources.clear();
+    mScopes.clear();
+}
+
+bool LogArchiveDatabase::_openSegment(void)
+{
+    mSegment.close();
+    mSegmentUsed = 0u;
+    return mSegment.open(_segmentPath(mSegmentNr), FileBase::FO_MODE_WRITE | FileBase::FO_MODE_BINARY | FileBase::FO_MODE_CREATE | FileBase::FO_MODE_TRUNCATE);
+}
+
+inline String LogArchiveDatabase::_segmentPath(uint32_t segment) const
+{
+    String result(mArchivePath);
+    result.append(".").append(String::makeString(segment));
+    return result;
+}
+
+bool LogArchiveDatabase::_appendRecord(const NETrace::sLogMessage & message, const TIME64 & received)
+{
+    const uint32_t msgLen   { _textLength(message.logMessageLen, NETrace::LOG_MESSAGE_IZE) };
+    const uint32_t threadLen{ _textLength(message.logThreadLen , NETrace::LOG_NAMES_SIZE) };
+    const uint32_t moduleLen{ _textLength(message.logModuleLen , NETrace::LOG_NAMES_SIZE) };
+    uint32_t size{ static_cast<uint32_t>(sizeof(sArchiveRecord)) + msgLen + threadLen + moduleLen };
+    size = (size + RECORD_ALIGN - 1u) & ~(RECORD_ALIGN - 1u);
+
+    if ((mBlockUsed + size > mBlockSize) && (_sealBlock() == false))
+        return false;
+
+    unsigned char * data{ mBlock.data() + mBlockUsed };
+    sArchiveRecord * record{ reinterpret_cast<sArchiveRecord *>(data) };
+    record->arSize      = size;
+    record->arScopeId   = message.logScopeId;
+    record->arMessageLen= static_cast<uint16_t>(msgLen);
+    record->arThreadLen = static_cast<uint8_t>(threadLen);
+    record->arModuleLen = static_cast<uint8_t>(moduleLen);
+    record->arMsgType   = static_cast<uint8_t>(message.logMsgType);
+    record->arReserved  = 0u;
+    record->arPrio      = static_cast<uint16_t>(message.logMessagePrio);
+    record->arTimestamp = message.logTimestamp;
+    record->arReceived  = received;
+    record->arCookie    = message.logCookie;
+    record->arModuleId  = message.logModuleId;
+    record->arThreadId  = message.logThreadId;
+
+    unsigned char * text{ data + sizeof(sArchiveRecord) };
+    NEMemory::memCopy(text, msgLen, message.logMessage, msgLen);
+    text += msgLen;
+    NEMemory::memCopy(text, threadLen, message.logThread, threadLen);
+    text += threadLen;
+    NEMemory::memCopy(text, moduleLen, message.logModule, moduleLen);
+    text += moduleLen;
+    NEMemory::memZero(text, static_cast<uint32_t>(data + size - text));
+
+    if (mBlockEntry.abCount == 0u)
+    {
+        mBlockEntry.abTimeFirst = message.logTimestamp;
+        mBlockEntry.abTimeLast  = message.logTimestamp;
+    }
+    else
+    {
+        mBlockEntry.abTimeFirst = MACRO_MIN(mBlockEntry.abTimeFirst, message.logTimestamp);
+        mBlockEntry.abTimeLast  = MACRO_MAX(mBlockEntry.abTimeLast , message.logTimestamp);
+    }
+
+    const uint32_t block{ mBlocks.getSize() };
+    _setBit(mSources[message.logCookie], block);
+    _setBit(mScopes[message.logScopeId], block);
+
+    ++ mBlockEntry.abCount;
+    mBlockUsed += size;
+    ++ mLogsWritten;
+    return true;
+}
+
+bool LogArchiveDatabase::_appendRecord(const char * message, const TIME64 & timestamp)
+{
+    Process& proc{ Process::getInstance() };
+    id_type threadId{ Thread::getCurrentThreadId() };
+
+    NETrace::sLogMessage logMsg(NETrace::eLogMessageType::LogMessageText);
+    logMsg.logCookie        = NEService::COOKIE_LOCAL;
+    logMsg.logScopeId       = static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE);
+    logMsg.logMessagePrio   = NETrace::eLogPriority::PrioIgnore;
+    logMsg.logModuleId      = proc.getId();
+    logMsg.logThreadId      = threadId;
+    logMsg.logTimestamp     = timestamp;
+    logMsg.logMessageLen    = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logMessage, NETrace::LOG_MESSAGE_IZE, message));
+    logMsg.logThreadLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logThread, NETrace::LOG_NAMES_SIZE, Thread::getThreadName(threadId).getString()));
+    logMsg.logModuleLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logModule, NETrace::LOG_NAMES_SIZE, proc.getAppName().getString()));
+
+    return _appendRecord(logMsg, timestamp);
+}
+
+bool LogArchiveDatabase::_sealBlock(void)
+{
+    if (mBlockUsed == 0u)
+        return true;
+
+    if ((mSegmentUsed != 0u) && (mSegmentUsed + mBlockUsed > mSegmentSize))
+    {
+        // the segment is complete, save the index to be able to read it.
+        _saveIndex();
+        ++ mSegmentNr;
+        if (_openSegment() == false)
+            return false;
+    }
+
+    if ((mSegment.isOpened() == false) || (_writeData(mSegment, mBlock.data(), mBlockUsed) == false))
+        return false;
+
+    const TIME64 upper{ mBlocks.isEmpty() ? mBlockEntry.abTimeLast : MACRO_MAX(mBlocks[mBlocks.getSize() - 1u].abTimeUpper, mBlockEntry.abTimeLast) };
+    mBlockEntry.abSegment   = mSegmentNr;
+    mBlockEntry.abOffset    = mSegmentUsed;
+    mBlockEntry.abSize      = mBlockUsed;
+    mBlockEntry.abTimeUpper = upper;
+    mBlocks.add(mBlockEntry);
+
+    mSegmentUsed   += mBlockUsed;
+    mBlockUsed      = 0u;
+    mBlockEntry     = sArchiveBlock{ };
+    return true;
+}
+
+bool LogArchiveDatabase::_saveIndex(void)
+{
+    File file;
+    if (file.open(mArchivePath, FileBase::FO_MODE_WRITE | FileBase::FO_MODE_BINARY | FileBase::FO_MODE_CREATE | FileBase::FO_MODE_TRUNCATE) == false)
+        return false;
+
+    sArchiveHeader header{ };
+    header.ahMagic      = ARCHIVE_MAGIC;
+    header.ahVersion    = ARCHIVE_VERSION;
+    header.ahSegments   = mSegmentNr + 1u;
+    header.ahBlocks     = mBlocks.getSize();
+    header.ahSources    = mSources.getSize();
+    header.ahScopes     = mScopes.getSize();
+    header.ahLogs       = mLogsWritten;
+
+    // the bitmaps may contain the bit of the current block, which is not written yet.
+    // It is harmless, since the queries check the blocks by index.
+    bool result{ _writeData(file, &header, sizeof(sArchiveHeader)) };
+    result = result && _writeData(file, mBlocks.getValues(), mBlocks.getSize() * static_cast<uint32_t>(sizeof(sArchiveBlock)));
+
+    for (MapSources::MAPPOS pos = mSources.firstPosition(); result && mSources.isValidPosition(pos); pos = mSources.nextPosition(pos))
+    {
+        const ITEM_ID & cookie{ mSources.keyAtPosition(pos) };
+        const BlockBitmap & bitmap{ mSources.valueAtPosition(pos) };
+        const uint32_t words{ static_cast<uint32_t>(bitmap.size()) };
+        result = _writeData(file, &cookie, sizeof(ITEM_ID)) && _writeData(file, &words, sizeof(uint32_t)) && _writeData(file, bitmap.data(), words * static_cast<uint32_t>(sizeof(uint64_t)));
+    }
+
+    for (MapScopes::MAPPOS pos = mScopes.firstPosition(); result && mScopes.isValidPosition(pos); pos = mScopes.nextPosition(pos))
+    {
+        const uint32_t & scopeId{ mScopes.keyAtPosition(pos) };
+        const BlockBitmap & bitmap{ mScopes.valueAtPosition(pos) };
+        const uint32_t words{ static_cast<uint32_t>(bitmap.size()) };
+        result = _writeData(file, &scopeId, sizeof(uint32_t)) && _writeData(file, &words, sizeof(uint32_t)) && _writeData(file, bitmap.data(), words * static_cast<uint32_t>(sizeof(uint64_t)));
+    }
+
+    file.close();
+    return result;
+}
+
+bool LogArchiveDatabase::_loadIndex(void)
+{
+    File file;
+    if (file.open(mArchivePath, FileBase::FO_MODE_READ | FileBase::FO_MODE_BINARY | FileBase::FO_MODE_EXIST) == false)
+        return false;
+
+    sArchiveHeader header{ };
+    if ((_readData(file, &header, sizeof(sArchiveHeader)) == false) || (header.ahMagic != ARCHIVE_MAGIC) || (header.ahVersion != ARCHIVE_VERSION))
+        return false;
+
+    mBlocks.resize(header.ahBlocks);
+    bool result{ header.ahBlocks == 0u ? true : _readData(file, &mBlocks[0], header.ahBlocks * static_cast<uint32_t>(sizeof(sArchiveBlock))) };
+
+    for (uint32_t i = 0; result && (i < header.ahSources); ++ i)
+    {
+        ITEM_ID cookie{ 0u };
+        uint32_t words{ 0u };
+        result = _readData(file, &cookie, sizeof(ITEM_ID)) && _readData(file, &words, sizeof(uint32_t));
+        if (result)
+        {
+            BlockBitmap & bitmap{ mSources[cookie] };
+            bitmap.resize(words);
+            result = _readData(file, bitmap.data(), words * static_cast<uint32_t>(sizeof(uint64_t)));
+        }
+    }
+
+    for (uint32_t i = 0; result && (i < header.ahScopes); ++ i)
+    {
+        uint32_t scopeId{ 0u };
+        uint32_t words{ 0u };
+        result = _readData(file, &scopeId, sizeof(uint32_t)) && _readData(file, &words, sizeof(uint32_t));
+        if (result)
+        {
+            BlockBitmap & bitmap{ mScopes[scopeId] };
+            bitmap.resize(words);
+            result = _readData(file, bitmap.data(), words * static_cast<uint32_t>(sizeof(uint64_t)));
+        }
+    }
+
+    mSegmentNr  = header.ahSegments != 0u ? header.ahSegments - 1u : 0u;
+    mLogsWritten= header.ahLogs;
+    file.close();
+    return result;
+}
+
+const unsigned char * LogArchiveDatabase::_blockData(const sArchiveBlock & block) const
+{
+    if (mMapped.getSize() <= block.abSegment)
+    {
+        mMapped.resize(block.abSegment + 1u);
+    }
+
+    sMappedSegment & segment{ mMapped[block.abSegment] };
+    const uint64_t blockEnd{ static_cast<uint64_t>(block.abOffset) + block.abSize };
+    if ((segment.msData == nullptr) || (segment.msSize < blockEnd))
+    {
+        // the segment is not mapped yet, or it was mapped before the block was written.
+        if (segment.msData != nullptr)
+        {
+            _osUnmapSegment(segment.msData, segment.msSize);
+        }
+
+        segment.msSize = 0u;
+        segment.msData = _osMapSegment(_segmentPath(block.abSegment), segment.msSize);
+    }
+
+    return ((segment.msData != nullptr) && (segment.msSize >= blockEnd) ? segment.msData + block.abOffset : nullptr);
+}
+
+void LogArchiveDatabase::_unmapSegments(void) const
+{
+    for (uint32_t i = 0; i < mMapped.getSize(); ++ i)
+    {
+        const sMappedSegment & segment{ mMapped[i] };
+        if (segment.msData != nullptr)
+        {
+            _osUnmapSegment(segment.msData, segment.msSize);
+        }
+    }
+
+    mMapped.clear();
+}
+
+bool LogArchiveDatabase::_queryBlock(const unsigned char * data, uint32_t size, const ITEM_ID & cookie, uint32_t scopeId, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount)
+{
+    uint32_t pos{ 0u };
+    while ((pos + sizeof(sArchiveRecord) <= size) && (result.getSize() < maxCount))
+    {
+        const sArchiveRecord & record{ *reinterpret_cast<const sArchiveRecord *>(data + pos) };
+        if ((record.arSize < sizeof(sArchiveRecord)) || (pos + record.arSize > size))
+            break;
+
+        pos += record.arSize;
+        if ((record.arTimestamp < timeBegin) || (record.arTimestamp > timeEnd))
+            continue;
+        if ((cookie != NEService::COOKIE_ANY) && (record.arCookie != cookie))
+            continue;
+        if ((scopeId != ANY_SCOPE) && (record.arScopeId != scopeId))
+            continue;
+
+        NETrace::sLogMessage logMsg(static_cast<NETrace::eLogMessageType>(record.arMsgType));
+        logMsg.logDataType      = NETrace::eLogDataType::LogDataRemote;
+        logMsg.logMessagePrio   = static_cast<NETrace::eLogPriority>(record.arPrio);
+        logMsg.logSource        = record.arCookie;
+        logMsg.logCookie        = record.arCookie;
+        logMsg.logModuleId      = record.arModuleId;
+        logMsg.logThreadId      = record.arThreadId;
+        logMsg.logTimestamp     = record.arTimestamp;
+        logMsg.logScopeId       = record.arScopeId;
+
+        const char * text{ reinterpret_cast<const char *>(&record + 1) };
+        logMsg.logMessageLen    = record.arMessageLen;
+        NEMemory::memCopy(logMsg.logMessage, NETrace::LOG_MESSAGE_IZE, text, record.arMessageLen);
+        logMsg.logMessage[record.arMessageLen] = String::EmptyChar;
+        text += record.arMessageLen;
+
+        logMsg.logThreadLen     = record.arThreadLen;
+        NEMemory::memCopy(logMsg.logThread, NETrace::LOG_NAMES_SIZE, text, record.arThreadLen);
+        logMsg.logThread[record.arThreadLen] = String::EmptyChar;
+        text += record.arThreadLen;
+
+        logMsg.logModuleLen     = record.arModuleLen;
+        NEMemory::memCopy(logMsg.logModule, NETrace::LOG_NAMES_SIZE, text, record.arModuleLen);
+        logMsg.logModule[record.arModuleLen] = String::EmptyChar;
+
+        result.add(logMsg);
+    }
+
+    return (result.getSize() < maxCount);
+}
+
+inline void LogArchiveDatabase::_setBit(BlockBitmap & bitmap, uint32_t block)
+{
+    const uint32_t word{ block / BITMAP_BITS };
+    if (bitmap.size() <= word)
+    {
+        bitmap.resize(word + 1u, 0u);
+    }
+
+    bitmap[word] |= (static_cast<uint64_t>(1u) << (block % BITMAP_BITS));
+}
+
+inline bool LogArchiveDatabase::_hasBit(const BlockBitmap & bitmap, uint32_t block)
+{
+    const uint32_t word{ block / BITMAP_BITS };
+    return ((word < bitmap.size()) && ((bitmap[word] & (static_cast<uint64_t>(1u) << (block % BITMAP_BITS))) != 0u));
+}
+
+inline uint32_t LogArchiveDatabase::_firstBlock(const TIME64 & timeBegin) const
+{
+    // the upper timestamps of the blocks do not decrease, find the first block,
+    // which upper timestamp is not earlier than the beginning of the time range.
+    uint32_t first{ 0u };
+    uint32_t last{ mBlocks.getSize() };
+    while (first < last)
+    {
+        const uint32_t middle{ first + (last - first) / 2u };
+        if (mBlocks[middle].abTimeUpper < timeBegin)
+        {
+            first = middle + 1u;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return first;
+}
@@ -26,6 +26,8 @@
 #include "areg/trace/NETrace.hpp"
 #include "areg/trace/private/NELogging.hpp"
 
+#include <atomic>
+
 #if defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
     #include <sqlite3.h>
 #else   // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
@@ -53,11 +55,11 @@ namespace
             ");"
     };
 
-    //! A string format to generate INSERT statement to insert a new entry in the version.
+    //! The SQL statement with parameters to insert a new entry in the version.
     //! Normally, this is the only entry in the version table.
-    constexpr std::string_view  _fmtVersion
+    constexpr std::string_view  _sqlInsertVersion
     {
-        "INSERT INTO version (name, version, describe, created_by, db_name, time_created) VALUES (\'%s\', \'%s\', \'%s\', \'%s\', \'%s\', %llu);"
+        "INSERT INTO version (name, version, describe, created_by, db_name, time_created) VALUES (?1, ?2, ?3, ?4, ?5, ?6);"
     };
 
     //! A string format to generate UPDATE state to change entry in the version table.
@@ -85,16 +87,16 @@ namespace
             ");"
     };
 
-    //! A string format to generate INSERT statement to insert a new entry in the instances table.
+    //! The SQL statement with parameters to insert a new entry in the instances table.
     //! It is called when a new log source instance is connecting to the log collector service.
     //! Each entry is a logging source process with unique cookie ID and the field indicating
     //! when the instance was connected or disconnected.
-    constexpr std::string_view _fmtInstance
+    constexpr std::string_view _sqlInsertInstance
     {
         "INSERT INTO instances "
         "(cookie_id, inst_connect, inst_type, inst_bits, inst_name, inst_location, time_connected, time_updated) "
         "VALUES "
-        "(%llu, 1, %u, %u, \'%s\', \'%s\', %llu, %llu);"
+        "(?1, 1, ?2, ?3, ?4, ?5, ?6, ?7);"
     };
 
     //! A string format to generate UPDATE statement to update instance entry.
@@ -132,11 +134,11 @@ namespace
             ");"
     };
 
-    //! A string format to generate INSERT statement to insert an information about scope.
+    //! The SQL statement with parameters to insert an information about scope.
     //! It is called when registering or updating scope list of the connected application.
-    constexpr std::string_view _fmtScopes
+    constexpr std::string_view _sqlInsertScope
     {
-        "INSERT INTO scopes (scope_id, cookie_id, scope_is_active, scope_prio, scope_name, time_received)  VALUES (%u, %llu, 1, %u, \'%s\', %llu);"
+        "INSERT INTO scopes (scope_id, cookie_id, scope_is_active, scope_prio, scope_name, time_received)  VALUES (?1, ?2, 1, ?3, ?4, ?5);"
     };
 
     //! A string format to generate UPDATE statement to update the scope state of a connected instance.
@@ -180,13 +182,28 @@ namespace
             ");"
     };
 
-    //! A string format to create INSERT statement to insert new log message in the logs table.
-    constexpr std::string_view _fmtLog
+    //! The SQL statement with parameters to insert new log message in the logs table.
+    //! The statement is prepared once and the parameters are bound for every log message.
+    constexpr std::string_view _sqlInsertLog
     {
         "INSERT INTO logs "
         "(cookie_id, scope_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received)"
         "VALUES "
-        "(%llu, %u, %u, %u, %llu, %llu, \'%s\', \'%s\', \'%s\', %llu, %llu);"
+        "(?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10, ?11);"
+    };
+
+    //! The SQL statement with parameters to select the log messages of the source created within the time range.
+    constexpr std::string_view _sqlSelectLogs
+    {
+        "SELECT cookie_id, scope_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created "
+        "FROM logs WHERE cookie_id = ?1 AND time_created BETWEEN ?2 AND ?3 ORDER BY id LIMIT ?4;"
+    };
+
+    //! The SQL statement with parameters to select the log messages of all sources created within the time range.
+    constexpr std::string_view _sqlSelectAllLogs
+    {
+        "SELECT cookie_id, scope_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created "
+        "FROM logs WHERE time_created BETWEEN ?2 AND ?3 ORDER BY id LIMIT ?4;"
     };
 
     //! A script to create index of the instances table. 
@@ -213,8 +230,36 @@ namespace
     //! The size of the string buffer to format SQL scripts
     constexpr uint32_t  SQL_LEN     { 768 };
 
-    //! The size of the string buffer to format SQL script to insert a log.
-    constexpr uint32_t  SQL_LEN_MAX { 1024 };
+    //! Sets the write-ahead log journal mode.
+    constexpr std::string_view  _sqlJournalWal      { "PRAGMA journal_mode=WAL;" };
+
+    //! Sets the normal synchronous mode.
+    constexpr std::string_view  _sqlSyncNormal      { "PRAGMA synchronous=NORMAL;" };
+
+    //! The prefix of the name of the writer thread.
+    constexpr std::string_view  _writerThreadName   { "_AREG_LOGDB_WRITER_" };
+
+    //! Generates unique name of the writer thread.
+    String _generateWriterName(void)
+    {
+        static std::atomic_uint _count{ 0u };
+        String result(_writerThreadName);
+        result.append(String::makeString(static_cast<uint32_t>(++ _count)));
+        return result;
+    }
+
+    //! Copies the text of the column to the buffer and returns the length of the copied text.
+    inline uint32_t _columnText(sqlite3_stmt* stmt, int column, char* buffer, uint32_t space)
+    {
+        const char* text{ reinterpret_cast<const char*>(::sqlite3_column_text(stmt, column)) };
+        return static_cast<uint32_t>(NEString::copyString<char, char>(buffer, static_cast<NEString::CharCount>(space), text != nullptr ? text : ""));
+    }
+
+    //! Binds the text parameter. The text should be valid until the statement is executed.
+    inline void _bindText(sqlite3_stmt* stmt, int index, const char* text)
+    {
+        ::sqlite3_bind_text(stmt, index, text != nullptr ? text : "", -1, SQLITE_STATIC);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -228,11 +273,28 @@ LogSqliteDatabase::LogSqliteDatabase(void)
     , mDbObject             ( nullptr )
     , mIsInitialized        ( false )
     , mDbLogEnabled         ( true )
+    , mStmtLog              ( nullptr )
+    , mStmtScope            ( nullptr )
+    , mStmtInstance         ( nullptr )
+    , mWalMode              ( true )
+    , mSyncNormal           ( true )
+    , mBatchSize            ( DEFAULT_BATCH_SIZE )
+    , mBatchTimeout         ( DEFAULT_BATCH_TIMEOUT )
+    , mLogsWritten          ( 0u )
+
+    , mWriterThread         ( static_cast<IEThreadConsumer &>(self()), _generateWriterName() )
+    , mQueue                ( DEFAULT_BATCH_SIZE )
+    , mWriting              ( DEFAULT_BATCH_SIZE )
+    , mEventWrite           ( true, true )
+    , mWriterExit           ( false )
+    , mQueueLock            ( false )
+    , mDbLock               ( false )
 {
 }
 
 LogSqliteDatabase::~LogSqliteDatabase(void)
 {
+    _stopWriter();
     _close();
 }
 
@@ -261,6 +323,8 @@ inline bool LogSqliteDatabase::_open(const String& dbPath)
 
 inline void LogSqliteDatabase::_close(void)
 {
+    Lock lock(mDbLock);
+    _finalizeStatements();
     if (mDbObject != nullptr)
     {
         ::sqlite3_close(reinterpret_cast<sqlite3*>(mDbObject));
@@ -288,37 +352,85 @@ inline void LogSqliteDatabase::_createIndexes(void)
 
 inline void LogSqliteDatabase::_initialize(void)
 {
-    Process& proc{ Process::getInstance() };
     DateTime now{ DateTime::getNow() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    const String& appName{ Process::getInstance().getName() };
+    const String version(NETrace::LOG_VERSION);
 
-    char sql[SQL_LEN]{};
-    String::formatString( sql, SQL_LEN, _fmtVersion.data()
-                        , Process::getInstance().getName().getString()
-                        , NETrace::LOG_VERSION.data()
-                        , "AREG SDK database logging module. Visit https://aregtech.com for more information."
-                        , "Created by AREG log observer API module."
-                        , mDbPath.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        );
-    VERIFY(_execute(sql));
-
-    String::formatString(sql, SQL_LEN, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , "Starting database logging..."
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint64_t>(now.getTime())
-                        );
-    VERIFY(_execute(sql));
+    sqlite3_stmt* stmt{ nullptr };
+    if (SQLITE_OK == ::sqlite3_prepare_v2(reinterpret_cast<sqlite3*>(mDbObject), _sqlInsertVersion.data(), static_cast<int>(_sqlInsertVersion.length()), &stmt, nullptr))
+    {
+        _bindText(stmt,            1, appName.getString());
+        _bindText(stmt,            2, version.getString());
+        _bindText(stmt,            3, "AREG SDK database logging module. Visit https://aregtech.com for more information.");
+        _bindText(stmt,            4, "Created by AREG log observer API module.");
+        _bindText(stmt,            5, mDbPath.getString());
+        ::sqlite3_bind_int64(stmt, 6, static_cast<sqlite3_int64>(now.getTime()));
+        ::sqlite3_step(stmt);
+        ::sqlite3_finalize(stmt);
+    }
+
+    VERIFY(_insertLog("Starting database logging...", now.getTime()));
+}
+
+inline void LogSqliteDatabase::_setJournalOptions(void)
+{
+    if (mWalMode)
+    {
+        VERIFY(_execute(_sqlJournalWal.data()));
+    }
+
+    if (mSyncNormal)
+    {
+        VERIFY(_execute(_sqlSyncNormal.data()));
+    }
+}
+
+inline bool LogSqliteDatabase::_prepareStatements(void)
+{
+    ASSERT(mDbObject != nullptr);
+    _finalizeStatements();
+
+    sqlite3* db{ reinterpret_cast<sqlite3*>(mDbObject) };
+    sqlite3_stmt* stmtLog{ nullptr };
+    sqlite3_stmt* stmtScope{ nullptr };
+    sqlite3_stmt* stmtInstance{ nullptr };
+    if (SQLITE_OK == ::sqlite3_prepare_v2(db, _sqlInsertLog.data(), static_cast<int>(_sqlInsertLog.length()), &stmtLog, nullptr))
+    {
+        mStmtLog = stmtLog;
+    }
+
+    if (SQLITE_OK == ::sqlite3_prepare_v2(db, _sqlInsertScope.data(), static_cast<int>(_sqlInsertScope.length()), &stmtScope, nullptr))
+    {
+        mStmtScope = stmtScope;
+    }
+
+    if (SQLITE_OK == ::sqlite3_prepare_v2(db, _sqlInsertInstance.data(), static_cast<int>(_sqlInsertInstance.length()), &stmtInstance, nullptr))
+    {
+        mStmtInstance = stmtInstance;
+    }
+
+    return ((mStmtLog != nullptr) && (mStmtScope != nullptr) && (mStmtInstance != nullptr));
+}
+
+inline void LogSqliteDatabase::_finalizeStatements(void)
+{
+    if (mStmtLog != nullptr)
+    {
+        ::sqlite3_finalize(reinterpret_cast<sqlite3_stmt*>(mStmtLog));
+        mStmtLog = nullptr;
+    }
+
+    if (mStmtScope != nullptr)
+    {
+        ::sqlite3_finalize(reinterpret_cast<sqlite3_stmt*>(mStmtScope));
+        mStmtScope = nullptr;
+    }
+
+    if (mStmtInstance != nullptr)
+    {
+        ::sqlite3_finalize(reinterpret_cast<sqlite3_stmt*>(mStmtInstance));
+        mStmtInstance = nullptr;
+    }
 }
 
 inline bool LogSqliteDatabase::_execute(const char* sql)
@@ -332,6 +444,221 @@ inline bool LogSqliteDatabase::_execute(const char* sql)
     return false;
 }
 
+inline bool LogSqliteDatabase::_insertLog(const NETrace::sLogMessage& message, const TIME64& timestamp)
+{
+    sqlite3_stmt* stmt{ reinterpret_cast<sqlite3_stmt*>(mStmtLog) };
+    if (stmt == nullptr)
+        return false;
+
+    ::sqlite3_bind_int64(stmt,  1, static_cast<sqlite3_int64>(message.logCookie));
+    ::sqlite3_bind_int64(stmt,  2, static_cast<sqlite3_int64>(message.logScopeId));
+    ::sqlite3_bind_int(stmt,    3, static_cast<int>(message.logMsgType));
+    ::sqlite3_bind_int(stmt,    4, static_cast<int>(message.logMessagePrio));
+    ::sqlite3_bind_int64(stmt,  5, static_cast<sqlite3_int64>(message.logModuleId));
+    ::sqlite3_bind_int64(stmt,  6, static_cast<sqlite3_int64>(message.logThreadId));
+    _bindText(stmt,             7, message.logMessage);
+    _bindText(stmt,             8, message.logThreadLen != 0 ? message.logThread : nullptr);
+    _bindText(stmt,             9, message.logModuleLen != 0 ? message.logModule : nullptr);
+    ::sqlite3_bind_int64(stmt, 10, static_cast<sqlite3_int64>(message.logTimestamp));
+    ::sqlite3_bind_int64(stmt, 11, static_cast<sqlite3_int64>(timestamp));
+
+    bool result{ ::sqlite3_step(stmt) == SQLITE_DONE };
+    ::sqlite3_reset(stmt);
+    return result;
+}
+
+inline bool LogSqliteDatabase::_insertLog(const char* message, const TIME64& timestamp)
+{
+    return _insertLog(_createLog(message, timestamp), timestamp);
+}
+
+inline NETrace::sLogMessage LogSqliteDatabase::_createLog(const char* message, const TIME64& timestamp) const
+{
+    Process& proc{ Process::getInstance() };
+    id_type threadId{ Thread::getCurrentThreadId() };
+
+    NETrace::sLogMessage logMsg(NETrace::eLogMessageType::LogMessageText);
+    logMsg.logCookie        = NEService::COOKIE_LOCAL;
+    logMsg.logScopeId       = static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE);
+    logMsg.logMessagePrio   = NETrace::eLogPriority::PrioIgnore;
+    logMsg.logModuleId      = proc.getId();
+    logMsg.logThreadId      = threadId;
+    logMsg.logTimestamp     = timestamp;
+    logMsg.logMessageLen    = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logMessage, NETrace::LOG_MESSAGE_IZE, message));
+    logMsg.logThreadLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logThread, NETrace::LOG_NAMES_SIZE, Thread::getThreadName(threadId).getString()));
+    logMsg.logModuleLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logModule, NETrace::LOG_NAMES_SIZE, proc.getAppName().getString()));
+
+    return logMsg;
+}
+
+inline bool LogSqliteDatabase::_insertScope(const char* scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID& cookie, const TIME64& timestamp)
+{
+    sqlite3_stmt* stmt{ reinterpret_cast<sqlite3_stmt*>(mStmtScope) };
+    if (stmt == nullptr)
+        return false;
+
+    ::sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(scopeId));
+    ::sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(cookie));
+    ::sqlite3_bind_int64(stmt, 3, static_cast<sqlite3_int64>(scopePrio));
+    _bindText(stmt,            4, scopeName);
+    ::sqlite3_bind_int64(stmt, 5, static_cast<sqlite3_int64>(timestamp));
+
+    bool result{ ::sqlite3_step(stmt) == SQLITE_DONE };
+    ::sqlite3_reset(stmt);
+    return result;
+}
+
+inline bool LogSqliteDatabase::_insertInstance(const NEService::sServiceConnectedInstance& instance, const TIME64& timestamp)
+{
+    sqlite3_stmt* stmt{ reinterpret_cast<sqlite3_stmt*>(mStmtInstance) };
+    if (stmt == nullptr)
+        return false;
+
+    ::sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(instance.ciCookie));
+    ::sqlite3_bind_int(stmt,   2, static_cast<int>(instance.ciSource));
+    ::sqlite3_bind_int(stmt,   3, static_cast<int>(instance.ciBitness));
+    _bindText(stmt,            4, instance.ciInstance.getString());
+    _bindText(stmt,            5, instance.ciLocation.getString());
+    ::sqlite3_bind_int64(stmt, 6, static_cast<sqlite3_int64>(instance.ciTimestamp));
+    ::sqlite3_bind_int64(stmt, 7, static_cast<sqlite3_int64>(timestamp));
+
+    bool result{ ::sqlite3_step(stmt) == SQLITE_DONE };
+    ::sqlite3_reset(stmt);
+    return result;
+}
+
+inline void LogSqliteDatabase::_queueLog(const char* message, const TIME64& timestamp)
+{
+    _queueEntry(sLogEntry{ eEntryType::EntryLog, _createLog(message, timestamp), timestamp, String(), 0u, 0u, 0u, NEService::sServiceConnectedInstance() });
+}
+
+inline void LogSqliteDatabase::_queueScope(const String& scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID& cookie, const TIME64& timestamp)
+{
+    _queueEntry(sLogEntry{ eEntryType::EntryScope, NETrace::sLogMessage(), timestamp, scopeName, cookie, scopeId, scopePrio, NEService::sServiceConnectedInstance() });
+}
+
+inline void LogSqliteDatabase::_queueSql(const char* sql, const TIME64& timestamp)
+{
+    _queueEntry(sLogEntry{ eEntryType::EntrySql, NETrace::sLogMessage(), timestamp, String(sql), 0u, 0u, 0u, NEService::sServiceConnectedInstance() });
+}
+
+inline void LogSqliteDatabase::_queueInstance(const NEService::sServiceConnectedInstance& instance, const TIME64& timestamp)
+{
+    _queueEntry(sLogEntry{ eEntryType::EntryInstance, NETrace::sLogMessage(), timestamp, String(), instance.ciCookie, 0u, 0u, instance });
+}
+
+inline void LogSqliteDatabase::_queueEntry(const sLogEntry& entry)
+{
+    bool doWrite{ false };
+    do
+    {
+        Lock lock(mQueueLock);
+        mQueue.add(entry);
+        doWrite = mQueue.getSize() >= mBatchSize;
+    } while (false);
+
+    if (doWrite)
+    {
+        mEventWrite.setEvent();
+    }
+}
+
+void LogSqliteDatabase::_writeQueuedLogs(void)
+{
+    // the database lock is taken first to guarantee that the messages
+    // queued before this call are written when the method returns.
+    Lock lock(mDbLock);
+    do
+    {
+        Lock lockQueue(mQueueLock);
+        mWriting = std::move(mQueue);
+        mQueue.clear();
+    } while (false);
+
+    if (mWriting.isEmpty() || (mDbObject == nullptr))
+    {
+        mWriting.clear();
+        return;
+    }
+
+    // if the transaction is started by the caller, do not start a new one.
+    bool ownTransaction{ ::sqlite3_get_autocommit(reinterpret_cast<sqlite3*>(mDbObject)) != 0 };
+    if (ownTransaction)
+    {
+        _execute("BEGIN TRANSACTION;");
+    }
+
+    uint32_t written{ 0u };
+    for (const sLogEntry& entry : mWriting.getData())
+    {
+        switch (entry.leType)
+        {
+        case eEntryType::EntryLog:
+            written += _insertLog(entry.leMessage, entry.leReceived) ? 1u : 0u;
+            break;
+
+        case eEntryType::EntryScope:
+            _insertScope(entry.leText.getString(), entry.leScopeId, entry.leScopePrio, entry.leCookie, entry.leReceived);
+            break;
+
+        case eEntryType::EntryInstance:
+            _insertInstance(entry.leInstance, entry.leReceived);
+            break;
+
+        case eEntryType::EntrySql:
+            _execute(entry.leText.getString());
+            break;
+
+        default:
+            ASSERT(false);
+            break;
+        }
+    }
+
+    if (ownTransaction)
+    {
+        _execute("COMMIT;");
+    }
+
+    mWriting.clear();
+
+    Lock lockQueue(mQueueLock);
+    mLogsWritten += written;
+}
+
+inline void LogSqliteDatabase::_startWriter(void)
+{
+    mWriterExit = false;
+    mEventWrite.resetEvent();
+    mWriterThread.createThread(NECommon::WAIT_INFINITE);
+}
+
+inline void LogSqliteDatabase::_stopWriter(void)
+{
+    if (mWriterThread.isValid())
+    {
+        mWriterExit = true;
+        mEventWrite.setEvent();
+        mWriterThread.shutdownThread(NECommon::WAIT_INFINITE);
+    }
+
+    _writeQueuedLogs();
+}
+
+void LogSqliteDatabase::onThreadRuns(void)
+{
+    while (mWriterExit == false)
+    {
+        mEventWrite.lock(mBatchTimeout);
+        _writeQueuedLogs();
+    }
+}
+
+void LogSqliteDatabase::flushLogs(void)
+{
+    _writeQueuedLogs();
+}
+
 bool LogSqliteDatabase::isOperable(void) const
 {
     return (mDbObject != nullptr);
@@ -342,13 +669,23 @@ bool LogSqliteDatabase::connect(const String& dbPath /*= String::EmptyString*/)
     if (mDbObject == nullptr)
     {
         ASSERT(mIsInitialized == false);
+        Lock lock(mDbLock);
         if (_open(dbPath))
         {
+            _setJournalOptions();
             _createTables();
             _createIndexes();
-            _initialize();
-            commit(true);
-            mIsInitialized = true;
+            if (_prepareStatements())
+            {
+                _initialize();
+                mLogsWritten = 0u;
+                mIsInitialized = true;
+                _startWriter();
+            }
+            else
+            {
+                _close();
+            }
         }
     }
 
@@ -357,32 +694,20 @@ bool LogSqliteDatabase::connect(const String& dbPath /*= String::EmptyString*/)
 
 void LogSqliteDatabase::disconnect(void)
 {
-    Process& proc{ Process::getInstance() };
-    DateTime now{ DateTime::getNow() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    _stopWriter();
 
+    Lock lock(mDbLock);
+    if (mDbObject == nullptr)
+        return;
+
+    DateTime now{ DateTime::getNow() };
     char sql[SQL_LEN]{};
 
     String::formatString( sql, SQL_LEN, _fmtUpdVersion.data()
                         , static_cast<uint64_t>(now.getTime()));
     _execute(sql);
 
-    String::formatString( sql, SQL_LEN, _fmtLog.data()
-                        , NEService::COOKIE_LOCAL
-                        , NEMath::CHECKSUM_IGNORE
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , "Closing database logging..."
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint64_t>(now.getTime())
-                        );
-    _execute(sql);
+    _insertLog("Closing database logging...", now.getTime());
 
     String::formatString( sql, SQL_LEN, _fmtCloseScopes.data()
                         , static_cast<uint64_t>(now.getTime()));
@@ -393,22 +718,38 @@ void LogSqliteDatabase::disconnect(void)
                         , static_cast<uint64_t>(now.getTime()));
     _execute(sql);
 
-    commit(true);
+    if (::sqlite3_get_autocommit(reinterpret_cast<sqlite3*>(mDbObject)) == 0)
+    {
+        _execute("COMMIT;");
+    }
+
     _close();
 }
 
 bool LogSqliteDatabase::execute(const String& sql)
 {
+    // the queued entries are written before, to keep the order.
+    _writeQueuedLogs();
+
+    Lock lock(mDbLock);
     return sql.isEmpty() ? false : _execute(sql.getString());
 }
 
 bool LogSqliteDatabase::begin(void)
 {
+    // the queued entries are written before, to keep the order.
+    _writeQueuedLogs();
+
+    Lock lock(mDbLock);
     return _execute("BEGIN TRANSACTION;");
 }
 
 bool LogSqliteDatabase::commit(bool doCommit)
 {
+    // the queued entries are written before, to keep the order.
+    _writeQueuedLogs();
+
+    Lock lock(mDbLock);
     return _execute(doCommit ? "COMMIT;" : "ROLLBACK;");
 }
 
@@ -419,30 +760,17 @@ bool LogSqliteDatabase::tablesInitialized(void) const
 
 bool LogSqliteDatabase::logMessage(const NETrace::sLogMessage& message, const DateTime& timestamp)
 {
-    char sql[SQL_LEN_MAX];
-    String::formatString(sql, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(message.logCookie)
-                        , static_cast<uint32_t>(message.logScopeId)
-                        , static_cast<uint32_t>(message.logMsgType)
-                        , static_cast<uint32_t>(message.logMessagePrio)
-                        , static_cast<uint64_t>(message.logModuleId)
-                        , static_cast<uint64_t>(message.logThreadId)
-                        , message.logMessage
-                        , message.logThreadLen != 0 ? message.logThread : String::EmptyString
-                        , message.logModuleId  != 0 ? message.logModule : String::EmptyString
-                        , static_cast<uint64_t>(message.logTimestamp)
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
+    if (mIsInitialized == false)
+        return false;
 
-    return _execute(sql);
+    _queueEntry(sLogEntry{ eEntryType::EntryLog, message, timestamp.getTime(), String(), 0u, 0u, 0u, NEService::sServiceConnectedInstance() });
+    return true;
 }
 
 bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedInstance& instance, const DateTime& timestamp)
 {
-    Process& proc{ Process::getInstance() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    if (mIsInitialized == false)
+        return false;
 
     char msg[MSG_LEN];
     String::formatString( msg, MSG_LEN, "The %u-bit instance [ %s ] with cookie [ %llu ] is connected at time [ %s ]"
@@ -451,131 +779,126 @@ bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedI
                         , static_cast<uint64_t>(instance.ciCookie)
                         , timestamp.formatTime().getString());
 
-    char sqlLog[SQL_LEN_MAX];
-    String::formatString( sqlLog, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , msg
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
-
-    char sqlInst[SQL_LEN];
-    String::formatString( sqlInst, SQL_LEN, _fmtInstance.data()
-                        , static_cast<uint64_t>(instance.ciCookie)
-                        , static_cast<uint32_t>(instance.ciSource)
-                        , static_cast<uint32_t>(instance.ciBitness)
-                        , instance.ciInstance.getString()
-                        , instance.ciLocation.getString()
-                        , static_cast<uint64_t>(instance.ciTimestamp)
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
-
-    return (_execute(sqlLog) && _execute(sqlInst));
+    _queueLog(msg, timestamp.getTime());
+    _queueInstance(instance, timestamp.getTime());
+    return true;
 }
 
 bool LogSqliteDatabase::logInstanceDisconnected(const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    logScopesDeactivate(cookie, timestamp);
-
-    Process& proc{ Process::getInstance() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    if (logScopesDeactivate(cookie, timestamp) == false)
+        return false;
 
     char msg[MSG_LEN];
     String::formatString( msg, MSG_LEN, "The instance with cookie [ %llu ] is disconnected at time [ %s ]"
                         , static_cast<uint64_t>(cookie)
                         , timestamp.formatTime().getString());
 
-    char sqlLog[SQL_LEN_MAX];
-    String::formatString( sqlLog, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , msg
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
-
     char sqlInst[SQL_LEN];
     String::formatString( sqlInst, SQL_LEN, _fmtUpdInstance.data()
                         , static_cast<uint64_t>(timestamp.getTime())
                         , static_cast<uint64_t>(DateTime::getNow().getTime())
                         , static_cast<uint64_t>(cookie));
 
-    return (_execute(sqlLog) && _execute(sqlInst));
+    _queueLog(msg, timestamp.getTime());
+    _queueSql(sqlInst, timestamp.getTime());
+    return true;
 }
 
 bool LogSqliteDatabase::logScopeActivate(const NETrace::sScopeInfo & scope, const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    char sql[SQL_LEN];
-    String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                        , static_cast<uint32_t>(scope.scopeId)
-                        , static_cast<uint64_t>(cookie)
-                        , static_cast<uint32_t>(scope.scopePrio)
-                        , scope.scopeName.getString()
-                        , static_cast<uint64_t>(timestamp.getTime()));
-    return _execute(sql);
+    return logScopeActivate(scope.scopeName, scope.scopeId, scope.scopePrio, cookie, timestamp);
 }
 
 uint32_t LogSqliteDatabase::logScopesActivate(const NETrace::ScopeNames& scopes, const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    uint32_t result{ 0 };
-    char sql[SQL_LEN];
+    if (mIsInitialized == false)
+        return 0u;
+
     for (const auto& scope : scopes.getData())
     {
-        String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                            , static_cast<uint32_t>(scope.scopeId)
-                            , static_cast<uint64_t>(cookie)
-                            , static_cast<uint32_t>(scope.scopePrio)
-                            , scope.scopeName.getString()
-                            , static_cast<uint64_t>(timestamp.getTime()));
-        result += _execute(sql) ? 1 : 0;
+        _queueScope(scope.scopeName, scope.scopeId, scope.scopePrio, cookie, timestamp.getTime());
     }
 
-    return result;
+    return scopes.getSize();
 }
 
 bool LogSqliteDatabase::logScopeActivate(const String& scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    char sql[SQL_LEN];
-    String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                        , static_cast<uint32_t>(scopeId)
-                        , static_cast<uint64_t>(cookie)
-                        , static_cast<uint32_t>(scopePrio)
-                        , scopeName.getString()
-                        , static_cast<uint64_t>(timestamp.getTime()));
-    return _execute(sql);
+    if (mIsInitialized == false)
+        return false;
+
+    _queueScope(scopeName, scopeId, scopePrio, cookie, timestamp.getTime());
+    return true;
 }
 
 bool LogSqliteDatabase::logScopesDeactivate(const ITEM_ID& cookie, const DateTime& timestamp)
 {
+    if (mIsInitialized == false)
+        return false;
+
     char sql[SQL_LEN];
     String::formatString( sql, SQL_LEN, _fmtUpdScopes.data()
                         , static_cast<uint64_t>(timestamp.getTime())
                         , static_cast<uint64_t>(cookie));
-    return _execute(sql);
+
+    _queueSql(sql, timestamp.getTime());
+    return true;
 }
 
 bool LogSqliteDatabase::logScopeDeactivate(const ITEM_ID& cookie, unsigned int scopeId, const DateTime& timestamp)
 {
+    if (mIsInitialized == false)
+        return false;
+
     char sql[SQL_LEN];
     String::formatString( sql, SQL_LEN, _fmtUpdScope.data()
                         , static_cast<uint64_t>(timestamp.getTime())
                         , static_cast<uint64_t>(cookie)
                         , static_cast<uint32_t>(scopeId)
                         );
-    return _execute(sql);
+
+    _queueSql(sql, timestamp.getTime());
+    return true;
+}
+
+uint32_t LogSqliteDatabase::queryLogs(const ITEM_ID& cookie, const TIME64& timeBegin, const TIME64& timeEnd, NETrace::LogMessages& OUT result, uint32_t maxCount)
+{
+    _writeQueuedLogs();
+
+    Lock lock(mDbLock);
+    if ((mDbObject == nullptr) || (maxCount == 0u))
+        return 0u;
+
+    const std::string_view& sql{ cookie != NEService::COOKIE_ANY ? _sqlSelectLogs : _sqlSelectAllLogs };
+    sqlite3_stmt* stmt{ nullptr };
+    if (SQLITE_OK != ::sqlite3_prepare_v2(reinterpret_cast<sqlite3*>(mDbObject), sql.data(), static_cast<int>(sql.length()), &stmt, nullptr))
+        return 0u;
+
+    ::sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(cookie));
+    ::sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(timeBegin));
+    ::sqlite3_bind_int64(stmt, 3, static_cast<sqlite3_int64>(timeEnd));
+    ::sqlite3_bind_int64(stmt, 4, static_cast<sqlite3_int64>(maxCount));
+
+    uint32_t count{ 0u };
+    while (::sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        NETrace::sLogMessage logMsg(static_cast<NETrace::eLogMessageType>(::sqlite3_column_int(stmt, 2)));
+        logMsg.logDataType      = NETrace::eLogDataType::LogDataRemote;
+        logMsg.logCookie        = static_cast<ITEM_ID>(::sqlite3_column_int64(stmt, 0));
+        logMsg.logSource        = logMsg.logCookie;
+        logMsg.logScopeId       = static_cast<uint32_t>(::sqlite3_column_int64(stmt, 1));
+        logMsg.logMessagePrio   = static_cast<NETrace::eLogPriority>(::sqlite3_column_int(stmt, 3));
+        logMsg.logModuleId      = static_cast<ITEM_ID>(::sqlite3_column_int64(stmt, 4));
+        logMsg.logThreadId      = static_cast<ITEM_ID>(::sqlite3_column_int64(stmt, 5));
+        logMsg.logMessageLen    = _columnText(stmt, 6, logMsg.logMessage, NETrace::LOG_MESSAGE_IZE);
+        logMsg.logThreadLen     = _columnText(stmt, 7, logMsg.logThread, NETrace::LOG_NAMES_SIZE);
+        logMsg.logModuleLen     = _columnText(stmt, 8, logMsg.logModule, NETrace::LOG_NAMES_SIZE);
+        logMsg.logTimestamp     = static_cast<TIME64>(::sqlite3_column_int64(stmt, 9));
+        result.add(logMsg);
+        ++ count;
+    }
+
+    ::sqlite3_finalize(stmt);
+    return count;
 }
@@ -0,0 +1,66 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        aregextend/db/private/posix/LogArchiveDatabasePosix.cpp
+ * \author      Artak Avetyan
+ * \ingroup     AREG platform, extended library, append-only binary log archive.
+ *              POSIX specific implementation.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "aregextend/db/LogArchiveDatabase.hpp"
+
+#ifdef _POSIX
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//////////////////////////////////////////////////////////////////////////
+// LogArchiveDatabase class POSIX specific implementation
+//////////////////////////////////////////////////////////////////////////
+
+unsigned char * LogArchiveDatabase::_osMapSegment(const String & filePath, uint64_t & OUT size)
+{
+    unsigned char * result{ nullptr };
+    size = 0u;
+
+    int fd = ::open(filePath.getString(), O_RDONLY);
+    if (fd != -1)
+    {
+        struct stat st{};
+        if ((::fstat(fd, &st) == 0) && (st.st_size > 0))
+        {
+            void * data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                result = reinterpret_cast<unsigned char *>(data);
+                size = static_cast<uint64_t>(st.st_size);
+            }
+        }
+
+        // the mapping is valid after closing the file descriptor.
+        ::close(fd);
+    }
+
+    return result;
+}
+
+void LogArchiveDatabase::_osUnmapSegment(unsigned char * data, uint64_t size)
+{
+    if (data != nullptr)
+    {
+        ::munmap(data, static_cast<size_t>(size));
+    }
+}
+
+#endif  // _POSIX
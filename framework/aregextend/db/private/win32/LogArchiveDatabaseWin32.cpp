@@ -0,0 +1,73 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        aregextend/db/private/win32/LogArchiveDatabaseWin32.cpp
+ * \author      Artak Avetyan
+ * \ingroup     AREG platform, extended library, append-only binary log archive.
+ *              Win32 specific implementation.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "aregextend/db/LogArchiveDatabase.hpp"
+
+#ifdef WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+#endif  // WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//////////////////////////////////////////////////////////////////////////
+// LogArchiveDatabase class Win32 specific implementation
+//////////////////////////////////////////////////////////////////////////
+
+unsigned char * LogArchiveDatabase::_osMapSegment(const String & filePath, uint64_t & OUT size)
+{
+    unsigned char * result{ nullptr };
+    size = 0u;
+
+    // the segment can be still opened for writing.
+    HANDLE file = ::CreateFileA(filePath.getString(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER length{};
+        if ((::GetFileSizeEx(file, &length) != FALSE) && (length.QuadPart > 0))
+        {
+            HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                void * data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (data != nullptr)
+                {
+                    result = reinterpret_cast<unsigned char *>(data);
+                    size = static_cast<uint64_t>(length.QuadPart);
+                }
+
+                // the view is valid after closing the mapping and file handles.
+                ::CloseHandle(mapping);
+            }
+        }
+
+        ::CloseHandle(file);
+    }
+
+    return result;
+}
+
+void LogArchiveDatabase::_osUnmapSegment(unsigned char * data, uint64_t /*size*/)
+{
+    if (data != nullptr)
+    {
+        ::UnmapViewOfFile(data);
+    }
+}
+
+#endif  // WINDOWS
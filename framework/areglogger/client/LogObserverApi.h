@@ -131,6 +131,96 @@ struct sLogScope
     char        lsName[LENGTH_SCOPE];
 };
 
+/**
+ * \brief   The structure of the filter of log messages, which the logger service forwards to the observer.
+ *          The log message should match all fields of the filter. The fields set to 0 or empty string match any message.
+ **/
+struct sLogFilter
+{
+    /* The cookie ID of the log source. ID_IGNORE (or 0) matches any log source. */
+    ITEM_ID     lfCookie;
+    /* The first scope ID of the range. If both, the first and the last IDs are 0, matches any scope ID. */
+    uint32_t    lfScopeFirst;
+    /* The last scope ID of the range, inclusive. */
+    uint32_t    lfScopeLast;
+    /* The bitwise set of eLogPriority values of messages. 0 matches any message priority. */
+    uint32_t    lfPriorities;
+    /* The prefix of the scope names. For example, 'areg_base_'. Empty string matches any scope. */
+    char        lfScopePrefix[LENGTH_SCOPE];
+    /* The substring to search in the text of the log message. Empty string matches any message. */
+    char        lfText[LENGTH_MESSAGE];
+};
+
+/**
+ * \brief   The structure of the statistics of dispatched events of one event class and message.
+ *          The time values are in nanoseconds.
+ **/
+struct sLogEventStats
+{
+    /* The ID of the service message. The value is 0xFFFFFFFF if the event is not a service message. */
+    uint32_t    esMessageId;
+    /* The number of dispatched events. */
+    uint64_t    esDispatched;
+    /* The number of events dispatched after their deadline. */
+    uint64_t    esDeadlineMissed;
+    /* The median of the time the events waited in the queue. */
+    uint64_t    esWaitMedian;
+    /* The 99th percentile of the time the events waited in the queue. */
+    uint64_t    esWaitP99;
+    /* The maximum time an event waited in the queue. */
+    uint64_t    esWaitMax;
+    /* The median of the time to process the events. */
+    uint64_t    esRunMedian;
+    /* The 99th percentile of the time to process the events. */
+    uint64_t    esRunP99;
+    /* The maximum time to process an event. */
+    uint64_t    esRunMax;
+    /* The name of the event class. Empty string if the entry collects the events, which did not fit in the table. */
+    char        esName[LENGTH_NAME];
+};
+
+/**
+ * \brief   The structure of the statistics of one dispatcher thread of the log source.
+ *          The time values are in nanoseconds.
+ **/
+struct sLogDispatcherStats
+{
+    /* The name of the dispatcher thread. */
+    char                    dsName[LENGTH_NAME];
+    /* The policy to wait for the events: 0 is blocking, 1 is adaptive spinning, 2 is busy polling. */
+    uint32_t                dsWaitPolicy;
+    /* The number of events in the queue. */
+    uint32_t                dsQueueSize;
+    /* The maximum number of events in the queue. */
+    uint32_t                dsQueuePeak;
+    /* The number of dispatched events. */
+    uint64_t                dsDispatched;
+    /* The number of events, which were not queued, because the dispatcher did not run. */
+    uint64_t                dsDropped;
+    /* The number of events removed from the queue without dispatching. */
+    uint64_t                dsCancelled;
+    /* The number of events dispatched after their deadline. */
+    uint64_t                dsDeadlineMissed;
+    /* The number of queued events replaced by the newer event of the same attribute. */
+    uint64_t                dsCoalesced;
+    /* The median of the time the events waited in the queue. */
+    uint64_t                dsWaitMedian;
+    /* The 99th percentile of the time the events waited in the queue. */
+    uint64_t                dsWaitP99;
+    /* The maximum time an event waited in the queue. */
+    uint64_t                dsWaitMax;
+    /* The median of the time to process the events. */
+    uint64_t                dsRunMedian;
+    /* The 99th percentile of the time to process the events. */
+    uint64_t                dsRunP99;
+    /* The maximum time to process an event. */
+    uint64_t                dsRunMax;
+    /* The number of entries in the list of statistics per event class. */
+    uint32_t                dsEventCount;
+    /* The list of statistics per event class and message. */
+    const sLogEventStats*   dsEvents;
+};
+
 /**
  * \brief   The structure of the logging message.
  **/
@@ -261,6 +351,14 @@ typedef void (*FuncLogMessage)(const sLogMessage * /*logMessage*/);
  **/
 typedef void (*FuncLogMessageEx)(const unsigned char* /*logBuffer*/, uint32_t /*size*/);
 
+/**
+ * \brief   The callback of the event triggered when receive the statistics of the dispatcher threads of an application.
+ *          cookie      The cookie ID of the connected instance / application. Same as sLogInstance::liCookie
+ *          statistics  The list of the statistics of the dispatcher threads.
+ *          count       The number of entries in the list.
+ **/
+typedef void (*FuncLogStatistics)(ITEM_ID /*cookie*/, const sLogDispatcherStats* /*statistics*/, uint32_t /*count*/);
+
 /**
  * \brief   The structure of the callbacks / events to set when send or receive messages.
  **/
@@ -288,6 +386,8 @@ struct sObserverEvents
     FuncLogMessage          evtLogMessage;
     /* The callback to trigger when receive remote message to log. To use, set the 'evtLogMessage' callback null. */
     FuncLogMessageEx        evtLogMessageEx;
+    /* The callback to trigger when receive the statistics of the dispatcher threads. */
+    FuncLogStatistics       evtLogStatistics;
 };
 
 /**
@@ -435,5 +535,39 @@ LOGGER_API bool logObserverRequestChangeScopePrio(ITEM_ID target, const sLogScop
  **/
 LOGGER_API bool logObserverRequestSaveConfig(ITEM_ID target);
 
+/**
+ * \brief   Call to set the filters of log messages. The logger service forwards to the observer
+ *          only the log messages, which match at least one filter in the list.
+ *          The filters replace the filters set before.
+ * \param   filters The list of filters. Can be NULL if count is 0.
+ * \param   count   The number of filter entries in the list. If 0, the logger service
+ *                  removes the filters and forwards all log messages to the observer.
+ * \return  Returns true if processed with success. Otherwise, returns false.
+ **/
+LOGGER_API bool logObserverRequestFilters(const sLogFilter* filters, uint32_t count);
+
+/**
+ * \brief   Call to receive the statistics of the dispatcher threads of the specified connected instance:
+ *          the queue size, the number of dispatched, dropped and cancelled events, and the percentiles of
+ *          the waiting and processing time. The callback of FuncLogStatistics type is triggered when receive the statistics.
+ * \param   target  The cookie ID of the target instance to receive the statistics.
+ *                  If the target is ID_IGNORE (or 0), it receives the statistics of all connected instances.
+ * \return  Returns true if processed with success. Otherwise, returns false.
+ **/
+LOGGER_API bool logObserverRequestStatistics(ITEM_ID target);
+
+/**
+ * \brief   Queries the log messages saved in the logging database, which were created by the
+ *          specified log source within the time range. The query is fast if the log messages are
+ *          saved in the log archive, i.e. the 'log::logobserver::db::name' property is 'archive'.
+ * \param   cookie      The cookie ID of the log source. If ID_IGNORE (or 0), queries the messages of all sources.
+ * \param   timeBegin   The beginning of the time range, inclusive. The time is in microseconds since epoch.
+ * \param   timeEnd     The end of the time range, inclusive. The time is in microseconds since epoch.
+ * \param   messages    The list to copy found log messages. Can be NULL if count is 0.
+ * \param   count       The number of entries in the list.
+ * \return  Returns the number of log messages copied in the list.
+ **/
+LOGGER_API uint32_t logObserverQueryLogs(ITEM_ID cookie, TIME64 timeBegin, TIME64 timeEnd, sLogMessage* messages, uint32_t count);
+
 #endif  // AREG_AREGLOGGER_CLIENT_LOGOBSERVERAPI_H
 
@@ -61,6 +61,7 @@ namespace
             dstCallbacks.evtLogUpdatedScopes    = srcCallbacks->evtLogUpdatedScopes;
             dstCallbacks.evtLogMessage          = srcCallbacks->evtLogMessage;
             dstCallbacks.evtLogMessageEx        = srcCallbacks->evtLogMessageEx;
+            dstCallbacks.evtLogStatistics       = srcCallbacks->evtLogStatistics;
         }
         else
         {
@@ -75,6 +76,7 @@ namespace
             dstCallbacks.evtLogUpdatedScopes    = nullptr;
             dstCallbacks.evtLogMessage          = nullptr;
             dstCallbacks.evtLogMessageEx        = nullptr;
+            dstCallbacks.evtLogStatistics       = nullptr;
         }
     }
 
@@ -327,3 +329,69 @@ LOGGER_API_IMPL bool logObserverRequestSaveConfig(ITEM_ID target /* = ID_IGNORED
 
     return result;
 }
+
+LOGGER_API_IMPL bool logObserverRequestFilters(const sLogFilter* filters, uint32_t count)
+{
+    bool result{ false };
+    Lock lock(theObserver.losLock);
+    if (_isInitialized(theObserver.losState) && ((filters != nullptr) || (count == 0)))
+    {
+        NETrace::LogFilters filterList(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            NETrace::sLogFilter filter;
+            filter.filterCookie     = filters[i].lfCookie != ID_IGNORE ? filters[i].lfCookie : NEService::COOKIE_ANY;
+            filter.filterScopeFirst = filters[i].lfScopeFirst;
+            filter.filterScopeLast  = filters[i].lfScopeLast;
+            filter.filterPriorities = filters[i].lfPriorities;
+            filter.filterScopePrefix= filters[i].lfScopePrefix;
+            filter.filterText       = filters[i].lfText;
+            filterList.add(filter);
+        }
+
+        result = LoggerClient::getInstance().requestLogFilters(filterList);
+    }
+
+    return result;
+}
+
+LOGGER_API_IMPL bool logObserverRequestStatistics(ITEM_ID target)
+{
+    bool result{ false };
+    Lock lock(theObserver.losLock);
+    if (_isInitialized(theObserver.losState))
+    {
+        result = LoggerClient::getInstance().requestStatistics(target != ID_IGNORE ? target : NEService::COOKIE_ANY);
+    }
+
+    return result;
+}
+
+LOGGER_API_IMPL uint32_t logObserverQueryLogs(ITEM_ID cookie, TIME64 timeBegin, TIME64 timeEnd, sLogMessage* messages, uint32_t count)
+{
+    uint32_t result{ 0u };
+    Lock lock(theObserver.losLock);
+    if (_isInitialized(theObserver.losState) && (messages != nullptr) && (count != 0u))
+    {
+        NETrace::LogMessages logs(count);
+        LoggerClient::getInstance().queryLogs(cookie != ID_IGNORE ? cookie : NEService::COOKIE_ANY, timeBegin, timeEnd, logs, count);
+        for (const NETrace::sLogMessage& log : logs.getData())
+        {
+            sLogMessage& msgLog{ messages[result ++] };
+            msgLog.msgType      = static_cast<eLogType>(log.logMsgType);
+            msgLog.msgPriority  = static_cast<eLogPriority>(log.logMessagePrio);
+            msgLog.msgSource    = static_cast<unsigned long long>(log.logSource);
+            msgLog.msgCookie    = static_cast<unsigned long long>(log.logCookie);
+            msgLog.msgModuleId  = static_cast<unsigned long long>(log.logModuleId);
+            msgLog.msgThreadId  = static_cast<unsigned long long>(log.logThreadId);
+            msgLog.msgTimestamp = static_cast<unsigned long long>(log.logTimestamp);
+            msgLog.msgScopeId   = static_cast<unsigned int>(log.logScopeId);
+
+            NEString::copyString(msgLog.msgLogText, LENGTH_MESSAGE, log.logMessage, static_cast<NEString::CharCount>(log.logMessageLen));
+            NEString::copyString(msgLog.msgThread, LENGTH_NAME, log.logThread, static_cast<NEString::CharCount>(log.logThreadLen));
+            NEString::copyString(msgLog.msgModule, LENGTH_NAME, log.logModule, static_cast<NEString::CharCount>(log.logModuleLen));
+        }
+    }
+
+    return result;
+}
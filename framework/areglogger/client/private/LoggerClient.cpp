@@ -47,7 +47,9 @@ LoggerClient::LoggerClient(void)
     , mMessageProcessor          ( self() )
     , mIsPaused                  ( false )
     , mInstances                 ( )
-    , mLogDatabase               ( )
+    , mSqliteDatabase            ( )
+    , mArchiveDatabase           ( )
+    , mLogDatabase               ( &mSqliteDatabase )
 {
 }
 
@@ -197,29 +199,58 @@ bool LoggerClient::requestSaveConfiguration(const ITEM_ID& target /*= NEService:
     return result;
 }
 
+bool LoggerClient::requestLogFilters(const NETrace::LogFilters& filters)
+{
+    bool result{ false };
+    Lock lock(mLock);
+    if (mChannel.getCookie() != NEService::COOKIE_UNKNOWN)
+    {
+        result = sendMessage(NETrace::messageFilterLogs(mChannel.getCookie(), LoggerClient::TargetID, filters));
+    }
+
+    return result;
+}
+
+bool LoggerClient::requestStatistics(const ITEM_ID& target /*= NEService::COOKIE_ANY*/)
+{
+    bool result{ false };
+    Lock lock(mLock);
+    if ((mChannel.getCookie() != NEService::COOKIE_UNKNOWN) && (target != NEService::COOKIE_UNKNOWN))
+    {
+        result = sendMessage(NETrace::messageQueryStatistics(mChannel.getCookie(), target == NEService::COOKIE_ANY ? LoggerClient::TargetID : target));
+    }
+
+    return result;
+}
+
 bool LoggerClient::openLoggingDatabase(const char* dbPath /*= nullptr*/)
 {
     String filePath (dbPath);
+    LogConfiguration config;
+    const String dbName{ config.getDatabaseName() };
+    mLogDatabase = dbName == NETrace::LOGDB_NAME_ARCHIVE ? static_cast<IELogDatabaseEngine *>(&mArchiveDatabase) : static_cast<IELogDatabaseEngine *>(&mSqliteDatabase);
     if (filePath.isEmpty())
     {
-        LogConfiguration config;
-        if (config.isDatabaseLoggingEnabled() && (config.getDatabaseName() == NETrace::LOGDB_NAME_SQLITE3))
+        const bool isEnabled{ config.isDatabaseLoggingEnabled() && ((dbName == NETrace::LOGDB_NAME_SQLITE3) || (dbName == NETrace::LOGDB_NAME_ARCHIVE)) };
+        mSqliteDatabase.setDatabaseLoggingEnabled(isEnabled);
+        mArchiveDatabase.setDatabaseLoggingEnabled(isEnabled);
+        if (isEnabled)
         {
-            mLogDatabase.setDatabaseLoggingEnabled(true);
             filePath = config.getDatabaseLocation();
         }
-        else
-        {
-            mLogDatabase.setDatabaseLoggingEnabled(false);
-        }
     }
 
-    return mLogDatabase.connect(filePath);
+    return mLogDatabase->connect(filePath);
 }
 
 void LoggerClient::closeLoggingDatabase(void)
 {
-    mLogDatabase.disconnect();
+    mLogDatabase->disconnect();
+}
+
+uint32_t LoggerClient::queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount)
+{
+    return mLogDatabase->queryLogs(cookie, timeBegin, timeEnd, result, maxCount);
 }
 
 void LoggerClient::prepareSaveConfiguration(ConfigManager& /* config */)
@@ -508,6 +539,10 @@ void LoggerClient::processReceivedMessage(const RemoteMessage& msgReceived, Sock
             }
             break;
 
+        case NEService::eFuncIdRange::ServiceLogStatistics:
+            mMessageProcessor.notifyLogStatistics(msgReceived);
+            break;
+
         case NEService::eFuncIdRange::SystemServiceNotifyRegister:      // fall through
         case NEService::eFuncIdRange::ServiceLastId:                    // fall through
         case NEService::eFuncIdRange::SystemServiceQueryInstances:      // fall through
@@ -531,6 +566,8 @@ void LoggerClient::processReceivedMessage(const RemoteMessage& msgReceived, Sock
         case NEService::eFuncIdRange::ServiceLogUpdateScopes:           // fall through
         case NEService::eFuncIdRange::ServiceLogQueryScopes:            // fall through
         case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
+        case NEService::eFuncIdRange::ServiceLogFilterMessages:         // fall through
+        case NEService::eFuncIdRange::ServiceLogQueryStatistics:        // fall through
         default:
             ASSERT(false);
         }
@@ -28,6 +28,7 @@
 #include "areg/persist/IEConfigurationListener.hpp"
 
 #include "areg/trace/NETrace.hpp"
+#include "aregextend/db/LogArchiveDatabase.hpp"
 #include "aregextend/db/LogSqliteDatabase.hpp"
 
 #include "areglogger/client/private/ObserverMessageProcessor.hpp"
@@ -199,6 +200,25 @@ public:
      **/
     bool requestSaveConfiguration(const ITEM_ID & target = NEService::COOKIE_ANY);
 
+    /**
+     * \brief   Generates and sends the message to the logger service to set the filters of log messages.
+     *          The logger service forwards to the observer only the log messages that match at least one filter.
+     *          The filters replace the filters set before. An empty list removes the filtering.
+     * \param   filters The list of log message filters.
+     * \return  Returns true if processed the request with success. Otherwise, returns false.
+     **/
+    bool requestLogFilters(const NETrace::LogFilters& filters);
+
+    /**
+     * \brief   Generates and sends the message to query the statistics of the dispatcher threads.
+     *          The message is sent either to certain target or to all connected clients
+     *          if the target is NEService::COOKIE_ANY.
+     * \param   target  The ID of the target to send the message.
+     *                  The message is sent to all clients if the target is NEService::COOKIE_ANY.
+     * \return  Returns true if processed the request with success. Otherwise, returns false.
+     **/
+    bool requestStatistics(const ITEM_ID& target = NEService::COOKIE_ANY);
+
     /**
      * \brief   Creates of opens the database for the logging. If specified path is null or empty,
      *          if uses the location specified in the configuration file.
@@ -208,6 +228,17 @@ public:
      **/
     bool openLoggingDatabase(const char* dbPath = nullptr);
 
+    /**
+     * \brief   Queries the saved log messages of the specified source created within the time range.
+     * \param   cookie      The cookie ID of the log source. NEService::COOKIE_ANY to query all sources.
+     * \param   timeBegin   The beginning of the time range, inclusive.
+     * \param   timeEnd     The end of the time range, inclusive.
+     * \param   result      On output, contains the found log messages.
+     * \param   maxCount    The maximum number of messages to return.
+     * \return  Returns the number of found log messages.
+     **/
+    uint32_t queryLogs(const ITEM_ID & cookie, const TIME64 & timeBegin, const TIME64 & timeEnd, NETrace::LogMessages & OUT result, uint32_t maxCount);
+
     /**
      * \brief   Closes previously opened logging database.
      **/
@@ -384,9 +415,20 @@ private:
     NEService::MapInstances     mInstances;
 
     /**
-     * \brief   The logging database engine.
+     * \brief   The SQLite logging database engine.
+     **/
+    LogSqliteDatabase           mSqliteDatabase;
+
+    /**
+     * \brief   The append-only binary log archive engine.
+     **/
+    LogArchiveDatabase          mArchiveDatabase;
+
+    /**
+     * \brief   The logging database engine selected by the configuration,
+     *          either SQLite database or log archive.
      **/
-    LogSqliteDatabase           mLogDatabase;
+    IELogDatabaseEngine *       mLogDatabase;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -21,6 +21,7 @@
 
 #include "areg/base/DateTime.hpp"
 #include "areg/base/RemoteMessage.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/trace/TraceScope.hpp"
@@ -66,7 +67,7 @@ void ObserverMessageProcessor::notifyConnectedClients(const RemoteMessage& msgRe
                 auto added = mLoggerClient.mInstances.addIfUnique(instance.ciCookie, instance, false);
                 if (added.second)
                 {
-                    mLoggerClient.mLogDatabase.logInstanceConnected(instance, now);
+                    mLoggerClient.mLogDatabase->logInstanceConnected(instance, now);
                 }
 
                 if (listConnect != nullptr)
@@ -105,7 +106,7 @@ void ObserverMessageProcessor::notifyConnectedClients(const RemoteMessage& msgRe
 
                     if (mLoggerClient.mInstances.removeAt(cookie))
                     {
-                        mLoggerClient.mLogDatabase.logInstanceDisconnected(cookie, now);
+                        mLoggerClient.mLogDatabase->logInstanceDisconnected(cookie, now);
                     }
                 }
             }
@@ -115,7 +116,7 @@ void ObserverMessageProcessor::notifyConnectedClients(const RemoteMessage& msgRe
             }
         }
 
-        mLoggerClient.mLogDatabase.commit(true);
+        mLoggerClient.mLogDatabase->commit(true);
 
     } while (false);
 
@@ -147,7 +148,7 @@ void ObserverMessageProcessor::notifyLogRegisterScopes(const RemoteMessage& msgR
     do
     {
         Lock lock(mLoggerClient.mLock);
-        mLoggerClient.mLogDatabase.logScopesDeactivate(cookie, now);
+        mLoggerClient.mLogDatabase->logScopesDeactivate(cookie, now);
         evtScopes = mLoggerClient.mCallbacks != nullptr ? mLoggerClient.mCallbacks->evtLogRegisterScopes : nullptr;
         msgReceived >> count;
         scopes = count != 0 ? new sLogScope[count] : nullptr;
@@ -161,7 +162,7 @@ void ObserverMessageProcessor::notifyLogRegisterScopes(const RemoteMessage& msgR
                 entry.lsPrio = scope.getPriority();
                 NEString::copyString(entry.lsName, static_cast<NEString::CharCount>(LENGTH_SCOPE), scope.getScopeName().getString(), scope.getScopeName().getLength());
 
-                mLoggerClient.mLogDatabase.logScopeActivate(entry.lsName, entry.lsId, entry.lsPrio, cookie, now);
+                mLoggerClient.mLogDatabase->logScopeActivate(entry.lsName, entry.lsId, entry.lsPrio, cookie, now);
             }
         }
         else
@@ -169,7 +170,7 @@ void ObserverMessageProcessor::notifyLogRegisterScopes(const RemoteMessage& msgR
             count = 0;
         }
 
-        mLoggerClient.mLogDatabase.commit(true);
+        mLoggerClient.mLogDatabase->commit(true);
 
     } while (false);
 
@@ -181,6 +182,74 @@ void ObserverMessageProcessor::notifyLogRegisterScopes(const RemoteMessage& msgR
     delete[] scopes;
 }
 
+void ObserverMessageProcessor::notifyLogStatistics(const RemoteMessage& msgReceived)
+{
+    FuncLogStatistics evtStatistics{ nullptr };
+    do
+    {
+        Lock lock(mLoggerClient.mLock);
+        evtStatistics = mLoggerClient.mCallbacks != nullptr ? mLoggerClient.mCallbacks->evtLogStatistics : nullptr;
+    } while (false);
+
+    if (evtStatistics == nullptr)
+        return;
+
+    DispatcherStatistics::ListStatistics list;
+    msgReceived >> list;
+
+    const uint32_t count{ list.getSize() };
+    uint32_t countEvents{ 0 };
+    for (const auto& entry : list.getData())
+    {
+        countEvents += entry.dsEvents.getSize();
+    }
+
+    sLogDispatcherStats* stats{ count != 0 ? new sLogDispatcherStats[count] : nullptr };
+    sLogEventStats* events{ countEvents != 0 ? new sLogEventStats[countEvents] : nullptr };
+    sLogEventStats* next{ events };
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const DispatcherStatistics::sDispatcherStatistics& src{ list[i] };
+        sLogDispatcherStats& dst{ stats[i] };
+        NEString::copyString(dst.dsName, static_cast<NEString::CharCount>(LENGTH_NAME), src.dsDispatcherName.getString(), src.dsDispatcherName.getLength());
+        dst.dsWaitPolicy    = static_cast<uint32_t>(src.dsWaitPolicy);
+        dst.dsQueueSize     = src.dsQueueSize;
+        dst.dsQueuePeak     = src.dsQueuePeak;
+        dst.dsDispatched    = src.dsDispatched;
+        dst.dsDropped       = src.dsDropped;
+        dst.dsCancelled     = src.dsCancelled;
+        dst.dsDeadlineMissed= src.dsDeadlineMissed;
+        dst.dsCoalesced     = src.dsCoalesced;
+        dst.dsWaitMedian    = src.dsWaitMedian;
+        dst.dsWaitP99       = src.dsWaitP99;
+        dst.dsWaitMax       = src.dsWaitMax;
+        dst.dsRunMedian     = src.dsRunMedian;
+        dst.dsRunP99        = src.dsRunP99;
+        dst.dsRunMax        = src.dsRunMax;
+        dst.dsEventCount    = src.dsEvents.getSize();
+        dst.dsEvents        = next;
+        for (const auto& event : src.dsEvents.getData())
+        {
+            NEString::copyString(next->esName, static_cast<NEString::CharCount>(LENGTH_NAME), event.esEventName.getString(), event.esEventName.getLength());
+            next->esMessageId   = event.esMessageId;
+            next->esDispatched  = event.esDispatched;
+            next->esDeadlineMissed  = event.esDeadlineMissed;
+            next->esWaitMedian  = event.esWaitMedian;
+            next->esWaitP99     = event.esWaitP99;
+            next->esWaitMax     = event.esWaitMax;
+            next->esRunMedian   = event.esRunMedian;
+            next->esRunP99      = event.esRunP99;
+            next->esRunMax      = event.esRunMax;
+            ++next;
+        }
+    }
+
+    evtStatistics(msgReceived.getSource(), stats, count);
+
+    delete[] events;
+    delete[] stats;
+}
+
 void ObserverMessageProcessor::notifyLogUpdateScopes(const RemoteMessage& msgReceived)
 {
     FuncLogUpdateScopes evtScopes{ nullptr };
@@ -192,7 +261,7 @@ void ObserverMessageProcessor::notifyLogUpdateScopes(const RemoteMessage& msgRec
     do
     {
         Lock lock(mLoggerClient.mLock);
-        mLoggerClient.mLogDatabase.logScopesDeactivate(cookie, now);
+        mLoggerClient.mLogDatabase->logScopesDeactivate(cookie, now);
         evtScopes = mLoggerClient.mCallbacks != nullptr ? mLoggerClient.mCallbacks->evtLogUpdatedScopes : nullptr;
         msgReceived >> count;
         scopes = count != 0 ? new sLogScope[count] : nullptr;
@@ -205,7 +274,7 @@ void ObserverMessageProcessor::notifyLogUpdateScopes(const RemoteMessage& msgRec
                 entry.lsId = scope.getScopeId();
                 entry.lsPrio = scope.getPriority();
                 NEString::copyString(entry.lsName, static_cast<NEString::CharCount>(LENGTH_SCOPE), scope.getScopeName().getString(), scope.getScopeName().getLength());
-                mLoggerClient.mLogDatabase.logScopeActivate(entry.lsName, entry.lsId, entry.lsPrio, cookie, now);
+                mLoggerClient.mLogDatabase->logScopeActivate(entry.lsName, entry.lsId, entry.lsPrio, cookie, now);
             }
         }
         else
@@ -213,7 +282,7 @@ void ObserverMessageProcessor::notifyLogUpdateScopes(const RemoteMessage& msgRec
             count = 0;
         }
 
-        mLoggerClient.mLogDatabase.commit(true);
+        mLoggerClient.mLogDatabase->commit(true);
     } while (false);
 
     if (evtScopes != nullptr)
@@ -238,8 +307,7 @@ void ObserverMessageProcessor::notifyLogMessage(const RemoteMessage& msgReceived
         Lock lock(mLoggerClient.mLock);
         const NETrace::sLogMessage* msgRemote = reinterpret_cast<const NETrace::sLogMessage*>(msgReceived.getBuffer());
         ASSERT(msgRemote != nullptr);
-        mLoggerClient.mLogDatabase.logMessage(*msgRemote, now);
-        mLoggerClient.mLogDatabase.commit(true);
+        mLoggerClient.mLogDatabase->logMessage(*msgRemote, now);
 
         if (mLoggerClient.mCallbacks != nullptr)
         {
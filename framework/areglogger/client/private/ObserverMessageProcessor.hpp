@@ -76,6 +76,12 @@ public:
      **/
     void notifyLogUpdateScopes(const RemoteMessage& msgReceived);
 
+    /**
+     * \brief   Triggered when the observer receives the statistics of the dispatcher threads of the log source.
+     * \param   msgReceived     The buffer with the statistics of the dispatcher threads.
+     **/
+    void notifyLogStatistics(const RemoteMessage& msgReceived);
+
     /**
      * \brief   Triggered to notify to log a message.
      * \param   msgReceived     The buffer with the log message.
@@ -68,6 +68,7 @@ private:
         , CMD_LogSaveLogs                                                                               //!< Logger save logs in the file.
         , CMD_LogSaveLogsStop                                                                           //!< Stop saving logs in the file.
         , CMD_LogSaveConfig                                                                             //!< Save the log configuration in the config file.
+        , CMD_LogDbBenchmark                                                                            //!< Measure the log database inserts per second.
     };
 
     /**
@@ -306,6 +307,16 @@ private:
      **/
     static void _processQueryScopes(const OptionParser::sOption& optScope);
 
+    /**
+     * \brief   Triggered to measure the number of inserts per second in the log database
+     *          and the time to query the logs of one source within a time range.
+     *          The benchmark writes the messages in temporary SQLite database files,
+     *          first each message in its own transaction, then in batches, and
+     *          in the temporary log archive, and compares the results.
+     * \param   optCount    The option entry that contains the number of log messages to write.
+     **/
+    static void _processDbBenchmark(const OptionParser::sOption& optCount);
+
     /**
      * \brief   Creates a list of remote messages to send to update log scope priorities.
      *          On output the 'msgList' contains the list of message. Each message contains
@@ -23,7 +23,13 @@
 #include "areg/base/String.hpp"
 #include "areg/trace/GETrace.h"
 
+#include "areg/base/DateTime.hpp"
+#include "areg/base/File.hpp"
+#include "areg/base/NEUtilities.hpp"
+
 #include "aregextend/console/Console.hpp"
+#include "aregextend/db/LogArchiveDatabase.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
 
 #include <stdio.h>
 
@@ -62,6 +68,7 @@ namespace
         , {"-a, --save      : Command to save logs in the file. Used in console application. Usage: --save"}
         , {"-b, --unsave    : Command to stop saving logs in the file. Used in console application. Usage: --unsave"}
         , {"-c, --console   : Command to run logger as a console application (default option). Usage: \'logger --console\'"}
+        , {"-d, --dbbench   : Command to compare inserts and queries of log database and archive. Used in console application. Usage: --dbbench=10000"}
         , {"-e, --query     : Command to query the list of logging scopes. Used in console application. Usage (\'*\' can be a cookie number): --query *"}
         , {"-f, --config    : Command to save current configuration, including log scopes in the config file. Used in console application. Usage: --config"}
         , {"-h, --help      : Command to display this message on console."}
@@ -78,6 +85,42 @@ namespace
         , {"-v, --verbose   : Command option to display data rate. Used in console application. Usage: --verbose"}
         , NESystemService::MSG_SEPARATOR
     };
+
+    //! The number of log sources in the log database benchmark.
+    constexpr uint32_t  _benchSources   { 16u };
+
+    //! Writes the log messages of the benchmark in the database and returns the elapsed time in microseconds.
+    //! The messages of the sources are interleaved and created with 1 millisecond interval.
+    template<class LogDatabase>
+    TIME64 _benchInsert(LogDatabase& database, NETrace::sLogMessage& logMsg, uint32_t count, const TIME64& start, bool flushEach)
+    {
+        const DateTime begin{ DateTime::getNow() };
+        for (uint32_t i = 0; i < count; ++ i)
+        {
+            logMsg.logCookie    = NEService::COOKIE_ANY + 1u + (i % _benchSources);
+            logMsg.logTimestamp = start + static_cast<TIME64>(i) * NEUtilities::MILLISEC_TO_MICROSECS;
+            database.logMessage(logMsg, begin);
+            if (flushEach)
+            {
+                database.flushLogs();
+            }
+        }
+
+        database.flushLogs();
+        return MACRO_MAX(DateTime::getNow().getTime() - begin.getTime(), static_cast<TIME64>(1));
+    }
+
+    //! Queries the logs of one source within the middle 10% of time range and returns the elapsed time in microseconds.
+    TIME64 _benchQuery(IELogDatabaseEngine& database, uint32_t count, const TIME64& start, uint32_t& OUT found)
+    {
+        const TIME64 timeBegin{ start + static_cast<TIME64>(count / 10u * 4u) * NEUtilities::MILLISEC_TO_MICROSECS };
+        const TIME64 timeEnd  { start + static_cast<TIME64>(count / 10u * 5u) * NEUtilities::MILLISEC_TO_MICROSECS };
+        NETrace::LogMessages result(count / 10u / _benchSources + 1u);
+
+        const DateTime begin{ DateTime::getNow() };
+        found = database.queryLogs(NEService::COOKIE_ANY + 1u, timeBegin, timeEnd, result, count);
+        return MACRO_MAX(DateTime::getNow().getTime() - begin.getTime(), static_cast<TIME64>(1));
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -102,6 +145,7 @@ const OptionParser::sOptionSetup Logger::ValidOptions[ ]
       { "-a", "--save"      , static_cast<int>(eLoggerOptions::CMD_LogSaveLogs)     , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-b", "--unsave"    , static_cast<int>(eLoggerOptions::CMD_LogSaveLogsStop) , OptionParser::NO_DATA         , {}, {}, {} }
     , { "-c", "--console"   , static_cast<int>(eLoggerOptions::CMD_LogConsole)      , OptionParser::NO_DATA         , {}, {}, {} }
+    , { "-d", "--dbbench"   , static_cast<int>(eLoggerOptions::CMD_LogDbBenchmark)  , OptionParser::INTEGER_NO_RANGE, {}, {}, {} }
     , { "-e", "--query"     , static_cast<int>(eLoggerOptions::CMD_LogQueryScopes)  , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-f", "--config"    , static_cast<int>(eLoggerOptions::CMD_LogSaveConfig)   , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-h", "--help"      , static_cast<int>(eLoggerOptions::CMD_LogPrintHelp)    , OptionParser::NO_DATA         , {}, {}, {} }
@@ -369,6 +413,10 @@ bool Logger::_checkCommand(const String& cmd)
                 Logger::_processQueryScopes(opt);
                 break;
 
+            case eLoggerOptions::CMD_LogDbBenchmark:
+                Logger::_processDbBenchmark(opt);
+                break;
+
             case eLoggerOptions::CMD_LogSaveLogs:       // fall through
             case eLoggerOptions::CMD_LogSaveConfig:     // fall through
             case eLoggerOptions::CMD_LogSaveLogsStop:
@@ -758,6 +806,75 @@ RemoteMessage Logger::_createScopeUpdateMessage(const String& scope)
     return result;
 }
 
+void Logger::_processDbBenchmark(const OptionParser::sOption& optCount)
+{
+    constexpr uint32_t defaultCount{ 10'000 };
+    const uint32_t count{ optCount.inValue.valInt > 0 ? static_cast<uint32_t>(optCount.inValue.valInt) : defaultCount };
+    const uint32_t batches[]{ 1u, LogSqliteDatabase::DEFAULT_BATCH_SIZE };
+    const TIME64 start{ DateTime::getNow().getTime() };
+
+    NETrace::sLogMessage logMsg(NETrace::eLogMessageType::LogMessageText);
+    logMsg.logModuleId   = Process::getInstance().getId();
+    logMsg.logMessageLen = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logMessage, NETrace::LOG_MESSAGE_IZE, "The log database benchmark message."));
+    logMsg.logModuleLen  = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logModule, NETrace::LOG_NAMES_SIZE, Process::getInstance().getAppName().getString()));
+
+    String result("SQLite: ");
+    uint32_t found{ 0u };
+    TIME64 query{ 0 };
+    for (uint32_t batch : batches)
+    {
+        const String filePath{ File::genTempFileName("dbbench_", true, true) };
+        LogSqliteDatabase database;
+        database.setBatchParameters(batch, LogSqliteDatabase::DEFAULT_BATCH_TIMEOUT);
+        if (database.connect(filePath) == false)
+        {
+            Logger::_outputInfo(String("Failed to create log database ") + filePath);
+            return;
+        }
+
+        const TIME64 elapsed{ _benchInsert(database, logMsg, count, start, batch == 1u) };
+        const uint64_t written{ database.getLogsWritten() };
+        query = _benchQuery(database, count, start, found);
+        database.disconnect();
+        File::deleteFile(filePath);
+
+        result.append(String::makeString(static_cast<uint64_t>(written * NEUtilities::SEC_TO_MICROSECS / elapsed)))
+              .append(" inserts/sec, batch size ")
+              .append(String::makeString(batch))
+              .append("; ");
+    }
+
+    result.append("query ").append(String::makeString(static_cast<uint64_t>(query))).append(" us. ");
+
+    const String filePath{ File::genTempFileName("dbbench_", true, true) };
+    LogArchiveDatabase archive;
+    if (archive.connect(filePath) == false)
+    {
+        Logger::_outputInfo(String("Failed to create log archive ") + filePath);
+        return;
+    }
+
+    const TIME64 elapsed{ _benchInsert(archive, logMsg, count, start, false) };
+    const uint64_t written{ archive.getLogsWritten() };
+    query = _benchQuery(archive, count, start, found);
+    const uint32_t segments{ static_cast<uint32_t>(written * sizeof(NETrace::sLogMessage) / LogArchiveDatabase::DEFAULT_SEGMENT_SIZE) + 1u };
+    archive.disconnect();
+    File::deleteFile(filePath);
+    for (uint32_t i = 0; i <= segments; ++ i)
+    {
+        File::deleteFile(filePath + "." + String::makeString(i));
+    }
+
+    result.append("Archive: ")
+          .append(String::makeString(static_cast<uint64_t>(written * NEUtilities::SEC_TO_MICROSECS / elapsed)))
+          .append(" inserts/sec; query ")
+          .append(String::makeString(static_cast<uint64_t>(query)))
+          .append(" us. ")
+          .append(String::makeString(count)).append(" messages, ")
+          .append(String::makeString(found)).append(" found.");
+    Logger::_outputInfo(result);
+}
+
 inline void Logger::_enableLocalLogs(ConfigManager& config, bool enable)
 {
     constexpr NEPersistence::eConfigKeys prioConfKey{ NEPersistence::eConfigKeys::EntryLogScope };
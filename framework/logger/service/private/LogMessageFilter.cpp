@@ -0,0 +1,161 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logger/service/private/LogMessageFilter.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Collector filter of log messages forwarded to observer.
+ ************************************************************************/
+#include "logger/service/private/LogMessageFilter.hpp"
+
+#include <limits>
+#include <string_view>
+
+LogMessageFilter::LogMessageFilter(void)
+    : mMatchers ( )
+    , mFields   ( eFilterFields::FilterNone )
+{
+}
+
+void LogMessageFilter::setFilters(const NETrace::LogFilters & filters)
+{
+    mMatchers.clear();
+    mMatchers.reserve(filters.getSize());
+    mFields = eFilterFields::FilterNone;
+
+    for (const NETrace::sLogFilter& filter : filters.getData())
+    {
+        sFilterMatcher matcher{};
+        matcher.fmFields        = eFilterFields::FilterNone;
+        matcher.fmCookie        = filter.filterCookie;
+        matcher.fmScopeFirst    = filter.filterScopeFirst;
+        matcher.fmScopeLast     = filter.filterScopeLast;
+        matcher.fmPriorities    = filter.filterPriorities;
+        matcher.fmScopePrefix   = filter.filterScopePrefix;
+        matcher.fmText          = filter.filterText;
+
+        if ((filter.filterCookie != NEService::COOKIE_ANY) && (filter.filterCookie != NEService::COOKIE_UNKNOWN))
+        {
+            matcher.fmFields |= eFilterFields::FilterCookie;
+        }
+
+        if ((filter.filterScopeFirst != 0) || (filter.filterScopeLast != 0))
+        {
+            // the range without the last scope ID has no upper limit.
+            matcher.fmFields |= eFilterFields::FilterScopeRange;
+            matcher.fmScopeLast = filter.filterScopeLast != 0 ? filter.filterScopeLast : std::numeric_limits<uint32_t>::max();
+        }
+
+        if (filter.filterPriorities != 0)
+        {
+            matcher.fmFields |= eFilterFields::FilterPriority;
+        }
+
+        if (filter.filterScopePrefix.isEmpty() == false)
+        {
+            matcher.fmFields |= eFilterFields::FilterScopePrefix;
+        }
+
+        if (filter.filterText.isEmpty() == false)
+        {
+            matcher.fmFields |= eFilterFields::FilterText;
+        }
+
+        if (matcher.fmFields == eFilterFields::FilterNone)
+        {
+            // the filter matches any message, no need to check other filters.
+            mMatchers.clear();
+            mFields = eFilterFields::FilterNone;
+            break;
+        }
+
+        mFields |= matcher.fmFields;
+        mMatchers.add(matcher);
+    }
+}
+
+void LogMessageFilter::updateScopes(const NETrace::ScopeNames & scopes)
+{
+    for (uint32_t i = 0; i < mMatchers.getSize(); ++ i)
+    {
+        sFilterMatcher& matcher{ mMatchers[i] };
+        if ((matcher.fmFields & eFilterFields::FilterScopePrefix) == 0)
+            continue;
+
+        for (const NETrace::sScopeInfo& scope : scopes.getData())
+        {
+            if (scope.scopeName.startsWith(matcher.fmScopePrefix))
+            {
+                matcher.fmScopeIds.setAt(scope.scopeId, true);
+            }
+        }
+    }
+}
+
+void LogMessageFilter::mergeScopes(NETrace::ScopeNames & scopes, const NETrace::ScopeNames & update)
+{
+    TEHashMap<unsigned int, uint32_t> indexes;
+    for (uint32_t i = 0; i < scopes.getSize(); ++ i)
+    {
+        indexes.setAt(scopes[i].scopeId, i);
+    }
+
+    for (const NETrace::sScopeInfo& scope : update.getData())
+    {
+        auto pos = indexes.find(scope.scopeId);
+        if (indexes.isValidPosition(pos))
+        {
+            scopes[indexes.valueAtPosition(pos)] = scope;
+        }
+        else
+        {
+            indexes.setAt(scope.scopeId, scopes.getSize());
+            scopes.add(scope);
+        }
+    }
+}
+
+bool LogMessageFilter::matches(const ITEM_ID & source, const NETrace::sLogMessage & logMsg) const
+{
+    if (mMatchers.isEmpty())
+        return true;
+
+    for (const sFilterMatcher& matcher : mMatchers.getData())
+    {
+        if (_matches(matcher, source, logMsg))
+            return true;
+    }
+
+    return false;
+}
+
+inline bool LogMessageFilter::_matches(const sFilterMatcher & filter, const ITEM_ID & source, const NETrace::sLogMessage & logMsg)
+{
+    const uint32_t fields{ filter.fmFields };
+    if (((fields & eFilterFields::FilterCookie) != 0) && (filter.fmCookie != source))
+        return false;
+
+    if (((fields & eFilterFields::FilterScopeRange) != 0) && ((logMsg.logScopeId < filter.fmScopeFirst) || (logMsg.logScopeId > filter.fmScopeLast)))
+        return false;
+
+    if (((fields & eFilterFields::FilterPriority) != 0) && ((filter.fmPriorities & static_cast<uint32_t>(logMsg.logMessagePrio)) == 0))
+        return false;
+
+    if (((fields & eFilterFields::FilterScopePrefix) != 0) && (filter.fmScopeIds.contains(logMsg.logScopeId) == false))
+        return false;
+
+    if ((fields & eFilterFields::FilterText) != 0)
+    {
+        const std::string_view text(logMsg.logMessage, logMsg.logMessageLen < NETrace::LOG_MESSAGE_IZE ? logMsg.logMessageLen : NETrace::LOG_MESSAGE_IZE - 1);
+        if (text.find(filter.fmText.getData()) == std::string_view::npos)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,167 @@
+#ifndef AREG_LOGGER_SERVICE_PRIVATE_LOGMESSAGEFILTER_HPP
+#define AREG_LOGGER_SERVICE_PRIVATE_LOGMESSAGEFILTER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logger/service/private/LogMessageFilter.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Collector filter of log messages forwarded to observer.
+ ************************************************************************/
+
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include "areg/base/String.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/trace/NETrace.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// LogMessageFilter class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The compiled list of log message filters of a single log observer.
+ *          The filters are compiled when set: only the fields that have values
+ *          are checked, and the scope name prefixes are resolved to the set of
+ *          scope IDs of the known scopes, so that the log message is never
+ *          compared by scope names. When a log source registers or updates
+ *          scopes, the scope ID sets are updated. The log message matches
+ *          if it matches at least one filter. The empty list matches any message.
+ **/
+class LogMessageFilter
+{
+//////////////////////////////////////////////////////////////////////////
+// Local types and constants.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   LogMessageFilter::eFilterFields
+     *          The bits of the fields to check in the compiled filter.
+     **/
+    enum eFilterFields : uint32_t
+    {
+          FilterNone        = 0x00  //!< No field to check, matches any message.
+        , FilterCookie      = 0x01  //!< Check the ID of the log source.
+        , FilterScopeRange  = 0x02  //!< Check the range of scope IDs.
+        , FilterPriority    = 0x04  //!< Check the message priority.
+        , FilterScopePrefix = 0x08  //!< Check the scope ID in the set of scopes matching the prefix.
+        , FilterText        = 0x10  //!< Check the substring in the message text.
+    };
+
+    //!< The set of scope IDs, which names match the prefix.
+    using ScopeIds  = TEHashMap<unsigned int, bool>;
+
+    /**
+     * \brief   LogMessageFilter::sFilterMatcher
+     *          The compiled filter.
+     **/
+    struct sFilterMatcher
+    {
+        uint32_t    fmFields;       //!< The bitwise set of eFilterFields to check.
+        ITEM_ID     fmCookie;       //!< The ID of the log source.
+        uint32_t    fmScopeFirst;   //!< The first scope ID of the range.
+        uint32_t    fmScopeLast;    //!< The last scope ID of the range.
+        uint32_t    fmPriorities;   //!< The bitwise set of message priorities.
+        String      fmScopePrefix;  //!< The prefix of scope names.
+        String      fmText;         //!< The substring to search in the message text.
+        ScopeIds    fmScopeIds;     //!< The IDs of known scopes, which names start with the prefix.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogMessageFilter(void);
+    LogMessageFilter(const LogMessageFilter & /*src*/) = default;
+    LogMessageFilter(LogMessageFilter && /*src*/) noexcept = default;
+    ~LogMessageFilter(void) = default;
+
+    LogMessageFilter & operator = (const LogMessageFilter & /*src*/) = default;
+    LogMessageFilter & operator = (LogMessageFilter && /*src*/) noexcept = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if there are no filters, i.e. any log message matches.
+     **/
+    inline bool isEmpty(void) const;
+
+    /**
+     * \brief   Returns true if at least one filter checks the scope name prefix.
+     *          Such filters require the list of scopes of log sources.
+     **/
+    inline bool hasScopePrefix(void) const;
+
+    /**
+     * \brief   Compiles and sets the list of filters. The previous filters are removed.
+     * \param   filters     The list of filters to compile.
+     **/
+    void setFilters(const NETrace::LogFilters & filters);
+
+    /**
+     * \brief   Updates the scope ID sets of compiled filters by the list of scopes of a log source.
+     * \param   scopes      The list of scope names and IDs of the log source.
+     **/
+    void updateScopes(const NETrace::ScopeNames & scopes);
+
+    /**
+     * \brief   Merges the partial list of scopes of a log source into the saved list of scopes.
+     *          The scopes with the same ID are replaced, the new scopes are added at the end.
+     * \param   scopes  The saved list of scopes of the log source to update.
+     * \param   update  The list of updated scopes of the log source.
+     **/
+    static void mergeScopes(NETrace::ScopeNames & scopes, const NETrace::ScopeNames & update);
+
+    /**
+     * \brief   Checks whether the log message matches at least one of filters.
+     * \param   source  The ID of the log source, which generated the message.
+     * \param   logMsg  The log message to check.
+     * \return  Returns true if there are no filters or the message matches at least one filter.
+     **/
+    bool matches(const ITEM_ID & source, const NETrace::sLogMessage & logMsg) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Checks whether the log message matches the single compiled filter.
+     **/
+    inline static bool _matches(const sFilterMatcher & filter, const ITEM_ID & source, const NETrace::sLogMessage & logMsg);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The list of compiled filters.
+    TEArrayList<sFilterMatcher> mMatchers;
+
+    //!< The bitwise set of fields checked by all filters.
+    uint32_t                    mFields;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogMessageFilter class inline methods
+//////////////////////////////////////////////////////////////////////////
+inline bool LogMessageFilter::isEmpty(void) const
+{
+    return mMatchers.isEmpty();
+}
+
+inline bool LogMessageFilter::hasScopePrefix(void) const
+{
+    return ((mFields & eFilterFields::FilterScopePrefix) != 0);
+}
+
+#endif // AREG_LOGGER_SERVICE_PRIVATE_LOGMESSAGEFILTER_HPP
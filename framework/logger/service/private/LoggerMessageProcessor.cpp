@@ -22,6 +22,8 @@ LoggerMessageProcessor::LoggerMessageProcessor(LoggerServerService & loggerServi
     : mLoggerService    ( loggerService )
     , mListSaveConfig   ( )
     , mPendingSave      ( NEService::COOKIE_UNKNOWN )
+    , mObserverFilters  ( )
+    , mSourceScopes     ( )
 {
 }
 
@@ -122,7 +124,7 @@ void LoggerMessageProcessor::notifyDisconnectedInstances(const TEArrayList<ITEM_
     }
 }
 
-void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived) const
+void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogRegisterScopes));
     msgReceived.moveToBegin();
@@ -135,6 +137,7 @@ void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgR
     msgStatus.format(fmt, static_cast<uint32_t>(msgReceived.getSource()), scopeCount);
 
     Logger::printStatus(msgStatus);
+    _saveSourceScopes(msgReceived, true);
     _forwardMessageToObservers(msgReceived);
 }
 
@@ -150,6 +153,18 @@ void LoggerMessageProcessor::queryLogSourceScopes(const RemoteMessage & msgRecei
     _forwardMessageToLogSources(msgReceived);
 }
 
+void LoggerMessageProcessor::queryLogSourceStatistics(const RemoteMessage & msgReceived) const
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogQueryStatistics));
+    _forwardMessageToLogSources(msgReceived);
+}
+
+void LoggerMessageProcessor::logSourceStatistics(const RemoteMessage & msgReceived) const
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogStatistics));
+    _forwardMessageToObservers(msgReceived);
+}
+
 void LoggerMessageProcessor::saveLogSourceConfiguration(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceSaveLogConfiguration));
@@ -181,6 +196,7 @@ void LoggerMessageProcessor::saveLogSourceConfiguration(const RemoteMessage & ms
 void LoggerMessageProcessor::logSourceScopesUpadated(const RemoteMessage& msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogScopesUpdated));
+    _saveSourceScopes(msgReceived, false);
     _forwardMessageToObservers(msgReceived);
 }
 
@@ -209,15 +225,87 @@ void LoggerMessageProcessor::clientDisconnected(const ITEM_ID& cookie)
     {
         processNextSaveConfig();
     }
+
+    mObserverFilters.removeAt(cookie);
+    mSourceScopes.removeAt(cookie);
 }
 
-void LoggerMessageProcessor::logMessage(const RemoteMessage & msgReceived) const
+void LoggerMessageProcessor::logMessage(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage));
     ASSERT(NETrace::eLogDataType::LogDataRemote == reinterpret_cast<const NETrace::sLogMessage *>(msgReceived.getBuffer())->logDataType);
+
+    const ITEM_ID& source{ msgReceived.getSource() };
+    if ((mObserverFilters.isEmpty() == false) && (mSourceScopes.contains(source) == false))
+    {
+        // the log source registers scopes only when requested, query them once to resolve scope names of filters.
+        for (const auto& entry : mObserverFilters.getData())
+        {
+            if (entry.second.hasScopePrefix())
+            {
+                mSourceScopes.setAt(source, NETrace::ScopeNames());
+                _forwardMessageToLogSources(NETrace::messageQueryScopes(NEService::COOKIE_LOGGER, source));
+                break;
+            }
+        }
+    }
+
     _forwardMessageToObservers(msgReceived);
 }
 
+void LoggerMessageProcessor::filterLogMessages(const RemoteMessage& msgReceived)
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogFilterMessages));
+
+    const ITEM_ID& source{ msgReceived.getSource() };
+    if (mLoggerService.getObservers().contains(source) == false)
+        return;
+
+    uint32_t count{ 0 };
+    NETrace::LogFilters filters;
+    msgReceived.moveToBegin();
+    msgReceived >> count;
+    filters.reserve(count);
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        NETrace::sLogFilter filter;
+        msgReceived >> filter;
+        filters.add(filter);
+    }
+
+    LogMessageFilter compiled;
+    compiled.setFilters(filters);
+    if (compiled.isEmpty())
+    {
+        mObserverFilters.removeAt(source);
+    }
+    else
+    {
+        for (const auto& entry : mSourceScopes.getData())
+        {
+            compiled.updateScopes(entry.second);
+        }
+
+        mObserverFilters.setAt(source, compiled);
+        if (compiled.hasScopePrefix())
+        {
+            // the log sources register scopes only when requested, query them to resolve the scope names.
+            _forwardMessageToLogSources(NETrace::messageQueryScopes(NEService::COOKIE_LOGGER, NEService::COOKIE_ANY));
+        }
+    }
+
+    String msgStatus;
+    constexpr char fmt[]{ "Observer %u set %u log filters ..." };
+    msgStatus.format(fmt, static_cast<uint32_t>(source), count);
+    Logger::printStatus(msgStatus);
+}
+
+void LoggerMessageProcessor::removeAllFilters(void)
+{
+    mObserverFilters.clear();
+    mSourceScopes.clear();
+}
+
 bool LoggerMessageProcessor::isLogSource(NEService::eMessageSource msgSource)
 {
     return ((msgSource == NEService::eMessageSource::MessageSourceClient    ) ||
@@ -253,8 +341,8 @@ inline void LoggerMessageProcessor::_forwardMessageToLogSources(const RemoteMess
             {
                 if (isLogSource(instance.second.ciSource))
                 {
-                    RemoteMessage msg{ msgReceived.clone(source, instance.first) };
-                    mLoggerService.sendMessage(msg);
+                    // the data is shared, only the target differs.
+                    mLoggerService.sendMessage(msgReceived.shareWithTarget(instance.first));
                 }
             }
         }
@@ -281,12 +369,56 @@ inline void LoggerMessageProcessor::_forwardMessageToObservers(const RemoteMessa
         }
         else if (target == NEService::COOKIE_ANY)
         {
+            // the filters are applied only to the log messages.
+            const NETrace::sLogMessage* logMsg{ mObserverFilters.isEmpty() || (msgReceived.getMessageId() != static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage))
+                                                ? nullptr
+                                                : reinterpret_cast<const NETrace::sLogMessage*>(msgReceived.getBuffer()) };
             for (const auto& observer : observers.getData())
             {
                 ASSERT(isLogObserver(observer.second.ciSource));
-                RemoteMessage msg{ msgReceived.clone(source, observer.first) };
-                mLoggerService.sendMessage(msg);
+                if (logMsg != nullptr)
+                {
+                    auto pos = mObserverFilters.find(observer.first);
+                    if (mObserverFilters.isValidPosition(pos) && (mObserverFilters.valueAtPosition(pos).matches(source, *logMsg) == false))
+                        continue;
+                }
+
+                // the data is shared, only the target differs.
+                mLoggerService.sendMessage(msgReceived.shareWithTarget(observer.first));
             }
         }
     }
 }
+
+inline void LoggerMessageProcessor::_saveSourceScopes(const RemoteMessage& msgReceived, bool replace)
+{
+    const ITEM_ID& source{ msgReceived.getSource() };
+    uint32_t count{ 0 };
+    NETrace::ScopeNames scopes;
+    msgReceived.moveToBegin();
+    msgReceived >> count;
+    scopes.reserve(count);
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        NETrace::sScopeInfo scope;
+        msgReceived >> scope;
+        scopes.add(scope);
+    }
+
+    msgReceived.moveToBegin();
+    for (auto pos = mObserverFilters.firstPosition(); mObserverFilters.isValidPosition(pos); pos = mObserverFilters.nextPosition(pos))
+    {
+        mObserverFilters.valueAtPosition(pos).updateScopes(scopes);
+    }
+
+    auto pos = replace ? mSourceScopes.invalidPosition() : mSourceScopes.find(source);
+    if (mSourceScopes.isValidPosition(pos))
+    {
+        // the update contains only the changed scopes of the log source.
+        LogMessageFilter::mergeScopes(mSourceScopes.valueAtPosition(pos), scopes);
+    }
+    else
+    {
+        mSourceScopes.setAt(source, scopes);
+    }
+}
@@ -22,7 +22,9 @@
 
 #include "areg/component/NEService.hpp"
 #include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
 #include "aregextend/service/ServiceCommunicatonBase.hpp"
+#include "logger/service/private/LogMessageFilter.hpp"
 
 /************************************************************************
  * Dependencies
@@ -89,9 +91,10 @@ public:
      * \brief   Called when a connected instance of application requests to register scopes.
      *          The scopes contain names and message priorities to log.
      *          The message is forwarded to the all connected observers to register scopes.
+     *          The scopes are saved to resolve scope names of log message filters.
      * \param   msgReceived     The message to process.
      **/
-    void registerScopesAtObserver(const RemoteMessage & msgReceived) const;
+    void registerScopesAtObserver(const RemoteMessage & msgReceived);
 
     /**
      * \brief   Called when a connected instance of observer requests to update scopes
@@ -119,11 +122,43 @@ public:
      **/
     void saveLogSourceConfiguration(const RemoteMessage & msgReceived);
 
+    /**
+     * \brief   Called when a connected instance of observer queries the statistics of the dispatchers.
+     *          The message is forwarded either to all connected non-observer instances
+     *          or to the certain application to receive the statistics of the dispatchers.
+     * \param   msgReceived     The message to process.
+     **/
+    void queryLogSourceStatistics(const RemoteMessage & msgReceived) const;
+
+    /**
+     * \brief   Called when the connected instance of log source replies the statistics of the dispatchers.
+     *          The message is forwarded to the observer, which queried the statistics.
+     * \param   msgReceived     The message to process.
+     **/
+    void logSourceStatistics(const RemoteMessage & msgReceived) const;
+
     /**
      * \brief   Called to forward the log message to the observer application.
+     *          If the message is forwarded to all observers, it is sent only to
+     *          the observers without filters or which filters match the message.
+     *          If an observer filters scope names and the scopes of the log source are unknown,
+     *          requests the log source to send the list of scopes.
      * \param   msgReceived     The message to process.
      **/
-    void logMessage(const RemoteMessage& msgReceived) const;
+    void logMessage(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Called when a connected instance of observer sets the filters of log messages.
+     *          The filters are compiled and replace the filters set before by the observer.
+     *          An empty list of filters removes filtering.
+     * \param   msgReceived     The message to process.
+     **/
+    void filterLogMessages(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Removes the filters of all observers and the saved scopes of all log sources.
+     **/
+    void removeAllFilters(void);
 
     /**
      * \brief   Called when the connected instance of log source updates the scope priorities.
@@ -148,7 +183,8 @@ public:
     void processNextSaveConfig(void);
 
     /**
-     * \brief   Called when an instance of a log source is disconnected.
+     * \brief   Called when an instance of a log source or observer is disconnected.
+     *          Removes the saved scopes of the log source or the filters of the observer.
      * \param   cookie      The ID of disconnected application.
      **/
     void clientDisconnected(const ITEM_ID& cookie);
@@ -189,6 +225,14 @@ private:
      * \param   msgReceived     The remote message received from a client.
      **/
     inline void _forwardMessageToObservers(const RemoteMessage& msgReceived) const;
+
+    /**
+     * \brief   Saves the list of scopes of a log source and updates the filters of observers.
+     * \param   msgReceived     The message to register or update scopes received from a log source.
+     * \param   replace         If true, the message contains the complete list of scopes, which replaces the saved list.
+     *                          Otherwise, the message contains only updated scopes, which are merged into the saved list.
+     **/
+    inline void _saveSourceScopes(const RemoteMessage& msgReceived, bool replace);
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -202,6 +246,12 @@ private:
     //!< The ID of an application pending to save the configuration.
     ITEM_ID                 mPendingSave;
 
+    //!< The compiled filters of log messages set by observers.
+    TEHashMap<ITEM_ID, LogMessageFilter>        mObserverFilters;
+
+    //!< The last registered scopes of log sources, used to resolve scope name prefixes of filters.
+    TEHashMap<ITEM_ID, NETrace::ScopeNames>     mSourceScopes;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,7 @@ void LoggerServerService::removeAllInstances(void)
     }
 
     mObservers.clear();
+    mLoggerProcessor.removeAllFilters();
 }
 
 void LoggerServerService::dispatchAndForwardLoggerMessage(const RemoteMessage& msgForward)
@@ -153,6 +154,10 @@ void LoggerServerService::dispatchAndForwardLoggerMessage(const RemoteMessage& m
         mLoggerProcessor.saveLogSourceConfiguration(msgForward);
         break;
 
+    case NEService::eFuncIdRange::ServiceLogQueryStatistics:
+        mLoggerProcessor.queryLogSourceStatistics(msgForward);
+        break;
+
     case NEService::eFuncIdRange::EmptyFunctionId:                  // fall through
     case NEService::eFuncIdRange::ComponentCleanup:                 // fall through
     case NEService::eFuncIdRange::RequestRegisterService:           // fall through
@@ -171,6 +176,8 @@ void LoggerServerService::dispatchAndForwardLoggerMessage(const RemoteMessage& m
     case NEService::eFuncIdRange::ServiceLogScopesUpdated:          // fall through
     case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+    case NEService::eFuncIdRange::ServiceLogFilterMessages:         // fall through
+    case NEService::eFuncIdRange::ServiceLogStatistics:             // fall through
     case NEService::eFuncIdRange::RequestFirstId:                   // fall through
     case NEService::eFuncIdRange::ResponseFirstId:                  // fall through
     case NEService::eFuncIdRange::AttributeFirstId:                 // fall through
@@ -233,6 +240,18 @@ void LoggerServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
         NETrace::logMessage(msgReceived);
         break;
 
+    case NEService::eFuncIdRange::ServiceLogFilterMessages:
+        mLoggerProcessor.filterLogMessages(msgReceived);
+        break;
+
+    case NEService::eFuncIdRange::ServiceLogQueryStatistics:
+        mLoggerProcessor.queryLogSourceStatistics(msgReceived);
+        break;
+
+    case NEService::eFuncIdRange::ServiceLogStatistics:
+        mLoggerProcessor.logSourceStatistics(msgReceived);
+        break;
+
     case NEService::eFuncIdRange::SystemServiceConnect:
     case NEService::eFuncIdRange::SystemServiceDisconnect:
         break;
@@ -30,6 +30,7 @@
 /************************************************************************
  * Dependencies.
  ************************************************************************/
+struct sLogDispatcherStats;
 struct sLogInstance;
 struct sLogMessage;
 struct sLogScope;
@@ -64,6 +65,8 @@ private:
         , CMD_LogUpdateScope    //!< Set and update the log scope priorities.
         , CMD_LogSaveConfig     //!< Save the configuration file.
         , CMD_LogStop           //!< Stop log observer.
+        , CMD_LogQueryLogs      //!< Query the saved log messages.
+        , CMD_LogStatistics     //!< Query the statistics of the dispatcher threads.
     };
 
     /**
@@ -111,6 +114,10 @@ private:
         , { eLoggerOptions::CMD_LogSaveConfig   , "Log observer requested to save configuration."   , "Log observer failed to request save config." }
           //!< The status or error message when request to stop logging.
         , { eLoggerOptions::CMD_LogStop         , "Log observer stops, type \'-r\' to resume."      , "Log observer failed to stop. Restart application." }
+          //!< The status or error message when query saved logs.
+        , { eLoggerOptions::CMD_LogQueryLogs    , "Log observer queried saved logs."                , "Log observer failed to query saved logs." }
+          //!< The status or error message when query the statistics of the dispatchers.
+        , { eLoggerOptions::CMD_LogStatistics   , "Log observer queries dispatcher statistics."     , "Log observer failed to query dispatcher statistics." }
     };
 
     //!< The initialized status.
@@ -229,6 +236,15 @@ private:
      **/
     static void callbackLogMessageEx(const unsigned char * logBuffer, uint32_t size);
 
+    /**
+     * \brief   The callback of the event triggered when receive the statistics of the dispatcher threads of an application.
+     *          Outputs the statistics of the dispatchers on the console.
+     * \param   cookie      The cookie ID of the connected instance / application. Same as sLogInstance::liCookie
+     * \param   statistics  The list of the statistics of the dispatcher threads.
+     * \param   count       The number of entries in the list.
+     **/
+    static void callbackLogStatistics(ITEM_ID cookie, const sLogDispatcherStats* statistics, uint32_t count);
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods.
 //////////////////////////////////////////////////////////////////////////
@@ -324,6 +340,25 @@ private:
      **/
     static bool _processQueryScopes(const OptionParser::sOption& optScope);
 
+    /**
+     * \brief   Triggered to query and display the saved log messages of the instance created within the time range.
+     * \param   optLogs     The option entry that contains the cookie ID of the instance and the time range.
+     *                      The time range is set by two numbers of seconds before the current time.
+     *                      For example, '--logs 256 60 0' queries logs of the instance with cookie ID 256
+     *                      created within the last minute. The cookie ID '*' queries logs of all instances.
+     * \return  Returns true if processed with success. Otherwise, returns false.
+     **/
+    static bool _processQueryLogs(const OptionParser::sOption& optLogs);
+
+    /**
+     * \brief   Triggered to query the statistics of the dispatcher threads of the instances.
+     *          The statistics are displayed when received.
+     * \param   optStats    The option entry that contains query command and list of client application IDs to request statistics.
+     *                      If the command contains a list of IDs, it can be separated either by space ' ' or semicolon ';'.
+     * \return  Returns true if processed with success. Otherwise, returns false.
+     **/
+    static bool _processQueryStatistics(const OptionParser::sOption& optStats);
+
     /**
      * \brief   Normalizes the scope to make it suitable to generate property object with the key and value.
      * \param   scope   The scope to normalize.
@@ -21,6 +21,7 @@
 #include "areg/appbase/Application.hpp"
 #include "areg/base/DateTime.hpp"
 #include "areg/base/File.hpp"
+#include "areg/base/NEUtilities.hpp"
 #include "areg/base/String.hpp"
 #include "areg/persist/ConfigManager.hpp"
 #include "aregextend/service/NESystemService.hpp"
@@ -43,6 +44,7 @@ namespace
         , NESystemService::MSG_SEPARATOR
         , {"-e, --query     : Query the list of logging scopes. Usage: --query *, \'*\' can be a cookie ID."}
         , {"-f, --config    : Save current configuration.       Usage: --config"}
+        , {"-g, --logs      : Display saved logs of instance.   Usage: --logs 256 60 0, logs of cookie 256 in last 60 seconds."}
         , {"-h, --help      : Display this message on console.  Usage: --help"}
         , {"-l, --load      : Command line option to configure. Usage: \'./logobserver --load=<path-to-init-file>\'"}
         , {"-n, --instances : Display list of log instances.    Usage: --instances"}
@@ -50,6 +52,7 @@ namespace
         , {"-p, --pause     : Pause the log observer.           Usage: --pause"}
         , {"-q, --quit      : Stop and quit the log observer.   Usage: --quit"}
         , {"-r, --restart   : Start / continue log observer.    Usage: --restart"}
+        , {"-s, --stats     : Display dispatcher statistics.    Usage: --stats *, \'*\' can be a cookie ID."}
         , {"-x, --stop      : Stop log observer.                Usage: --stop"}
         , NESystemService::MSG_SEPARATOR
     };
@@ -78,6 +81,7 @@ const OptionParser::sOptionSetup LogObserver::ValidOptions[ ]
 {
       { "-e", "--query"     , static_cast<int>(eLoggerOptions::CMD_LogQueryScopes)  , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-f", "--config"    , static_cast<int>(eLoggerOptions::CMD_LogSaveConfig)   , OptionParser::STRING_NO_RANGE , {}, {}, {} }
+    , { "-g", "--logs"      , static_cast<int>(eLoggerOptions::CMD_LogQueryLogs)    , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-h", "--help"      , static_cast<int>(eLoggerOptions::CMD_LogPrintHelp)    , OptionParser::NO_DATA         , {}, {}, {} }
     , { "-l", "--load"      , static_cast<int>(eLoggerOptions::CMD_LogLoad)         , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-n", "--instances" , static_cast<int>(eLoggerOptions::CMD_LogInstances)    , OptionParser::NO_DATA         , {}, {}, {} }
@@ -85,6 +89,7 @@ const OptionParser::sOptionSetup LogObserver::ValidOptions[ ]
     , { "-p", "--pause"     , static_cast<int>(eLoggerOptions::CMD_LogPause)        , OptionParser::NO_DATA         , {}, {}, {} }
     , { "-q", "--quit"      , static_cast<int>(eLoggerOptions::CMD_LogQuit)         , OptionParser::NO_DATA         , {}, {}, {} }
     , { "-r", "--restart"   , static_cast<int>(eLoggerOptions::CMD_LogRestart)      , OptionParser::NO_DATA         , {}, {}, {} }
+    , { "-s", "--stats"     , static_cast<int>(eLoggerOptions::CMD_LogStatistics)   , OptionParser::STRING_NO_RANGE , {}, {}, {} }
     , { "-x", "--stop"      , static_cast<int>(eLoggerOptions::CMD_LogStop)         , OptionParser::NO_DATA         , {}, {}, {} }
 };
 
@@ -280,6 +285,46 @@ void LogObserver::callbackLogMessageEx(const unsigned char* logBuffer, uint32_t
     }
 }
 
+void LogObserver::callbackLogStatistics(ITEM_ID cookie, const sLogDispatcherStats* statistics, uint32_t count)
+{
+    static constexpr std::string_view _title{ "Dispatcher statistics of instance %u, times in microseconds:" };
+    static constexpr std::string_view _table{ "  Queue / Peak  |  Dispatched  | Dropped | Cancel | Wait p50 / p99 / max  |  Run p50 / p99 / max  |  Dispatcher " };
+    static constexpr std::string_view _formt{ "  %5u / %-5u  |%12llu  |%8llu |%7llu |%7llu /%6llu /%7llu |%7llu /%6llu /%7llu |  %s " };
+
+    Console& console = Console::getInstance();
+    Console::Coord coord{ NESystemService::COORD_INFO_MSG };
+    console.lockConsole();
+
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    ++coord.posY;
+    console.outputMsg(coord, _title.data(), static_cast<uint32_t>(cookie));
+    ++coord.posY;
+    console.outputTxt(coord, _table);
+    ++coord.posY;
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    ++coord.posY;
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        const sLogDispatcherStats& stats{ statistics[i] };
+        console.outputMsg(coord, _formt.data()
+                            , stats.dsQueueSize, stats.dsQueuePeak
+                            , static_cast<unsigned long long>(stats.dsDispatched)
+                            , static_cast<unsigned long long>(stats.dsDropped)
+                            , static_cast<unsigned long long>(stats.dsCancelled)
+                            , static_cast<unsigned long long>(stats.dsWaitMedian / 1000u)
+                            , static_cast<unsigned long long>(stats.dsWaitP99 / 1000u)
+                            , static_cast<unsigned long long>(stats.dsWaitMax / 1000u)
+                            , static_cast<unsigned long long>(stats.dsRunMedian / 1000u)
+                            , static_cast<unsigned long long>(stats.dsRunP99 / 1000u)
+                            , static_cast<unsigned long long>(stats.dsRunMax / 1000u)
+                            , stats.dsName);
+        ++coord.posY;
+    }
+
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    console.unlockConsole();
+}
+
 void LogObserver::logMain( int argc, char ** argv )
 {
     sObserverEvents evts
@@ -295,6 +340,7 @@ void LogObserver::logMain( int argc, char ** argv )
         , nullptr
         , nullptr
         , &LogObserver::callbackLogMessageEx
+        , &LogObserver::callbackLogStatistics
     };
 
     Application::setWorkingDirectory(nullptr);
@@ -351,6 +397,16 @@ bool LogObserver::_checkCommand(const String& cmd)
                 status = &ObserverStatus[static_cast<uint32_t>(eLoggerOptions::CMD_LogSaveConfig)];
                 break;
 
+            case LogObserver::eLoggerOptions::CMD_LogQueryLogs:
+                processed = LogObserver::_processQueryLogs(opt);
+                status = &ObserverStatus[static_cast<uint32_t>(eLoggerOptions::CMD_LogQueryLogs)];
+                break;
+
+            case LogObserver::eLoggerOptions::CMD_LogStatistics:
+                processed = LogObserver::_processQueryStatistics(opt);
+                status = &ObserverStatus[static_cast<uint32_t>(eLoggerOptions::CMD_LogStatistics)];
+                break;
+
             case LogObserver::eLoggerOptions::CMD_LogPrintHelp:
                 processed = LogObserver::_processPrintHelp();
                 status = &ObserverStatus[static_cast<uint32_t>(eLoggerOptions::CMD_LogPrintHelp)];
@@ -667,6 +723,88 @@ bool LogObserver::_processQueryScopes(const OptionParser::sOption& optScope)
     return result;
 }
 
+bool LogObserver::_processQueryLogs(const OptionParser::sOption& optLogs)
+{
+    static constexpr std::string_view _table{ "  Time                      |  Inst. ID  |  Prio   |  Message " };
+    static constexpr std::string_view _formt{ "  %s |%11u |  %-6s |  %s " };
+    static constexpr std::string_view _found{ "Found %u log messages, displayed last %u ..." };
+    constexpr uint32_t maxLogs{ 1000u };
+    constexpr uint32_t maxLines{ 10u };
+
+    const OptionParser::StrList& optValues{ optLogs.inString };
+    if (optValues.empty())
+        return false;
+
+    ITEM_ID cookie{ ID_IGNORE };
+    if ((optValues[0] != NEPersistence::SYNTAX_ALL_MODULES) && optValues[0].isNumeric())
+    {
+        cookie = optValues[0].toUInt64();
+    }
+
+    const TIME64 now{ DateTime::getNow().getTime() };
+    const TIME64 secBegin{ optValues.size() > 1 ? static_cast<TIME64>(optValues[1].toUInt64()) : 60u };
+    const TIME64 secEnd  { optValues.size() > 2 ? static_cast<TIME64>(optValues[2].toUInt64()) : 0u };
+    const TIME64 timeBegin{ now - MACRO_MAX(secBegin, secEnd) * NEUtilities::SEC_TO_MICROSECS };
+    const TIME64 timeEnd  { now - MACRO_MIN(secBegin, secEnd) * NEUtilities::SEC_TO_MICROSECS };
+
+    TEArrayList<sLogMessage> logs(maxLogs, maxLogs);
+    const uint32_t count{ ::logObserverQueryLogs(cookie, timeBegin, timeEnd, &logs[0], maxLogs) };
+    const uint32_t first{ count > maxLines ? count - maxLines : 0u };
+
+    Console& console = Console::getInstance();
+    Console::Coord coord{ NESystemService::COORD_INFO_MSG };
+    console.lockConsole();
+
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    ++coord.posY;
+    console.outputMsg(coord, _found.data(), count, count - first);
+    ++coord.posY;
+    console.outputTxt(coord, _table);
+    ++coord.posY;
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    ++coord.posY;
+    for (uint32_t i = first; i < count; ++ i)
+    {
+        const sLogMessage& log{ logs[i] };
+        const String time{ DateTime(log.msgTimestamp).formatTime() };
+        const String& prio{ NETrace::logPrioToString(static_cast<NETrace::eLogPriority>(log.msgPriority)) };
+        console.outputMsg(coord, _formt.data(), time.getString(), static_cast<uint32_t>(log.msgCookie), prio.getString(), log.msgLogText);
+        ++coord.posY;
+    }
+
+    console.outputTxt(coord, NESystemService::MSG_SEPARATOR);
+    console.unlockConsole();
+
+    return true;
+}
+
+bool LogObserver::_processQueryStatistics(const OptionParser::sOption& optStats)
+{
+    bool result{ true };
+    TEArrayList<ITEM_ID> listTargets;
+    if (optStats.inString.empty() || (optStats.inString[0] == NEPersistence::SYNTAX_ALL_MODULES))
+    {
+        listTargets.add(ID_IGNORE);
+    }
+    else
+    {
+        for (const auto& elem : optStats.inString)
+        {
+            if (elem.isNumeric())
+            {
+                listTargets.add(elem.toUInt64());
+            }
+        }
+    }
+
+    for (const auto& target : listTargets.getData())
+    {
+        result &= ::logObserverRequestStatistics(target);
+    }
+
+    return result;
+}
+
 String LogObserver::_normalizeScopeProperty(const String & scope)
 {
     const NEPersistence::sPropertyKey& propKey{ NEPersistence::DefaultPropertyKeys[static_cast<uint32_t>(NEPersistence::eConfigKeys::EntryLogScope)] };
@@ -93,6 +93,16 @@ protected:
      **/
     virtual void unregisterServiceConsumer( const ProxyAddress & proxyService, const NEService::eDisconnectReason reason ) override;
 
+    /**
+     * \brief   Call to register the lists of service providers and service consumers at once.
+     *          It is called when the connection is established to register all public services,
+     *          and has the same effect as registering each service provider and service consumer.
+     * \param   listStubs   The addresses of service providers to register in the system.
+     * \param   listProxies The addresses of service consumers to register in the system.
+     * \return  Returns true if registration process started with success. Otherwise, it returns false.
+     **/
+    virtual bool registerServices( const TEArrayList<StubAddress> & listStubs, const TEArrayList<ProxyAddress> & listProxies ) override;
+
 /************************************************************************/
 // IEServiceRegisterConsumer interface overrides
 /************************************************************************/
@@ -208,6 +218,21 @@ protected:
      **/
     virtual void disconnectServices( void ) override;
 
+/************************************************************************/
+// IEServiceConnectionProvider overrides
+/************************************************************************/
+
+    /**
+     * \brief   Creates the service connect notification message, sets the message target and the source.
+     *          The router appends the optional features it supports, so that the connected
+     *          client registers the services in one message only if the router confirms it.
+     * \param   source      The ID of the source that sends connection message.
+     * \param   target      The ID of the target to send the connection message.
+     * \param   msgSource   The message source type of the connected client.
+     * \return  Returns the created message for remote communication.
+     **/
+    virtual RemoteMessage createServiceConnectMessage( const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource ) const override;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods.
 //////////////////////////////////////////////////////////////////////////
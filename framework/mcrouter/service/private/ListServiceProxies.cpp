@@ -18,6 +18,30 @@
 
 const ServiceProxy     ListServiceProxies::InvalidProxyService;
 
+ListServiceProxies::ListServiceProxies( const ListServiceProxies & source )
+    : ListServiceProxiesBase( static_cast<const ListServiceProxiesBase &>(source) )
+    , mProxyIndex           ( )
+{
+    _rebuildIndex();
+}
+
+ListServiceProxies & ListServiceProxies::operator = ( const ListServiceProxies & source )
+{
+    if (this != &source)
+    {
+        ListServiceProxiesBase::operator = (static_cast<const ListServiceProxiesBase &>(source));
+        _rebuildIndex();
+    }
+
+    return (*this);
+}
+
+void ListServiceProxies::clear( void )
+{
+    mProxyIndex.clear();
+    ListServiceProxiesBase::clear();
+}
+
 const ServiceProxy & ListServiceProxies::getService( const ProxyAddress & addrProxy ) const
 {
     ListServiceProxies::LISTPOS pos = _findProxy(addrProxy);
@@ -35,8 +59,7 @@ ServiceProxy & ListServiceProxies::registerService( const ProxyAddress & addrPro
     ListServiceProxies::LISTPOS pos = _findProxy(addrProxy);
     if ( isInvalidPosition(pos) )
     {
-        pushLast(ServiceProxy(addrProxy));
-        pos = lastPosition();
+        pos = _pushProxy(ServiceProxy(addrProxy));
     }
 
     return static_cast<ServiceProxy &>(valueAtPosition(pos));
@@ -47,8 +70,7 @@ ServiceProxy & ListServiceProxies::registerService(const ProxyAddress & addrProx
     ListServiceProxies::LISTPOS pos = _findProxy(addrProxy);
     if (isInvalidPosition(pos))
     {
-        pushLast(ServiceProxy(addrProxy));
-        pos = lastPosition();
+        pos = _pushProxy(ServiceProxy(addrProxy));
     }
 
     const StubAddress & addrStub = stubService.getServiceAddress();
@@ -70,15 +92,11 @@ ServiceProxy & ListServiceProxies::registerService(const ProxyAddress & addrProx
 ServiceProxy ListServiceProxies::unregisterService( const ProxyAddress & addrProxy )
 {
     ServiceProxy result;
-    for (ListServiceProxies::LISTPOS pos = firstPosition( ); isValidPosition(pos); pos = nextPosition(pos) )
+    ListServiceProxies::LISTPOS pos = _findProxy(addrProxy);
+    if ( isValidPosition(pos) )
     {
-        const ServiceProxy & proxyService = valueAtPosition(pos);
-        if ( proxyService == addrProxy )
-        {
-            result = proxyService;
-            removeAt(pos);
-            break;
-        }
+        mProxyIndex.removeAt(addrProxy);
+        removeAt(pos, result);
     }
 
     return result;
@@ -116,7 +134,7 @@ int ListServiceProxies::getSpecificService(ListServiceProxies & out_listProxies,
         if ( proxyService.getServiceAddress().getCookie() == cookie )
         {
             result += 1;
-            out_listProxies.pushLast(proxyService);
+            out_listProxies._pushProxy(proxyService);
         }
     }
     return result;
@@ -124,12 +142,23 @@ int ListServiceProxies::getSpecificService(ListServiceProxies & out_listProxies,
 
 ListServiceProxies::LISTPOS ListServiceProxies::_findProxy(const ProxyAddress & addrProxy) const
 {
-    LISTPOS pos = firstPosition( );
-    for ( ; isValidPosition(pos); pos = nextPosition(pos))
-    {
-        if ( valueAtPosition(pos) == addrProxy )
-            break;
-    }
+    ProxyIndex::MAPPOS pos = mProxyIndex.find(addrProxy);
+    return (mProxyIndex.isValidPosition(pos) ? mProxyIndex.valueAtPosition(pos) : invalidPosition());
+}
 
+ListServiceProxies::LISTPOS ListServiceProxies::_pushProxy(const ServiceProxy & proxyService)
+{
+    pushLast(proxyService);
+    LISTPOS pos = lastPosition();
+    mProxyIndex.setAt(proxyService.getServiceAddress(), pos);
     return pos;
 }
+
+void ListServiceProxies::_rebuildIndex(void)
+{
+    mProxyIndex.clear();
+    for ( LISTPOS pos = firstPosition( ); isValidPosition(pos); pos = nextPosition(pos) )
+    {
+        mProxyIndex.setAt(valueAtPosition(pos).getServiceAddress(), pos);
+    }
+}
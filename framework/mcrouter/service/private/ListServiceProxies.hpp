@@ -19,6 +19,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/TEHashMap.hpp"
 #include "areg/base/TELinkedList.hpp"
 #include "mcrouter/service/private/ServiceProxy.hpp"
 
@@ -33,8 +34,13 @@ using ListServiceProxiesBase = TELinkedList<ServiceProxy>;
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The list of remote service proxies registered in network.
+ *          The list keeps the index of proxy addresses, so that the proxy
+ *          is found without iterating the list. The list is inherited privately,
+ *          the entries are added and removed only via methods of this class,
+ *          which keep the index valid. The methods of the list to iterate
+ *          the entries are public.
  **/
-class ListServiceProxies  : public ListServiceProxiesBase
+class ListServiceProxies  : private ListServiceProxiesBase
 {
 //////////////////////////////////////////////////////////////////////////
 // The internal constants and types
@@ -45,6 +51,14 @@ private:
      **/
     static const ServiceProxy     InvalidProxyService;
 
+    /**
+     * \brief   The index of proxy addresses and the positions in the list.
+     **/
+    using ProxyIndex    = TEHashMap<ProxyAddress, ListServiceProxiesBase::LISTPOS>;
+
+public:
+    using ListServiceProxiesBase::LISTPOS;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -58,7 +72,7 @@ public:
      * \brief   Copies the list of proxies from the given source.
      * \param   source  The source of proxy list to copy
      **/
-    ListServiceProxies( const ListServiceProxies & source ) = default;
+    ListServiceProxies( const ListServiceProxies & source );
 
     /**
      * \brief   Moves the list of proxies from the given source.
@@ -79,7 +93,7 @@ public:
      * \brief   Empties existing list and copies all entries from given source.
      * \param   source  The source of proxy list to copy
      **/
-    ListServiceProxies & operator = ( const ListServiceProxies & source ) = default;
+    ListServiceProxies & operator = ( const ListServiceProxies & source );
 
     /**
      * \brief   Empties existing list and moves all entries from given source.
@@ -87,6 +101,21 @@ public:
      **/
     ListServiceProxies & operator = ( ListServiceProxies && source ) noexcept = default;
 
+    using ListServiceProxiesBase::isEmpty;
+    using ListServiceProxiesBase::getSize;
+    using ListServiceProxiesBase::firstPosition;
+    using ListServiceProxiesBase::lastPosition;
+    using ListServiceProxiesBase::nextPosition;
+    using ListServiceProxiesBase::isValidPosition;
+    using ListServiceProxiesBase::isInvalidPosition;
+    using ListServiceProxiesBase::invalidPosition;
+    using ListServiceProxiesBase::valueAtPosition;
+
+    /**
+     * \brief   Removes all entries of the list and the index of proxy addresses.
+     **/
+    void clear( void );
+
     /**
      * \brief   Returns true if specified proxy is already registered in the list.
      * \param   addrProxy   The address of proxy service to check.
@@ -188,6 +217,27 @@ private:
      * \return  Returns valid position value if entry found. Otherwise, returns nullptr.
      **/
     LISTPOS _findProxy( const ProxyAddress & addrProxy ) const;
+
+    /**
+     * \brief   Adds the service proxy entry at the end of the list and indexes the address.
+     * \param   proxyService    The service proxy entry to add.
+     * \return  Returns the position of new entry.
+     **/
+    LISTPOS _pushProxy( const ServiceProxy & proxyService );
+
+    /**
+     * \brief   Rebuilds the index of proxy addresses.
+     **/
+    void _rebuildIndex( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The index of proxy addresses.
+     **/
+    ProxyIndex  mProxyIndex;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@ DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_registerServiceProvider);
 DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_unregisterServiceProvider);
 DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_registerServiceConsumer);
 DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_unregisterServiceConsumer);
+DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_registerServices);
 
 DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_registeredRemoteServiceProvider);
 DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_registeredRemoteServiceConsumer);
@@ -71,6 +72,13 @@ void RouterServerService::unregisterServiceConsumer(const ProxyAddress & /* prox
     TRACE_ERR("Method is not implemented, this should not be called");
 }
 
+bool RouterServerService::registerServices(const TEArrayList<StubAddress> & /* listStubs */, const TEArrayList<ProxyAddress> & /* listProxies */)
+{
+    TRACE_SCOPE(mcrouter_service_RouterServerService_registerServices);
+    TRACE_ERR("Method is not implemented, this should not be called");
+    return false;
+}
+
 void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgReceived)
 {
     TRACE_SCOPE(mcrouter_service_RouterServerService_onServiceMessageReceived);
@@ -110,6 +118,32 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
                 }
                 break;
 
+            case NEService::eServiceRequestType::RegisterServices:
+                {
+                    // register all stubs first, so that the proxies of the same message
+                    // find the stubs and are connected without waiting.
+                    uint32_t count{ 0 };
+                    msgReceived >> count;
+                    TRACE_DBG("Registering [ %u ] stubs of source [ %u ]", count, static_cast<uint32_t>(source));
+                    for (uint32_t i = 0; i < count; ++ i)
+                    {
+                        StubAddress stubService(msgReceived);
+                        stubService.setSource(source);
+                        registeredRemoteServiceProvider(stubService);
+                    }
+
+                    count = 0;
+                    msgReceived >> count;
+                    TRACE_DBG("Registering [ %u ] proxies of source [ %u ]", count, static_cast<uint32_t>(source));
+                    for (uint32_t i = 0; i < count; ++ i)
+                    {
+                        ProxyAddress proxyService(msgReceived);
+                        proxyService.setSource(source);
+                        registeredRemoteServiceConsumer(proxyService);
+                    }
+                }
+                break;
+
             case NEService::eServiceRequestType::UnregisterStub:
                 {
                     StubAddress stubService(msgReceived);
@@ -183,6 +217,9 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
     case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
     case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+    case NEService::eFuncIdRange::ServiceLogFilterMessages:         // fall through
+    case NEService::eFuncIdRange::ServiceLogQueryStatistics:        // fall through
+    case NEService::eFuncIdRange::ServiceLogStatistics:             // fall through
         break;
 
     case NEService::eFuncIdRange::ResponseServiceProviderConnection:// fall through
@@ -243,6 +280,13 @@ void RouterServerService::onServiceMessageSend(const RemoteMessage &msgSend)
     }
 }
 
+RemoteMessage RouterServerService::createServiceConnectMessage(const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource) const
+{
+    RemoteMessage result{ ServiceCommunicatonBase::createServiceConnectMessage(source, target, msgSource) };
+    result << static_cast<uint32_t>(NERemoteService::eServiceFeatures::FeatureRegisterServices);
+    return result;
+}
+
 void RouterServerService::disconnectServices(void)
 {
     ServiceCommunicatonBase::disconnectServices( );
@@ -286,7 +330,7 @@ void RouterServerService::registeredRemoteServiceProvider(const StubAddress & st
                         , listProxies.getSize());
 
             TEArrayList<ITEM_ID> sendList;
-            for (ListServiceProxiesBase::LISTPOS pos = listProxies.firstPosition(); listProxies.isValidPosition(pos); pos = listProxies.nextPosition(pos) )
+            for (ListServiceProxies::LISTPOS pos = listProxies.firstPosition(); listProxies.isValidPosition(pos); pos = listProxies.nextPosition(pos) )
             {
                 const ServiceProxy & proxyService = listProxies.valueAtPosition(pos);
                 const ProxyAddress & addrProxy    = proxyService.getServiceAddress();
@@ -412,7 +456,7 @@ void RouterServerService::unregisteredRemoteServiceProvider(const StubAddress &
         TRACE_DBG("Filter sources [ %u ] of proxy list", static_cast<unsigned int>(cookie));
 
         TEArrayList<ITEM_ID> sendList;
-        for (ListServiceProxiesBase::LISTPOS pos = listProxies.firstPosition(); listProxies.isValidPosition(pos); pos = listProxies.nextPosition(pos) )
+        for (ListServiceProxies::LISTPOS pos = listProxies.firstPosition(); listProxies.isValidPosition(pos); pos = listProxies.nextPosition(pos) )
         {
             const ServiceProxy & proxyService = listProxies.valueAtPosition(pos);
             const ProxyAddress & addrProxy    = proxyService.getServiceAddress();
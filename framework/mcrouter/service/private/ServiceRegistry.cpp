@@ -40,6 +40,18 @@ const ListServiceProxies  ServiceRegistry::EmptyProxiesList;
 // ServiceRegistry class methods
 //////////////////////////////////////////////////////////////////////////
 
+ServiceRegistry::ServiceRegistry( void )
+    : ServiceRegistryBase   ( )
+    , mSourceIndex          ( )
+{
+}
+
+void ServiceRegistry::clear( void )
+{
+    ServiceRegistryBase::clear();
+    mSourceIndex.clear();
+}
+
 bool ServiceRegistry::isServiceRegistered(const StubAddress & addrStub) const
 {
     return contains(ServiceStub(addrStub));
@@ -101,6 +113,11 @@ const ServiceStub & ServiceRegistry::registerServiceProxy(const ProxyAddress & a
                         , NEService::getString(result.getServiceStatus()));
     }
 
+    if (out_proxyService.isValid())
+    {
+        mSourceIndex.addProxy(addrProxy.getSource(), addrProxy);
+    }
+
     return result;
 }
 
@@ -114,6 +131,12 @@ const ServiceStub & ServiceRegistry::unregisterServiceProxy(const ProxyAddress &
         const ServiceStub & stub = keyAtPosition(pos);
         ListServiceProxies & proxies = valueAtPosition(pos);
         out_proxyService = proxies.unregisterService(addrProxy);
+        if (out_proxyService.isValid())
+        {
+            const ProxyAddress & proxy = out_proxyService.getServiceAddress();
+            mSourceIndex.removeProxy(proxy.getSource(), proxy);
+        }
+
         if ( proxies.isEmpty() && (stub.isValid() == false) )
         {
             TRACE_INFO("Proxy [ %s ] is unregistered, remove empty and invalid service entry with status [ %s ]"
@@ -148,6 +171,11 @@ const ServiceStub & ServiceRegistry::registerServiceStub(const StubAddress & add
     ASSERT(isValidPosition(pos.first));
     ServiceStub& result = keyAtPosition(pos.first);
     ListServiceProxies& proxies = valueAtPosition(pos.first);
+    if ( result.isValid() )
+    {
+        const StubAddress & stub = result.getServiceAddress();
+        mSourceIndex.removeStub(stub.getSource(), stub);
+    }
 
     if ( pos.second )
     {
@@ -168,6 +196,11 @@ const ServiceStub & ServiceRegistry::registerServiceStub(const StubAddress & add
                     , out_listProxies.getSize());
     }
 
+    if ( result.isValid() )
+    {
+        mSourceIndex.addStub(addrStub.getSource(), result.getServiceAddress());
+    }
+
     return result;
 }
 
@@ -180,6 +213,11 @@ const ServiceStub & ServiceRegistry::unregisterServiceStub(const StubAddress & a
     {
         ServiceStub & stub = keyAtPosition(pos);
         ListServiceProxies & proxies = valueAtPosition(pos);
+        if ( stub.isValid() )
+        {
+            const StubAddress & addrRegistered = stub.getServiceAddress();
+            mSourceIndex.removeStub(addrRegistered.getSource(), addrRegistered);
+        }
 
         stub.setServiceStatus( NEService::eServiceConnection::ServicePending );
         proxies.stubServiceUnavailable( );
@@ -219,92 +257,50 @@ void ServiceRegistry::getServiceList(const ITEM_ID & cookie , TEArrayList<StubAd
     TRACE_SCOPE(mcrouter_service_private_ServiceRegistry_getServiceList);
     TRACE_DBG("Filter service list for cookie [ %u ]", static_cast<unsigned int>(cookie));
 
-    for (ServiceRegistryBase::MAPPOS posMap = firstPosition(); isValidPosition(posMap); posMap = nextPosition(posMap) )
+    if (cookie == NEService::COOKIE_ANY)
     {
-        const ServiceStub & svcStub  = keyAtPosition(posMap);
-        const StubAddress & addrStub = svcStub.getServiceAddress();
-        const ListServiceProxies & listProxies = valueAtPosition(posMap);
-
-        if ( svcStub.isValid() && ((cookie == NEService::COOKIE_ANY) || (addrStub.getCookie() == cookie)) )
-        {
-            TRACE_INFO("The cookie [ %u ] of service [ %s ] with status [ %s ] match criteria."
-                        , static_cast<unsigned int>(addrStub.getCookie())
-                        , StubAddress::convAddressToPath(addrStub).getString()
-                        , NEService::getString(svcStub.getServiceStatus()));
-
-            out_stubServiceList.add(addrStub);
-        }
-        else
+        mSourceIndex.getServices(cookie, out_stubServiceList, out_proxyServiceList);
+    }
+    else
+    {
+        // The cookie of address registered in the router is the source cookie.
+        // Pick up the services of the source and filter by the cookie of the address.
+        TEArrayList<StubAddress>  listStubs;
+        TEArrayList<ProxyAddress> listProxies;
+        mSourceIndex.getServices(cookie, listStubs, listProxies);
+        for (uint32_t i = 0; i < listStubs.getSize(); ++ i)
         {
-            TRACE_DBG("Ignore stub [ %s ] with cookie [ %u ] and status [ %s ]"
-                        , StubAddress::convAddressToPath(addrStub).getString()
-                        , static_cast<unsigned int>(addrStub.getCookie())
-                        , NEService::getString(svcStub.getServiceStatus()));
+            if (listStubs[i].getCookie() == cookie)
+            {
+                out_stubServiceList.add(listStubs[i]);
+            }
         }
 
-        for (ListServiceProxiesBase::LISTPOS posList = listProxies.firstPosition(); listProxies.isValidPosition(posList); posList = listProxies.nextPosition(posList) )
+        for (uint32_t i = 0; i < listProxies.getSize(); ++ i)
         {
-            const ServiceProxy & svcProxy   = listProxies.valueAtPosition(posList);
-            const ProxyAddress & addrProxy  = svcProxy.getServiceAddress();
-            if ( svcProxy.isValid() && ((cookie == NEService::COOKIE_ANY) || (addrProxy.getCookie() == cookie)) )
+            if (listProxies[i].getCookie() == cookie)
             {
-                TRACE_INFO("The cookie [ %u ] of proxy [ %s ] with status [ %s ] match criteria."
-                            , static_cast<unsigned int>(addrProxy.getCookie())
-                            , ProxyAddress::convAddressToPath(addrProxy).getString()
-                            , NEService::getString(svcProxy.getServiceStatus()));
-
-                out_proxyServiceList.add(addrProxy);
-            }
-            else
-            {
-                TRACE_DBG("Ignore proxy [ %s ] with cookie [ %u ] and status [ %s ]"
-                            , ProxyAddress::convAddressToPath(addrProxy).getString()
-                            , static_cast<unsigned int>(addrProxy.getCookie())
-                            , NEService::getString(svcProxy.getServiceStatus()));
+                out_proxyServiceList.add(listProxies[i]);
             }
         }
     }
+
+    TRACE_DBG("Found [ %u ] stubs and [ %u ] proxies of cookie [ %u ]"
+                , out_stubServiceList.getSize()
+                , out_proxyServiceList.getSize()
+                , static_cast<unsigned int>(cookie));
 }
 
 void ServiceRegistry::getServiceSources(const ITEM_ID & cookie, TEArrayList<StubAddress> & OUT stubSource, TEArrayList<ProxyAddress> & OUT proxySources)
 {
     TRACE_SCOPE(mcrouter_service_private_ServiceRegistry_getServiceSources);
-    TRACE_DBG("Pickup services with [ %u ] sources ", static_cast<unsigned int>(cookie));
-
-    for (ServiceRegistry::MAPPOS posMap = firstPosition(); isValidPosition(posMap); posMap = nextPosition(posMap) )
-    {
-        const ServiceStub & svcStub  = keyAtPosition(posMap);
-        const StubAddress & addrStub = svcStub.getServiceAddress();
-        const ListServiceProxies & listProxies = valueAtPosition(posMap);
 
-        if (svcStub.isValid() && (cookie == addrStub.getSource()))
-        {
-            TRACE_INFO("Found stub [ %s ] of source [ %u ]", addrStub.convToString().getString(), static_cast<unsigned int>(cookie));
-            stubSource.add(addrStub);
-        }
-        else
-        {
-            TRACE_DBG("Ignore stub [ %s ], it is either invalid or different source than [ %u ]"
-                        , addrStub.convToString().getString()
-                        , static_cast<unsigned int>(cookie));
-        }
-
-        for (ListServiceProxiesBase::LISTPOS posList = listProxies.firstPosition(); listProxies.isValidPosition(posList); posList = listProxies.nextPosition(posList) )
-        {
-            const ServiceProxy & svcProxy   = listProxies.valueAtPosition(posList);
-            const ProxyAddress & addrProxy  = svcProxy.getServiceAddress();
+    mSourceIndex.getServices(cookie, stubSource, proxySources);
 
-            if (svcProxy.isValid() && (cookie == addrProxy.getSource()))
-            {
-                TRACE_INFO("Found proxy [ %s ] of source [ %u ]", addrProxy.convToString().getString(), static_cast<unsigned int>(cookie));
-                proxySources.add(addrProxy);
-            }
-            else
-            {
-                TRACE_DBG("Ignore proxy [ %s ], it is either invalid or has different source than [ %u ]", addrProxy.convToString().getString(), static_cast<unsigned int>(cookie));
-            }
-        }
-    }
+    TRACE_DBG("Found [ %u ] stubs and [ %u ] proxies of source [ %u ]"
+                , stubSource.getSize()
+                , proxySources.getSize()
+                , static_cast<unsigned int>(cookie));
 }
 
 const ServiceStub & ServiceRegistry::disconnectProxy(const ProxyAddress & IN addrProxy)
@@ -23,6 +23,7 @@
 #include "mcrouter/service/private/ServiceStub.hpp"
 #include "mcrouter/service/private/ListServiceProxies.hpp"
 #include "areg/base/TEArrayList.hpp"
+#include "areg/ipc/RemoteServiceIndex.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // ServiceRegistry class declaration
@@ -31,6 +32,10 @@ using ServiceRegistryBase = TEHashMap<ServiceStub, ListServiceProxies>;
 
 /**
  * \brief   The remote services registration map, which is a map of stub and list of connected proxies.
+ *          The registry keeps the index of registered stubs and proxies by the source
+ *          connection cookie, so that the services of disconnected source are found
+ *          without iterating all services. In the router, the cookie of the registered
+ *          service address is the cookie of the source connection.
  **/
 class ServiceRegistry   : public ServiceRegistryBase
 {
@@ -57,7 +62,7 @@ public:
     /**
      * \brief   Default constructor
      **/
-    ServiceRegistry( void ) = default;
+    ServiceRegistry( void );
     /**
      * \brief   Destructor
      **/
@@ -68,6 +73,11 @@ public:
 //////////////////////////////////////////////////////////////////////////
 public:
 
+    /**
+     * \brief   Removes all registered services and clears the index of sources.
+     **/
+    void clear( void );
+
     /**
      * \brief   Returns true if passed stub service is already registered.
      * \param   addrStub    The remote servicing stub object to check.
@@ -196,6 +206,15 @@ private:
      **/
     MAPPOS findService( const ServiceAddress & addrService ) const;
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The valid stubs and proxies indexed by the source connection cookie.
+     **/
+    RemoteServiceIndex  mSourceIndex;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
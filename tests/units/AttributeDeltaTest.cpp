@@ -0,0 +1,233 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/AttributeDeltaTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the delta of the serialized attribute data.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/AttributeDelta.hpp"
+#include "areg/component/EventDataStream.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+
+namespace
+{
+    template<typename Type>
+    EventDataStream _serialize( const Type & value )
+    {
+        EventDataStream data(EventDataStream::eEventData::EventDataExternal);
+        data.getStreamForWrite() << value;
+        return data;
+    }
+
+    template<typename Type>
+    Type _deserialize( const EventDataStream & data )
+    {
+        Type value;
+        data.resetCursor();
+        data.getStreamForRead() >> value;
+        return value;
+    }
+
+    unsigned int _sizeOf( const EventDataStream & data )
+    {
+        BufferView view;
+        data.getDataView(view);
+        return view.getSize();
+    }
+}
+
+/**
+ * \brief   Checks that the change of one entry of a large array is sent as
+ *          a small patch, which restores the array on the receiving side.
+ **/
+TEST( AttributeDeltaTest, PatchArrayEntry )
+{
+    TEArrayList<uint32_t> array;
+    for (uint32_t i = 0; i < 10000; ++ i)
+    {
+        array.add(i);
+    }
+
+    AttributeDelta stub, proxy;
+    EventDataStream snapshot(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream first{ _serialize(array) };
+    ASSERT_TRUE( stub.encodeUpdate(first, snapshot) );
+    EXPECT_GT( _sizeOf(snapshot), _sizeOf(first) );
+
+    EventDataStream restored(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( proxy.decode(snapshot, restored) );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(restored), array );
+
+    array[5000] = 0xFFFFFFFFu;
+    array[9999] = 1u;
+    EventDataStream patch(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), patch) );
+    EXPECT_LT( _sizeOf(patch), 64u );
+
+    EventDataStream updated(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( proxy.decode(patch, updated) );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(updated), array );
+    EXPECT_EQ( proxy.getImage().getSize(), stub.getImage().getSize() );
+}
+
+/**
+ * \brief   Checks that the changed value of a map entry is sent as a patch.
+ **/
+TEST( AttributeDeltaTest, PatchMapEntry )
+{
+    TEHashMap<uint32_t, uint32_t> map;
+    for (uint32_t i = 0; i < 2000; ++ i)
+    {
+        map.setAt(i, i * 2);
+    }
+
+    AttributeDelta stub, proxy;
+    EventDataStream snapshot(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restored(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(map), snapshot) );
+    ASSERT_TRUE( proxy.decode(snapshot, restored) );
+
+    map.setAt(1000, 1);
+    EventDataStream patch(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream updated(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(map), patch) );
+    EXPECT_LT( _sizeOf(patch), 64u );
+    ASSERT_TRUE( proxy.decode(patch, updated) );
+    EXPECT_EQ( (_deserialize<TEHashMap<uint32_t, uint32_t>>(updated)), map );
+}
+
+/**
+ * \brief   Checks that the inserted and removed entries are sent as a patch.
+ **/
+TEST( AttributeDeltaTest, PatchResize )
+{
+    TEArrayList<uint32_t> array;
+    for (uint32_t i = 0; i < 2000; ++ i)
+    {
+        array.add(i);
+    }
+
+    AttributeDelta stub, proxy;
+    EventDataStream snapshot(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restored(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), snapshot) );
+    ASSERT_TRUE( proxy.decode(snapshot, restored) );
+
+    array.insertAt(1500, 0xABCDu);
+    EventDataStream inserted(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restoredInserted(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), inserted) );
+    EXPECT_LT( _sizeOf(inserted), 64u );
+    ASSERT_TRUE( proxy.decode(inserted, restoredInserted) );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(restoredInserted), array );
+
+    array.removeAt(1900);
+    array.removeAt(1800);
+    EventDataStream removed(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restoredRemoved(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), removed) );
+    EXPECT_LT( _sizeOf(removed), _sizeOf(snapshot) / 2 );
+    ASSERT_TRUE( proxy.decode(removed, restoredRemoved) );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(restoredRemoved), array );
+}
+
+/**
+ * \brief   Checks that the patch is rejected without the image it is based on
+ *          and the receiver recovers with the snapshot of the new listener.
+ **/
+TEST( AttributeDeltaTest, SnapshotRecovery )
+{
+    TEArrayList<uint32_t> array(4096);
+    for (uint32_t i = 0; i < 4096; ++ i)
+    {
+        array.add(i * 3);
+    }
+
+    AttributeDelta stub, proxy;
+    EventDataStream snapshot(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), snapshot) );
+
+    array[10] = 7u;
+    EventDataStream patch(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restored(EventDataStream::eEventData::EventDataExternal);
+    const EventDataStream current{ _serialize(array) };
+    ASSERT_TRUE( stub.encodeUpdate(current, patch) );
+    EXPECT_FALSE( proxy.decode(patch, restored) );
+    EXPECT_FALSE( proxy.hasImage() );
+
+    // the listener requests the snapshot, the image of the stub remains unchanged.
+    proxy.setSnapshotPending(true);
+    const BufferView image{ stub.getImage() };
+    EventDataStream resync(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeSnapshot(_serialize(array), resync) );
+    EXPECT_EQ( stub.getImage().getData(), image.getData() );
+
+    EventDataStream recovered(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( proxy.decode(resync, recovered) );
+    EXPECT_FALSE( proxy.isSnapshotPending() );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(recovered), array );
+
+    array[20] = 9u;
+    EventDataStream next(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restoredNext(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), next) );
+    ASSERT_TRUE( proxy.decode(next, restoredNext) );
+    EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(restoredNext), array );
+}
+
+/**
+ * \brief   Checks that the delta updates of an array of 40 KB, which entries are changed
+ *          one by one, restore the array and are 100 times smaller than the whole updates.
+ **/
+TEST( AttributeDeltaTest, DeltaUpdateSize )
+{
+    constexpr uint32_t entries{ 10000 };
+    constexpr uint32_t updates{ 100 };
+
+    TEArrayList<uint32_t> array(entries);
+    for (uint32_t i = 0; i < entries; ++ i)
+    {
+        array.add(i);
+    }
+
+    AttributeDelta stub, proxy;
+    EventDataStream snapshot(EventDataStream::eEventData::EventDataExternal);
+    EventDataStream restored(EventDataStream::eEventData::EventDataExternal);
+    ASSERT_TRUE( stub.encodeUpdate(_serialize(array), snapshot) );
+    ASSERT_TRUE( proxy.decode(snapshot, restored) );
+
+    uint64_t bytesFull{ 0 }, bytesDelta{ 0 };
+    for (uint32_t i = 0; i < updates; ++ i)
+    {
+        array[(i * 97) % entries] = i;
+        const EventDataStream data{ _serialize(array) };
+        bytesFull += _sizeOf(data);
+        EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(data).getSize(), entries );
+    }
+
+    for (uint32_t i = 0; i < updates; ++ i)
+    {
+        array[(i * 89) % entries] = i + 1;
+        EventDataStream delta(EventDataStream::eEventData::EventDataExternal);
+        EventDataStream data(EventDataStream::eEventData::EventDataExternal);
+        ASSERT_TRUE( stub.encodeUpdate(_serialize(array), delta) );
+        bytesDelta += _sizeOf(delta);
+        ASSERT_TRUE( proxy.decode(delta, data) );
+        EXPECT_EQ( _deserialize<TEArrayList<uint32_t>>(data), array );
+    }
+
+    EXPECT_LT( bytesDelta * 100, bytesFull );
+}
@@ -0,0 +1,216 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/BufferPoolTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the size-classed pool of memory blocks.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/BufferPool.hpp"
+#include "areg/base/RemoteMessage.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< Clears the pool and the statistics, restores the cache size when the test completes.
+    struct PoolGuard
+    {
+        PoolGuard( void )
+        {
+            BufferPool::getInstance().clearPool();
+            BufferPool::getInstance().resetStatistics();
+        }
+
+        ~PoolGuard( void )
+        {
+            BufferPool::getInstance().setMaxCachedBlocks(BufferPool::DEFAULT_MAX_CACHED);
+        }
+    };
+
+    //!< Returns the header of the remote message with the given data size.
+    NEMemory::sRemoteMessageHeader _messageHeader( uint32_t dataSize )
+    {
+        NEMemory::sRemoteMessageHeader header{ };
+        header.rbhBufHeader.biUsed  = dataSize;
+        header.rbhBufHeader.biLength= dataSize;
+        header.rbhTarget            = 20;
+        header.rbhSource            = 10;
+        return header;
+    }
+
+    //!< Returns the sum of the statistics field of all size classes.
+    uint64_t _totalStats( uint64_t BufferPool::sPoolStatistics::* field )
+    {
+        uint64_t result{ 0 };
+        const BufferPool::PoolStatistics stats{ BufferPool::getInstance().getStatistics() };
+        for (const auto & entry : stats.getData())
+        {
+            result += entry.*field;
+        }
+
+        return result;
+    }
+
+    //!< Returns the number of cached blocks of all size classes.
+    uint32_t _totalCached( void )
+    {
+        uint32_t result{ 0 };
+        const BufferPool::PoolStatistics stats{ BufferPool::getInstance().getStatistics() };
+        for (const auto & entry : stats.getData())
+        {
+            result += entry.psCached;
+        }
+
+        return result;
+    }
+}
+
+/**
+ * \brief   Checks that the sizes are mapped to the size classes.
+ **/
+TEST( BufferPoolTest, SizeClasses )
+{
+    EXPECT_EQ( BufferPool::getSizeClass(1), 0u );
+    EXPECT_EQ( BufferPool::getSizeClass(BufferPool::MIN_BLOCK_SIZE), 0u );
+    EXPECT_EQ( BufferPool::getSizeClass(BufferPool::MIN_BLOCK_SIZE + 1), 1u );
+    EXPECT_EQ( BufferPool::getSizeClass(BufferPool::MAX_BLOCK_SIZE), BufferPool::SIZE_CLASSES - 1 );
+    EXPECT_EQ( BufferPool::getSizeClass(BufferPool::MAX_BLOCK_SIZE + 1), BufferPool::INVALID_CLASS );
+}
+
+/**
+ * \brief   Checks that the released block is reused and the big blocks are not pooled.
+ **/
+TEST( BufferPoolTest, ReuseBlocks )
+{
+    PoolGuard guard;
+    BufferPool & pool{ BufferPool::getInstance() };
+
+    uint32_t sizeClass{ BufferPool::INVALID_CLASS };
+    unsigned char * first{ pool.allocateBlock(200, sizeClass) };
+    ASSERT_NE( first, nullptr );
+    EXPECT_EQ( sizeClass, 1u );
+    pool.releaseBlock(first, sizeClass);
+
+    unsigned char * second{ pool.allocateBlock(256, sizeClass) };
+    EXPECT_EQ( second, first );
+    pool.releaseBlock(second, sizeClass);
+
+    unsigned char * big{ pool.allocateBlock(BufferPool::MAX_BLOCK_SIZE + 1, sizeClass) };
+    EXPECT_EQ( sizeClass, BufferPool::INVALID_CLASS );
+    pool.releaseBlock(big, sizeClass);
+
+    const BufferPool::PoolStatistics stats{ pool.getStatistics() };
+    ASSERT_EQ( stats.getSize(), BufferPool::SIZE_CLASSES + 1 );
+    EXPECT_EQ( stats[1].psBlockSize, 256u );
+    EXPECT_EQ( stats[1].psAllocated, 2u );
+    EXPECT_EQ( stats[1].psReused, 1u );
+    EXPECT_EQ( stats[1].psReleased, 2u );
+    EXPECT_EQ( stats[1].psCached, 1u );
+    EXPECT_EQ( stats[BufferPool::SIZE_CLASSES].psAllocated, 1u );
+    EXPECT_EQ( stats[BufferPool::SIZE_CLASSES].psDropped, 1u );
+}
+
+/**
+ * \brief   Checks that the number of cached blocks is limited.
+ **/
+TEST( BufferPoolTest, MaxCachedBlocks )
+{
+    PoolGuard guard;
+    BufferPool & pool{ BufferPool::getInstance() };
+    pool.setMaxCachedBlocks(2);
+
+    uint32_t sizeClass{ BufferPool::INVALID_CLASS };
+    unsigned char * blocks[4]{ };
+    for (auto & block : blocks)
+    {
+        block = pool.allocateBlock(1000, sizeClass);
+    }
+
+    for (auto & block : blocks)
+    {
+        pool.releaseBlock(block, sizeClass);
+    }
+
+    BufferPool::PoolStatistics stats{ pool.getStatistics() };
+    EXPECT_EQ( stats[sizeClass].psCached, 2u );
+    EXPECT_EQ( stats[sizeClass].psDropped, 2u );
+
+    pool.setMaxCachedBlocks(0);
+    stats = pool.getStatistics();
+    EXPECT_EQ( stats[sizeClass].psCached, 0u );
+}
+
+/**
+ * \brief   Checks that the buffer of remote message returns to the pool
+ *          when the last shared object releases it.
+ **/
+TEST( BufferPoolTest, RemoteMessageBuffer )
+{
+    PoolGuard guard;
+    const NEMemory::sRemoteMessageHeader header{ _messageHeader(100) };
+
+    RemoteMessage msg;
+    ASSERT_NE( msg.initMessage(header), nullptr );
+    const unsigned char * buffer{ msg.getBuffer() };
+    RemoteMessage shared{ msg.shareWithTarget(30) };
+    msg.invalidate();
+
+    EXPECT_EQ( _totalCached(), 0u );
+
+    shared.invalidate();
+    EXPECT_EQ( _totalCached(), 1u );
+
+    ASSERT_NE( msg.initMessage(header), nullptr );
+    EXPECT_EQ( msg.getBuffer(), buffer );
+    EXPECT_EQ( _totalStats(&BufferPool::sPoolStatistics::psReused), 1u );
+}
+
+/**
+ * \brief   Checks the pool, when blocks are allocated and released by several threads.
+ **/
+TEST( BufferPoolTest, ConcurrentAccess )
+{
+    PoolGuard guard;
+    constexpr uint32_t threads{ 4 };
+    constexpr uint32_t count{ 10000 };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < threads; ++ i)
+    {
+        workers.emplace_back([i]() {
+            BufferPool & pool{ BufferPool::getInstance() };
+            for (uint32_t j = 0; j < count; ++ j)
+            {
+                uint32_t sizeClass{ BufferPool::INVALID_CLASS };
+                unsigned char * block{ pool.allocateBlock(512 - (i * 16), sizeClass) };
+                block[0] = static_cast<unsigned char>(j);
+                pool.releaseBlock(block, sizeClass);
+            }
+        });
+    }
+
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+
+    const BufferPool::PoolStatistics stats{ BufferPool::getInstance().getStatistics() };
+    const uint32_t sizeClass{ BufferPool::getSizeClass(512) };
+    EXPECT_EQ( stats[sizeClass].psAllocated, threads * count );
+    EXPECT_EQ( stats[sizeClass].psReleased + stats[sizeClass].psDropped, threads * count );
+    EXPECT_LE( stats[sizeClass].psCached, threads );
+    EXPECT_GE( stats[sizeClass].psReused, stats[sizeClass].psAllocated - threads );
+}
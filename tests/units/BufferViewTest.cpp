@@ -0,0 +1,65 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/BufferViewTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the read-only view of the shared buffer.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/BufferView.hpp"
+
+/**
+ * \brief   Checks that the view references the data of the shared buffer
+ *          and limits the offset and the size by the used size of the buffer.
+ **/
+TEST( BufferViewTest, ReferenceData )
+{
+    const unsigned char bytes[]{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    SharedBuffer buffer(bytes, sizeof(bytes));
+
+    const BufferView view(buffer, 2, 5);
+    ASSERT_FALSE( view.isEmpty() );
+    EXPECT_EQ( view.getData(), buffer.getBuffer() + 2 );
+    EXPECT_EQ( view.getSize(), 5u );
+    EXPECT_EQ( view[0], 2u );
+    EXPECT_EQ( view.getEnd(), view.getData() + 5 );
+
+    const BufferView tail(buffer, 8, 100);
+    EXPECT_EQ( tail.getSize(), 2u );
+    EXPECT_TRUE( BufferView(buffer, 10, 1).isEmpty() );
+
+    const BufferView part{ view.getView(3, 10) };
+    EXPECT_EQ( part.getData(), view.getData() + 3 );
+    EXPECT_EQ( part.getSize(), 2u );
+    EXPECT_TRUE( view.getView(5, 1).isEmpty() );
+
+    SharedBuffer copy{ view.copyBuffer() };
+    EXPECT_NE( copy.getBuffer(), view.getData() );
+    EXPECT_EQ( copy.getSizeUsed(), view.getSize() );
+    EXPECT_EQ( copy.getBuffer()[4], 6u );
+
+    // the view keeps the data while it references the buffer.
+    buffer.invalidate();
+    EXPECT_EQ( view[4], 6u );
+    EXPECT_EQ( part[1], 6u );
+
+    BufferView source(copy, 0, 1);
+    BufferView moved(std::move(source));
+    EXPECT_TRUE( source.isEmpty() );
+    EXPECT_EQ( moved.getSize(), 1u );
+    moved.release();
+    EXPECT_TRUE( moved.isEmpty() );
+    EXPECT_EQ( moved.getData(), nullptr );
+    EXPECT_TRUE( BufferView::EmptyView.isEmpty() );
+}
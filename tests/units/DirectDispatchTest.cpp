@@ -0,0 +1,460 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/DirectDispatchTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the direct dispatching of the requests to the stub of the same thread.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/IEProxyListener.hpp"
+#include "areg/component/NotificationEvent.hpp"
+#include "areg/component/ProxyBase.hpp"
+#include "areg/component/RequestEvents.hpp"
+#include "areg/component/ResponseEvents.hpp"
+#include "areg/component/StubBase.hpp"
+#include "areg/component/TEEvent.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //! The ID of the request of the service.
+    constexpr unsigned int  MSG_REQUEST_PING    { NEService::REQUEST_ID_FIRST };
+    //! The ID of the response of the service.
+    constexpr unsigned int  MSG_RESPONSE_PING   { NEService::RESPONSE_ID_FIRST };
+    //! The role name of the service.
+    constexpr char          PING_SERVICE_ROLE[] { "DirectDispatchService" };
+    //! The number of sequential calls to measure.
+    constexpr uint32_t      PING_CALLS          { 10000u };
+
+    const unsigned int  _pingRequestIds[]       { MSG_REQUEST_PING };
+    const unsigned int  _pingResponseIds[]      { MSG_RESPONSE_PING };
+    const unsigned int  _pingRequestToResponse[]{ MSG_RESPONSE_PING };
+    const unsigned int  _pingResponseParams[]   { 0u };
+
+    //! The service interface with one request and one response without parameters.
+    const NEService::SInterfaceData & _pingInterface( void )
+    {
+        static const NEService::SInterfaceData _interface
+        {
+              "DirectDispatchPing"
+            , Version( 1, 0, 0 )
+            , NEService::eServiceType::ServiceLocal
+            , 1u
+            , 1u
+            , 0u
+            , _pingRequestIds
+            , _pingResponseIds
+            , nullptr
+            , _pingRequestToResponse
+            , _pingResponseParams
+        };
+
+        return _interface;
+    }
+
+    //! The depth of the request calls of the client.
+    std::atomic_uint32_t    _callDepth      { 0u };
+    //! The number of requests processed by the stub while the client calls the request.
+    std::atomic_uint32_t    _inlineCalls    { 0u };
+    //! The number of received responses.
+    std::atomic_uint32_t    _pingResponses  { 0u };
+    //! The flag, indicating that the client completed the sequential calls.
+    std::atomic_bool        _pingCompleted  { false };
+    //! The flag, indicating that the client is connected to the service.
+    std::atomic_bool        _pingConnected  { false };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// The events of the service
+//////////////////////////////////////////////////////////////////////////
+
+class PingRequestEvent : public LocalRequestEvent
+{
+    DECLARE_RUNTIME_EVENT( PingRequestEvent )
+
+public:
+    PingRequestEvent( const EventDataStream & args, const ProxyAddress & fromSource, const StubAddress & toTarget, unsigned int reqId )
+        : LocalRequestEvent( args, fromSource, toTarget, reqId )
+    {
+    }
+
+    virtual ~PingRequestEvent( void ) = default;
+};
+
+IMPLEMENT_RUNTIME_EVENT( PingRequestEvent, LocalRequestEvent )
+
+class PingNotifyRequestEvent : public LocalNotifyRequestEvent
+{
+    DECLARE_RUNTIME_EVENT( PingNotifyRequestEvent )
+
+public:
+    PingNotifyRequestEvent( const ProxyAddress & fromProxy, const StubAddress & toStub, unsigned int msgId, NEService::eRequestType reqType )
+        : LocalNotifyRequestEvent( fromProxy, toStub, msgId, reqType )
+    {
+    }
+
+    virtual ~PingNotifyRequestEvent( void ) = default;
+};
+
+IMPLEMENT_RUNTIME_EVENT( PingNotifyRequestEvent, LocalNotifyRequestEvent )
+
+class PingResponseEvent : public LocalResponseEvent
+{
+    DECLARE_RUNTIME_EVENT( PingResponseEvent )
+
+public:
+    PingResponseEvent( const EventDataStream & args, const ProxyAddress & proxyTarget, NEService::eResultType result, unsigned int respId )
+        : LocalResponseEvent( args, proxyTarget, result, respId )
+    {
+    }
+
+    PingResponseEvent( const ProxyAddress & proxyTarget, const PingResponseEvent & src )
+        : LocalResponseEvent( proxyTarget, src )
+    {
+    }
+
+    virtual ~PingResponseEvent( void ) = default;
+
+    virtual ServiceResponseEvent * cloneForTarget( const ProxyAddress & target ) const override
+    {
+        return DEBUG_NEW PingResponseEvent( target, *this );
+    }
+};
+
+IMPLEMENT_RUNTIME_EVENT( PingResponseEvent, LocalResponseEvent )
+
+class PingNotificationEvent : public NotificationEvent
+{
+    DECLARE_RUNTIME_EVENT( PingNotificationEvent )
+
+public:
+    explicit PingNotificationEvent( const NotificationEventData & data )
+        : NotificationEvent( data )
+    {
+    }
+
+    virtual ~PingNotificationEvent( void ) = default;
+};
+
+IMPLEMENT_RUNTIME_EVENT( PingNotificationEvent, NotificationEvent )
+
+//////////////////////////////////////////////////////////////////////////
+// The proxy and the stub of the service
+//////////////////////////////////////////////////////////////////////////
+
+class PingProxy : public ProxyBase
+{
+public:
+    static ProxyBase * CreateProxy( const String & roleName, DispatcherThread * ownerThread )
+    {
+        return DEBUG_NEW PingProxy( roleName, ownerThread );
+    }
+
+    PingProxy( const String & roleName, DispatcherThread * ownerThread )
+        : ProxyBase( roleName, _pingInterface( ), ownerThread )
+    {
+    }
+
+    virtual ~PingProxy( void ) = default;
+
+    void requestPing( IENotificationEventConsumer & caller )
+    {
+        sendRequestEvent( MSG_REQUEST_PING, EventDataStream::EmptyData, &caller );
+    }
+
+protected:
+    virtual void processResponseEvent( ServiceResponseEvent & eventElem ) override
+    {
+        setState( eventElem.getResponseId( ), NEService::eDataStateType::DataIsOK );
+        notifyListeners( eventElem.getResponseId( ), eventElem.getResult( ), eventElem.getSequenceNumber( ) );
+    }
+
+    virtual void processAttributeEvent( ServiceResponseEvent & /* eventElem */ ) override
+    {
+    }
+
+    virtual ProxyBase::ServiceAvailableEvent * createServiceAvailableEvent( IENotificationEventConsumer & consumer ) override
+    {
+        return DEBUG_NEW ProxyBase::ServiceAvailableEvent( consumer );
+    }
+
+    virtual NotificationEvent * createNotificationEvent( const NotificationEventData & data ) const override
+    {
+        return DEBUG_NEW PingNotificationEvent( data );
+    }
+
+    virtual ServiceRequestEvent * createRequestEvent( const EventDataStream & args, unsigned int reqId ) override
+    {
+        return DEBUG_NEW PingRequestEvent( args, getProxyAddress( ), getStubAddress( ), reqId );
+    }
+
+    virtual ServiceRequestEvent * createNotificationRequestEvent( unsigned int msgId, NEService::eRequestType reqType ) override
+    {
+        return DEBUG_NEW PingNotifyRequestEvent( getProxyAddress( ), getStubAddress( ), msgId, reqType );
+    }
+
+    virtual void registerServiceListeners( void ) override
+    {
+        ProxyBase::registerServiceListeners( );
+        PingResponseEvent::addListener( static_cast<IEEventConsumer &>(*this), getProxyDispatcherThread( ) );
+    }
+
+    virtual void unregisterServiceListeners( void ) override
+    {
+        PingResponseEvent::removeListener( static_cast<IEEventConsumer &>(*this), getProxyDispatcherThread( ) );
+        ProxyBase::unregisterServiceListeners( );
+    }
+};
+
+class PingService : public Component
+                  , public StubBase
+{
+public:
+    static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+    {
+        return DEBUG_NEW PingService( entry, owner );
+    }
+
+    static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+    {
+        delete (&compObject);
+    }
+
+    PingService( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        : Component ( entry, owner )
+        , StubBase  ( static_cast<Component &>(*this), _pingInterface( ) )
+    {
+    }
+
+    virtual void startupServiceInterface( Component & holder ) override
+    {
+        PingRequestEvent::addListener( static_cast<IEEventConsumer &>(*this), holder.getMasterThread( ) );
+        PingNotifyRequestEvent::addListener( static_cast<IEEventConsumer &>(*this), holder.getMasterThread( ) );
+        StubBase::startupServiceInterface( holder );
+    }
+
+    virtual void shutdownServiceIntrface( Component & holder ) override
+    {
+        PingRequestEvent::removeListener( static_cast<IEEventConsumer &>(*this), holder.getMasterThread( ) );
+        PingNotifyRequestEvent::removeListener( static_cast<IEEventConsumer &>(*this), holder.getMasterThread( ) );
+        StubBase::shutdownServiceIntrface( holder );
+    }
+
+    virtual void sendNotification( unsigned int /* msgId */ ) override
+    {
+    }
+
+    virtual void errorRequest( unsigned int /* msgId */, bool /* msgCancel */ ) override
+    {
+    }
+
+protected:
+    virtual ResponseEvent * createResponseEvent( const ProxyAddress & proxy, unsigned int msgId, NEService::eResultType result, const EventDataStream & data ) const override
+    {
+        return DEBUG_NEW PingResponseEvent( data, proxy, result, msgId );
+    }
+
+    virtual void processRequestEvent( ServiceRequestEvent & eventElem ) override
+    {
+        if ( eventElem.getRequestId( ) == MSG_REQUEST_PING )
+        {
+            if ( _callDepth.load( ) != 0u )
+            {
+                _inlineCalls.fetch_add( 1u );
+            }
+
+            StubBase::Listener listener( MSG_REQUEST_PING, 0u, eventElem.getEventSource( ) );
+            if ( canExecuteRequest( listener, MSG_RESPONSE_PING, eventElem.getSequenceNumber( ) ) )
+            {
+                sendResponseEvent( MSG_RESPONSE_PING, EventDataStream::EmptyData );
+            }
+        }
+    }
+
+    virtual void processAttributeEvent( ServiceRequestEvent & eventElem ) override
+    {
+        if ( eventElem.getRequestType( ) == NEService::eRequestType::RemoveAllNotify )
+        {
+            clearAllListeners( eventElem.getEventSource( ) );
+        }
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// The client of the service
+//////////////////////////////////////////////////////////////////////////
+
+//! The data of the event to start the sequential calls.
+struct PingStart
+{
+    bool    directDispatch{ false };
+};
+
+DECLARE_EVENT( PingStart, PingStartEvent, IEPingStartConsumer );
+
+class PingClient : public Component
+                 , public IEProxyListener
+                 , public IEPingStartConsumer
+{
+public:
+    static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+    {
+        return DEBUG_NEW PingClient( entry, owner );
+    }
+
+    static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+    {
+        delete (&compObject);
+    }
+
+    PingClient( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        : Component             ( entry, owner )
+        , IEProxyListener       ( )
+        , IEPingStartConsumer   ( )
+        , mProxy                ( )
+        , mCalls                ( 0u )
+    {
+    }
+
+    virtual void startupComponent( ComponentThread & comThread ) override
+    {
+        Component::startupComponent( comThread );
+        PingStartEvent::addListener( static_cast<IEPingStartConsumer &>(*this), comThread );
+        mProxy = ProxyBase::findOrCreateProxy( PING_SERVICE_ROLE, _pingInterface( ), static_cast<IEProxyListener &>(*this), &PingProxy::CreateProxy, comThread );
+    }
+
+    virtual void shutdownComponent( ComponentThread & comThread ) override
+    {
+        PingStartEvent::removeListener( static_cast<IEPingStartConsumer &>(*this), comThread );
+        if ( mProxy != nullptr )
+        {
+            mProxy->freeProxy( static_cast<IEProxyListener &>(*this) );
+            mProxy.reset( );
+        }
+
+        Component::shutdownComponent( comThread );
+    }
+
+    virtual bool serviceConnected( NEService::eServiceConnection status, ProxyBase & /* proxy */ ) override
+    {
+        _pingConnected.store( status == NEService::eServiceConnection::ServiceConnected );
+        return true;
+    }
+
+    virtual void processNotificationEvent( NotificationEvent & eventElem ) override
+    {
+        if ( static_cast<const NotificationEvent &>(eventElem).getData( ).getNotifyId( ) != MSG_RESPONSE_PING )
+            return;
+
+        _pingResponses.fetch_add( 1u );
+        if ( ++ mCalls < PING_CALLS )
+        {
+            _requestPing( );
+        }
+        else
+        {
+            _pingCompleted.store( true );
+        }
+    }
+
+    virtual void processEvent( const PingStart & data ) override
+    {
+        mProxy->setDirectDispatch( data.directDispatch );
+        mCalls = 0u;
+        _requestPing( );
+    }
+
+private:
+    void _requestPing( void )
+    {
+        _callDepth.fetch_add( 1u );
+        static_cast<PingProxy *>(mProxy.get( ))->requestPing( static_cast<IENotificationEventConsumer &>(*this) );
+        _callDepth.fetch_sub( 1u );
+    }
+
+    std::shared_ptr<ProxyBase>  mProxy;
+    uint32_t                    mCalls;
+};
+
+namespace
+{
+    //! Makes the sequential calls and waits until the client receives the last response.
+    void _makeCalls( DispatcherThread & dispatcher, bool directDispatch )
+    {
+        _inlineCalls.store( 0u );
+        _pingResponses.store( 0u );
+        _pingCompleted.store( false );
+        PingStartEvent::sendEvent( PingStart{ directDispatch }, dispatcher );
+        while ( _pingCompleted.load( ) == false )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+    }
+}
+
+/**
+ * \brief   Checks that the requests to the stub of the same thread are processed in the call
+ *          if the direct dispatching is enabled, and are queued otherwise.
+ **/
+TEST( DirectDispatchTest, SameThreadCalls )
+{
+    const bool startManager{ Application::isServiceManagerStarted( ) == false };
+    if ( startManager )
+    {
+        ASSERT_TRUE( Application::startServiceManager( ) );
+    }
+
+    const String modelName( "DirectDispatchModel" );
+    const String threadName( "DirectDispatchThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    NERegistry::ComponentEntry & service = thread.addComponent( PING_SERVICE_ROLE, &PingService::CreateComponent, &PingService::DeleteComponent );
+    service.addSupportedService( NERegistry::ServiceEntry( _pingInterface( ).idServiceName, _pingInterface( ).idVersion ) );
+    thread.addComponent( "DirectDispatchClient", &PingClient::CreateComponent, &PingClient::DeleteComponent );
+
+    _pingConnected.store( false );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    for ( int i = 0; (i < 5000) && (_pingConnected.load( ) == false); ++ i )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    EXPECT_TRUE( _pingConnected.load( ) );
+    if ( _pingConnected.load( ) )
+    {
+        DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+
+        _makeCalls( dispatcher, false );
+        EXPECT_EQ( _pingResponses.load( ), PING_CALLS );
+        EXPECT_EQ( _inlineCalls.load( ), 0u );
+
+        _makeCalls( dispatcher, true );
+        EXPECT_EQ( _pingResponses.load( ), PING_CALLS );
+        EXPECT_EQ( _inlineCalls.load( ), PING_CALLS );
+    }
+
+    ComponentLoader::removeComponentModel( modelName );
+    if ( startManager )
+    {
+        Application::stopServiceManager( );
+    }
+}
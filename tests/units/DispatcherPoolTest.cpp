@@ -0,0 +1,234 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/DispatcherPoolTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the work stealing pool and the pooled component threads.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/WorkStealingPool.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/TEEvent.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //! The task, which counts the runs and schedules itself again until the number of runs is reached.
+    class CountingTask : public IEPoolTask
+    {
+    public:
+        CountingTask( WorkStealingPool & pool, uint32_t runs, std::atomic_uint32_t & done )
+            : IEPoolTask( )
+            , mPool     ( pool )
+            , mRuns     ( runs )
+            , mDone     ( done )
+        {
+        }
+
+        virtual void runTask( void ) override
+        {
+            if (-- mRuns != 0)
+            {
+                mPool.scheduleTask( *this );
+            }
+            else
+            {
+                mDone.fetch_add( 1u );
+            }
+        }
+
+    private:
+        WorkStealingPool &      mPool;
+        uint32_t                mRuns;
+        std::atomic_uint32_t &  mDone;
+    };
+
+    //! The token passed in the ring of the component threads.
+    struct RingToken
+    {
+        uint32_t    hops;
+    };
+
+    DECLARE_EVENT( RingToken, RingTokenEvent, IERingTokenConsumer );
+
+    //! The number of threads in the ring.
+    constexpr uint32_t  RING_THREADS    { 8u };
+    //! The number of tokens passed in the ring at the same time.
+    constexpr uint32_t  RING_TOKENS     { 8u };
+    //! The number of hops of every token.
+    constexpr uint32_t  RING_HOPS       { 1000u };
+
+    std::atomic_uint32_t    _ringStarted{ 0u };
+    std::atomic_uint32_t    _ringDone{ 0u };
+    std::atomic_uint32_t    _ringHosted{ 0u };
+
+    inline String _ringThreadName( uint32_t index )
+    {
+        return String("RingThread_").append( String::makeString(index % RING_THREADS) );
+    }
+
+    //! The component of the ring, which passes the token to the next thread.
+    class RingNode  : public Component
+                    , public IERingTokenConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW RingNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        RingNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component             ( entry, owner )
+            , IERingTokenConsumer   ( )
+            , mNext                 ( nullptr )
+            , mIndex                ( String(entry.mRoleName.getString() + entry.mRoleName.findLast('_') + 1).toUInt32() )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            RingTokenEvent::addListener( static_cast<IERingTokenConsumer &>(*this), comThread );
+            _ringStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            RingTokenEvent::removeListener( static_cast<IERingTokenConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const RingToken & data ) override
+        {
+            if (data.hops == 0)
+            {
+                // only the pool workers run the hosted threads, they poll without the timed wait.
+                _ringHosted.fetch_add( Thread::isCurrentThreadHosted() ? 1u : 0u );
+                _ringDone.fetch_add( 1u );
+                return;
+            }
+
+            if (mNext == nullptr)
+            {
+                mNext = &DispatcherThread::getDispatcherThread( _ringThreadName(mIndex + 1) );
+            }
+
+            RingTokenEvent::sendEvent( RingToken{ data.hops - 1 }, *mNext );
+        }
+
+    private:
+        DispatcherThread *  mNext;
+        const uint32_t      mIndex;
+    };
+
+    /**
+     * \brief   Loads the ring of component threads, passes the tokens and unloads the ring.
+     *          Checks that the tokens are processed by the threads of the pool only in the pooled mode.
+     **/
+    void _runRing( NERegistry::eDispatchMode mode )
+    {
+        const String modelName( String("RingModel_").append(String::makeString(static_cast<uint32_t>(mode))) );
+        NERegistry::Model model( modelName );
+        model.setDispatchMode( mode );
+        for (uint32_t i = 0; i < RING_THREADS; ++ i)
+        {
+            NERegistry::ComponentThreadEntry & thread = model.addThread( _ringThreadName(i) );
+            thread.addComponent( String("RingNode_").append(String::makeString(i)), &RingNode::CreateComponent, &RingNode::DeleteComponent );
+        }
+
+        _ringStarted.store( 0u );
+        _ringDone.store( 0u );
+        _ringHosted.store( 0u );
+        ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+        ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+        while (_ringStarted.load() != RING_THREADS)
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+        }
+
+        for (uint32_t i = 0; i < RING_TOKENS; ++ i)
+        {
+            RingTokenEvent::sendEvent( RingToken{ RING_HOPS }, DispatcherThread::getDispatcherThread( _ringThreadName(i) ) );
+        }
+
+        while (_ringDone.load() != RING_TOKENS)
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+        }
+
+        EXPECT_EQ( _ringHosted.load(), mode == NERegistry::eDispatchMode::DispatchPooled ? RING_TOKENS : 0u );
+        EXPECT_FALSE( Thread::isCurrentThreadHosted() );
+        ComponentLoader::removeComponentModel( modelName );
+        ComponentThread::stopDispatcherPool( );
+    }
+}
+
+/**
+ * \brief   Checks that all scheduled tasks and rescheduled tasks run.
+ **/
+TEST( DispatcherPoolTest, ScheduleTasks )
+{
+    constexpr uint32_t  tasks{ 64u };
+    constexpr uint32_t  runs{ 1000u };
+
+    WorkStealingPool pool( "DispatcherPoolTest" );
+    EXPECT_FALSE( pool.isPoolStarted() );
+    ASSERT_TRUE( pool.startPool( 4u ) );
+    EXPECT_EQ( pool.getThreadCount(), 4u );
+    EXPECT_FALSE( pool.isPoolThread() );
+
+    std::atomic_uint32_t done{ 0u };
+    TEArrayList<CountingTask *> list;
+    for (uint32_t i = 0; i < tasks; ++ i)
+    {
+        list.add( DEBUG_NEW CountingTask( pool, runs, done ) );
+        EXPECT_TRUE( pool.scheduleTask( *list[i] ) );
+    }
+
+    while (done.load() != tasks)
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+    }
+
+    EXPECT_EQ( pool.getTasksRun(), static_cast<uint64_t>(tasks) * runs );
+    EXPECT_LE( pool.getTasksStolen(), pool.getTasksRun() );
+
+    pool.stopPool( );
+    EXPECT_FALSE( pool.isPoolStarted() );
+    EXPECT_FALSE( pool.scheduleTask( *list[0] ) );
+    for (uint32_t i = 0; i < tasks; ++ i)
+    {
+        delete list[i];
+    }
+}
+
+/**
+ * \brief   Passes the tokens in the ring of component threads with dedicated
+ *          threads and with the threads of the pool.
+ **/
+TEST( DispatcherPoolTest, RingDispatchModes )
+{
+    _runRing( NERegistry::eDispatchMode::DispatchThread );
+    _runRing( NERegistry::eDispatchMode::DispatchPooled );
+}
@@ -0,0 +1,213 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/DispatcherStatisticsTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the statistics of the dispatcher threads.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/base/LatencyHistogram.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/TEEvent.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //! The data of the measured event.
+    struct StatsData
+    {
+        uint32_t    value{ 0u };
+    };
+
+    DECLARE_EVENT( StatsData, StatsDataEvent, IEStatsDataConsumer );
+
+    //! The number of dispatched events.
+    constexpr uint32_t  STATS_EVENTS    { 1000u };
+
+    std::atomic_uint32_t    _statsStarted{ 0u };
+    std::atomic_uint32_t    _statsReceived{ 0u };
+
+    //! The component, which receives the measured events.
+    class StatsNode : public Component
+                    , public IEStatsDataConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW StatsNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        StatsNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component             ( entry, owner )
+            , IEStatsDataConsumer   ( )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            StatsDataEvent::addListener( static_cast<IEStatsDataConsumer &>(*this), comThread );
+            _statsStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            StatsDataEvent::removeListener( static_cast<IEStatsDataConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const StatsData & /* data */ ) override
+        {
+            _statsReceived.fetch_add( 1u );
+        }
+    };
+
+    //! Returns the statistics of the dispatcher with the name. The name is empty if not found.
+    DispatcherStatistics::sDispatcherStatistics _findStatistics( const String & name )
+    {
+        DispatcherStatistics::ListStatistics list;
+        Application::queryDispatcherStatistics( list );
+        for ( const auto & entry : list.getData( ) )
+        {
+            if ( entry.dsDispatcherName == name )
+                return entry;
+        }
+
+        return DispatcherStatistics::sDispatcherStatistics( );
+    }
+}
+
+/**
+ * \brief   Checks that every value is recorded in the bucket with the relative error below 1 / SUB_BUCKETS.
+ **/
+TEST( DispatcherStatisticsTest, HistogramBuckets )
+{
+    uint32_t lastIndex{ 0u };
+    for ( uint64_t value = 0u; value < 1000000u; value += 1u + value / 64u )
+    {
+        const uint32_t index{ LatencyHistogram::getBucketIndex( value ) };
+        const uint64_t upper{ LatencyHistogram::getBucketValue( index ) };
+        EXPECT_GE( index, lastIndex );
+        EXPECT_GE( upper, value );
+        EXPECT_LE( upper - value, value / LatencyHistogram::SUB_BUCKETS );
+        lastIndex = index;
+    }
+
+    EXPECT_EQ( LatencyHistogram::getBucketIndex( static_cast<uint64_t>(~0u) << 40 ), LatencyHistogram::BUCKET_COUNT - 1u );
+}
+
+/**
+ * \brief   Checks the percentiles of the recorded values.
+ **/
+TEST( DispatcherStatisticsTest, HistogramPercentiles )
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ( histogram.getPercentile( 50.0 ), 0u );
+
+    for ( uint64_t value = 1u; value <= 10000u; ++ value )
+    {
+        histogram.recordValue( value );
+    }
+
+    EXPECT_EQ( histogram.getCount( ), 10000u );
+    EXPECT_EQ( histogram.getMaxValue( ), 10000u );
+    EXPECT_EQ( histogram.getPercentile( 100.0 ), 10000u );
+
+    const uint64_t median{ histogram.getPercentile( 50.0 ) };
+    EXPECT_GE( median, 5000u );
+    EXPECT_LE( median, 5000u + 5000u / LatencyHistogram::SUB_BUCKETS );
+
+    const uint64_t p99{ histogram.getPercentile( 99.0 ) };
+    EXPECT_GE( p99, 9900u );
+    EXPECT_LE( p99, 10000u );
+
+    histogram.reset( );
+    EXPECT_EQ( histogram.getCount( ), 0u );
+    EXPECT_EQ( histogram.getMaxValue( ), 0u );
+}
+
+/**
+ * \brief   Checks that the dispatched events are counted per dispatcher and per event class.
+ **/
+TEST( DispatcherStatisticsTest, DispatchedEvents )
+{
+    const String modelName( "DispatcherStatisticsModel" );
+    const String threadName( "DispatcherStatisticsThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.addComponent( "DispatcherStatisticsNode", &StatsNode::CreateComponent, &StatsNode::DeleteComponent );
+
+    _statsStarted.store( 0u );
+    _statsReceived.store( 0u );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _statsStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+    const uint64_t dispatchedBefore{ _findStatistics( threadName ).dsDispatched };
+    for ( uint32_t i = 0; i < STATS_EVENTS; ++ i )
+    {
+        StatsDataEvent::sendEvent( StatsData{ i }, dispatcher );
+    }
+
+    while ( _statsReceived.load( ) != STATS_EVENTS )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    const DispatcherStatistics::sDispatcherStatistics stats{ _findStatistics( threadName ) };
+    ComponentLoader::removeComponentModel( modelName );
+
+    ASSERT_EQ( stats.dsDispatcherName, threadName );
+    EXPECT_GE( stats.dsDispatched - dispatchedBefore, static_cast<uint64_t>(STATS_EVENTS) );
+    EXPECT_GE( stats.dsQueuePeak, 1u );
+    EXPECT_EQ( stats.dsDropped, 0u );
+    EXPECT_LE( stats.dsWaitMedian, stats.dsWaitMax );
+    EXPECT_LE( stats.dsRunMedian, stats.dsRunMax );
+
+    const DispatcherStatistics::sEventStatistics * eventStats{ nullptr };
+    for ( const auto & entry : stats.dsEvents.getData( ) )
+    {
+        if ( entry.esEventName.isValidPosition( entry.esEventName.findFirst( "StatsDataEvent" ) ) )
+        {
+            eventStats = &entry;
+        }
+    }
+
+    ASSERT_NE( eventStats, nullptr );
+    EXPECT_EQ( eventStats->esDispatched, static_cast<uint64_t>(STATS_EVENTS) );
+    EXPECT_EQ( eventStats->esMessageId, NEService::INVALID_MESSAGE_ID );
+    EXPECT_LE( eventStats->esWaitMedian, eventStats->esWaitP99 );
+    EXPECT_LE( eventStats->esWaitP99, eventStats->esWaitMax );
+    EXPECT_LE( eventStats->esRunMedian, eventStats->esRunP99 );
+    EXPECT_LE( eventStats->esRunP99, eventStats->esRunMax );
+    EXPECT_LE( eventStats->esWaitMax, stats.dsWaitMax );
+    EXPECT_LE( eventStats->esRunMax, stats.dsRunMax );
+}
+
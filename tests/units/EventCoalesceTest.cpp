@@ -0,0 +1,273 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/EventCoalesceTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the coalescing of the queued events with the same key.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/ResponseEvents.hpp"
+#include "areg/component/TEEvent.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //! The data of the event with the coalescing key.
+    struct CoalesceData
+    {
+        uint64_t    key{ 0u };
+        uint32_t    value{ 0u };
+        uint32_t    target{ 0u };
+    };
+
+    DECLARE_EVENT( CoalesceData, CoalesceDataEvent, IECoalesceDataConsumer );
+
+    //! The event, which coalescing key is the key of the data.
+    class CoalesceEvent : public CoalesceDataEvent
+    {
+    public:
+        explicit CoalesceEvent( const CoalesceData & data )
+            : CoalesceDataEvent( data )
+        {
+        }
+
+        virtual uint64_t getCoalesceKey( void ) const override
+        {
+            return getData( ).key;
+        }
+
+        //! Only the events of the same target are replaced, the keys of other targets may be the same.
+        virtual bool canReplaceEvent( const Event & queuedEvent ) const override
+        {
+            return (static_cast<const CoalesceEvent &>(queuedEvent).getData( ).target == getData( ).target);
+        }
+
+        //! Sends the event to the dispatcher.
+        static void send( DispatcherThread & dispatcher, uint64_t key, uint32_t value, uint32_t target = 0u )
+        {
+            CoalesceEvent * eventElem = DEBUG_NEW CoalesceEvent( CoalesceData{ key, value, target } );
+            eventElem->registerForThread( &dispatcher );
+            eventElem->deliverEvent( );
+        }
+    };
+
+    //! The attribute update event of the proxy.
+    class CoalesceResponseEvent : public LocalResponseEvent
+    {
+    public:
+        CoalesceResponseEvent( const ProxyAddress & proxyTarget, NEService::eResultType result, unsigned int respId )
+            : LocalResponseEvent( proxyTarget, result, respId )
+        {
+        }
+    };
+
+    //! The value of the event, which blocks the dispatcher until the other events are queued.
+    constexpr uint32_t  BLOCKING_VALUE  { 0u };
+    //! The key of the coalesced events.
+    constexpr uint64_t  COALESCED_KEY   { 0x0000000100000001ull };
+    //! The key of the events, which are not coalesced.
+    constexpr uint64_t  QUEUED_KEY      { 0x0000000100000002ull };
+
+    std::atomic_uint32_t    _coalesceStarted{ 0u };
+    std::atomic_uint32_t    _coalesceReceived{ 0u };
+    std::atomic_bool        _coalesceBlocked{ false };
+    std::atomic_bool        _coalesceRelease{ false };
+    std::vector<uint32_t>   _coalesceOrder;
+
+    //! The component, which records the order of the received events.
+    class CoalesceNode  : public Component
+                        , public IECoalesceDataConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW CoalesceNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        CoalesceNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component             ( entry, owner )
+            , IECoalesceDataConsumer( )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            CoalesceDataEvent::addListener( static_cast<IECoalesceDataConsumer &>(*this), comThread );
+            _coalesceStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            CoalesceDataEvent::removeListener( static_cast<IECoalesceDataConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const CoalesceData & data ) override
+        {
+            if ( data.value == BLOCKING_VALUE )
+            {
+                _coalesceBlocked.store( true );
+                while ( _coalesceRelease.load( ) == false )
+                {
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+                }
+            }
+            else
+            {
+                _coalesceOrder.push_back( data.value );
+            }
+
+            _coalesceReceived.fetch_add( 1u );
+        }
+    };
+
+    //! Returns the statistics of the dispatcher with the name. The name is empty if not found.
+    DispatcherStatistics::sDispatcherStatistics _findStatistics( const String & name )
+    {
+        DispatcherStatistics::ListStatistics list;
+        Application::queryDispatcherStatistics( list );
+        for ( const auto & entry : list.getData( ) )
+        {
+            if ( entry.dsDispatcherName == name )
+                return entry;
+        }
+
+        return DispatcherStatistics::sDispatcherStatistics( );
+    }
+}
+
+/**
+ * \brief   Checks that the queued event is replaced by the new event with the same key
+ *          if coalescing of the key is enabled, that the events with other keys or other
+ *          targets keep the order, and that the replaced events are counted in the statistics.
+ **/
+TEST( EventCoalesceTest, LatestValueWins )
+{
+    const String modelName( "EventCoalesceModel" );
+    const String threadName( "EventCoalesceThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.addComponent( "EventCoalesceNode", &CoalesceNode::CreateComponent, &CoalesceNode::DeleteComponent );
+
+    _coalesceStarted.store( 0u );
+    _coalesceReceived.store( 0u );
+    _coalesceBlocked.store( false );
+    _coalesceRelease.store( false );
+    _coalesceOrder.clear( );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _coalesceStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+    EventDispatcher & eventDispatcher = dispatcher.getEventDispatcher( );
+    eventDispatcher.setEventCoalescing( COALESCED_KEY, true );
+    const uint64_t coalescedBefore{ _findStatistics( threadName ).dsCoalesced };
+
+    CoalesceEvent::send( dispatcher, 0u, BLOCKING_VALUE );
+    while ( _coalesceBlocked.load( ) == false )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    CoalesceEvent::send( dispatcher, COALESCED_KEY, 1u );
+    CoalesceEvent::send( dispatcher, COALESCED_KEY, 2u );
+    CoalesceEvent::send( dispatcher, COALESCED_KEY, 5u, 1u );
+    CoalesceEvent::send( dispatcher, QUEUED_KEY, 10u );
+    CoalesceEvent::send( dispatcher, COALESCED_KEY, 3u );
+    CoalesceEvent::send( dispatcher, QUEUED_KEY, 11u );
+    CoalesceEvent::send( dispatcher, 0u, 20u );
+    EXPECT_EQ( eventDispatcher.getQueueSize( ), 5u );
+
+    _coalesceRelease.store( true );
+    while ( _coalesceReceived.load( ) != 6u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    // the key is not coalesced anymore.
+    eventDispatcher.setEventCoalescing( COALESCED_KEY, false );
+    const DispatcherStatistics::sDispatcherStatistics stats{ _findStatistics( threadName ) };
+    ComponentLoader::removeComponentModel( modelName );
+
+    const std::vector<uint32_t> expected{ 5u, 10u, 3u, 11u, 20u };
+    EXPECT_EQ( _coalesceOrder, expected );
+
+    ASSERT_EQ( stats.dsDispatcherName, threadName );
+    EXPECT_EQ( stats.dsCoalesced - coalescedBefore, 2u );
+}
+
+/**
+ * \brief   Checks that only the attribute updates with the whole data have the coalescing key,
+ *          the key differs per proxy and attribute, and that the update replaces only the queued
+ *          update of the same attribute of the same proxy.
+ **/
+TEST( EventCoalesceTest, AttributeUpdateKey )
+{
+    // the address of the proxy is valid only in the running dispatcher thread.
+    const String modelName( "EventCoalesceKeyModel" );
+    const String threadName( "EventCoalesceKeyThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.addComponent( "EventCoalesceKeyNode", &CoalesceNode::CreateComponent, &CoalesceNode::DeleteComponent );
+
+    _coalesceStarted.store( 0u );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _coalesceStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    const ProxyAddress proxy( "CoalesceService", Version( 1, 0, 0 ), NEService::eServiceType::ServiceLocal, "CoalesceRole", threadName );
+    const ProxyAddress other( "CoalesceService", Version( 1, 0, 0 ), NEService::eServiceType::ServiceLocal, "CoalesceOther", threadName );
+    ComponentLoader::removeComponentModel( modelName );
+
+    constexpr unsigned int attrFirst { NEService::ATTRIBUTE_ID_FIRST };
+    constexpr unsigned int attrSecond{ NEService::ATTRIBUTE_ID_FIRST + 1u };
+
+    const uint64_t key{ ServiceResponseEvent::createCoalesceKey( proxy, attrFirst ) };
+    EXPECT_NE( key, 0u );
+    EXPECT_NE( key, ServiceResponseEvent::createCoalesceKey( proxy, attrSecond ) );
+    EXPECT_NE( key, ServiceResponseEvent::createCoalesceKey( other, attrFirst ) );
+
+    EXPECT_EQ( CoalesceResponseEvent( proxy, NEService::eResultType::DataOK, attrFirst ).getCoalesceKey( ), key );
+    EXPECT_EQ( CoalesceResponseEvent( proxy, NEService::eResultType::DataInvalid, attrFirst ).getCoalesceKey( ), key );
+    EXPECT_EQ( CoalesceResponseEvent( proxy, NEService::eResultType::DataDelta, attrFirst ).getCoalesceKey( ), 0u );
+    EXPECT_EQ( CoalesceResponseEvent( proxy, NEService::eResultType::RequestOK, NEService::RESPONSE_ID_FIRST ).getCoalesceKey( ), 0u );
+
+    // the queued update is replaced only by the update of the same attribute of the same proxy.
+    const CoalesceResponseEvent update( proxy, NEService::eResultType::DataOK, attrFirst );
+    EXPECT_TRUE( update.canReplaceEvent( CoalesceResponseEvent( proxy, NEService::eResultType::DataInvalid, attrFirst ) ) );
+    EXPECT_FALSE( update.canReplaceEvent( CoalesceResponseEvent( proxy, NEService::eResultType::DataOK, attrSecond ) ) );
+    EXPECT_FALSE( update.canReplaceEvent( CoalesceResponseEvent( other, NEService::eResultType::DataOK, attrFirst ) ) );
+}
@@ -0,0 +1,265 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/EventDataStreamTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the event data referencing the received remote message.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/component/EventDataStream.hpp"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    //!< The header value streamed before the event data.
+    constexpr uint32_t  MESSAGE_HEADER  { 0x12345678 };
+
+    //!< Returns the event data with the given number of parameters.
+    EventDataStream _createData( uint32_t count )
+    {
+        EventDataStream data(EventDataStream::eEventData::EventDataExternal);
+        IEOutStream & stream = data.getStreamForWrite();
+        for (uint32_t i = 0; i < count; ++ i)
+        {
+            stream << i;
+        }
+
+        return data;
+    }
+
+    //!< Returns the remote message, which contains the header and the event data.
+    RemoteMessage _createMessage( const EventDataStream & data )
+    {
+        RemoteMessage msg;
+        msg << MESSAGE_HEADER;
+        msg << data;
+        msg.moveToBegin();
+        return msg;
+    }
+
+    //!< Reads and checks the parameters of event data.
+    void _checkData( const EventDataStream & data, uint32_t count )
+    {
+        const IEInStream & stream = data.getStreamForRead();
+        for (uint32_t i = 0; i < count; ++ i)
+        {
+            uint32_t value{ 0 };
+            stream >> value;
+            ASSERT_EQ( value, i );
+        }
+    }
+}
+
+/**
+ * \brief   Checks that the event data references the data of the source within the scope.
+ **/
+TEST( EventDataStreamTest, SharedSource )
+{
+    constexpr uint32_t count{ 64 };
+    const RemoteMessage msg{ _createMessage(_createData(count)) };
+
+    uint32_t header{ 0 };
+    msg >> header;
+    ASSERT_EQ( header, MESSAGE_HEADER );
+
+    EventDataStream::SharedSourceScope scope(msg);
+    const EventDataStream data(msg);
+    EXPECT_TRUE( data.isSharedSource() );
+    EXPECT_FALSE( data.isEmpty() );
+    EXPECT_TRUE( msg.isEndOfBuffer() );
+    _checkData(data, count);
+
+    EventDataStream copy(data);
+    EXPECT_TRUE( copy.isSharedSource() );
+    _checkData(copy, count);
+}
+
+/**
+ * \brief   Checks that the data is copied out of the scope
+ *          or if the data is not the last entry of the source.
+ **/
+TEST( EventDataStreamTest, CopiedSource )
+{
+    constexpr uint32_t count{ 16 };
+    const RemoteMessage msg{ _createMessage(_createData(count)) };
+
+    uint32_t header{ 0 };
+    msg >> header;
+    const EventDataStream data(msg);
+    EXPECT_FALSE( data.isSharedSource() );
+    _checkData(data, count);
+
+    RemoteMessage trailing;
+    trailing << MESSAGE_HEADER << _createData(count) << MESSAGE_HEADER;
+    trailing.moveToBegin();
+    trailing >> header;
+
+    EventDataStream::SharedSourceScope scope(trailing);
+    const EventDataStream copied(trailing);
+    EXPECT_FALSE( copied.isSharedSource() );
+    _checkData(copied, count);
+
+    header = 0;
+    trailing >> header;
+    EXPECT_EQ( header, MESSAGE_HEADER );
+}
+
+/**
+ * \brief   Checks that the referenced data is copied when modified
+ *          and is streamed without the data of the source.
+ **/
+TEST( EventDataStreamTest, DetachAndStream )
+{
+    constexpr uint32_t count{ 32 };
+    const RemoteMessage msg{ _createMessage(_createData(count)) };
+    const unsigned int msgSize{ msg.getSizeUsed() };
+
+    uint32_t header{ 0 };
+    msg >> header;
+    EventDataStream::SharedSourceScope scope(msg);
+    EventDataStream data(msg);
+    ASSERT_TRUE( data.isSharedSource() );
+
+    SharedBuffer buffer;
+    buffer << data;
+    buffer.moveToBegin();
+    const EventDataStream streamed(buffer);
+    EXPECT_FALSE( streamed.isSharedSource() );
+    _checkData(streamed, count);
+
+    _checkData(data, count);
+    data.getStreamForWrite() << count;
+    EXPECT_FALSE( data.isSharedSource() );
+    EXPECT_EQ( msg.getSizeUsed(), msgSize );
+
+    data.resetCursor();
+    _checkData(data, count + 1);
+}
+
+/**
+ * \brief   Checks that the event data decoded several times from the same message
+ *          references the message within the scope and is copied out of the scope.
+ **/
+TEST( EventDataStreamTest, DecodeRepeated )
+{
+    constexpr uint32_t count{ 100 };
+    constexpr uint32_t params{ 1024 };
+    const RemoteMessage msg{ _createMessage(_createData(params)) };
+    const unsigned int msgSize{ msg.getSizeUsed() };
+
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        msg.moveToBegin();
+        uint32_t header{ 0 };
+        msg >> header;
+        ASSERT_EQ( header, MESSAGE_HEADER );
+        if ((i % 2) == 0)
+        {
+            EventDataStream::SharedSourceScope scope(msg);
+            const EventDataStream data(msg);
+            ASSERT_TRUE( data.isSharedSource() );
+            _checkData(data, params);
+        }
+        else
+        {
+            const EventDataStream data(msg);
+            ASSERT_FALSE( data.isSharedSource() );
+            _checkData(data, params);
+        }
+    }
+
+    EXPECT_EQ( msg.getSizeUsed(), msgSize );
+}
+
+/**
+ * \brief   Checks that the view of the received data references the message
+ *          and that the view is not created if the data contains shared buffers.
+ **/
+TEST( EventDataStreamTest, DataView )
+{
+    constexpr uint32_t count{ 64 };
+    RemoteMessage msg{ _createMessage(_createData(count)) };
+
+    uint32_t header{ 0 };
+    msg >> header;
+    BufferView view;
+    {
+        EventDataStream::SharedSourceScope scope(msg);
+        const EventDataStream data(msg);
+        ASSERT_TRUE( data.getDataView(view) );
+    }
+
+    ASSERT_EQ( view.getSize(), count * sizeof(uint32_t) );
+    EXPECT_EQ( view.getEnd(), msg.getBuffer() + msg.getSizeUsed() );
+    const uint32_t * values = reinterpret_cast<const uint32_t *>(view.getData());
+    EXPECT_EQ( values[0], 0u );
+    EXPECT_EQ( values[count - 1], count - 1 );
+
+    // the view keeps the data of the released message.
+    msg.invalidate();
+    EXPECT_EQ( reinterpret_cast<const uint32_t *>(view.getData())[count - 1], count - 1 );
+
+    EventDataStream local(EventDataStream::eEventData::EventDataInternal);
+    EXPECT_FALSE( local.getDataView(view) );
+    EXPECT_TRUE( view.isEmpty() );
+
+    local.getStreamForWrite() << count;
+    EXPECT_TRUE( local.getDataView(view) );
+    EXPECT_EQ( view.getSize(), sizeof(uint32_t) );
+
+    local.getStreamForWrite() << SharedBuffer(reinterpret_cast<const unsigned char *>(&count), sizeof(uint32_t));
+    EXPECT_FALSE( local.getDataView(view) );
+}
+
+/**
+ * \brief   Checks that the view of the large binary data of the received message
+ *          references the message and contains the same data as the deserialized buffer.
+ **/
+TEST( EventDataStreamTest, DataViewLargeBlock )
+{
+    constexpr uint32_t blockSize{ 1024 * 1024 };
+
+    std::vector<unsigned char> bytes(blockSize);
+    for (uint32_t i = 0; i < blockSize; ++ i)
+    {
+        bytes[i] = static_cast<unsigned char>(i % 251);
+    }
+
+    const SharedBuffer block(bytes.data(), blockSize);
+    EventDataStream data(EventDataStream::eEventData::EventDataExternal);
+    data.getStreamForWrite() << block;
+    const RemoteMessage msg{ _createMessage(data) };
+
+    uint32_t header{ 0 };
+    msg >> header;
+    EventDataStream::SharedSourceScope scope(msg);
+    const EventDataStream received(msg);
+    ASSERT_TRUE( received.isSharedSource() );
+
+    SharedBuffer param;
+    received.getStreamForRead() >> param;
+    ASSERT_EQ( param.getSizeUsed(), blockSize );
+
+    BufferView view;
+    ASSERT_TRUE( received.getDataView(view) );
+    const BufferView paramView{ view.getView(sizeof(uint32_t), blockSize) };
+    ASSERT_EQ( paramView.getSize(), blockSize );
+    EXPECT_GE( paramView.getData(), msg.getBuffer() );
+    EXPECT_EQ( paramView.getEnd(), msg.getBuffer() + msg.getSizeUsed() );
+    EXPECT_EQ( ::memcmp(paramView.getData(), param.getBuffer(), blockSize), 0 );
+    EXPECT_EQ( ::memcmp(paramView.getData(), bytes.data(), blockSize), 0 );
+}
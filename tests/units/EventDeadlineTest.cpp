@@ -0,0 +1,288 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/EventDeadlineTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the dispatching order of the events with deadlines.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/TEEvent.hpp"
+#include "areg/component/private/SortedEventStack.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //! The data of the event with a deadline.
+    struct DeadlineData
+    {
+        uint32_t    value{ 0u };
+    };
+
+    DECLARE_EVENT( DeadlineData, DeadlineDataEvent, IEDeadlineDataConsumer );
+
+    //! The event, which priority and deadline are set when created.
+    class DeadlineEvent : public DeadlineDataEvent
+    {
+    public:
+        DeadlineEvent( uint32_t value, Event::eEventPriority eventPrio, uint64_t deadline )
+            : DeadlineDataEvent( DeadlineData{ value }, eventPrio )
+        {
+            setDeadline( deadline );
+        }
+
+        //! Sends the event to the dispatcher.
+        static void send( DispatcherThread & dispatcher, uint32_t value, Event::eEventPriority eventPrio, uint64_t deadline )
+        {
+            DeadlineEvent * eventElem = DEBUG_NEW DeadlineEvent( value, eventPrio, deadline );
+            eventElem->registerForThread( &dispatcher );
+            eventElem->deliverEvent( );
+        }
+    };
+
+    //! The value of the event, which blocks the dispatcher until the other events are queued.
+    constexpr uint32_t  BLOCKING_VALUE  { 0u };
+
+    std::atomic_uint32_t    _deadlineStarted{ 0u };
+    std::atomic_uint32_t    _deadlineReceived{ 0u };
+    std::atomic_bool        _deadlineBlocked{ false };
+    std::atomic_bool        _deadlineRelease{ false };
+    std::vector<uint32_t>   _deadlineOrder;
+
+    //! The component, which records the order of the received events.
+    class DeadlineNode  : public Component
+                        , public IEDeadlineDataConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW DeadlineNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        DeadlineNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component             ( entry, owner )
+            , IEDeadlineDataConsumer( )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            DeadlineDataEvent::addListener( static_cast<IEDeadlineDataConsumer &>(*this), comThread );
+            _deadlineStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            DeadlineDataEvent::removeListener( static_cast<IEDeadlineDataConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const DeadlineData & data ) override
+        {
+            if ( data.value == BLOCKING_VALUE )
+            {
+                _deadlineBlocked.store( true );
+                while ( _deadlineRelease.load( ) == false )
+                {
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+                }
+            }
+            else
+            {
+                _deadlineOrder.push_back( data.value );
+            }
+
+            _deadlineReceived.fetch_add( 1u );
+        }
+    };
+
+    //! Returns the statistics of the dispatcher with the name. The name is empty if not found.
+    DispatcherStatistics::sDispatcherStatistics _findStatistics( const String & name )
+    {
+        DispatcherStatistics::ListStatistics list;
+        Application::queryDispatcherStatistics( list );
+        for ( const auto & entry : list.getData( ) )
+        {
+            if ( entry.dsDispatcherName == name )
+                return entry;
+        }
+
+        return DispatcherStatistics::sDispatcherStatistics( );
+    }
+}
+
+/**
+ * \brief   Checks that the events of the same priority are dispatched by the earliest deadline
+ *          before the events without deadline, the priorities are respected and the events
+ *          dispatched after the deadline are counted in the statistics.
+ **/
+TEST( EventDeadlineTest, EarliestDeadlineFirst )
+{
+    const String modelName( "EventDeadlineModel" );
+    const String threadName( "EventDeadlineThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.addComponent( "EventDeadlineNode", &DeadlineNode::CreateComponent, &DeadlineNode::DeleteComponent );
+
+    _deadlineStarted.store( 0u );
+    _deadlineReceived.store( 0u );
+    _deadlineBlocked.store( false );
+    _deadlineRelease.store( false );
+    _deadlineOrder.clear( );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _deadlineStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+    const uint64_t missedBefore{ _findStatistics( threadName ).dsDeadlineMissed };
+
+    DeadlineEvent::send( dispatcher, BLOCKING_VALUE, Event::eEventPriority::EventPriorityNormal, 0u );
+    while ( _deadlineBlocked.load( ) == false )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    // The deadlines far in the future are not missed, the deadline in the past is missed.
+    const uint64_t now{ DispatcherStatistics::getTimestamp( ) };
+    const uint64_t later{ now + 60000000000ull };
+    DeadlineEvent::send( dispatcher, 1u, Event::eEventPriority::EventPriorityNormal, 0u );
+    DeadlineEvent::send( dispatcher, 2u, Event::eEventPriority::EventPriorityNormal, later + 3000u );
+    DeadlineEvent::send( dispatcher, 3u, Event::eEventPriority::EventPriorityLow, 1u );
+    DeadlineEvent::send( dispatcher, 4u, Event::eEventPriority::EventPriorityNormal, later + 1000u );
+    DeadlineEvent::send( dispatcher, 5u, Event::eEventPriority::EventPriorityHigh, 0u );
+    DeadlineEvent::send( dispatcher, 6u, Event::eEventPriority::EventPriorityNormal, 0u );
+    DeadlineEvent::send( dispatcher, 7u, Event::eEventPriority::EventPriorityNormal, later + 1000u );
+    EXPECT_GE( dispatcher.getEventDispatcher( ).getQueueSize( ), 7u );
+
+    _deadlineRelease.store( true );
+    while ( _deadlineReceived.load( ) != 8u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    const DispatcherStatistics::sDispatcherStatistics stats{ _findStatistics( threadName ) };
+    ComponentLoader::removeComponentModel( modelName );
+
+    const std::vector<uint32_t> expected{ 5u, 4u, 7u, 2u, 1u, 6u, 3u };
+    EXPECT_EQ( _deadlineOrder, expected );
+
+    ASSERT_EQ( stats.dsDispatcherName, threadName );
+    EXPECT_EQ( stats.dsDeadlineMissed - missedBefore, 1u );
+}
+
+/**
+ * \brief   Checks that the continuous flow of the events with deadline does not starve the
+ *          events without deadline of the same priority: after the limited number of events
+ *          with deadline the waiting event without deadline is dispatched.
+ **/
+TEST( EventDeadlineTest, NoStarvationOfFifoEvents )
+{
+    const String modelName( "EventStarvationModel" );
+    const String threadName( "EventStarvationThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.addComponent( "EventStarvationNode", &DeadlineNode::CreateComponent, &DeadlineNode::DeleteComponent );
+
+    _deadlineStarted.store( 0u );
+    _deadlineReceived.store( 0u );
+    _deadlineBlocked.store( false );
+    _deadlineRelease.store( false );
+    _deadlineOrder.clear( );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _deadlineStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+    DeadlineEvent::send( dispatcher, BLOCKING_VALUE, Event::eEventPriority::EventPriorityNormal, 0u );
+    while ( _deadlineBlocked.load( ) == false )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    // The events without deadline are values 1 and 2, the events with deadline start from 100.
+    constexpr uint32_t deadlineCount{ 4u * SortedEventStack::DEADLINE_RUN_MAX };
+    const uint64_t later{ DispatcherStatistics::getTimestamp( ) + 60000000000ull };
+    DeadlineEvent::send( dispatcher, 1u, Event::eEventPriority::EventPriorityNormal, 0u );
+    DeadlineEvent::send( dispatcher, 2u, Event::eEventPriority::EventPriorityNormal, 0u );
+    for ( uint32_t i = 0u; i < deadlineCount; ++ i )
+    {
+        DeadlineEvent::send( dispatcher, 100u + i, Event::eEventPriority::EventPriorityNormal, later + i );
+    }
+
+    _deadlineRelease.store( true );
+    while ( _deadlineReceived.load( ) != deadlineCount + 3u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    ComponentLoader::removeComponentModel( modelName );
+
+    // The runs of the events with deadline keep the earliest deadline order, each run is followed by one waiting FIFO event.
+    std::vector<uint32_t> expected;
+    uint32_t next{ 100u };
+    for ( uint32_t fifo = 1u; fifo <= 2u; ++ fifo )
+    {
+        for ( uint32_t i = 0u; i < SortedEventStack::DEADLINE_RUN_MAX; ++ i )
+        {
+            expected.push_back( next ++ );
+        }
+
+        expected.push_back( fifo );
+    }
+
+    while ( next < 100u + deadlineCount )
+    {
+        expected.push_back( next ++ );
+    }
+
+    EXPECT_EQ( _deadlineOrder, expected );
+}
+
+/**
+ * \brief   Checks that the relative deadline is set from the current time and can be removed.
+ **/
+TEST( EventDeadlineTest, DeadlineTimeout )
+{
+    DeadlineEvent eventElem( 1u, Event::eEventPriority::EventPriorityNormal, 0u );
+    EXPECT_EQ( eventElem.getDeadline( ), 0u );
+
+    const uint64_t before{ DispatcherStatistics::getTimestamp( ) };
+    eventElem.setDeadlineTimeout( 500u );
+    const uint64_t after{ DispatcherStatistics::getTimestamp( ) };
+    EXPECT_GE( eventElem.getDeadline( ), before + 500000u );
+    EXPECT_LE( eventElem.getDeadline( ), after + 500000u );
+
+    eventElem.setDeadlineTimeout( 0u );
+    EXPECT_EQ( eventElem.getDeadline( ), 0u );
+}
@@ -0,0 +1,198 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LayoutManagerTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the compiled log layouts.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/trace/private/LayoutManager.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/base/String.hpp"
+
+#include <string>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The output stream, which collects the formatted log messages in the string.
+    class LayoutOutput : public IEOutStream
+    {
+    public:
+        LayoutOutput( void ) = default;
+        virtual ~LayoutOutput( void ) = default;
+
+        virtual unsigned int write( const unsigned char * buffer, unsigned int size ) override
+        {
+            mText.append(reinterpret_cast<const char *>(buffer), size);
+            ++ mWrites;
+            return size;
+        }
+
+        virtual unsigned int write( const IEByteBuffer & /*buffer*/ ) override
+        {
+            return 0;
+        }
+
+        virtual unsigned int write( const String & ascii ) override
+        {
+            return write(reinterpret_cast<const unsigned char *>(ascii.getString()), static_cast<unsigned int>(ascii.getLength()));
+        }
+
+        virtual unsigned int write( const WideString & /*wide*/ ) override
+        {
+            return 0;
+        }
+
+        virtual void flush( void ) override
+        {
+        }
+
+        void clear( void )
+        {
+            mText.clear();
+            mWrites = 0;
+        }
+
+        std::string mText   { };
+        uint32_t    mWrites { 0 };
+
+    protected:
+        virtual unsigned int getSizeWritable( void ) const override
+        {
+            return 0xFFFFFFFFu;
+        }
+    };
+
+    //!< Creates the log message with fixed data.
+    NETrace::sLogMessage _createLogMessage( const char * message )
+    {
+        NETrace::sLogMessage logMsg(NETrace::eLogMessageType::LogMessageText);
+        logMsg.logDataType      = NETrace::eLogDataType::LogDataRemote;
+        logMsg.logMessagePrio   = NETrace::eLogPriority::PrioDebug;
+        logMsg.logCookie        = 7;
+        logMsg.logThreadId      = 42;
+        logMsg.logScopeId       = 1234;
+        logMsg.logTimestamp     = DateTime::getNow();
+        logMsg.logMessageLen    = static_cast<uint32_t>(NEString::getStringLength<char>(message));
+        NEString::copyString<char, char>(logMsg.logMessage, NETrace::LOG_MESSAGE_IZE, message);
+        logMsg.logThreadLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logThread, NETrace::LOG_NAMES_SIZE, "test_thread"));
+        logMsg.logModuleLen     = static_cast<uint32_t>(NEString::copyString<char, char>(logMsg.logModule, NETrace::LOG_NAMES_SIZE, "test_module"));
+        return logMsg;
+    }
+
+    //!< Formats the timestamp in the same way as the layouts did before compiling them.
+    std::string _formatTimestamp( const TIME64 & timestamp )
+    {
+        String result;
+        DateTime::formatTime(DateTime(timestamp), result, NEUtilities::TIME_FORMAT_ISO8601_OUTPUT);
+        return std::string(result.getString(), result.getLength());
+    }
+}
+
+/**
+ * \brief   Checks that the compiled layouts output the fields and the literal text.
+ **/
+TEST( LayoutManagerTest, CompileLayoutFormat )
+{
+    const NETrace::sLogMessage logMsg{ _createLogMessage("Hello 'world'") };
+    const String & prio{ NETrace::logPrioToString(logMsg.logMessagePrio) };
+
+    LayoutManager layouts;
+    LayoutOutput output;
+    ASSERT_TRUE( layouts.createLayouts("[ %a.%t %x.%y ] %p >>> %m, scope %s, 100%% done %q%n") );
+    ASSERT_TRUE( layouts.isValid() );
+
+    layouts.logMessage(logMsg, output);
+
+    std::string expected{ "[ 007.000042 test_module.test_thread ] " };
+    expected += std::string(prio.getString(), prio.getLength());
+    expected += " >>> Hello 'world', scope 1234, 100% done %q\n";
+    EXPECT_EQ( output.mText, expected );
+    EXPECT_EQ( output.mWrites, 1u );
+
+    // the message and the scope name are exclusive, the second is ignored.
+    output.clear();
+    ASSERT_TRUE( layouts.createLayouts(String("%z: %m")) );
+    layouts.logMessage(logMsg, output);
+    EXPECT_EQ( output.mText, std::string("Hello 'world': ") );
+
+    layouts.deleteLayouts();
+    EXPECT_FALSE( layouts.isValid() );
+    EXPECT_FALSE( layouts.createLayouts("") );
+}
+
+/**
+ * \brief   Checks that the cached date-time outputs the same text as DateTime::formatTime
+ *          within the same second and after the second changes.
+ **/
+TEST( LayoutManagerTest, CachedDayTime )
+{
+    NETrace::sLogMessage logMsg{ _createLogMessage("message") };
+    const TIME64 start{ (logMsg.logTimestamp / NEUtilities::SEC_TO_MICROSECS) * NEUtilities::SEC_TO_MICROSECS };
+    constexpr TIME64 steps[]{ 0, 1'000, 999'999, 1'000'000, 1'250'000, 61'001'000, 3'600'000'000LL };
+
+    LayoutManager layouts;
+    LayoutOutput output;
+    ASSERT_TRUE( layouts.createLayouts("%d") );
+
+    for (const TIME64 step : steps)
+    {
+        output.clear();
+        logMsg.logTimestamp = start + step;
+        layouts.logMessage(logMsg, output);
+        EXPECT_EQ( output.mText, _formatTimestamp(logMsg.logTimestamp) );
+    }
+}
+
+/**
+ * \brief   Checks that the sequence of messages with the full layout is formatted with a single
+ *          write per message and the same text as formatting every field of every message,
+ *          while the cached date-time moves across the second boundaries.
+ **/
+TEST( LayoutManagerTest, FormatMessageSequence )
+{
+    constexpr uint32_t  count{ 1'000 };
+    constexpr TIME64    step{ 7'300 };
+    NETrace::sLogMessage logMsg{ _createLogMessage("The message to output in the log.") };
+    const String & prio{ NETrace::logPrioToString(logMsg.logMessagePrio) };
+    const TIME64 start{ logMsg.logTimestamp };
+
+    LayoutManager layouts;
+    LayoutOutput output;
+    ASSERT_TRUE( layouts.createLayouts("%d: [ %a.%t  %x.%z: %p ]%n") );
+
+    uint32_t mismatches{ 0 };
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        logMsg.logTimestamp = start + static_cast<TIME64>(i) * step;
+        layouts.logMessage(logMsg, output);
+
+        std::string expected{ _formatTimestamp(logMsg.logTimestamp) };
+        expected += ": [ 007.000042  test_module.The message to output in the log.: ";
+        expected += std::string(prio.getString(), prio.getLength());
+        expected += " ]\n";
+        mismatches += (output.mText != expected ? 1u : 0u);
+        output.mText.clear();
+    }
+
+    EXPECT_EQ( mismatches, 0u );
+    EXPECT_EQ( output.mWrites, count );
+}
+
+#endif  // AREG_LOGS
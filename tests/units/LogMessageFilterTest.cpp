@@ -0,0 +1,195 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogMessageFilterTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the log message filters of the log collector.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "logger/service/private/LogMessageFilter.hpp"
+
+#include <string.h>
+
+namespace
+{
+    //!< The ID of the log source used in the tests.
+    constexpr ITEM_ID   SOURCE_COOKIE   { 256 };
+
+    //!< Returns the log message of the scope with the priority and the text.
+    NETrace::sLogMessage _logMessage( unsigned int scopeId, NETrace::eLogPriority prio, const char * text = "log message" )
+    {
+        return NETrace::sLogMessage( NETrace::eLogMessageType::LogMessageText, scopeId, prio, text, static_cast<unsigned int>(::strlen( text )) );
+    }
+
+    //!< Returns the filter of the scope ID range.
+    NETrace::sLogFilter _rangeFilter( uint32_t first, uint32_t last )
+    {
+        NETrace::sLogFilter result;
+        result.filterScopeFirst = first;
+        result.filterScopeLast  = last;
+        return result;
+    }
+
+    //!< Returns the filter of the scope name prefix.
+    NETrace::sLogFilter _prefixFilter( const char * prefix )
+    {
+        NETrace::sLogFilter result;
+        result.filterScopePrefix = prefix;
+        return result;
+    }
+}
+
+/**
+ * \brief   Checks the empty list of filters and the filter with default values match any message.
+ **/
+TEST( LogMessageFilterTest, MatchAny )
+{
+    LogMessageFilter filter;
+    EXPECT_TRUE( filter.isEmpty( ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 10u, NETrace::eLogPriority::PrioDebug ) ) );
+
+    NETrace::LogFilters filters;
+    filters.add( _rangeFilter( 100u, 200u ) );
+    filters.add( NETrace::sLogFilter( ) );
+    filter.setFilters( filters );
+    EXPECT_TRUE( filter.isEmpty( ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 10u, NETrace::eLogPriority::PrioDebug ) ) );
+}
+
+/**
+ * \brief   Checks the ranges of scope IDs, including the ranges without lower or upper limit.
+ **/
+TEST( LogMessageFilterTest, ScopeRange )
+{
+    LogMessageFilter filter;
+    NETrace::LogFilters filters;
+
+    filters.add( _rangeFilter( 100u, 200u ) );
+    filter.setFilters( filters );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 99u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 100u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 200u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 201u, NETrace::eLogPriority::PrioInfo ) ) );
+
+    // The range without the last scope ID has no upper limit.
+    filters.clear( );
+    filters.add( _rangeFilter( 100u, 0u ) );
+    filter.setFilters( filters );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 99u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 100u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 0xFFFFFFFFu, NETrace::eLogPriority::PrioInfo ) ) );
+
+    // The range without the first scope ID starts from zero.
+    filters.clear( );
+    filters.add( _rangeFilter( 0u, 50u ) );
+    filter.setFilters( filters );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 0u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 50u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 51u, NETrace::eLogPriority::PrioInfo ) ) );
+}
+
+/**
+ * \brief   Checks that the message matches if it matches all fields of at least one filter.
+ **/
+TEST( LogMessageFilterTest, MatchFields )
+{
+    NETrace::sLogFilter errors;
+    errors.filterCookie     = SOURCE_COOKIE;
+    errors.filterPriorities = static_cast<uint32_t>(NETrace::eLogPriority::PrioError);
+
+    NETrace::sLogFilter text{ _rangeFilter( 10u, 20u ) };
+    text.filterText = "timeout";
+
+    NETrace::LogFilters filters;
+    filters.add( errors );
+    filters.add( text );
+    LogMessageFilter filter;
+    filter.setFilters( filters );
+    EXPECT_FALSE( filter.isEmpty( ) );
+    EXPECT_FALSE( filter.hasScopePrefix( ) );
+
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioError ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE + 1, _logMessage( 1u, NETrace::eLogPriority::PrioError ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioWarning ) ) );
+
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE + 1, _logMessage( 15u, NETrace::eLogPriority::PrioDebug, "connection timeout expired" ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE + 1, _logMessage( 15u, NETrace::eLogPriority::PrioDebug, "connection established" ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE + 1, _logMessage( 25u, NETrace::eLogPriority::PrioDebug, "connection timeout expired" ) ) );
+}
+
+/**
+ * \brief   Checks that the scope name prefix is resolved by the registered and updated scopes.
+ **/
+TEST( LogMessageFilterTest, ScopePrefix )
+{
+    NETrace::LogFilters filters;
+    filters.add( _prefixFilter( "areg_ipc_" ) );
+    LogMessageFilter filter;
+    filter.setFilters( filters );
+    EXPECT_TRUE( filter.hasScopePrefix( ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioInfo ) ) );
+
+    NETrace::ScopeNames scopes;
+    scopes.add( NETrace::sScopeInfo( "areg_ipc_connect", 1u, 0u ) );
+    scopes.add( NETrace::sScopeInfo( "areg_base_thread", 2u, 0u ) );
+    filter.updateScopes( scopes );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 2u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 3u, NETrace::eLogPriority::PrioInfo ) ) );
+
+    // The partial update adds the new scope, the resolved scopes are kept.
+    NETrace::ScopeNames update;
+    update.add( NETrace::sScopeInfo( "areg_ipc_send", 3u, 0u ) );
+    filter.updateScopes( update );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 3u, NETrace::eLogPriority::PrioInfo ) ) );
+}
+
+/**
+ * \brief   Checks that the partial list of scopes is merged into the saved list of scopes.
+ **/
+TEST( LogMessageFilterTest, MergeScopes )
+{
+    NETrace::ScopeNames scopes;
+    scopes.add( NETrace::sScopeInfo( "areg_ipc_connect", 1u, 0x10u ) );
+    scopes.add( NETrace::sScopeInfo( "areg_base_thread", 2u, 0x10u ) );
+    scopes.add( NETrace::sScopeInfo( "areg_ipc_send", 3u, 0x10u ) );
+
+    NETrace::ScopeNames update;
+    update.add( NETrace::sScopeInfo( "areg_base_thread", 2u, 0x40u ) );
+    update.add( NETrace::sScopeInfo( "areg_ipc_receive", 4u, 0x80u ) );
+    LogMessageFilter::mergeScopes( scopes, update );
+
+    ASSERT_EQ( scopes.getSize( ), 4u );
+    EXPECT_EQ( scopes[0].scopeId, 1u );
+    EXPECT_EQ( scopes[0].scopePrio, 0x10u );
+    EXPECT_EQ( scopes[1].scopeId, 2u );
+    EXPECT_EQ( scopes[1].scopePrio, 0x40u );
+    EXPECT_EQ( scopes[2].scopeId, 3u );
+    EXPECT_EQ( scopes[2].scopePrio, 0x10u );
+    EXPECT_EQ( scopes[3].scopeId, 4u );
+    EXPECT_EQ( scopes[3].scopeName, "areg_ipc_receive" );
+    EXPECT_EQ( scopes[3].scopePrio, 0x80u );
+
+    // The resolved scopes of the new filter contain both registered and updated scopes.
+    NETrace::LogFilters filters;
+    filters.add( _prefixFilter( "areg_ipc_" ) );
+    LogMessageFilter filter;
+    filter.setFilters( filters );
+    filter.updateScopes( scopes );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 1u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_FALSE( filter.matches( SOURCE_COOKIE, _logMessage( 2u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 3u, NETrace::eLogPriority::PrioInfo ) ) );
+    EXPECT_TRUE( filter.matches( SOURCE_COOKIE, _logMessage( 4u, NETrace::eLogPriority::PrioInfo ) ) );
+}
@@ -0,0 +1,110 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ModelLoadingTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the concurrent loading of the model and startup timeline.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //! The number of component threads in the model.
+    constexpr uint32_t  LOAD_THREADS    { 32u };
+
+    std::atomic_uint32_t    _loadStarted{ 0u };
+
+    //! The component, which counts the started components.
+    class LoadNode : public Component
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW LoadNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        LoadNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component ( entry, owner )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            _loadStarted.fetch_add( 1u );
+        }
+    };
+}
+
+/**
+ * \brief   Checks that all threads of the model run when the model is loaded
+ *          and the startup timeline of every thread is in the order of startup steps.
+ **/
+TEST( ModelLoadingTest, ConcurrentThreadStart )
+{
+    const String modelName( "ModelLoadingModel" );
+    NERegistry::Model model( modelName );
+    for ( uint32_t i = 0; i < LOAD_THREADS; ++ i )
+    {
+        NERegistry::ComponentThreadEntry & thread = model.addThread( String("ModelLoadingThread_") + String::makeString(i) );
+        thread.addComponent( String("ModelLoadingNode_") + String::makeString(i), &LoadNode::CreateComponent, &LoadNode::DeleteComponent );
+    }
+
+    _loadStarted.store( 0u );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+
+    for ( uint32_t i = 0; i < LOAD_THREADS; ++ i )
+    {
+        Thread * thread = Thread::findThreadByName( String("ModelLoadingThread_") + String::makeString(i) );
+        ASSERT_NE( thread, nullptr );
+        EXPECT_TRUE( thread->waitForThreadRun( NECommon::DO_NOT_WAIT ) );
+    }
+
+    while ( _loadStarted.load( ) != LOAD_THREADS )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    for ( uint32_t i = 0; i < LOAD_THREADS; ++ i )
+    {
+        ComponentThread * thread = RUNTIME_CAST( Thread::findThreadByName( String("ModelLoadingThread_") + String::makeString(i) ), ComponentThread );
+        ASSERT_NE( thread, nullptr );
+        ComponentThread::sStartupTimeline timeline{ thread->getStartupTimeline( ) };
+        while ( timeline.stRegistered == 0u )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+            timeline = thread->getStartupTimeline( );
+        }
+
+        EXPECT_NE( timeline.stCreated, 0u );
+        EXPECT_LE( timeline.stCreated, timeline.stStarted );
+        EXPECT_LE( timeline.stStarted, timeline.stRegistered );
+    }
+
+    ComponentLoader::removeComponentModel( modelName );
+}
@@ -0,0 +1,357 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ReconnectBackoffTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the reconnect timeouts and bulk registration of services.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+#include "areg/ipc/IERemoteMessageHandler.hpp"
+#include "areg/ipc/IEServiceConnectionConsumer.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/ReconnectBackoff.hpp"
+#include "areg/ipc/ServiceClientConnectionBase.hpp"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace
+{
+    //!< The window of the first retry in milliseconds.
+    constexpr unsigned int  MIN_TIMEOUT         { 500 };
+
+    //!< The maximum window of the retry in milliseconds.
+    constexpr unsigned int  MAX_TIMEOUT         { 4000 };
+
+    //!< The number of clients, which reconnect after the router restart.
+    constexpr uint32_t      CLIENT_COUNT        { 500 };
+
+    //!< The number of stubs registered by each client.
+    constexpr uint32_t      CLIENT_STUBS        { 10 };
+
+    //!< The number of proxies registered by each client.
+    constexpr uint32_t      CLIENT_PROXIES      { 40 };
+
+    //!< The time in milliseconds, while the router is not available.
+    constexpr uint64_t      ROUTER_DOWN_TIME    { 3000 };
+
+    //!< The router cost to receive and dispatch one message in microseconds.
+    constexpr uint64_t      MESSAGE_COST        { 50 };
+
+    //!< The router cost to register one address in microseconds.
+    constexpr uint64_t      ADDRESS_COST        { 2 };
+
+    //!< The cookie of the client connection.
+    constexpr ITEM_ID       CLIENT_COOKIE       { NEService::COOKIE_REMOTE_SERVICE + 1 };
+
+    //!< The result of the router restart.
+    struct sRecovery
+    {
+        uint64_t    rcAttempts;     //!< The number of connection attempts of all clients.
+        uint64_t    rcMessages;     //!< The number of messages received by the router.
+        uint64_t    rcMaxDelay;     //!< The maximum time in microseconds, while the message waits in the router queue.
+        uint64_t    rcRecovery;     //!< The time in microseconds since the router restart, when all services are registered.
+    };
+
+    /**
+     * \brief   The client connection, which receives the connection notifications
+     *          of the router without connecting the socket.
+     **/
+    class FeatureConnection : public    IEServiceConnectionConsumer
+                            , public    IERemoteMessageHandler
+                            , public    ServiceClientConnectionBase
+    {
+    public:
+        explicit FeatureConnection( DispatcherThread & dispatcher )
+            : IEServiceConnectionConsumer   ( )
+            , IERemoteMessageHandler        ( )
+            , ServiceClientConnectionBase   ( NEService::COOKIE_ROUTER
+                                            , NERemoteService::eRemoteServices::ServiceRouter
+                                            , static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectTcpip)
+                                            , NEService::eMessageSource::MessageSourceClient
+                                            , static_cast<IEServiceConnectionConsumer &>(self())
+                                            , static_cast<IERemoteMessageHandler &>(self())
+                                            , dispatcher
+                                            , "ReconnectBackoffTest_" )
+        {
+        }
+
+        using ServiceClientConnectionBase::serviceConnectionEvent;
+        using ServiceClientConnectionBase::isServiceFeatureSupported;
+
+        virtual void connectedRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void disconnectedRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void lostRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void failedSendMessage( const RemoteMessage & /*msgFailed*/, Socket & /*whichTarget*/ ) override {}
+        virtual void failedReceiveMessage( Socket & /*whichSource*/ ) override {}
+        virtual void failedProcessMessage( const RemoteMessage & /*msgUnprocessed*/ ) override {}
+        virtual void processReceivedMessage( const RemoteMessage & /*msgReceived*/, Socket & /*whichSource*/ ) override {}
+
+    private:
+        FeatureConnection & self( void )
+        {
+            return (*this);
+        }
+    };
+
+    //!< Creates the connection notification of the router. The router of older
+    //!< version sends neither the message source, nor the features.
+    RemoteMessage _connectNotify( bool hasSource, bool hasFeatures )
+    {
+        RemoteMessage msg{ NERemoteService::createConnectNotify(NEService::COOKIE_ROUTER, CLIENT_COOKIE) };
+        msg.moveToEnd();
+        if (hasSource)
+        {
+            msg << NEService::eMessageSource::MessageSourceService;
+        }
+
+        if (hasFeatures)
+        {
+            msg << static_cast<uint32_t>(NERemoteService::eServiceFeatures::FeatureRegisterServices);
+        }
+
+        msg.moveToBegin();
+        return msg;
+    }
+
+    //!< Returns the address of the public stub.
+    StubAddress _stubAddress( uint32_t service )
+    {
+        return StubAddress(String("BulkService_") + String::makeString(service), Version(1, 0, 0), NEService::eServiceType::ServicePublic, "bulk_role", "bulk_thread");
+    }
+
+    //!< Returns the address of the public proxy. The proxy is read from the stream,
+    //!< since the thread of the proxy does not exist in this process.
+    ProxyAddress _proxyAddress( uint32_t service )
+    {
+        SharedBuffer stream;
+        stream << ServiceAddress(String("BulkService_") + String::makeString(service), Version(1, 0, 0), NEService::eServiceType::ServicePublic, "bulk_role");
+        stream << String("bulk_consumer");
+        stream << NEService::COOKIE_LOCAL;
+        stream.moveToBegin();
+        return ProxyAddress(stream);
+    }
+
+    /**
+     * \brief   Simulates the router restart. All clients lose the connection at the same time
+     *          and retry the connection until the router is available again. The connected
+     *          client sends the connect message and registers services either by one message
+     *          per service, or by one message for all services. The router processes the
+     *          messages in the order of arrival.
+     * \param   backoff The flag, indicating whether the clients use jittered exponential timeout,
+     *                  or the fixed timeout to retry the connection.
+     * \param   bulk    The flag, indicating whether the services are registered by one message.
+     **/
+    sRecovery _restartRouter( bool backoff, bool bulk )
+    {
+        sRecovery result{ 0, 0, 0, 0 };
+        std::vector<uint64_t> connected;
+        connected.reserve(CLIENT_COUNT);
+        for (uint32_t i = 0; i < CLIENT_COUNT; ++ i)
+        {
+            ReconnectBackoff timeouts(MIN_TIMEOUT, MAX_TIMEOUT);
+            uint64_t time{ 0 };
+            do
+            {
+                time += backoff ? timeouts.nextTimeout() : MIN_TIMEOUT;
+                ++ result.rcAttempts;
+            } while (time < ROUTER_DOWN_TIME);
+
+            connected.push_back(time * 1000);
+        }
+
+        std::sort(connected.begin(), connected.end());
+
+        const uint32_t messages{ bulk ? 1u : CLIENT_STUBS + CLIENT_PROXIES };
+        const uint64_t registerCost{ bulk ? MESSAGE_COST + (CLIENT_STUBS + CLIENT_PROXIES) * ADDRESS_COST : MESSAGE_COST + ADDRESS_COST };
+        uint64_t routerFree{ 0 };
+        for (uint64_t arrival : connected)
+        {
+            routerFree = MACRO_MAX(routerFree, arrival) + MESSAGE_COST;
+            for (uint32_t i = 0; i < messages; ++ i)
+            {
+                result.rcMaxDelay = MACRO_MAX(result.rcMaxDelay, routerFree - arrival);
+                routerFree += registerCost;
+            }
+
+            result.rcMessages += 1 + messages;
+        }
+
+        result.rcRecovery = routerFree;
+        return result;
+    }
+}
+
+/**
+ * \brief   Checks the growth of the retry window.
+ **/
+TEST( ReconnectBackoffTest, TimeoutWindow )
+{
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 0), 500u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 1), 1000u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 2), 2000u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 3), 4000u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 4), 4000u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, 1000), 4000u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, 700, 1), 700u );
+    EXPECT_EQ( ReconnectBackoff::getTimeoutWindow(0, 0, 5), 1u );
+}
+
+/**
+ * \brief   Checks that the timeouts are in the upper half of the window,
+ *          the attempts are counted and reset.
+ **/
+TEST( ReconnectBackoffTest, NextTimeout )
+{
+    ReconnectBackoff backoff(MIN_TIMEOUT, MAX_TIMEOUT);
+    EXPECT_EQ( backoff.getAttempts(), 0u );
+    for (uint32_t i = 0; i < 10; ++ i)
+    {
+        const unsigned int window{ ReconnectBackoff::getTimeoutWindow(MIN_TIMEOUT, MAX_TIMEOUT, i) };
+        const unsigned int timeout{ backoff.nextTimeout() };
+        EXPECT_GE( timeout, window / 2 );
+        EXPECT_LE( timeout, window );
+        EXPECT_EQ( backoff.getAttempts(), i + 1 );
+    }
+
+    backoff.reset();
+    EXPECT_EQ( backoff.getAttempts(), 0u );
+    EXPECT_LE( backoff.nextTimeout(), MIN_TIMEOUT );
+}
+
+/**
+ * \brief   Checks that the clients, which start retrying at the same time, get different timeouts.
+ **/
+TEST( ReconnectBackoffTest, JitterSpreadsClients )
+{
+    std::set<unsigned int> timeouts;
+    for (uint32_t i = 0; i < CLIENT_COUNT; ++ i)
+    {
+        ReconnectBackoff backoff(MIN_TIMEOUT, MAX_TIMEOUT);
+        timeouts.insert(backoff.nextTimeout());
+    }
+
+    // 500 clients in the window of 251 values
+    EXPECT_GT( timeouts.size(), 100u );
+}
+
+/**
+ * \brief   Checks the message, which registers stubs and proxies at once.
+ **/
+TEST( ReconnectBackoffTest, RegisterServicesMessage )
+{
+    TEArrayList<StubAddress> stubs;
+    TEArrayList<ProxyAddress> proxies;
+    uint32_t sizeSingle{ 0 };
+    for (uint32_t i = 0; i < CLIENT_STUBS; ++ i)
+    {
+        stubs.add(_stubAddress(i));
+        sizeSingle += NERemoteService::createRouterRegisterService(stubs[i], CLIENT_COOKIE, NEService::COOKIE_ROUTER).getSizeUsed();
+    }
+
+    for (uint32_t i = 0; i < CLIENT_PROXIES; ++ i)
+    {
+        proxies.add(_proxyAddress(i + CLIENT_STUBS));
+        sizeSingle += NERemoteService::createRouterRegisterClient(proxies[i], CLIENT_COOKIE, NEService::COOKIE_ROUTER).getSizeUsed();
+    }
+
+    const RemoteMessage msg{ NERemoteService::createRouterRegisterServices(stubs, proxies, CLIENT_COOKIE, NEService::COOKIE_ROUTER) };
+    ASSERT_TRUE( msg.isValid() );
+    EXPECT_EQ( msg.getMessageId(), static_cast<uint32_t>(NEService::eFuncIdRange::SystemServiceRequestRegister) );
+    EXPECT_EQ( msg.getSource(), CLIENT_COOKIE );
+
+    msg.moveToBegin();
+    NEService::eServiceRequestType reqType{ NEService::eServiceRequestType::RegisterStub };
+    msg >> reqType;
+    EXPECT_EQ( reqType, NEService::eServiceRequestType::RegisterServices );
+
+    uint32_t count{ 0 };
+    msg >> count;
+    ASSERT_EQ( count, CLIENT_STUBS );
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        StubAddress stub(msg);
+        EXPECT_EQ( stub.getServiceName(), stubs[i].getServiceName() );
+        EXPECT_EQ( stub.getCookie(), CLIENT_COOKIE );
+    }
+
+    msg >> count;
+    ASSERT_EQ( count, CLIENT_PROXIES );
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        ProxyAddress proxy(msg);
+        EXPECT_EQ( proxy.getServiceName(), proxies[i].getServiceName() );
+        EXPECT_EQ( proxy.getCookie(), CLIENT_COOKIE );
+        EXPECT_TRUE( proxy.isValid() );
+    }
+
+    EXPECT_LT( msg.getSizeUsed(), sizeSingle );
+
+    TEArrayList<StubAddress> emptyStubs;
+    TEArrayList<ProxyAddress> emptyProxies;
+    EXPECT_FALSE( NERemoteService::createRouterRegisterServices(stubs, proxies, NEService::COOKIE_UNKNOWN, NEService::COOKIE_ROUTER).isValid() );
+    EXPECT_TRUE( NERemoteService::createRouterRegisterServices(emptyStubs, emptyProxies, CLIENT_COOKIE, NEService::COOKIE_ROUTER).isValid() );
+}
+
+/**
+ * \brief   Checks that the bulk registration is enabled only if the router confirms it
+ *          in the connection notification, and that it is reset when disconnected.
+ **/
+TEST( ReconnectBackoffTest, RegisterServicesNegotiation )
+{
+    DispatcherThread dispatcher("ReconnectBackoffTest_Dispatcher");
+    FeatureConnection connection(dispatcher);
+    EXPECT_FALSE( connection.isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) );
+
+    connection.serviceConnectionEvent(_connectNotify(false, false));
+    EXPECT_EQ( connection.getConnectionCookie(), CLIENT_COOKIE );
+    EXPECT_FALSE( connection.isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) );
+
+    connection.serviceConnectionEvent(_connectNotify(true, false));
+    EXPECT_FALSE( connection.isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) );
+
+    connection.serviceConnectionEvent(_connectNotify(true, true));
+    EXPECT_TRUE( connection.isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) );
+
+    RemoteMessage msgDisconnect{ NERemoteService::createDisconnectNotify(NEService::COOKIE_ROUTER, CLIENT_COOKIE) };
+    msgDisconnect.moveToBegin();
+    connection.serviceConnectionEvent(msgDisconnect);
+    EXPECT_FALSE( connection.isServiceFeatureSupported(NERemoteService::eServiceFeatures::FeatureRegisterServices) );
+}
+
+/**
+ * \brief   Checks that the jittered backoff and the registration by one message reduce the attempts,
+ *          the messages and the delays to register the services of 500 clients after the router restart,
+ *          using the real retry timeouts and the model of the router processing the messages one by one.
+ **/
+TEST( ReconnectBackoffTest, RouterRestartRecovery )
+{
+    const sRecovery fixedSingle { _restartRouter(false, false) };
+    const sRecovery fixedBulk   { _restartRouter(false, true ) };
+    const sRecovery backoffSingle{ _restartRouter(true , false) };
+    const sRecovery backoffBulk { _restartRouter(true , true ) };
+
+    EXPECT_LT( fixedBulk.rcMessages, fixedSingle.rcMessages );
+    EXPECT_LT( fixedBulk.rcRecovery, fixedSingle.rcRecovery );
+    EXPECT_LT( backoffSingle.rcAttempts, fixedSingle.rcAttempts );
+    EXPECT_LT( backoffSingle.rcMaxDelay, fixedSingle.rcMaxDelay );
+    EXPECT_LT( backoffBulk.rcMaxDelay, fixedSingle.rcMaxDelay );
+    EXPECT_LT( backoffBulk.rcMessages, backoffSingle.rcMessages );
+}
@@ -0,0 +1,221 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/RemoteAddressCacheTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the addresses interned in the remote messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/component/private/RemoteAddressCache.hpp"
+
+namespace
+{
+    //!< The cookie of the remote peer.
+    constexpr ITEM_ID   PEER_COOKIE     { 1024 };
+
+    //!< Clears the cache when the test starts and completes.
+    struct CacheGuard
+    {
+        CacheGuard( void )
+        {
+            RemoteAddressCache::clear();
+        }
+
+        ~CacheGuard( void )
+        {
+            RemoteAddressCache::clear();
+        }
+    };
+
+    //!< Returns the stub address used in the tests.
+    StubAddress _stubAddress( void )
+    {
+        StubAddress result("RemoteServiceInterfaceName", Version(1, 0, 0), NEService::eServiceType::ServicePublic, "remote_service_provider_role_name", "remote_service_thread_name");
+        result.setCookie(PEER_COOKIE);
+        return result;
+    }
+
+    //!< Returns the proxy address used in the tests.
+    ProxyAddress _proxyAddress( void )
+    {
+        ProxyAddress result("RemoteServiceInterfaceName", Version(1, 0, 0), NEService::eServiceType::ServicePublic, "remote_service_provider_role_name", "remote_service_consumer_thread");
+        result.setCookie(PEER_COOKIE + 1);
+        return result;
+    }
+
+    //!< Writes the stub address and the proxy address within the outgoing scope.
+    void _writeAddresses( SharedBuffer & stream, const StubAddress & stub, const ProxyAddress & proxy )
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE, true);
+        RemoteAddressCache::writeAddress(stream, stub);
+        RemoteAddressCache::writeAddress(stream, proxy);
+    }
+}
+
+/**
+ * \brief   Checks that the address is streamed in full, if there is no scope.
+ **/
+TEST( RemoteAddressCacheTest, NoScope )
+{
+    CacheGuard guard;
+    const StubAddress stub{ _stubAddress() };
+
+    SharedBuffer first;
+    SharedBuffer second;
+    RemoteAddressCache::writeAddress(first, stub);
+    RemoteAddressCache::writeAddress(second, stub);
+    EXPECT_EQ( first.getSizeUsed(), second.getSizeUsed() );
+
+    first.moveToBegin();
+    EXPECT_EQ( RemoteAddressCache::readStubAddress(first), stub );
+}
+
+/**
+ * \brief   Checks that the address is defined once, the next messages contain
+ *          only the handle, and the receiver resolves the handle.
+ **/
+TEST( RemoteAddressCacheTest, DefineAndResolve )
+{
+    CacheGuard guard;
+    const StubAddress stub{ _stubAddress() };
+    const ProxyAddress proxy{ _proxyAddress() };
+
+    SharedBuffer first;
+    SharedBuffer second;
+    _writeAddresses(first, stub, proxy);
+    _writeAddresses(second, stub, proxy);
+    EXPECT_EQ( second.getSizeUsed(), 2 * (sizeof(uint8_t) + sizeof(uint32_t)) );
+    EXPECT_GT( first.getSizeUsed(), second.getSizeUsed() );
+
+    RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+    first.moveToBegin();
+    EXPECT_EQ( RemoteAddressCache::readStubAddress(first), stub );
+    EXPECT_EQ( RemoteAddressCache::readProxyAddress(first), proxy );
+
+    second.moveToBegin();
+    const StubAddress resolvedStub{ RemoteAddressCache::readStubAddress(second) };
+    const ProxyAddress resolvedProxy{ RemoteAddressCache::readProxyAddress(second) };
+    EXPECT_EQ( resolvedStub, stub );
+    EXPECT_EQ( resolvedStub.getRoleName(), stub.getRoleName() );
+    EXPECT_EQ( resolvedStub.getThread(), stub.getThread() );
+    EXPECT_EQ( resolvedProxy, proxy );
+    EXPECT_EQ( resolvedProxy.getThread(), proxy.getThread() );
+}
+
+/**
+ * \brief   Checks that the handles are scoped to the peer and
+ *          are not resolved after the cache is cleared.
+ **/
+TEST( RemoteAddressCacheTest, UnknownHandle )
+{
+    CacheGuard guard;
+    const StubAddress stub{ _stubAddress() };
+    const ProxyAddress proxy{ _proxyAddress() };
+
+    SharedBuffer first;
+    SharedBuffer second;
+    _writeAddresses(first, stub, proxy);
+    _writeAddresses(second, stub, proxy);
+
+    do
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+        first.moveToBegin();
+        RemoteAddressCache::readStubAddress(first);
+        RemoteAddressCache::readProxyAddress(first);
+    } while (false);
+
+    do
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE + 1, false);
+        second.moveToBegin();
+        EXPECT_FALSE( RemoteAddressCache::readStubAddress(second).isValid() );
+    } while (false);
+
+    RemoteAddressCache::clear();
+    RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+    second.moveToBegin();
+    EXPECT_FALSE( RemoteAddressCache::readStubAddress(second).isValid() );
+    EXPECT_FALSE( RemoteAddressCache::readProxyAddress(second).isValid() );
+}
+
+/**
+ * \brief   Checks that the addresses are defined again after the handles
+ *          of the peer are reset, and the handles of other peers remain.
+ **/
+TEST( RemoteAddressCacheTest, ResetPeer )
+{
+    CacheGuard guard;
+    const StubAddress stub{ _stubAddress() };
+    const ProxyAddress proxy{ _proxyAddress() };
+
+    SharedBuffer first;
+    SharedBuffer second;
+    SharedBuffer other;
+    _writeAddresses(first, stub, proxy);
+    do
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE + 1, true);
+        RemoteAddressCache::writeAddress(other, stub);
+    } while (false);
+
+    RemoteAddressCache::resetPeer(PEER_COOKIE);
+    _writeAddresses(second, stub, proxy);
+    EXPECT_EQ( second.getSizeUsed(), first.getSizeUsed() );
+
+    RemoteAddressCache::Scope scope(PEER_COOKIE + 1, true);
+    SharedBuffer handle;
+    RemoteAddressCache::writeAddress(handle, stub);
+    EXPECT_EQ( handle.getSizeUsed(), sizeof(uint8_t) + sizeof(uint32_t) );
+}
+
+/**
+ * \brief   Checks that the handles received from the peer remain after the handles
+ *          sent to the peer are reset, and are removed when the peer disconnects.
+ **/
+TEST( RemoteAddressCacheTest, RemovePeer )
+{
+    CacheGuard guard;
+    const StubAddress stub{ _stubAddress() };
+    const ProxyAddress proxy{ _proxyAddress() };
+
+    SharedBuffer first;
+    SharedBuffer second;
+    _writeAddresses(first, stub, proxy);
+    _writeAddresses(second, stub, proxy);
+
+    do
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+        first.moveToBegin();
+        EXPECT_EQ( RemoteAddressCache::readStubAddress(first), stub );
+        EXPECT_EQ( RemoteAddressCache::readProxyAddress(first), proxy );
+    } while (false);
+
+    RemoteAddressCache::resetPeer(PEER_COOKIE);
+    do
+    {
+        RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+        second.moveToBegin();
+        EXPECT_EQ( RemoteAddressCache::readStubAddress(second), stub );
+        EXPECT_EQ( RemoteAddressCache::readProxyAddress(second), proxy );
+    } while (false);
+
+    RemoteAddressCache::removePeer(PEER_COOKIE);
+    RemoteAddressCache::Scope scope(PEER_COOKIE, false);
+    second.moveToBegin();
+    EXPECT_FALSE( RemoteAddressCache::readStubAddress(second).isValid() );
+    EXPECT_FALSE( RemoteAddressCache::readProxyAddress(second).isValid() );
+}
@@ -0,0 +1,96 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/RemoteMessageTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the remote message object.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/base/NEMemory.hpp"
+
+namespace
+{
+    //!< Creates the remote message with the fixed header and data.
+    RemoteMessage _createMessage( void )
+    {
+        NEMemory::sRemoteMessageHeader header{ };
+        header.rbhSource    = 10;
+        header.rbhTarget    = 20;
+        header.rbhMessageId = 1234;
+
+        RemoteMessage msg;
+        msg.initMessage(header, 64);
+        for (uint32_t i = 0; i < 16; ++ i)
+        {
+            msg << i;
+        }
+
+        return msg;
+    }
+}
+
+/**
+ * \brief   Checks that the shared messages refer to the same data,
+ *          but are delivered to different targets.
+ **/
+TEST( RemoteMessageTest, ShareWithTarget )
+{
+    const RemoteMessage msg{ _createMessage() };
+    const RemoteMessage first{ msg.shareWithTarget(30) };
+    RemoteMessage second{ msg.shareWithTarget(40) };
+
+    EXPECT_FALSE( msg.isSharedWithTarget() );
+    EXPECT_TRUE( first.isSharedWithTarget() );
+    EXPECT_EQ( first.getBuffer(), msg.getBuffer() );
+    EXPECT_EQ( second.getBuffer(), msg.getBuffer() );
+
+    EXPECT_EQ( msg.getTarget(), 20u );
+    EXPECT_EQ( first.getTarget(), 30u );
+    EXPECT_EQ( second.getTarget(), 40u );
+    EXPECT_EQ( first.getSource(), msg.getSource() );
+
+    second.setTarget(50);
+    EXPECT_EQ( second.getTarget(), 50u );
+    EXPECT_EQ( first.getTarget(), 30u );
+    EXPECT_EQ( msg.getTarget(), 20u );
+
+    // the target is not a part of checksum, all messages have the valid checksum.
+    EXPECT_TRUE( msg.isChecksumValid() );
+    EXPECT_TRUE( first.isChecksumValid() );
+
+    NEMemory::sRemoteMessageHeader header{ };
+    first.copyHeader(header);
+    EXPECT_EQ( header.rbhTarget, 30u );
+    EXPECT_EQ( header.rbhSource, 10u );
+    EXPECT_EQ( header.rbhMessageId, 1234u );
+    EXPECT_EQ( header.rbhChecksum, msg.getChecksum() );
+}
+
+/**
+ * \brief   Checks that the cloned message copies the data and the header.
+ **/
+TEST( RemoteMessageTest, CloneMessage )
+{
+    const RemoteMessage msg{ _createMessage() };
+    const RemoteMessage copy{ msg.clone(0, 30) };
+
+    EXPECT_NE( copy.getBuffer(), msg.getBuffer() );
+    EXPECT_FALSE( copy.isSharedWithTarget() );
+    EXPECT_EQ( copy.getTarget(), 30u );
+    EXPECT_EQ( copy.getSource(), msg.getSource() );
+    EXPECT_EQ( copy.getSizeUsed(), msg.getSizeUsed() );
+    EXPECT_EQ( NEMemory::memCompare(copy.getBuffer(), msg.getBuffer(), msg.getSizeUsed()), NEMath::eCompare::Equal );
+}
@@ -0,0 +1,229 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/RemoteServiceIndexTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the index of remote services by connection cookie.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/base/TELinkedList.hpp"
+#include "areg/ipc/RemoteServiceIndex.hpp"
+
+namespace
+{
+    //!< The number of remote connections in the stress test.
+    constexpr uint32_t  CONNECTIONS             { 1000 };
+
+    //!< The number of stubs registered by each connection.
+    constexpr uint32_t  STUBS_PER_CONNECTION    { 5 };
+
+    //!< The number of proxies registered by each connection.
+    constexpr uint32_t  PROXIES_PER_CONNECTION  { 50 };
+
+    //!< The total number of registered stubs.
+    constexpr uint32_t  STUB_COUNT              { CONNECTIONS * STUBS_PER_CONNECTION };
+
+    //!< The registry of services, as the stub and the list of proxies, iterated to find services of the cookie.
+    using ServiceList = TEHashMap<StubAddress, TELinkedList<ProxyAddress>>;
+
+    //!< Returns the cookie of the connection.
+    inline ITEM_ID _cookie( uint32_t connection )
+    {
+        return NEService::COOKIE_REMOTE_SERVICE + connection;
+    }
+
+    //!< Returns the name of the service interface.
+    String _serviceName( uint32_t service )
+    {
+        return String("RemoteServiceInterface_") + String::makeString(service);
+    }
+
+    //!< Returns the address of the stub registered by the connection.
+    StubAddress _stubAddress( uint32_t service, ITEM_ID cookie )
+    {
+        StubAddress result(_serviceName(service), Version(1, 0, 0), NEService::eServiceType::ServicePublic, "provider_role", "provider_thread");
+        result.setCookie(cookie);
+        result.setSource(cookie);
+        return result;
+    }
+
+    //!< Returns the address of the proxy registered by the connection.
+    //!< The remote proxy is read from the stream, since the thread of the proxy does not exist in this process.
+    ProxyAddress _proxyAddress( uint32_t service, ITEM_ID cookie )
+    {
+        SharedBuffer stream;
+        stream << ServiceAddress(_serviceName(service), Version(1, 0, 0), NEService::eServiceType::ServicePublic, "provider_role");
+        stream << String("consumer_thread");
+        stream << cookie;
+        stream.moveToBegin();
+
+        ProxyAddress result(stream);
+        result.setSource(cookie);
+        return result;
+    }
+
+    //!< Returns the service, which is used by the proxy of the connection.
+    inline uint32_t _proxyService( uint32_t connection, uint32_t proxy )
+    {
+        return (connection * STUBS_PER_CONNECTION + 1 + proxy * 97) % STUB_COUNT;
+    }
+
+    //!< Finds the services of the cookie by iterating all services and all proxies.
+    void _scanServices( const ServiceList & services, ITEM_ID cookie, TEArrayList<StubAddress> & out_listStubs, TEArrayList<ProxyAddress> & out_listProxies )
+    {
+        for (ServiceList::MAPPOS pos = services.firstPosition(); services.isValidPosition(pos); pos = services.nextPosition(pos))
+        {
+            const StubAddress & stub = services.keyAtPosition(pos);
+            if (stub.getSource() == cookie)
+            {
+                out_listStubs.add(stub);
+            }
+
+            const TELinkedList<ProxyAddress> & proxies = services.valueAtPosition(pos);
+            for (TELinkedList<ProxyAddress>::LISTPOS posProxy = proxies.firstPosition(); proxies.isValidPosition(posProxy); posProxy = proxies.nextPosition(posProxy))
+            {
+                if (proxies.valueAtPosition(posProxy).getSource() == cookie)
+                {
+                    out_listProxies.add(proxies.valueAtPosition(posProxy));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief   Checks adding, removing and collecting the services of the cookie.
+ **/
+TEST( RemoteServiceIndexTest, AddRemoveServices )
+{
+    RemoteServiceIndex index;
+    const ITEM_ID first{ _cookie(1) };
+    const ITEM_ID second{ _cookie(2) };
+
+    EXPECT_TRUE( index.addStub(first, _stubAddress(1, first)) );
+    EXPECT_FALSE( index.addStub(first, _stubAddress(1, first)) );
+    EXPECT_TRUE( index.addProxy(first, _proxyAddress(2, first)) );
+    EXPECT_TRUE( index.addProxy(second, _proxyAddress(1, second)) );
+    EXPECT_TRUE( index.addProxy(second, _proxyAddress(2, second)) );
+
+    EXPECT_EQ( index.getCookieCount(), 2u );
+    EXPECT_EQ( index.getStubCount(), 1u );
+    EXPECT_EQ( index.getProxyCount(), 3u );
+
+    TEArrayList<StubAddress> stubs;
+    TEArrayList<ProxyAddress> proxies;
+    index.getServices(first, stubs, proxies);
+    ASSERT_EQ( stubs.getSize(), 1u );
+    ASSERT_EQ( proxies.getSize(), 1u );
+    EXPECT_EQ( stubs[0], _stubAddress(1, first) );
+    EXPECT_EQ( proxies[0], _proxyAddress(2, first) );
+
+    stubs.clear();
+    proxies.clear();
+    index.getServices(NEService::COOKIE_ANY, stubs, proxies);
+    EXPECT_EQ( stubs.getSize(), 1u );
+    EXPECT_EQ( proxies.getSize(), 3u );
+
+    EXPECT_FALSE( index.removeProxy(first, _proxyAddress(1, first)) );
+    EXPECT_TRUE( index.removeProxy(first, _proxyAddress(2, first)) );
+    EXPECT_TRUE( index.removeStub(first, _stubAddress(1, first)) );
+    EXPECT_EQ( index.getCookieCount(), 1u );
+
+    index.removeCookie(second);
+    EXPECT_TRUE( index.isEmpty() );
+    EXPECT_EQ( index.getStubCount(), 0u );
+    EXPECT_EQ( index.getProxyCount(), 0u );
+
+    stubs.clear();
+    proxies.clear();
+    index.getServices(second, stubs, proxies);
+    EXPECT_TRUE( stubs.isEmpty() );
+    EXPECT_TRUE( proxies.isEmpty() );
+}
+
+/**
+ * \brief   Registers the stubs and proxies of many connections and checks that the services
+ *          of every connection found using the index match the services found iterating all services.
+ **/
+TEST( RemoteServiceIndexTest, StressManyConnections )
+{
+    ServiceList services;
+    RemoteServiceIndex index;
+
+    for (uint32_t connection = 0; connection < CONNECTIONS; ++ connection)
+    {
+        const ITEM_ID cookie{ _cookie(connection) };
+        for (uint32_t stub = 0; stub < STUBS_PER_CONNECTION; ++ stub)
+        {
+            const StubAddress addrStub{ _stubAddress(connection * STUBS_PER_CONNECTION + stub, cookie) };
+            services.setAt(addrStub, TELinkedList<ProxyAddress>());
+            index.addStub(cookie, addrStub);
+        }
+    }
+
+    for (uint32_t connection = 0; connection < CONNECTIONS; ++ connection)
+    {
+        const ITEM_ID cookie{ _cookie(connection) };
+        for (uint32_t proxy = 0; proxy < PROXIES_PER_CONNECTION; ++ proxy)
+        {
+            const uint32_t service{ _proxyService(connection, proxy) };
+            const ProxyAddress addrProxy{ _proxyAddress(service, cookie) };
+            const StubAddress addrStub{ _stubAddress(service, _cookie(service / STUBS_PER_CONNECTION)) };
+            services.getAt(addrStub).pushLast(addrProxy);
+            index.addProxy(cookie, addrProxy);
+        }
+    }
+
+    ASSERT_EQ( index.getStubCount(), STUB_COUNT );
+    ASSERT_EQ( index.getProxyCount(), CONNECTIONS * PROXIES_PER_CONNECTION );
+
+    for (uint32_t connection = 0; connection < CONNECTIONS; ++ connection)
+    {
+        const ITEM_ID cookie{ _cookie(connection) };
+        TEArrayList<StubAddress> scanStubs;
+        TEArrayList<ProxyAddress> scanProxies;
+        _scanServices(services, cookie, scanStubs, scanProxies);
+
+        TEArrayList<StubAddress> listStubs;
+        TEArrayList<ProxyAddress> listProxies;
+        index.getServices(cookie, listStubs, listProxies);
+        ASSERT_EQ( listStubs.getSize(), STUBS_PER_CONNECTION );
+        ASSERT_EQ( listProxies.getSize(), PROXIES_PER_CONNECTION );
+        ASSERT_EQ( listStubs.getSize(), scanStubs.getSize() );
+        ASSERT_EQ( listProxies.getSize(), scanProxies.getSize() );
+
+        for (uint32_t i = 0; i < listStubs.getSize(); ++ i)
+        {
+            EXPECT_TRUE( scanStubs.contains(listStubs[i]) );
+        }
+
+        for (uint32_t i = 0; i < listProxies.getSize(); ++ i)
+        {
+            EXPECT_TRUE( scanProxies.contains(listProxies[i]) );
+        }
+
+        for (uint32_t i = 0; i < listProxies.getSize(); ++ i)
+        {
+            index.removeProxy(cookie, listProxies[i]);
+        }
+
+        for (uint32_t i = 0; i < listStubs.getSize(); ++ i)
+        {
+            index.removeStub(cookie, listStubs[i]);
+        }
+    }
+
+    EXPECT_TRUE( index.isEmpty() );
+}
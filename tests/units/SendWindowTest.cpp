@@ -0,0 +1,309 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SendWindowTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the credit based window of queued messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/ipc/IERemoteMessageHandler.hpp"
+#include "areg/ipc/IEServiceConnectionConsumer.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/SendWindow.hpp"
+#include "areg/ipc/ServerConnectionBase.hpp"
+#include "areg/ipc/ServiceClientConnectionBase.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The host of the test server.
+    constexpr char              SERVER_HOST[]   { "127.0.0.1" };
+
+    //!< The first port number to try to bind the test server.
+    constexpr unsigned short    SERVER_PORT     { 28381 };
+
+    //!< The size of the data of messages sent via connection.
+    constexpr uint32_t          MESSAGE_SIZE    { 1024 };
+
+    //!< The number of messages, which the slow link reads before it pauses for a millisecond.
+    constexpr uint32_t          LINK_BATCH      { 32 };
+
+    //!< Receives remote messages.
+    class MessageConnection : public SocketConnectionBase
+    {
+    public:
+        using SocketConnectionBase::receiveMessage;
+    };
+
+    /**
+     * \brief   The client connection, which sends messages to the test server
+     *          via the send thread of the service connection. As a stub does,
+     *          the producer waits for the send window before it sends a message.
+     **/
+    class WindowConnection  : public    IEServiceConnectionConsumer
+                            , public    IERemoteMessageHandler
+                            , public    ServiceClientConnectionBase
+    {
+    public:
+        explicit WindowConnection( DispatcherThread & dispatcher )
+            : IEServiceConnectionConsumer   ( )
+            , IERemoteMessageHandler        ( )
+            , ServiceClientConnectionBase   ( NEService::COOKIE_ROUTER
+                                            , NERemoteService::eRemoteServices::ServiceRouter
+                                            , static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectTcpip)
+                                            , NEService::eMessageSource::MessageSourceClient
+                                            , static_cast<IEServiceConnectionConsumer &>(self())
+                                            , static_cast<IERemoteMessageHandler &>(self())
+                                            , dispatcher
+                                            , "SendWindowTest_" )
+        {
+        }
+
+        //!< Connects to the server and starts the threads to send and receive messages.
+        bool start( const NESocket::SocketAddress & address )
+        {
+            applyServiceConnectionData(address.getHostAddress(), address.getHostPort());
+            onServiceStart();
+            return (getConnectionState() == ServiceClientConnectionBase::eConnectionState::ConnectionStarting);
+        }
+
+        //!< Sends the queued messages and closes the connection.
+        void stop( void )
+        {
+            onServiceStop();
+        }
+
+        //!< Waits for the send window and queues the message to send.
+        bool send( const RemoteMessage & msg )
+        {
+            waitForSendWindow(NECommon::WAIT_INFINITE);
+            return sendMessage(msg);
+        }
+
+        virtual void connectedRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void disconnectedRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void lostRemoteServiceChannel( const Channel & /*channel*/ ) override {}
+        virtual void failedSendMessage( const RemoteMessage & /*msgFailed*/, Socket & /*whichTarget*/ ) override {}
+        virtual void failedReceiveMessage( Socket & /*whichSource*/ ) override {}
+        virtual void failedProcessMessage( const RemoteMessage & /*msgUnprocessed*/ ) override {}
+        virtual void processReceivedMessage( const RemoteMessage & /*msgReceived*/, Socket & /*whichSource*/ ) override {}
+
+    private:
+        WindowConnection & self( void )
+        {
+            return (*this);
+        }
+    };
+
+    //!< Creates the socket of the server and sets it to listen the connections.
+    bool _startServer( ServerConnectionBase & server )
+    {
+        for (unsigned short port = SERVER_PORT; port < SERVER_PORT + 100; ++ port)
+        {
+            if (server.createSocket(SERVER_HOST, port) && server.serverListen())
+            {
+                return true;
+            }
+
+            server.closeSocket();
+        }
+
+        return false;
+    }
+
+    //!< Creates the message with the data of the fixed size.
+    RemoteMessage _createMessage( uint32_t seqNr )
+    {
+        RemoteMessage msg{ NERemoteService::createConnectNotify(NEService::COOKIE_ROUTER, NEService::COOKIE_UNKNOWN) };
+        msg.moveToEnd();
+        for (uint32_t i = 0; i < MESSAGE_SIZE / sizeof(uint32_t); ++ i)
+        {
+            msg << seqNr;
+        }
+
+        return msg;
+    }
+
+    /**
+     * \brief   Accepts the connection and reads the messages like a slow link, which
+     *          pauses for a millisecond after each batch of messages. Reads until the
+     *          connection is closed.
+     **/
+    void _runSlowLink( ServerConnectionBase & server, std::atomic<uint64_t> & received )
+    {
+        NESocket::SocketAddress addrAccepted;
+        SOCKETHANDLE hSocket{ server.waitForConnectionEvent(addrAccepted) };
+        if ((hSocket == NESocket::InvalidSocketHandle) || (hSocket == NESocket::FailedSocketHandle))
+        {
+            return;
+        }
+
+        SocketAccepted client(hSocket, addrAccepted);
+        server.acceptConnection(client);
+
+        MessageConnection connection;
+        RemoteMessage msg;
+        uint32_t batch{ 0 };
+        while (connection.receiveMessage(msg, client) > 0)
+        {
+            ++ received;
+            if (++ batch == LINK_BATCH)
+            {
+                batch = 0;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        server.closeConnection(client);
+    }
+}
+
+/**
+ * \brief   Checks that the messages are rejected when the message window is exhausted,
+ *          unless they are forced, and the credits are returned when messages are sent
+ *          or dropped, while only the sent messages are counted.
+ **/
+TEST( SendWindowTest, MessageWindow )
+{
+    SendWindow window(3, SendWindow::UNLIMITED);
+    EXPECT_TRUE( window.acquire(10, false) );
+    EXPECT_TRUE( window.acquire(10, false) );
+    EXPECT_TRUE( window.acquire(10, false) );
+    EXPECT_FALSE( window.canAcquire(10) );
+    EXPECT_FALSE( window.acquire(10, false) );
+    EXPECT_TRUE( window.acquire(10, true) );
+
+    SendWindow::sWindowStatistics stats{ window.getStatistics() };
+    EXPECT_EQ( stats.wsQueuedMessages, 4u );
+    EXPECT_EQ( stats.wsQueuedBytes, 40u );
+    EXPECT_EQ( stats.wsRejectedMessages, 1u );
+
+    window.release(10, true);
+    EXPECT_FALSE( window.canAcquire(10) );
+    window.release(10, false);
+    EXPECT_TRUE( window.canAcquire(10) );
+
+    stats = window.getStatistics();
+    EXPECT_EQ( stats.wsQueuedMessages, 2u );
+    EXPECT_EQ( stats.wsPeakMessages, 4u );
+    EXPECT_EQ( stats.wsSentMessages, 1u );
+
+    window.reset();
+    window.resetStatistics();
+    stats = window.getStatistics();
+    EXPECT_EQ( stats.wsQueuedMessages, 0u );
+    EXPECT_EQ( stats.wsPeakMessages, 0u );
+    EXPECT_EQ( stats.wsRejectedMessages, 0u );
+}
+
+/**
+ * \brief   Checks the byte window, and that the message bigger than
+ *          the window is accepted only if the queue is empty.
+ **/
+TEST( SendWindowTest, ByteWindow )
+{
+    SendWindow window(SendWindow::UNLIMITED, 100);
+    EXPECT_TRUE( window.acquire(60, false) );
+    EXPECT_FALSE( window.acquire(60, false) );
+    EXPECT_TRUE( window.acquire(40, false) );
+    window.release(60, true);
+    window.release(40, true);
+
+    EXPECT_TRUE( window.acquire(500, false) );
+    EXPECT_FALSE( window.acquire(1, false) );
+    window.release(500, true);
+
+    window.setWindow(SendWindow::UNLIMITED, SendWindow::UNLIMITED);
+    for (uint32_t i = 0; i < 1000; ++ i)
+    {
+        ASSERT_TRUE( window.acquire(1000, false) );
+    }
+
+    EXPECT_EQ( window.getStatistics().wsQueuedBytes, 1000u * 1000u );
+}
+
+/**
+ * \brief   Sends messages via the real connection to the slow link as fast as the window allows.
+ *          The producer waits for the credits, so that the queue depth is limited by the window,
+ *          while the queue never runs dry and the throughput of the link stays stable.
+ **/
+TEST( SendWindowTest, SlowLinkBackpressure )
+{
+    constexpr uint32_t maxMessages{ 64 };
+    constexpr uint32_t intervals{ 6 };
+    constexpr std::chrono::milliseconds interval{ 50 };
+
+    ServerConnectionBase server;
+    ASSERT_TRUE( _startServer(server) );
+
+    DispatcherThread dispatcher("SendWindowTest_Dispatcher");
+    WindowConnection connection(dispatcher);
+    connection.setSendWindow(maxMessages, SendWindow::UNLIMITED);
+    ASSERT_TRUE( connection.start(server.getAddress()) );
+
+    std::atomic<uint64_t> received{ 0 };
+    std::thread link(_runSlowLink, std::ref(server), std::ref(received));
+
+    std::atomic_bool run{ true };
+    std::atomic<uint64_t> queued{ 0 };
+    std::thread producer([&]() {
+        uint32_t seqNr{ 0 };
+        while (run && connection.send(_createMessage(++ seqNr)))
+        {
+            ++ queued;
+        }
+    });
+
+    // The first interval fills the buffers of the sockets.
+    std::this_thread::sleep_for(interval);
+
+    std::vector<uint64_t> throughput;
+    uint64_t last{ received.load() };
+    for (uint32_t i = 0; i < intervals; ++ i)
+    {
+        std::this_thread::sleep_for(interval);
+        const uint64_t current{ received.load() };
+        throughput.push_back(current - last);
+        last = current;
+    }
+
+    const SendWindow::sWindowStatistics stats{ connection.querySendQueue() };
+    run = false;
+    producer.join();
+    connection.stop();
+    link.join();
+    server.closeSocket();
+
+    // The window was exhausted and the producer waited, but the queue did not grow beyond the window.
+    EXPECT_EQ( stats.wsPeakMessages, maxMessages );
+    EXPECT_LE( stats.wsPeakBytes, maxMessages * _createMessage(0).getSizeUsed() );
+    EXPECT_EQ( stats.wsRejectedMessages, 0u );
+
+    // The link is busy in every interval, the waiting producer does not let the queue run dry.
+    const uint64_t maxThroughput{ *std::max_element(throughput.begin(), throughput.end()) };
+    const uint64_t minThroughput{ *std::min_element(throughput.begin(), throughput.end()) };
+    EXPECT_GT( minThroughput, 0u );
+    EXPECT_GE( minThroughput * 2u, maxThroughput );
+
+    // Every queued message and the connect message are received.
+    EXPECT_EQ( received.load(), queued.load() + 1u );
+}
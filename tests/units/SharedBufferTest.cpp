@@ -0,0 +1,202 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SharedBufferTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the growth of shared buffer.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/base/String.hpp"
+
+namespace
+{
+    //!< The number of parameters of the representative request.
+    constexpr uint32_t  REQUEST_PARAMS  { 50 };
+
+    //!< Restores the growth limit of byte buffers when the test completes.
+    struct GrowthLimitGuard
+    {
+        GrowthLimitGuard( unsigned int growthLimit )
+            : mSaved( IEByteBuffer::getGrowthLimit() )
+        {
+            IEByteBuffer::setGrowthLimit(growthLimit);
+        }
+
+        ~GrowthLimitGuard( void )
+        {
+            IEByteBuffer::setGrowthLimit(mSaved);
+        }
+
+        const unsigned int  mSaved;
+    };
+
+    //!< Counts the reallocations of the buffer, which copied the existing data.
+    struct ReallocCounter
+    {
+        ReallocCounter( const SharedBuffer & buffer )
+            : mBuffer   ( buffer )
+            , mData     ( buffer.getBuffer() )
+            , mCount    ( 0 )
+        {
+        }
+
+        //!< Checks whether the buffer was reallocated since the last call.
+        inline void check( void )
+        {
+            const unsigned char * data{ mBuffer.getBuffer() };
+            if ((data != mData) && (mData != nullptr))
+            {
+                ++ mCount;
+            }
+
+            mData = data;
+        }
+
+        const SharedBuffer &    mBuffer;
+        const unsigned char *   mData;
+        uint32_t                mCount;
+    };
+
+    //!< Streams the parameters of the representative request, the mix of small fields and strings.
+    //!< Returns the number of reallocations of the buffer.
+    uint32_t _writeRequest( SharedBuffer & buffer, const String & name )
+    {
+        ReallocCounter counter(buffer);
+        for (uint32_t i = 0; i < REQUEST_PARAMS / 5; ++ i)
+        {
+            buffer << i;
+            counter.check();
+            buffer << static_cast<int64_t>(i) * 3;
+            counter.check();
+            buffer << ((i % 2) == 0);
+            counter.check();
+            buffer << static_cast<double>(i) / 7.0;
+            counter.check();
+            buffer << name;
+            counter.check();
+        }
+
+        return counter.mCount;
+    }
+}
+
+/**
+ * \brief   Checks that the appended data grows the buffer geometrically
+ *          and the data remains the same as with the exact growth.
+ **/
+TEST( SharedBufferTest, GeometricGrowth )
+{
+    constexpr uint32_t count{ 256 };
+    uint32_t exact{ 0 };
+    SharedBuffer bufExact;
+    {
+        GrowthLimitGuard guard(0);
+        ReallocCounter counter(bufExact);
+        for (uint32_t i = 0; i < count; ++ i)
+        {
+            bufExact << i;
+            counter.check();
+        }
+
+        exact = counter.mCount;
+    }
+
+    GrowthLimitGuard guard(IEByteBuffer::DEFAULT_GROWTH_LIMIT);
+    SharedBuffer buffer;
+    ReallocCounter counter(buffer);
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        buffer << i;
+        counter.check();
+    }
+
+    EXPECT_LT( counter.mCount, exact );
+    EXPECT_LE( counter.mCount, 10u );
+    ASSERT_EQ( buffer.getSizeUsed(), count * sizeof(uint32_t) );
+    EXPECT_EQ( NEMemory::memCompare(buffer.getBuffer(), bufExact.getBuffer(), buffer.getSizeUsed()), NEMath::eCompare::Equal );
+
+    buffer.moveToBegin();
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        uint32_t value{ 0 };
+        buffer >> value;
+        EXPECT_EQ( value, i );
+    }
+}
+
+/**
+ * \brief   Checks that the growth is limited by the configured size.
+ **/
+TEST( SharedBufferTest, GrowthLimit )
+{
+    constexpr unsigned int limit{ 1024 };
+    GrowthLimitGuard guard(limit);
+
+    SharedBuffer buffer;
+    unsigned char data[ 512 ]{ };
+    for (uint32_t i = 0; i < 32; ++ i)
+    {
+        buffer.write(data, sizeof(data));
+    }
+
+    EXPECT_EQ( buffer.getSizeUsed(), 32u * sizeof(data) );
+    EXPECT_LE( buffer.getSizeAvailable(), buffer.getSizeUsed() + limit + NEMemory::BLOCK_SIZE );
+}
+
+/**
+ * \brief   Checks that the explicit reservation of the space does not grow geometrically.
+ **/
+TEST( SharedBufferTest, ExactReserve )
+{
+    GrowthLimitGuard guard(IEByteBuffer::DEFAULT_GROWTH_LIMIT);
+
+    SharedBuffer buffer;
+    unsigned char data[ 1024 ]{ };
+    buffer.reserve(sizeof(data), true);
+    buffer.write(data, sizeof(data));
+    buffer.reserve(sizeof(data) + 100, true);
+
+    EXPECT_EQ( buffer.getSizeUsed(), sizeof(data) );
+    EXPECT_LE( buffer.getSizeAvailable(), sizeof(data) + 100 + NEMemory::BLOCK_SIZE );
+}
+
+/**
+ * \brief   Checks that the representative request is serialized with fewer reallocations
+ *          if the buffer grows geometrically and that the serialized data is the same.
+ **/
+TEST( SharedBufferTest, SerializeRequest )
+{
+    const String name("representative_request_parameter");
+
+    SharedBuffer bufExact;
+    uint32_t reallocExact{ 0 };
+    {
+        GrowthLimitGuard guard(0);
+        reallocExact = _writeRequest(bufExact, name);
+    }
+
+    SharedBuffer bufGrowth;
+    uint32_t reallocGrowth{ 0 };
+    {
+        GrowthLimitGuard guard(IEByteBuffer::DEFAULT_GROWTH_LIMIT);
+        reallocGrowth = _writeRequest(bufGrowth, name);
+    }
+
+    EXPECT_LT( reallocGrowth, reallocExact );
+    ASSERT_EQ( bufGrowth.getSizeUsed(), bufExact.getSizeUsed() );
+    EXPECT_EQ( NEMemory::memCompare(bufGrowth.getBuffer(), bufExact.getBuffer(), bufExact.getSizeUsed()), NEMath::eCompare::Equal );
+}
@@ -0,0 +1,324 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ThreadPlacementTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the placement of the threads on CPU cores.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/TEEvent.hpp"
+#include "areg/persist/ConfigManager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <unistd.h>
+#endif  // defined(__linux__)
+
+namespace
+{
+    //! Returns the bit mask of the first CPU core, which the process is allowed to run.
+    inline uint64_t _firstCpuMask( void )
+    {
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO( &cpuSet );
+        if ( ::sched_getaffinity( 0, sizeof( cpu_set_t ), &cpuSet ) == 0 )
+        {
+            for ( int cpu = 0; cpu < 64; ++ cpu )
+            {
+                if ( CPU_ISSET( cpu, &cpuSet ) )
+                    return (static_cast<uint64_t>(1u) << cpu);
+            }
+        }
+#endif  // defined(__linux__)
+
+        return 1u;
+    }
+
+    //! The thread consumer, which saves the CPU mask of the thread.
+    class AffinityConsumer : public IEThreadConsumer
+    {
+    public:
+        AffinityConsumer( void )
+            : IEThreadConsumer  ( )
+            , mCpuMask          ( 0u )
+        {
+        }
+
+        virtual void onThreadRuns( void ) override
+        {
+#if defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO( &cpuSet );
+            if ( ::pthread_getaffinity_np( ::pthread_self( ), sizeof( cpu_set_t ), &cpuSet ) == 0 )
+            {
+                for ( int cpu = 0; cpu < 64; ++ cpu )
+                {
+                    mCpuMask |= CPU_ISSET( cpu, &cpuSet ) ? (static_cast<uint64_t>(1u) << cpu) : 0u;
+                }
+            }
+#endif  // defined(__linux__)
+        }
+
+        uint64_t    mCpuMask;
+    };
+
+    //! The thread consumer, which applies the NUMA node placements from the running thread.
+    class NumaConsumer : public IEThreadConsumer
+    {
+    public:
+        NumaConsumer( void )
+            : IEThreadConsumer  ( )
+            , mTooBigNode       ( true )
+            , mNegativeNode     ( true )
+            , mFirstNode        ( false )
+            , mHasCpus          ( false )
+        {
+        }
+
+        virtual void onThreadRuns( void ) override
+        {
+            Thread * thread{ Thread::getCurrentThread( ) };
+            Thread::sPlacement placement;
+            placement.numaNode = 1 << 20;
+            mTooBigNode = thread->setPlacement( placement );
+            placement.numaNode = -2;
+            mNegativeNode = thread->setPlacement( placement );
+            placement.numaNode = 0;
+            mFirstNode = thread->setPlacement( placement );
+
+#if defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO( &cpuSet );
+            mHasCpus = (::pthread_getaffinity_np( ::pthread_self( ), sizeof( cpu_set_t ), &cpuSet ) == 0) && (CPU_COUNT( &cpuSet ) != 0);
+#endif  // defined(__linux__)
+        }
+
+        bool    mTooBigNode;    //!< The result of placing the thread on the node out of range.
+        bool    mNegativeNode;  //!< The result of placing the thread on the negative node.
+        bool    mFirstNode;     //!< The result of placing the thread on the node 0.
+        bool    mHasCpus;       //!< Flag, indicating whether the thread can run on a core after placement.
+    };
+
+    //! The index of the sent event.
+    struct PlacementProbe
+    {
+        uint32_t    index;
+    };
+
+    DECLARE_EVENT( PlacementProbe, PlacementProbeEvent, IEPlacementProbeConsumer );
+
+    //! The number of sent events.
+    constexpr uint32_t  PROBE_EVENTS    { 200u };
+
+    std::atomic_uint32_t    _probeStarted{ 0u };
+    std::atomic_uint32_t    _probeReceived{ 0u };
+    std::atomic_uint64_t    _probeCpuMask{ 0u };
+
+    //! The component, which saves the CPU cores, where the events are dispatched.
+    class PlacementNode : public Component
+                        , public IEPlacementProbeConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW PlacementNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        PlacementNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component                 ( entry, owner )
+            , IEPlacementProbeConsumer  ( )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            PlacementProbeEvent::addListener( static_cast<IEPlacementProbeConsumer &>(*this), comThread );
+            _probeStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            PlacementProbeEvent::removeListener( static_cast<IEPlacementProbeConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const PlacementProbe & /*data*/ ) override
+        {
+#if defined(__linux__)
+            const int cpu{ ::sched_getcpu( ) };
+            if ( (cpu >= 0) && (cpu < 64) )
+            {
+                _probeCpuMask.fetch_or( static_cast<uint64_t>(1u) << cpu );
+            }
+#endif  // defined(__linux__)
+
+            _probeReceived.fetch_add( 1u );
+        }
+    };
+}
+
+/**
+ * \brief   Checks that the placement configured by the thread name is set, returned and removed.
+ **/
+TEST( ThreadPlacementTest, ConfigurePlacement )
+{
+    const String threadName( "ThreadPlacementTestConfigured" );
+    EXPECT_TRUE( Thread::getConfiguredPlacement( threadName ).isEmpty() );
+
+    Thread::sPlacement placement;
+    placement.cpuMask   = 0x05u;
+    placement.policy    = Thread::eSchedulingPolicy::PolicyBatch;
+    Thread::configurePlacement( threadName, placement );
+
+    const Thread::sPlacement configured{ Thread::getConfiguredPlacement( threadName ) };
+    EXPECT_EQ( configured.cpuMask, 0x05u );
+    EXPECT_EQ( configured.policy, Thread::eSchedulingPolicy::PolicyBatch );
+    EXPECT_EQ( configured.numaNode, Thread::NUMA_NODE_ANY );
+
+    Thread::configurePlacement( threadName, Thread::sPlacement() );
+    EXPECT_TRUE( Thread::getConfiguredPlacement( threadName ).isEmpty() );
+}
+
+/**
+ * \brief   Checks that the placement of the thread is saved in and read from the configuration.
+ **/
+TEST( ThreadPlacementTest, ConfigProperties )
+{
+    ConfigManager config;
+    const String threadName( "ThreadPlacementTestConfig" );
+    EXPECT_TRUE( config.getThreadPlacement( threadName ).isEmpty() );
+
+    Thread::sPlacement placement;
+    placement.cpuMask   = 0x0Du;
+    placement.policy    = Thread::eSchedulingPolicy::PolicyIdle;
+    placement.numaNode  = 0;
+    config.setThreadPlacement( threadName, placement, true );
+
+    const Thread::sPlacement configured{ config.getThreadPlacement( threadName ) };
+    EXPECT_EQ( configured.cpuMask, 0x0Du );
+    EXPECT_EQ( configured.policy, Thread::eSchedulingPolicy::PolicyIdle );
+    EXPECT_EQ( configured.numaNode, 0 );
+
+    // the list of CPU cores with the range.
+    const NEPersistence::sPropertyKey & key = NEPersistence::getThreadAffinity( );
+    config.setModuleProperty( key.section, key.property, "ThreadPlacementTestRange", "1-3 | 5", NEPersistence::eConfigKeys::EntryThreadAffinity, true );
+    EXPECT_EQ( config.getThreadPlacement( "ThreadPlacementTestRange" ).cpuMask, 0x2Eu );
+
+    const std::vector<String> threads{ config.getPlacedThreads( ) };
+    EXPECT_EQ( threads.size(), 2u );
+    EXPECT_NE( std::find( threads.begin(), threads.end(), threadName ), threads.end() );
+}
+
+/**
+ * \brief   Checks that the thread runs on the CPU core set in the placement.
+ **/
+TEST( ThreadPlacementTest, ApplyAffinity )
+{
+    AffinityConsumer consumer;
+    Thread thread( consumer, "ThreadPlacementTestAffinity" );
+    Thread::sPlacement placement;
+    placement.cpuMask = _firstCpuMask( );
+    EXPECT_TRUE( thread.setPlacement( placement ) );
+    EXPECT_EQ( thread.getPlacement().cpuMask, placement.cpuMask );
+
+    ASSERT_TRUE( thread.createThread( NECommon::WAIT_INFINITE ) );
+    thread.shutdownThread( NECommon::WAIT_INFINITE );
+
+#if defined(__linux__)
+    EXPECT_EQ( consumer.mCpuMask, placement.cpuMask );
+#endif  // defined(__linux__)
+}
+
+/**
+ * \brief   Checks that the NUMA node out of range is rejected
+ *          and the node 0 binds the thread to the cores of the node.
+ **/
+TEST( ThreadPlacementTest, ApplyNumaNode )
+{
+    NumaConsumer consumer;
+    Thread thread( consumer, "ThreadPlacementTestNuma" );
+    ASSERT_TRUE( thread.createThread( NECommon::WAIT_INFINITE ) );
+    // the thread is unregistered when shutting down, let it complete first.
+    ASSERT_TRUE( thread.completionWait( NECommon::WAIT_INFINITE ) );
+    thread.shutdownThread( NECommon::WAIT_INFINITE );
+
+#if defined(__linux__)
+    EXPECT_FALSE( consumer.mTooBigNode );
+    EXPECT_FALSE( consumer.mNegativeNode );
+    EXPECT_TRUE( consumer.mHasCpus );
+    if ( ::access( "/sys/devices/system/node/node0", F_OK ) == 0 )
+    {
+        EXPECT_TRUE( consumer.mFirstNode );
+    }
+#endif  // defined(__linux__)
+}
+
+/**
+ * \brief   Checks that the placement of the component thread in the model is applied:
+ *          the events of the component pinned to a CPU core are dispatched on that core.
+ **/
+TEST( ThreadPlacementTest, DispatchOnPinnedCore )
+{
+    const String modelName( "ThreadPlacementModel" );
+    const String threadName( "ThreadPlacementPinned" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    thread.mPlacement.cpuMask = _firstCpuMask( );
+    thread.addComponent( "ThreadPlacementNode", &PlacementNode::CreateComponent, &PlacementNode::DeleteComponent );
+
+    _probeStarted.store( 0u );
+    _probeReceived.store( 0u );
+    _probeCpuMask.store( 0u );
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    while ( _probeStarted.load( ) != 1u )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+
+    DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+    for ( uint32_t i = 0; i < PROBE_EVENTS; ++ i )
+    {
+        PlacementProbeEvent::sendEvent( PlacementProbe{ i }, dispatcher );
+        while ( _probeReceived.load( ) != i + 1 )
+        {
+            std::this_thread::yield( );
+        }
+    }
+
+    ComponentLoader::removeComponentModel( modelName );
+
+    EXPECT_EQ( _probeReceived.load( ), PROBE_EVENTS );
+#if defined(__linux__)
+    EXPECT_EQ( _probeCpuMask.load( ), thread.mPlacement.cpuMask );
+#endif  // defined(__linux__)
+}
@@ -0,0 +1,163 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/WaitPolicyTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the wait policies of the dispatcher threads.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/DispatcherStatistics.hpp"
+#include "areg/component/TEEvent.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //! The data of the event sent to the idle thread.
+    struct WaitData
+    {
+        uint32_t    value{ 0u };
+    };
+
+    DECLARE_EVENT( WaitData, WaitDataEvent, IEWaitDataConsumer );
+
+    //! The number of events sent to the idle thread.
+    constexpr uint32_t  WAIT_EVENTS     { 1000u };
+    //! The factor of the blocking waiting time, which the spinning policies do not exceed on a single CPU.
+    constexpr uint64_t  SINGLE_CPU_FACTOR{ 4u };
+
+    std::atomic_uint32_t    _waitStarted{ 0u };
+    std::atomic_uint32_t    _waitReceived{ 0u };
+
+    //! The component, which receives the events.
+    class WaitNode  : public Component
+                    , public IEWaitDataConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW WaitNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        WaitNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component         ( entry, owner )
+            , IEWaitDataConsumer( )
+        {
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            WaitDataEvent::addListener( static_cast<IEWaitDataConsumer &>(*this), comThread );
+            _waitStarted.fetch_add( 1u );
+        }
+
+        virtual void shutdownComponent( ComponentThread & comThread ) override
+        {
+            WaitDataEvent::removeListener( static_cast<IEWaitDataConsumer &>(*this), comThread );
+            Component::shutdownComponent( comThread );
+        }
+
+        virtual void processEvent( const WaitData & /* data */ ) override
+        {
+            _waitReceived.fetch_add( 1u );
+        }
+    };
+
+    //! Sends the events one by one to the idle thread with the wait policy and returns the statistics.
+    DispatcherStatistics::sDispatcherStatistics _measureWaitPolicy( NECommon::eWaitPolicy policy, uint32_t spinTime )
+    {
+        const String modelName( String("WaitPolicyModel_") + NECommon::getString( policy ) );
+        const String threadName( String("WaitPolicyThread_") + String::makeString( static_cast<uint32_t>(policy) ) );
+        NERegistry::Model model( modelName );
+        NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+        thread.mWaitPolicy  = policy;
+        thread.mSpinTime    = spinTime;
+        thread.addComponent( String("WaitPolicyNode_") + String::makeString( static_cast<uint32_t>(policy) ), &WaitNode::CreateComponent, &WaitNode::DeleteComponent );
+
+        _waitStarted.store( 0u );
+        _waitReceived.store( 0u );
+        EXPECT_TRUE( ComponentLoader::addModelUnique( model ) );
+        EXPECT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+        while ( _waitStarted.load( ) != 1u )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+
+        DispatcherThread & dispatcher = DispatcherThread::getDispatcherThread( threadName );
+        EXPECT_EQ( dispatcher.getWaitPolicy( ), policy );
+        for ( uint32_t i = 0; i < WAIT_EVENTS; ++ i )
+        {
+            // let the dispatcher become idle before the next event.
+            std::this_thread::sleep_for( std::chrono::microseconds( 50 ) );
+            WaitDataEvent::sendEvent( WaitData{ i }, dispatcher );
+        }
+
+        while ( _waitReceived.load( ) != WAIT_EVENTS )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+
+        DispatcherStatistics::sDispatcherStatistics result;
+        DispatcherStatistics::ListStatistics list;
+        Application::queryDispatcherStatistics( list );
+        for ( const auto & entry : list.getData( ) )
+        {
+            if ( entry.dsDispatcherName == threadName )
+            {
+                result = entry;
+            }
+        }
+
+        ComponentLoader::removeComponentModel( modelName );
+        return result;
+    }
+}
+
+/**
+ * \brief   Checks that the dispatcher receives all events and exits with every wait policy,
+ *          and that the spinning policies do not wait for the events sent to the idle
+ *          dispatcher longer than the blocking policy. On a single CPU the spinning thread
+ *          competes with the sender, the waiting time is only checked to be of the same order.
+ **/
+TEST( WaitPolicyTest, IdleDispatcherLatency )
+{
+    const DispatcherStatistics::sDispatcherStatistics blocking{ _measureWaitPolicy( NECommon::eWaitPolicy::WaitBlocking, 200u ) };
+    EXPECT_EQ( blocking.dsWaitPolicy, NECommon::eWaitPolicy::WaitBlocking );
+    EXPECT_GE( blocking.dsDispatched, static_cast<uint64_t>(WAIT_EVENTS) );
+    EXPECT_EQ( blocking.dsDropped, 0u );
+
+    const uint64_t maxWait{ std::thread::hardware_concurrency( ) > 1u ? blocking.dsWaitP99 : blocking.dsWaitP99 * SINGLE_CPU_FACTOR };
+    const NECommon::eWaitPolicy policies[]{ NECommon::eWaitPolicy::WaitAdaptive, NECommon::eWaitPolicy::WaitBusyPoll };
+    for ( NECommon::eWaitPolicy policy : policies )
+    {
+        const DispatcherStatistics::sDispatcherStatistics stats{ _measureWaitPolicy( policy, 200u ) };
+        EXPECT_EQ( stats.dsWaitPolicy, policy );
+        EXPECT_GE( stats.dsDispatched, static_cast<uint64_t>(WAIT_EVENTS) );
+        EXPECT_EQ( stats.dsDropped, 0u );
+        EXPECT_LE( stats.dsWaitP99, maxWait ) << NECommon::getString( policy ) << " p99 " << stats.dsWaitP99
+                                              << " ns, blocking p99 " << blocking.dsWaitP99 << " ns.";
+    }
+}
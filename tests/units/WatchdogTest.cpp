@@ -0,0 +1,100 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/WatchdogTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the stamps of the thread watchdog.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/private/Watchdog.hpp"
+
+/**
+ * \brief   Checks that the stamp of the event processed longer than the timeout
+ *          is reported once, and the stamps of idle thread are not reported.
+ **/
+TEST( WatchdogTest, CheckExpired )
+{
+    ComponentThread thread("WatchdogTestThread");
+    Watchdog watchdog(thread, 100u);
+    ASSERT_TRUE( watchdog.isValid() );
+
+    // the thread is idle.
+    EXPECT_FALSE( watchdog.checkExpired(1000u) );
+    EXPECT_FALSE( watchdog.checkExpired(5000u) );
+
+    // the scanner sees the event first at 1000 ms.
+    watchdog.startGuard();
+    EXPECT_FALSE( watchdog.checkExpired(1000u) );
+    EXPECT_FALSE( watchdog.checkExpired(1099u) );
+    EXPECT_TRUE(  watchdog.checkExpired(1100u) );
+    EXPECT_FALSE( watchdog.checkExpired(1200u) );
+    watchdog.stopGuard();
+    EXPECT_FALSE( watchdog.checkExpired(1300u) );
+
+    // the next events are short, the stamp changes between the checks.
+    for (uint64_t now = 2000u; now < 3000u; now += 50u)
+    {
+        watchdog.startGuard();
+        EXPECT_FALSE( watchdog.checkExpired(now) );
+        watchdog.stopGuard();
+    }
+
+    EXPECT_FALSE( watchdog.checkExpired(3000u) );
+}
+
+/**
+ * \brief   Checks that the watchdog with ignored timeout does not change the stamp.
+ **/
+TEST( WatchdogTest, IgnoreTimeout )
+{
+    ComponentThread thread("WatchdogTestIgnore");
+    Watchdog watchdog(thread, NECommon::WATCHDOG_IGNORE);
+    EXPECT_FALSE( watchdog.isValid() );
+
+    watchdog.startGuard();
+    EXPECT_EQ( watchdog.getStamp(), 0u );
+    EXPECT_FALSE( watchdog.checkExpired(100000u) );
+    watchdog.stopGuard();
+    EXPECT_EQ( watchdog.getStamp(), 0u );
+}
+
+/**
+ * \brief   Checks that every guarded event changes the sequence and the stamp,
+ *          and that the stamp marks the running event.
+ **/
+TEST( WatchdogTest, GuardSequence )
+{
+    constexpr uint32_t events{ 1000 };
+
+    ComponentThread thread("WatchdogTestSequence");
+    Watchdog watchdogOn(thread, 100u);
+    Watchdog watchdogOff(thread, NECommon::WATCHDOG_IGNORE);
+
+    for (uint32_t i = 1; i <= events; ++ i)
+    {
+        watchdogOn.startGuard();
+        ASSERT_EQ( watchdogOn.getSequence(), static_cast<Watchdog::SEQUENCE_ID>(i) );
+        ASSERT_EQ( watchdogOn.getStamp(), (static_cast<Watchdog::STAMP>(i) << 1) | 1u );
+        watchdogOn.stopGuard();
+        ASSERT_EQ( watchdogOn.getStamp(), static_cast<Watchdog::STAMP>(i) << 1 );
+
+        watchdogOff.startGuard();
+        watchdogOff.stopGuard();
+    }
+
+    EXPECT_EQ( watchdogOn.getSequence(), static_cast<Watchdog::SEQUENCE_ID>(events) );
+    EXPECT_EQ( watchdogOff.getSequence(), 0u );
+    EXPECT_EQ( watchdogOff.getStamp(), 0u );
+}
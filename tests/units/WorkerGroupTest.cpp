@@ -0,0 +1,230 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/WorkerGroupTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the Worker Group running the parallel tasks of the component.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ComponentThread.hpp"
+#include "areg/component/IEWorkerGroupConsumer.hpp"
+#include "areg/component/WorkerGroup.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t  GROUP_THREADS   { 4u };         //!< The number of threads of the group.
+    constexpr uint32_t  RANGE_SIZE      { 100000u };    //!< The number of indexes processed in parallel.
+    constexpr uint32_t  JOB_RANGE       { 1u };         //!< The ID of the parallel range job.
+    constexpr uint32_t  JOB_TASK        { 2u };         //!< The ID of the single task job.
+    constexpr uint32_t  IMAGE_WIDTH     { 1920u };      //!< The width of the image to blur.
+    constexpr uint32_t  IMAGE_HEIGHT    { 1080u };      //!< The height of the image to blur.
+    constexpr uint32_t  WAIT_TIMEOUT    { 10000u };     //!< The timeout in milliseconds to wait for the component and the results.
+
+    std::atomic_uint32_t            _groupStarted{ 0u };
+    std::atomic_uint32_t            _jobsReceived{ 0u };
+    std::atomic_bool                _resultInOwner{ true };
+    std::atomic<WorkerGroup *>      _workerGroup{ nullptr };
+    std::vector<std::atomic_uint32_t> _rangeVisits( RANGE_SIZE );
+    std::atomic_uint32_t            _taskRuns{ 0u };
+    WorkerGroup::sJobResult         _rangeResult{ 0u, 0u, 0u, 0u };
+
+    //! The component, which submits the jobs to the worker group and receives the results.
+    class WorkerGroupNode   : public Component
+                            , public IEWorkerGroupConsumer
+    {
+    public:
+        static Component * CreateComponent( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+        {
+            return DEBUG_NEW WorkerGroupNode( entry, owner );
+        }
+
+        static void DeleteComponent( Component & compObject, const NERegistry::ComponentEntry & /* entry */ )
+        {
+            delete (&compObject);
+        }
+
+        WorkerGroupNode( const NERegistry::ComponentEntry & entry, ComponentThread & owner )
+            : Component             ( entry, owner )
+            , IEWorkerGroupConsumer ( entry.getWorkerGroups()[0].mConsumerName )
+            , mGroupName            ( entry.getWorkerGroups()[0].mGroupName )
+        {
+        }
+
+        virtual IEWorkerGroupConsumer * workerGroupConsumer( const String & consumerName, const String & /* workerGroupName */ ) override
+        {
+            return (isEqualName( consumerName ) ? static_cast<IEWorkerGroupConsumer *>(this) : nullptr);
+        }
+
+        virtual void startupComponent( ComponentThread & comThread ) override
+        {
+            Component::startupComponent( comThread );
+            WorkerGroup * group{ findWorkerGroup( mGroupName ) };
+            ASSERT( group != nullptr );
+
+            group->postParallelFor( JOB_RANGE, 0u, RANGE_SIZE, 0u, []( uint32_t first, uint32_t last )
+                {
+                    for ( uint32_t i = first; i < last; ++ i )
+                    {
+                        _rangeVisits[i].fetch_add( 1u );
+                    }
+                } );
+
+            group->postTask( JOB_TASK, []( ) { _taskRuns.fetch_add( 1u ); } );
+
+            _workerGroup.store( group );
+            _groupStarted.fetch_add( 1u );
+        }
+
+        virtual void onWorkerJobCompleted( WorkerGroup & workerGroup, const WorkerGroup::sJobResult & result ) override
+        {
+            if ( (&DispatcherThread::getCurrentDispatcherThread( ) != &getMasterThread( )) || (&workerGroup.getOwnerThread( ) != &getMasterThread( )) )
+            {
+                _resultInOwner.store( false );
+            }
+
+            if ( result.jrJobId == JOB_RANGE )
+            {
+                _rangeResult = result;
+            }
+
+            _jobsReceived.fetch_add( 1u );
+        }
+
+    private:
+        const String    mGroupName;
+    };
+
+    //! Blurs the rows [first, last) of the gray image with the 3x3 box filter.
+    void _blurRows( const std::vector<uint8_t> & src, std::vector<uint8_t> & dst, uint32_t first, uint32_t last )
+    {
+        for ( uint32_t y = first; y < last; ++ y )
+        {
+            const uint32_t y0{ y > 0u ? y - 1u : y };
+            const uint32_t y1{ y + 1u < IMAGE_HEIGHT ? y + 1u : y };
+            for ( uint32_t x = 0u; x < IMAGE_WIDTH; ++ x )
+            {
+                const uint32_t x0{ x > 0u ? x - 1u : x };
+                const uint32_t x1{ x + 1u < IMAGE_WIDTH ? x + 1u : x };
+                uint32_t sum{ 0u };
+                for ( uint32_t row : { y0, y, y1 } )
+                {
+                    const uint8_t * line{ src.data( ) + static_cast<size_t>(row) * IMAGE_WIDTH };
+                    sum += static_cast<uint32_t>(line[x0]) + line[x] + line[x1];
+                }
+
+                dst[static_cast<size_t>(y) * IMAGE_WIDTH + x] = static_cast<uint8_t>(sum / 9u);
+            }
+        }
+    }
+
+    //! Waits until the condition is true. Returns false if the condition is still false after the timeout.
+    template<typename Condition>
+    bool _waitUntil( Condition && condition, uint32_t timeout )
+    {
+        const auto expire{ std::chrono::steady_clock::now( ) + std::chrono::milliseconds( timeout ) };
+        while ( condition( ) == false )
+        {
+            if ( std::chrono::steady_clock::now( ) >= expire )
+                return false;
+
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+
+        return true;
+    }
+}
+
+/**
+ * \brief   Checks that the worker group registered with the component processes the range in
+ *          parallel and the single task, that the results are notified in the component thread,
+ *          that the blocking parallel loop of the 3x3 blur of the full HD image processes
+ *          the same data as the serial loop, and that the tasks are counted in the statistics.
+ **/
+TEST( WorkerGroupTest, ParallelJobsOfComponent )
+{
+    const String modelName( "WorkerGroupModel" );
+    const String threadName( "WorkerGroupThread" );
+    NERegistry::Model model( modelName );
+    NERegistry::ComponentThreadEntry & thread = model.addThread( threadName );
+    NERegistry::ComponentEntry & entry = thread.addComponent( "WorkerGroupNode", &WorkerGroupNode::CreateComponent, &WorkerGroupNode::DeleteComponent );
+    entry.addWorkerGroup( NERegistry::WorkerGroupEntry( threadName, "WorkerGroupTestGroup", "WorkerGroupNode", "WorkerGroupConsumer", GROUP_THREADS ) );
+    ASSERT_EQ( entry.findWorkerGroup( NEUtilities::createComponentItemName( threadName, "WorkerGroupTestGroup" ) ), 0 );
+
+    _groupStarted.store( 0u );
+    _jobsReceived.store( 0u );
+    _resultInOwner.store( true );
+    _workerGroup.store( nullptr );
+    _taskRuns.store( 0u );
+    for ( auto & visit : _rangeVisits )
+    {
+        visit.store( 0u );
+    }
+
+    ASSERT_TRUE( ComponentLoader::addModelUnique( model ) );
+    ASSERT_TRUE( ComponentLoader::loadComponentModel( modelName ) );
+    if ( _waitUntil( []( ) { return (_groupStarted.load( ) == 1u) && (_jobsReceived.load( ) == 2u); }, WAIT_TIMEOUT ) == false )
+    {
+        ComponentLoader::removeComponentModel( modelName );
+        FAIL( ) << "Timeout: the group started " << _groupStarted.load( ) << " times, received " << _jobsReceived.load( ) << " of 2 job results.";
+    }
+
+    WorkerGroup * group{ _workerGroup.load( ) };
+    ASSERT_NE( group, nullptr );
+    EXPECT_TRUE( group->isGroupStarted( ) );
+    EXPECT_EQ( group->getThreadCount( ), GROUP_THREADS );
+    EXPECT_TRUE( _resultInOwner.load( ) );
+    EXPECT_EQ( _taskRuns.load( ), 1u );
+    EXPECT_EQ( _rangeResult.jrTaskCount, GROUP_THREADS * 4u );
+
+    uint32_t wrongVisits{ 0u };
+    for ( const auto & visit : _rangeVisits )
+    {
+        wrongVisits += (visit.load( ) != 1u ? 1u : 0u);
+    }
+
+    EXPECT_EQ( wrongVisits, 0u );
+
+    // The blocking parallel loop of the image kernel.
+    std::vector<uint8_t> image( static_cast<size_t>(IMAGE_WIDTH) * IMAGE_HEIGHT );
+    for ( size_t i = 0; i < image.size( ); ++ i )
+    {
+        image[i] = static_cast<uint8_t>((i * 31u) ^ (i >> 7));
+    }
+
+    std::vector<uint8_t> serial( image.size( ) );
+    std::vector<uint8_t> parallel( image.size( ) );
+    _blurRows( image, serial, 0u, IMAGE_HEIGHT );
+    EXPECT_TRUE( group->parallelFor( 0u, IMAGE_HEIGHT, 16u, [&]( uint32_t first, uint32_t last ) { _blurRows( image, parallel, first, last ); } ) );
+    EXPECT_EQ( serial, parallel );
+    EXPECT_TRUE( group->parallelFor( 5u, 5u, 0u, []( uint32_t, uint32_t ) { ADD_FAILURE( ); } ) );
+
+    const WorkerGroup::sGroupStatistics stats{ group->getStatistics( ) };
+    ComponentLoader::removeComponentModel( modelName );
+
+    EXPECT_EQ( stats.gsThreadCount, GROUP_THREADS );
+    EXPECT_EQ( stats.gsJobs, 3u );
+    EXPECT_EQ( stats.gsTasks, static_cast<uint64_t>(GROUP_THREADS * 4u + 1u + IMAGE_HEIGHT / 16u + (IMAGE_HEIGHT % 16u != 0u ? 1u : 0u)) );
+    EXPECT_LE( stats.gsTasksStolen, stats.gsTasks );
+    EXPECT_LE( stats.gsWaitMedian, stats.gsWaitP99 );
+    EXPECT_LE( stats.gsRunMedian, stats.gsRunP99 );
+    EXPECT_LE( stats.gsRunP99, stats.gsRunMax );
+}